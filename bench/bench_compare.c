@@ -0,0 +1,284 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "rudraksh_params.h"
+#include "rudraksh_crypto.h"
+#include "bench_util.h"
+#include "kyber512.h"
+#include "fips202.h"
+#include "kat_rng.h"
+
+// ==========================================================
+// Rudraksh vs Kyber-512 比較 Benchmark
+// 用法: bench_compare [-n 次數 (預設 1000)] [-w 暖機次數 (預設 100)] [-c CPU (預設 0，-1 不綁定)] [--json]
+//
+// 兩者以相同的編譯參數、相同的亂數來源 (rudraksh_randombytes)、同一顆綁定的 CPU 依序量測：
+//   1. keygen / encaps / decaps 的 cycles (median / p90 / min)
+//   2. 在預先填滿圖樣的執行緒 stack 上執行一次，量測實際 stack 峰值 (需要 pthread_attr_setstack)
+//   3. pk / sk / ct / 共享金鑰長度
+// 開始前先以 NIST KAT 驗證 Kyber-512 的輸出，並驗證兩者 encaps / decaps 的共享金鑰一致
+// ==========================================================
+
+#define PAINT_BYTE 0xA5
+#define STACK_BYTES (256 * 1024)
+
+enum { SCHEME_RUDRAKSH, SCHEME_KYBER, N_SCHEMES };
+enum { OP_KEYGEN, OP_ENCAPS, OP_DECAPS, N_CMP_OPS };
+
+static const char *const SCHEME_NAMES[N_SCHEMES] = { "rudraksh", "kyber512" };
+static const char *const OP_NAMES[N_CMP_OPS] = { "keygen", "encaps", "decaps" };
+
+typedef struct {
+    public_key_bitstream pk;
+    secret_key_bitstream sk;
+    cipher_text ct;
+    shared_secret ss;
+
+    uint8_t k_pk[KYBER512_PUBLICKEYBYTES];
+    uint8_t k_sk[KYBER512_SECRETKEYBYTES];
+    uint8_t k_ct[KYBER512_CIPHERTEXTBYTES];
+    uint8_t k_ss[KYBER512_BYTES];
+} cmp_ctx;
+
+static void r_keygen(cmp_ctx *x) { rudraksh_kem_keygen(&x->pk, &x->sk); }
+static void r_encaps(cmp_ctx *x) { rudraksh_kem_encapsulate(&x->pk, &x->ct, &x->ss); }
+static void r_decaps(cmp_ctx *x) { rudraksh_kem_decapsulate(&x->sk, &x->ct, &x->ss); }
+static void k_keygen(cmp_ctx *x) { kyber512_keypair(x->k_pk, x->k_sk); }
+static void k_encaps(cmp_ctx *x) { kyber512_enc(x->k_ct, x->k_ss, x->k_pk); }
+static void k_decaps(cmp_ctx *x) { kyber512_dec(x->k_ss, x->k_ct, x->k_sk); }
+
+static void (*const OPS[N_SCHEMES][N_CMP_OPS])(cmp_ctx *) = {
+    { r_keygen, r_encaps, r_decaps },
+    { k_keygen, k_encaps, k_decaps },
+};
+
+// ==========================================================
+// Kyber-512 KAT 自我檢查
+// 重現 pq-crystals round-3 PQCkemKAT_1632.rsp 的 count = 0：
+//   entropy 0..47 初始化 DRBG 取出 48 bytes seed，以 seed 重新初始化後依序 keypair (d, z)、enc (m)
+// ss 即 .rsp 的 "ss ="；pk / sk / ct 以 SHA3-256 摘要比對 (ss 經 H(pk)、H(c) 綁定完整的 pk 與 ct)
+// ==========================================================
+
+static const uint8_t KAT0_SEED_PREFIX[8] = { 0x06, 0x15, 0x50, 0x23, 0x4D, 0x15, 0x8C, 0x5E };
+static const uint8_t KAT0_SS[KYBER512_BYTES] = {
+    0x0A, 0x69, 0x25, 0x67, 0x6F, 0x24, 0xB2, 0x2C, 0x28, 0x6F, 0x4C, 0x81, 0xA4, 0x22, 0x4C, 0xEC,
+    0x50, 0x6C, 0x9B, 0x25, 0x7D, 0x48, 0x0E, 0x02, 0xE3, 0xB4, 0x9F, 0x44, 0xCA, 0xA3, 0x23, 0x7F
+};
+static const uint8_t KAT0_PK_SHA3[32] = {
+    0x7F, 0xFA, 0xD1, 0xBC, 0x8A, 0xF7, 0x3B, 0x7E, 0x87, 0x49, 0x56, 0xB8, 0x1C, 0x2A, 0x2E, 0xF0,
+    0xBF, 0xAB, 0xE8, 0xDC, 0x93, 0xD7, 0x7B, 0x2F, 0xBC, 0x9E, 0x0C, 0x64, 0xEF, 0xA0, 0x1E, 0x84
+};
+static const uint8_t KAT0_SK_SHA3[32] = {
+    0x26, 0xE1, 0xB5, 0xEA, 0x0F, 0x48, 0xB3, 0xC8, 0x7D, 0x7C, 0xE8, 0x71, 0x13, 0xB6, 0xA9, 0x3A,
+    0x49, 0xD9, 0xF7, 0xED, 0xE7, 0xC5, 0xCB, 0x15, 0xB4, 0x13, 0x82, 0xBD, 0x32, 0x43, 0x71, 0x5A
+};
+static const uint8_t KAT0_CT_SHA3[32] = {
+    0x2B, 0x5C, 0x81, 0x1B, 0x5A, 0x5D, 0x62, 0xB1, 0xFC, 0x79, 0xFC, 0xAF, 0xB1, 0x62, 0x3E, 0x81,
+    0xAE, 0x16, 0x4E, 0x3D, 0x71, 0xF7, 0x52, 0x78, 0xDC, 0xC1, 0x7A, 0x44, 0x8F, 0x10, 0x6A, 0x23
+};
+
+// 回傳 0 代表與 KAT 一致
+static int kyber_kat_check(void) {
+    uint8_t entropy[KAT_SEEDBYTES], seed[KAT_SEEDBYTES];
+    uint8_t coins[2 * KYBER_SYMBYTES], h[32];
+    uint8_t pk[KYBER512_PUBLICKEYBYTES], sk[KYBER512_SECRETKEYBYTES];
+    uint8_t ct[KYBER512_CIPHERTEXTBYTES], ss[KYBER512_BYTES], ss_dec[KYBER512_BYTES];
+    int bad = 0;
+
+    for (int i = 0; i < KAT_SEEDBYTES; i++) entropy[i] = (uint8_t)i;
+    kat_rng_init(entropy);
+    kat_rng_bytes(seed, sizeof(seed));
+    bad |= memcmp(seed, KAT0_SEED_PREFIX, sizeof(KAT0_SEED_PREFIX)) != 0;
+
+    kat_rng_init(seed);
+    kat_rng_bytes(coins, KYBER_SYMBYTES);
+    kat_rng_bytes(coins + KYBER_SYMBYTES, KYBER_SYMBYTES);
+    kyber512_keypair_derand(pk, sk, coins);
+    kat_rng_bytes(coins, KYBER_SYMBYTES);
+    kyber512_enc_derand(ct, ss, pk, coins);
+    kyber512_dec(ss_dec, ct, sk);
+
+    sha3_256(h, pk, sizeof(pk));
+    bad |= memcmp(h, KAT0_PK_SHA3, sizeof(h)) != 0;
+    sha3_256(h, sk, sizeof(sk));
+    bad |= memcmp(h, KAT0_SK_SHA3, sizeof(h)) != 0;
+    sha3_256(h, ct, sizeof(ct));
+    bad |= memcmp(h, KAT0_CT_SHA3, sizeof(h)) != 0;
+    bad |= memcmp(ss, KAT0_SS, sizeof(ss)) != 0;
+    bad |= memcmp(ss_dec, KAT0_SS, sizeof(ss)) != 0;
+    return bad ? -1 : 0;
+}
+
+// ==========================================================
+// Stack 峰值 (stack painting，同 tests/test_stack.c)
+// ==========================================================
+
+typedef struct {
+    void (*fn)(cmp_ctx *);
+    cmp_ctx *ctx;
+} thread_arg;
+
+static void *thread_main(void *arg) {
+    thread_arg *a = (thread_arg *)arg;
+    a->fn(a->ctx);
+    return NULL;
+}
+
+static void op_none(cmp_ctx *x) { (void)x; }
+
+// 回傳用到的 stack bytes，不支援時回傳 0
+static size_t stack_used(void (*fn)(cmp_ctx *), cmp_ctx *ctx) {
+#ifdef _WIN32
+    (void)fn; (void)ctx;
+    return 0;
+#else
+    uint8_t *stack = NULL;
+    pthread_attr_t attr;
+    pthread_t tid;
+    thread_arg arg = { fn, ctx };
+    size_t used = 0;
+
+    if (posix_memalign((void **)&stack, 4096, STACK_BYTES) != 0) return 0;
+    memset(stack, PAINT_BYTE, STACK_BYTES);
+
+    pthread_attr_init(&attr);
+    if (pthread_attr_setstack(&attr, stack, STACK_BYTES) == 0 &&
+        pthread_create(&tid, &attr, thread_main, &arg) == 0) {
+        pthread_join(tid, NULL);
+
+        size_t untouched = 0;
+        while (untouched < STACK_BYTES && stack[untouched] == PAINT_BYTE) untouched++;
+        used = STACK_BYTES - untouched;
+    }
+    pthread_attr_destroy(&attr);
+    free(stack);
+    return used;
+#endif
+}
+
+// ==========================================================
+// 主程式
+// ==========================================================
+
+int main(int argc, char **argv) {
+    size_t iters = 1000, warmup = 100;
+    int cpu = 0, json = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) iters = (size_t)atol(argv[++i]);
+        else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) warmup = (size_t)atol(argv[++i]);
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) cpu = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--json") == 0) json = 1;
+        else {
+            fprintf(stderr, "usage: %s [-n iterations] [-w warmup] [-c cpu|-1] [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (iters == 0) iters = 1;
+
+    int pinned = cpu >= 0 && bench_pin_cpu(cpu) == 0;
+
+    // 1. 正確性檢查 (金鑰 / 密文同時作為後續量測的有效輸入)
+    if (kyber_kat_check() != 0) {
+        fprintf(stderr, "kyber512 does not match PQCkemKAT_1632.rsp (count = 0), aborting\n");
+        return 1;
+    }
+
+    static cmp_ctx ctx;
+    shared_secret ss_r;
+    uint8_t ss_k[KYBER512_BYTES];
+
+    for (int s = 0; s < N_SCHEMES; s++) {
+        for (int op = 0; op < N_CMP_OPS; op++) OPS[s][op](&ctx);
+    }
+    rudraksh_kem_encapsulate(&ctx.pk, &ctx.ct, &ss_r);
+    rudraksh_kem_decapsulate(&ctx.sk, &ctx.ct, &ctx.ss);
+    kyber512_enc(ctx.k_ct, ss_k, ctx.k_pk);
+    kyber512_dec(ctx.k_ss, ctx.k_ct, ctx.k_sk);
+    if (memcmp(ss_r.bytes, ctx.ss.bytes, RUDRAKSH_len_K) != 0 || memcmp(ss_k, ctx.k_ss, KYBER512_BYTES) != 0) {
+        fprintf(stderr, "shared secret mismatch, aborting\n");
+        return 1;
+    }
+
+    // 2. 計時 + stack 峰值
+    uint64_t *samples = malloc(iters * sizeof(uint64_t));
+    bench_stats stats[N_SCHEMES][N_CMP_OPS];
+    size_t stack[N_SCHEMES][N_CMP_OPS];
+    size_t stack_base = stack_used(op_none, &ctx);
+    if (samples == NULL) return 1;
+
+    // 依 keygen -> encaps -> decaps 順序，前一項的輸出即為下一項的有效輸入
+    for (int s = 0; s < N_SCHEMES; s++) {
+        for (int op = 0; op < N_CMP_OPS; op++) {
+            void (*fn)(cmp_ctx *) = OPS[s][op];
+
+            for (size_t i = 0; i < warmup; i++) fn(&ctx);
+            for (size_t i = 0; i < iters; i++) {
+                uint64_t t0 = bench_cycles();
+                fn(&ctx);
+                samples[i] = bench_cycles() - t0;
+            }
+            bench_compute_stats(samples, iters, &stats[s][op]);
+
+            size_t used = stack_used(fn, &ctx);
+            stack[s][op] = used > stack_base ? used - stack_base : 0;
+        }
+    }
+    free(samples);
+
+    // 3. 長度
+    const size_t sizes[N_SCHEMES][4] = {
+        { CRYPTO_PUBLICKEYBYTES, CRYPTO_SECRETKEYBYTES, CRYPTO_CIPHERTEXTBYTES, RUDRAKSH_len_K },
+        { KYBER512_PUBLICKEYBYTES, KYBER512_SECRETKEYBYTES, KYBER512_CIPHERTEXTBYTES, KYBER512_BYTES },
+    };
+
+    if (json) {
+        printf("{\n");
+        printf("  \"compiler\": \"%s\",\n", __VERSION__);
+        printf("  \"unit\": \"%s\",\n", bench_timer_unit());
+        printf("  \"iterations\": %zu,\n", iters);
+        printf("  \"cpu\": %d,\n", pinned ? cpu : -1);
+        printf("  \"schemes\": [\n");
+        for (int s = 0; s < N_SCHEMES; s++) {
+            printf("    { \"name\": \"%s\", \"pk\": %zu, \"sk\": %zu, \"ct\": %zu, \"ss\": %zu, \"results\": [\n",
+                   SCHEME_NAMES[s], sizes[s][0], sizes[s][1], sizes[s][2], sizes[s][3]);
+            for (int op = 0; op < N_CMP_OPS; op++) {
+                printf("      { \"name\": \"%s\", \"min\": %llu, \"median\": %llu, \"p90\": %llu, \"stack\": %zu }%s\n",
+                       OP_NAMES[op], (unsigned long long)stats[s][op].min, (unsigned long long)stats[s][op].median,
+                       (unsigned long long)stats[s][op].p90, stack[s][op], op + 1 < N_CMP_OPS ? "," : "");
+            }
+            printf("    ] }%s\n", s + 1 < N_SCHEMES ? "," : "");
+        }
+        printf("  ]\n}\n");
+        return 0;
+    }
+
+    printf("=============================================\n");
+    printf("   Rudraksh vs Kyber-512\n");
+    printf("=============================================\n");
+    printf("iterations: %zu (warm-up %zu), unit: %s, ", iters, warmup, bench_timer_unit());
+    if (pinned) printf("pinned to CPU %d\n\n", cpu);
+    else printf("not pinned\n\n");
+
+    printf("%-10s %-8s %12s %12s %12s %12s\n", "scheme", "op", "median", "p90", "min", "stack (B)");
+    for (int s = 0; s < N_SCHEMES; s++) {
+        for (int op = 0; op < N_CMP_OPS; op++) {
+            printf("%-10s %-8s %12llu %12llu %12llu %12zu\n", SCHEME_NAMES[s], OP_NAMES[op],
+                   (unsigned long long)stats[s][op].median, (unsigned long long)stats[s][op].p90,
+                   (unsigned long long)stats[s][op].min, stack[s][op]);
+        }
+    }
+
+    printf("\nratio (rudraksh / kyber512, median):");
+    for (int op = 0; op < N_CMP_OPS; op++) {
+        printf(" %s %.2fx", OP_NAMES[op],
+               (double)stats[SCHEME_RUDRAKSH][op].median / (double)stats[SCHEME_KYBER][op].median);
+    }
+    printf("\n\n%-10s %8s %8s %8s %8s\n", "scheme", "pk", "sk", "ct", "ss");
+    for (int s = 0; s < N_SCHEMES; s++) {
+        printf("%-10s %8zu %8zu %8zu %8zu\n", SCHEME_NAMES[s], sizes[s][0], sizes[s][1], sizes[s][2], sizes[s][3]);
+    }
+    return 0;
+}
@@ -0,0 +1,250 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rudraksh_params.h"
+#include "rudraksh_crypto.h"
+#include "rudraksh_random.h"
+#include "rudraksh_dispatch.h"
+#include "rudraksh_autotune.h"
+#include "bench_util.h"
+
+// ==========================================================
+// KEM / PKE Benchmark
+// 用法: bench_kem [-n 次數 (預設 1000)] [-w 暖機次數 (預設 100)] [-c CPU (預設 0，-1 不綁定)] [--json] [--perf]
+// 每個函式各自暖機後逐次計時，報告 median / p90 / p99
+// --perf: 另外以 perf_event_open 計數器重跑一輪，報告每次呼叫的平均事件數與 IPC
+//         (計數器不可用時，例如容器內，只印出提示並照常輸出計時結果)
+// ==========================================================
+
+// 所有被測函式共用的輸入 / 輸出
+typedef struct {
+    public_key_bitstream pkb;
+    secret_key_bitstream skb;
+    cipher_text ct;
+    shared_secret ss;
+    public_key pk;
+    secret_key sk;
+    poly m;
+    uint8_t r[RUDRAKSH_len_K];
+    polymat A;          // NTT 域矩陣 A (矩陣乘法階段用)
+    polyvec s_hat, b_hat;
+    polymat A_src, A_tmp;   // 一般域矩陣 A (各乘法策略的 b = A s 用)
+    polyvec s_src, s_tmp;
+    polymat_fm A_fm;        // 頻率優先佈局的 NTT 域 A / s / b
+    polyvec_fm s_fm, b_fm;
+} bench_ctx;
+
+static void op_kem_keygen(bench_ctx *x) { rudraksh_kem_keygen(&x->pkb, &x->skb); }
+static void op_kem_encaps(bench_ctx *x) { rudraksh_kem_encapsulate(&x->pkb, &x->ct, &x->ss); }
+static void op_kem_decaps(bench_ctx *x) { rudraksh_kem_decapsulate(&x->skb, &x->ct, &x->ss); }
+static void op_pke_keygen(bench_ctx *x) { rudraksh_pke_keygen(&x->pk, &x->sk); }
+static void op_pke_encrypt(bench_ctx *x) { rudraksh_pke_encrypt(&x->pk, &x->m, x->r, &x->ct); }
+static void op_pke_decrypt(bench_ctx *x) { poly m; rudraksh_pke_decrypt(&x->ct, &x->sk, &m); }
+// keygen / encrypt 內部的主要階段
+static void op_gen_matrix_a(bench_ctx *x)    { poly_matrixA_generator(&x->A, x->r); polymat_ntt(&x->A); }
+static void op_mat_vec_mul(bench_ctx *x)     { poly_matrix_vec_mul_ntt(&x->b_hat, &x->A, &x->s_hat); }
+static void op_mat_t_vec_mul(bench_ctx *x)   { poly_matrix_trans_vec_mul_ntt(&x->b_hat, &x->A, &x->s_hat); }
+static void op_mat_vec_mul_fm(bench_ctx *x)  { poly_matrix_vec_mul_fm(&x->b_fm, &x->A_fm, &x->s_fm); }
+static void op_mat_t_vec_mul_fm(bench_ctx *x) { poly_matrix_trans_vec_mul_fm(&x->b_fm, &x->A_fm, &x->s_fm); }
+// 一般域輸入 b = A s 的各乘法策略 (NTT 含 A、s 的正向與 b 的反向轉換)
+static void op_matvec_ntt(bench_ctx *x) {
+    x->A_tmp = x->A_src;
+    x->s_tmp = x->s_src;
+    polymat_ntt(&x->A_tmp);
+    polyvec_ntt(&x->s_tmp);
+    poly_matrix_vec_mul_ntt(&x->b_hat, &x->A_tmp, &x->s_tmp);
+    polyvec_invntt_tomont(&x->b_hat);
+}
+static void op_matvec_ntt_fm(bench_ctx *x) {
+    x->A_tmp = x->A_src;
+    x->s_tmp = x->s_src;
+    polymat_ntt_fm(&x->A_fm, &x->A_tmp);
+    polyvec_ntt_fm(&x->s_fm, &x->s_tmp);
+    poly_matrix_vec_mul_fm(&x->b_fm, &x->A_fm, &x->s_fm);
+    polyvec_invntt_fm(&x->b_hat, &x->b_fm);
+}
+static void op_matvec_karatsuba(bench_ctx *x) { poly_matrix_vec_mul_karatsuba(&x->b_hat, &x->A_src, &x->s_src); }
+static void op_matvec_fft(bench_ctx *x)       { poly_matrix_vec_mul_fft(&x->b_hat, &x->A_src, &x->s_src); }
+static void op_matvec_kronecker(bench_ctx *x) { poly_matrix_vec_mul_kronecker(&x->b_hat, &x->A_src, &x->s_src); }
+
+typedef struct {
+    const char *name;
+    void (*fn)(bench_ctx *);
+} bench_op;
+
+static const bench_op OPS[] = {
+    { "kem_keygen",  op_kem_keygen  },
+    { "kem_encaps",  op_kem_encaps  },
+    { "kem_decaps",  op_kem_decaps  },
+    { "pke_keygen",  op_pke_keygen  },
+    { "pke_encrypt", op_pke_encrypt },
+    { "pke_decrypt", op_pke_decrypt },
+    { "gen_matrix_a", op_gen_matrix_a },
+    { "mat_vec_mul",  op_mat_vec_mul },
+    { "mat_t_vec_mul", op_mat_t_vec_mul },
+    { "mat_vec_mul_fm", op_mat_vec_mul_fm },
+    { "mat_t_vec_mul_fm", op_mat_t_vec_mul_fm },
+    { "matvec_ntt",   op_matvec_ntt },
+    { "matvec_ntt_fm", op_matvec_ntt_fm },
+    { "matvec_karatsuba", op_matvec_karatsuba },
+    { "matvec_fft",   op_matvec_fft },
+    { "matvec_kronecker", op_matvec_kronecker },
+};
+#define N_OPS (sizeof(OPS) / sizeof(OPS[0]))
+
+int main(int argc, char **argv) {
+    size_t iters = 1000, warmup = 100;
+    int cpu = 0, json = 0, perf = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) iters = (size_t)atol(argv[++i]);
+        else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) warmup = (size_t)atol(argv[++i]);
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) cpu = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--json") == 0) json = 1;
+        else if (strcmp(argv[i], "--perf") == 0) perf = 1;
+        else {
+            fprintf(stderr, "usage: %s [-n iterations] [-w warmup] [-c cpu|-1] [--json] [--perf]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (iters == 0) iters = 1;
+
+    int pinned = cpu >= 0 && bench_pin_cpu(cpu) == 0;
+
+    // 準備輸入 (一組有效的金鑰 / 密文)
+    static bench_ctx ctx;
+    uint8_t msg[RUDRAKSH_len_K];
+    rudraksh_randombytes(msg, sizeof(msg));
+    rudraksh_randombytes(ctx.r, sizeof(ctx.r));
+    arrange_msg(&ctx.m, msg);
+    rudraksh_kem_keygen(&ctx.pkb, &ctx.skb);
+    rudraksh_kem_encapsulate(&ctx.pkb, &ctx.ct, &ctx.ss);
+    rudraksh_pke_keygen(&ctx.pk, &ctx.sk);
+    op_gen_matrix_a(&ctx);
+    for (int i = 0; i < RUDRAKSH_K; i++) poly_cbd_eta(&ctx.s_hat.vec[i], ctx.r, (uint8_t)i);
+    poly_matrixA_generator(&ctx.A_src, ctx.r);
+    ctx.s_src = ctx.s_hat;
+    polyvec_ntt(&ctx.s_hat);
+    ctx.A_tmp = ctx.A_src;
+    ctx.s_tmp = ctx.s_src;
+    polymat_ntt_fm(&ctx.A_fm, &ctx.A_tmp);
+    polyvec_ntt_fm(&ctx.s_fm, &ctx.s_tmp);
+
+    // 硬體計數器 (可選)
+    bench_perf pc;
+    int perf_ok = perf && bench_perf_open(&pc) > 0;
+    if (perf && !perf_ok) {
+        fprintf(stderr, "note: perf_event_open unavailable (container or perf_event_paranoid), skipping hardware counters\n");
+    }
+
+    uint64_t *samples = malloc(iters * sizeof(uint64_t));
+    bench_stats stats[N_OPS];
+    double events[N_OPS][BENCH_PERF_N];   // 每次呼叫的平均事件數，-1 代表不可用
+    if (samples == NULL) return 1;
+
+    // 依 OPS 順序執行，前一項的輸出 (金鑰 / 密文) 即為下一項的有效輸入
+    for (size_t k = 0; k < N_OPS; k++) {
+        for (size_t i = 0; i < warmup; i++) OPS[k].fn(&ctx);
+
+        for (size_t i = 0; i < iters; i++) {
+            uint64_t t0 = bench_cycles();
+            OPS[k].fn(&ctx);
+            samples[i] = bench_cycles() - t0;
+        }
+        bench_compute_stats(samples, iters, &stats[k]);
+
+        // 計數器另跑一輪，避免 rdtsc 本身被算進事件數
+        if (perf_ok) {
+            int64_t total[BENCH_PERF_N];
+            bench_perf_start(&pc);
+            for (size_t i = 0; i < iters; i++) OPS[k].fn(&ctx);
+            bench_perf_stop(&pc);
+            bench_perf_read(&pc, total);
+            for (int e = 0; e < BENCH_PERF_N; e++) {
+                events[k][e] = total[e] < 0 ? -1.0 : (double)total[e] / (double)iters;
+            }
+        }
+    }
+    free(samples);
+    if (perf_ok) bench_perf_close(&pc);
+
+    if (json) {
+        printf("{\n");
+        printf("  \"scheme\": \"rudraksh-kem-poly64\",\n");
+        printf("  \"symmetric\": \"%s\",\n", RUDRAKSH_SYM_NAME);
+        printf("  \"kernels\": \"%s\",\n", rudraksh_kernels_active()->name);
+        printf("  \"mul\": {");
+        for (int sh = 0; sh < RUDRAKSH_N_SHAPES; sh++) {
+            printf(" \"%s\": \"%s\"%s", rudraksh_mul_shape_name((rudraksh_mul_shape)sh),
+                   rudraksh_mul_choice((rudraksh_mul_shape)sh)->name, sh + 1 < RUDRAKSH_N_SHAPES ? "," : " },\n");
+        }
+        printf("  \"compiler\": \"%s\",\n", __VERSION__);
+        printf("  \"unit\": \"%s\",\n", bench_timer_unit());
+        printf("  \"iterations\": %zu,\n", iters);
+        printf("  \"warmup\": %zu,\n", warmup);
+        printf("  \"cpu\": %d,\n", pinned ? cpu : -1);
+        printf("  \"results\": [\n");
+        for (size_t k = 0; k < N_OPS; k++) {
+            printf("    { \"name\": \"%s\", \"min\": %llu, \"median\": %llu, \"p90\": %llu, \"p99\": %llu",
+                   OPS[k].name, (unsigned long long)stats[k].min, (unsigned long long)stats[k].median,
+                   (unsigned long long)stats[k].p90, (unsigned long long)stats[k].p99);
+            // 不可用的計數器輸出 null
+            if (perf_ok) {
+                printf(", \"perf\": {");
+                for (int e = 0; e < BENCH_PERF_N; e++) {
+                    if (events[k][e] < 0) printf(" \"%s\": null,", bench_perf_name(e));
+                    else printf(" \"%s\": %.0f,", bench_perf_name(e), events[k][e]);
+                }
+                if (events[k][BENCH_PERF_CYCLES] > 0 && events[k][BENCH_PERF_INSTRUCTIONS] >= 0) {
+                    printf(" \"ipc\": %.3f }", events[k][BENCH_PERF_INSTRUCTIONS] / events[k][BENCH_PERF_CYCLES]);
+                } else {
+                    printf(" \"ipc\": null }");
+                }
+            }
+            printf(" }%s\n", k + 1 < N_OPS ? "," : "");
+        }
+        printf("  ]\n}\n");
+        return 0;
+    }
+
+    printf("=============================================\n");
+    printf("   Rudraksh KEM-poly64 Benchmark\n");
+    printf("=============================================\n");
+    printf("symmetric backend: %s, kernels: %s\n", RUDRAKSH_SYM_NAME, rudraksh_kernels_active()->name);
+    printf("multiply strategy:");
+    for (int sh = 0; sh < RUDRAKSH_N_SHAPES; sh++) {
+        printf(" %s=%s", rudraksh_mul_shape_name((rudraksh_mul_shape)sh), rudraksh_mul_choice((rudraksh_mul_shape)sh)->name);
+    }
+    printf("\n");
+    printf("iterations: %zu (warm-up %zu), unit: %s, ", iters, warmup, bench_timer_unit());
+    if (pinned) printf("pinned to CPU %d\n\n", cpu);
+    else printf("not pinned\n\n");
+
+    printf("%-16s %12s %12s %12s %12s\n", "operation", "median", "p90", "p99", "min");
+    for (size_t k = 0; k < N_OPS; k++) {
+        printf("%-16s %12llu %12llu %12llu %12llu\n", OPS[k].name,
+               (unsigned long long)stats[k].median, (unsigned long long)stats[k].p90,
+               (unsigned long long)stats[k].p99, (unsigned long long)stats[k].min);
+    }
+
+    if (perf_ok) {
+        printf("\nhardware counters (per call, user space):\n");
+        printf("%-16s %12s %12s %6s %12s %12s\n", "operation", "instructions", "cycles", "IPC", "l1d_misses", "br_misses");
+        for (size_t k = 0; k < N_OPS; k++) {
+            char col[BENCH_PERF_N][24], ipc[16];
+            for (int e = 0; e < BENCH_PERF_N; e++) {
+                if (events[k][e] < 0) snprintf(col[e], sizeof(col[e]), "n/a");
+                else snprintf(col[e], sizeof(col[e]), "%.0f", events[k][e]);
+            }
+            if (events[k][BENCH_PERF_CYCLES] > 0 && events[k][BENCH_PERF_INSTRUCTIONS] >= 0) {
+                snprintf(ipc, sizeof(ipc), "%.2f", events[k][BENCH_PERF_INSTRUCTIONS] / events[k][BENCH_PERF_CYCLES]);
+            } else {
+                snprintf(ipc, sizeof(ipc), "n/a");
+            }
+            printf("%-16s %12s %12s %6s %12s %12s\n", OPS[k].name, col[BENCH_PERF_INSTRUCTIONS],
+                   col[BENCH_PERF_CYCLES], ipc, col[BENCH_PERF_L1D_MISSES], col[BENCH_PERF_BRANCH_MISSES]);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,265 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rudraksh_params.h"
+#include "rudraksh_math.h"
+#include "rudraksh_random.h"
+#include "rudraksh_dispatch.h"
+#include "bench_util.h"
+
+// ==========================================================
+// 底層核心 Microbenchmark (含回歸比對)
+// 用法: bench_micro [-n 樣本數 (預設 2000)] [-w 暖機次數 (預設 200)] [-c CPU (預設 0，-1 不綁定)]
+//                   [--save <baseline 檔>] [--compare <baseline 檔>] [--threshold <百分比> (預設 10)]
+//
+// 每個樣本連續呼叫核心 reps 次再平均，避免短核心被 rdtsc 本身的開銷淹沒
+// baseline 為純文字檔：'#' 開頭為註解，其餘每行 "<核心名稱> <median>"
+// --compare 時 median 超過 baseline (1 + threshold%) 的核心標記為 REGRESSED，程式回傳 2
+// ==========================================================
+
+#define DEFAULT_THRESHOLD 10.0
+#define MAX_NAME 48
+
+// 所有核心共用的輸入 / 輸出
+typedef struct {
+    poly a, b, r;
+    polyvec v;
+    uint8_t seed[RUDRAKSH_len_K];
+    uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+    uint8_t out[CRYPTO_PUBLICKEYBYTES_VECTOR_B];   // 足以容納 13-bit 序列化 / u 壓縮
+    ascon_state_t state;
+    uint64_t keccak[25 * 4];
+    uint8_t nonce;
+} micro_ctx;
+
+// NTT / INTT 輸出都已約化到 [0, q)，可以原地反覆執行
+static void k_ntt(micro_ctx *x)              { poly_ntt(&x->a); }
+static void k_invntt(micro_ctx *x)           { poly_invntt(&x->a); }
+static void k_basemul_acc(micro_ctx *x)      { poly_basemul_acc(&x->r, &x->a, &x->b); }
+static void k_dot_ntt(micro_ctx *x)          { poly_vector_vector_mul_ntt(&x->r, &x->v, &x->v); }   // K 項點乘和
+static void k_basemul_acc_serial(micro_ctx *x) { poly_basemul_acc_serial(&x->r, &x->a, &x->b); }
+static void k_basemul_acc_karatsuba(micro_ctx *x) { poly_basemul_acc_karatsuba(&x->r, &x->a, &x->b); }
+static void k_basemul_acc_fft(micro_ctx *x)  { poly_basemul_acc_fft(&x->r, &x->a, &x->b); }
+static void k_basemul_acc_kronecker(micro_ctx *x) { poly_basemul_acc_kronecker(&x->r, &x->a, &x->b); }
+static void k_poly_add(micro_ctx *x)         { poly_add(&x->r, &x->a, &x->b); }
+static void k_poly_sub(micro_ctx *x)         { poly_sub(&x->r, &x->a, &x->b); }
+static void k_decode(micro_ctx *x)           { poly_decode(&x->r, &x->a); }
+static void k_generator(micro_ctx *x)        { poly_generator(&x->r, x->seed, 0, x->nonce++ % RUDRAKSH_K); }
+static void k_cbd_eta(micro_ctx *x)          { poly_cbd_eta(&x->r, x->seed, x->nonce++); }
+static void k_hash(micro_ctx *x)             { rudraksh_hash(x->out, x->pk, CRYPTO_PUBLICKEYBYTES, RUDRAKSH_len_K); }
+static void k_p12(micro_ctx *x)              { P12(&x->state); }
+static void k_p8(micro_ctx *x)               { P8(&x->state); }
+static void k_keccakf1600(micro_ctx *x)      { rudraksh_keccakf1600(x->keccak); }
+static void k_keccakf1600_x4(micro_ctx *x)   { rudraksh_keccakf1600_x4(x->keccak); }   // 一次 4 個狀態
+static void k_tobytes_13bit(micro_ctx *x)    { polyvec_tobytes_13bit(x->out, &x->v); }
+static void k_compress_u(micro_ctx *x)       { polyvec_compress_u(x->out, &x->v); }
+static void k_compress_v(micro_ctx *x)       { poly_compress_v(x->out, &x->a); }
+
+typedef struct {
+    const char *name;
+    void (*fn)(micro_ctx *);
+    unsigned reps;      // 每個樣本的呼叫次數
+} micro_kernel;
+
+static const micro_kernel KERNELS[] = {
+    { "poly_ntt",                k_ntt,                16 },
+    { "poly_invntt",             k_invntt,             16 },
+    { "poly_basemul_acc",        k_basemul_acc,        16 },
+    { "poly_vector_vector_mul_ntt", k_dot_ntt,         4  },
+    { "poly_basemul_acc_serial", k_basemul_acc_serial, 1  },
+    { "poly_basemul_acc_karatsuba", k_basemul_acc_karatsuba, 4 },
+    { "poly_basemul_acc_fft",    k_basemul_acc_fft,    4  },
+    { "poly_basemul_acc_kronecker", k_basemul_acc_kronecker, 4 },
+    { "poly_add",                k_poly_add,           16 },
+    { "poly_sub",                k_poly_sub,           16 },
+    { "poly_decode",             k_decode,             16 },
+    { "poly_generator",          k_generator,          4  },
+    { "poly_cbd_eta",            k_cbd_eta,            16 },
+    { "rudraksh_hash",           k_hash,               4  },  // H(pk)：952 bytes -> 16 bytes
+    { "P12",                     k_p12,                16 },
+    { "P8",                      k_p8,                 16 },
+    { "keccakf1600",             k_keccakf1600,        4  },
+    { "keccakf1600_x4",          k_keccakf1600_x4,     4  },
+    { "polyvec_tobytes_13bit",   k_tobytes_13bit,      16 },
+    { "polyvec_compress_u",      k_compress_u,         16 },
+    { "poly_compress_v",         k_compress_v,         16 },
+};
+#define N_KERNELS (sizeof(KERNELS) / sizeof(KERNELS[0]))
+
+// ==========================================================
+// Baseline 檔案
+// ==========================================================
+
+typedef struct {
+    char name[MAX_NAME];
+    uint64_t median;
+} baseline_entry;
+
+static int save_baseline(const char *path, const char *unit, const bench_stats *stats) {
+    FILE *f = fopen(path, "w");
+    if (f == NULL) return -1;
+
+    fprintf(f, "# rudraksh bench_micro baseline\n");
+    fprintf(f, "# compiler %s\n", __VERSION__);
+    fprintf(f, "# unit %s\n", unit);
+    for (size_t k = 0; k < N_KERNELS; k++) {
+        fprintf(f, "%s %llu\n", KERNELS[k].name, (unsigned long long)stats[k].median);
+    }
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+// 回傳讀到的項目數，失敗回傳 -1；unit 為 baseline 記錄的計時單位 (若有)
+static int load_baseline(const char *path, baseline_entry *entries, int max, char unit[16]) {
+    FILE *f = fopen(path, "r");
+    char line[256];
+    int n = 0;
+
+    if (f == NULL) return -1;
+    unit[0] = '\0';
+
+    while (fgets(line, sizeof(line), f) != NULL) {
+        char name[MAX_NAME];
+        unsigned long long median;
+
+        if (line[0] == '#') {
+            sscanf(line, "# unit %15s", unit);
+            continue;
+        }
+        if (sscanf(line, "%47s %llu", name, &median) != 2 || n >= max) continue;
+        memcpy(entries[n].name, name, MAX_NAME);
+        entries[n].median = median;
+        n++;
+    }
+    fclose(f);
+    return n;
+}
+
+static const baseline_entry *find_entry(const baseline_entry *entries, int n, const char *name) {
+    for (int i = 0; i < n; i++) {
+        if (strcmp(entries[i].name, name) == 0) return &entries[i];
+    }
+    return NULL;
+}
+
+// ==========================================================
+// 主程式
+// ==========================================================
+
+static void usage(const char *prog) {
+    fprintf(stderr, "usage: %s [-n samples] [-w warmup] [-c cpu|-1] [--save file] [--compare file] [--threshold pct]\n", prog);
+}
+
+int main(int argc, char **argv) {
+    size_t samples_n = 2000, warmup = 200;
+    int cpu = 0;
+    const char *save_path = NULL, *compare_path = NULL;
+    double threshold = DEFAULT_THRESHOLD;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) samples_n = (size_t)atol(argv[++i]);
+        else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) warmup = (size_t)atol(argv[++i]);
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) cpu = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--save") == 0 && i + 1 < argc) save_path = argv[++i];
+        else if (strcmp(argv[i], "--compare") == 0 && i + 1 < argc) compare_path = argv[++i];
+        else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) threshold = atof(argv[++i]);
+        else { usage(argv[0]); return 1; }
+    }
+    if (samples_n == 0) samples_n = 1;
+    if (threshold < 0) { usage(argv[0]); return 1; }
+
+    int pinned = cpu >= 0 && bench_pin_cpu(cpu) == 0;
+
+    // 1. 準備輸入 (隨機種子、Rq 上的隨機多項式)
+    static micro_ctx ctx;
+    rudraksh_randombytes(ctx.seed, sizeof(ctx.seed));
+    rudraksh_randombytes(ctx.pk, sizeof(ctx.pk));
+    poly_generator(&ctx.a, ctx.seed, 0, 0);
+    poly_generator(&ctx.b, ctx.seed, 0, 1);
+    for (int i = 0; i < RUDRAKSH_K; i++) poly_generator(&ctx.v.vec[i], ctx.seed, 1, (uint8_t)i);
+    rudraksh_randombytes((uint8_t *)&ctx.state, sizeof(ctx.state));
+
+    // 2. 逐一量測
+    uint64_t *samples = malloc(samples_n * sizeof(uint64_t));
+    bench_stats stats[N_KERNELS];
+    if (samples == NULL) return 1;
+
+    for (size_t k = 0; k < N_KERNELS; k++) {
+        const micro_kernel *kn = &KERNELS[k];
+
+        for (size_t i = 0; i < warmup; i++) kn->fn(&ctx);
+
+        for (size_t i = 0; i < samples_n; i++) {
+            uint64_t t0 = bench_cycles();
+            for (unsigned r = 0; r < kn->reps; r++) kn->fn(&ctx);
+            samples[i] = (bench_cycles() - t0) / kn->reps;
+        }
+        bench_compute_stats(samples, samples_n, &stats[k]);
+    }
+    free(samples);
+
+    printf("=============================================\n");
+    printf("   Rudraksh Kernel Microbenchmark\n");
+    printf("=============================================\n");
+    printf("symmetric backend: %s, kernels: %s, keccak x4: %s, fft: %s\n", RUDRAKSH_SYM_NAME,
+           rudraksh_kernels_active()->name, rudraksh_keccakf1600_x4_impl(), rudraksh_fft_impl());
+    printf("samples: %zu (warm-up %zu), unit: %s / call, ", samples_n, warmup, bench_timer_unit());
+    if (pinned) printf("pinned to CPU %d\n\n", cpu);
+    else printf("not pinned\n\n");
+
+    // 3. 無 baseline：直接列出
+    if (compare_path == NULL) {
+        printf("%-24s %10s %10s %10s\n", "kernel", "median", "p90", "min");
+        for (size_t k = 0; k < N_KERNELS; k++) {
+            printf("%-24s %10llu %10llu %10llu\n", KERNELS[k].name, (unsigned long long)stats[k].median,
+                   (unsigned long long)stats[k].p90, (unsigned long long)stats[k].min);
+        }
+    }
+
+    // 4. 與 baseline 比對 (只比 median，樣本的雜訊由 median 吸收)
+    int regressed = 0;
+    if (compare_path != NULL) {
+        baseline_entry base[64];
+        char base_unit[16];
+        int n_base = load_baseline(compare_path, base, 64, base_unit);
+
+        if (n_base < 0) {
+            fprintf(stderr, "cannot read baseline %s\n", compare_path);
+            return 1;
+        }
+        if (base_unit[0] != '\0' && strcmp(base_unit, bench_timer_unit()) != 0) {
+            fprintf(stderr, "baseline unit '%s' does not match timer unit '%s'\n", base_unit, bench_timer_unit());
+            return 1;
+        }
+
+        printf("baseline: %s, threshold: +%.1f%%\n\n", compare_path, threshold);
+        printf("%-24s %10s %10s %9s  %s\n", "kernel", "baseline", "median", "delta", "status");
+        for (size_t k = 0; k < N_KERNELS; k++) {
+            const baseline_entry *e = find_entry(base, n_base, KERNELS[k].name);
+            if (e == NULL || e->median == 0) {
+                printf("%-24s %10s %10llu %9s  new\n", KERNELS[k].name, "-",
+                       (unsigned long long)stats[k].median, "-");
+                continue;
+            }
+
+            double delta = 100.0 * ((double)stats[k].median - (double)e->median) / (double)e->median;
+            const char *status = "ok";
+            if (delta > threshold) { status = "REGRESSED"; regressed++; }
+            else if (delta < -threshold) status = "faster";
+
+            printf("%-24s %10llu %10llu %+8.1f%%  %s\n", KERNELS[k].name, (unsigned long long)e->median,
+                   (unsigned long long)stats[k].median, delta, status);
+        }
+        printf("\n%d kernel(s) regressed\n", regressed);
+    }
+
+    if (save_path != NULL) {
+        if (save_baseline(save_path, bench_timer_unit(), stats) != 0) {
+            fprintf(stderr, "cannot write baseline %s\n", save_path);
+            return 1;
+        }
+        printf("\nbaseline saved to %s\n", save_path);
+    }
+
+    return regressed ? 2 : 0;
+}
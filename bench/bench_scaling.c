@@ -0,0 +1,245 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "rudraksh_params.h"
+#include "rudraksh_crypto.h"
+#include "bench_util.h"
+
+// ==========================================================
+// 多核心擴展性 Benchmark (KEM 吞吐量)
+// 用法: bench_scaling [-t 最大執行緒數 (預設全部 CPU)] [-n 每執行緒次數 (預設 300)]
+//                     [-c 起始 CPU (預設 0，-1 不綁定)] [-s shared|private|both (預設 both)] [--json]
+//
+// 執行緒數依 1, 2, 4, ... 倍增到最大值，每個執行緒綁定到 (起始 CPU + i) % CPU 數，
+// 各自獨立反覆執行 encaps / decaps，以 barrier 同時起跑
+//   shared : 所有執行緒共用同一組 pk / sk / ct (唯讀)
+//   private: 每個執行緒在自己的 CPU 上生成自己的金鑰 (first-touch，記憶體落在本地節點)
+// 報告 ops/s、相對單執行緒的加速比與每核心效率、合併所有執行緒的延遲 p50 / p99 / max
+// ==========================================================
+
+enum { OP_ENCAPS, OP_DECAPS, N_SCALING_OPS };
+enum { SCENARIO_SHARED, SCENARIO_PRIVATE, N_SCENARIOS };
+
+static const char *const OP_NAMES[N_SCALING_OPS] = { "encaps", "decaps" };
+static const char *const SCENARIO_NAMES[N_SCENARIOS] = { "shared", "private" };
+
+typedef struct {
+    public_key_bitstream pk;
+    secret_key_bitstream sk;
+    cipher_text ct;
+} key_set;
+
+typedef struct {
+    int op;
+    int scenario;
+    size_t iters;
+    key_set *shared;        // API 參數不是 const，但各執行緒只讀取
+    pthread_barrier_t start;
+} run_cfg;
+
+// 每個執行緒的工作區
+typedef struct {
+    run_cfg *cfg;
+    int cpu;                // -1 代表不綁定
+    int pinned;
+    uint64_t *samples;      // 每次呼叫的延遲 (ns)
+    uint64_t t_start, t_end;
+    pthread_t tid;
+} worker_t;
+
+typedef struct {
+    int threads;
+    double ops_per_sec;
+    double speedup;
+    double efficiency;
+    bench_stats lat;
+    int pinned;             // 成功綁定的執行緒數
+} scaling_row;
+
+static void *worker_main(void *arg) {
+    worker_t *w = (worker_t *)arg;
+    run_cfg *cfg = w->cfg;
+    key_set *keys = cfg->shared;
+    key_set *own = NULL;
+    cipher_text ct;
+    shared_secret ss;
+
+    w->pinned = w->cpu >= 0 && bench_pin_cpu(w->cpu) == 0;
+
+    // private：綁定之後才配置並生成金鑰，讓記憶體落在本執行緒的 CPU 上
+    if (cfg->scenario == SCENARIO_PRIVATE) {
+        own = malloc(sizeof(key_set));
+        if (own != NULL) {
+            rudraksh_kem_keygen(&own->pk, &own->sk);
+            rudraksh_kem_encapsulate(&own->pk, &own->ct, &ss);
+            keys = own;
+        }
+    }
+
+    // 暖機一次 (快取、分支預測)
+    if (cfg->op == OP_ENCAPS) rudraksh_kem_encapsulate(&keys->pk, &ct, &ss);
+    else rudraksh_kem_decapsulate(&keys->sk, &keys->ct, &ss);
+
+    pthread_barrier_wait(&cfg->start);
+
+    w->t_start = bench_ns();
+    for (size_t i = 0; i < cfg->iters; i++) {
+        uint64_t t0 = bench_ns();
+        if (cfg->op == OP_ENCAPS) rudraksh_kem_encapsulate(&keys->pk, &ct, &ss);
+        else rudraksh_kem_decapsulate(&keys->sk, &keys->ct, &ss);
+        w->samples[i] = bench_ns() - t0;
+    }
+    w->t_end = bench_ns();
+
+    free(own);
+    return NULL;
+}
+
+// 以 threads 個執行緒跑一輪，回傳 0 代表成功
+static int run_point(run_cfg *cfg, int threads, int first_cpu, int n_cpus, scaling_row *row) {
+    worker_t *w = calloc((size_t)threads, sizeof(worker_t));
+    uint64_t *all = malloc((size_t)threads * cfg->iters * sizeof(uint64_t));
+    int started = 0, ret = -1;
+
+    if (w == NULL || all == NULL) goto done;
+    if (pthread_barrier_init(&cfg->start, NULL, (unsigned)threads) != 0) goto done;
+
+    for (int i = 0; i < threads; i++) {
+        w[i].cfg = cfg;
+        w[i].cpu = first_cpu >= 0 ? (first_cpu + i) % n_cpus : -1;
+        w[i].samples = all + (size_t)i * cfg->iters;
+        if (pthread_create(&w[i].tid, NULL, worker_main, &w[i]) != 0) break;
+        started++;
+    }
+    if (started != threads) {
+        // barrier 永遠湊不齊，無法安全收回已啟動的執行緒
+        fprintf(stderr, "pthread_create failed at thread %d\n", started);
+        exit(1);
+    }
+    for (int i = 0; i < threads; i++) pthread_join(w[i].tid, NULL);
+    pthread_barrier_destroy(&cfg->start);
+
+    // wall time = 最早開始到最晚結束
+    uint64_t t0 = w[0].t_start, t1 = w[0].t_end;
+    row->pinned = 0;
+    for (int i = 0; i < threads; i++) {
+        if (w[i].t_start < t0) t0 = w[i].t_start;
+        if (w[i].t_end > t1) t1 = w[i].t_end;
+        row->pinned += w[i].pinned;
+    }
+    row->threads = threads;
+    row->ops_per_sec = (double)threads * (double)cfg->iters * 1e9 / (double)(t1 > t0 ? t1 - t0 : 1);
+    bench_compute_stats(all, (size_t)threads * cfg->iters, &row->lat);
+    ret = 0;
+
+done:
+    free(all);
+    free(w);
+    return ret;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr, "usage: %s [-t max_threads] [-n iterations_per_thread] [-c first_cpu|-1] [-s shared|private|both] [--json]\n", prog);
+}
+
+int main(int argc, char **argv) {
+    int n_cpus = bench_cpu_count();
+    int max_threads = n_cpus, first_cpu = 0, json = 0;
+    int scenario_mask = (1 << SCENARIO_SHARED) | (1 << SCENARIO_PRIVATE);
+    size_t iters = 300;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) max_threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) iters = (size_t)atol(argv[++i]);
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) first_cpu = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            const char *s = argv[++i];
+            if (strcmp(s, "shared") == 0) scenario_mask = 1 << SCENARIO_SHARED;
+            else if (strcmp(s, "private") == 0) scenario_mask = 1 << SCENARIO_PRIVATE;
+            else if (strcmp(s, "both") != 0) { usage(argv[0]); return 1; }
+        }
+        else if (strcmp(argv[i], "--json") == 0) json = 1;
+        else { usage(argv[0]); return 1; }
+    }
+    if (max_threads < 1 || iters == 0) { usage(argv[0]); return 1; }
+
+    // 執行緒數：1, 2, 4, ... 並確保包含最大值
+    int counts[32], n_counts = 0;
+    for (int t = 1; t < max_threads && n_counts < 31; t *= 2) counts[n_counts++] = t;
+    counts[n_counts++] = max_threads;
+
+    // shared 情境的金鑰 (主執行緒生成)
+    static key_set shared;
+    shared_secret ss;
+    rudraksh_kem_keygen(&shared.pk, &shared.sk);
+    rudraksh_kem_encapsulate(&shared.pk, &shared.ct, &ss);
+
+    if (json) {
+        printf("{\n");
+        printf("  \"scheme\": \"rudraksh-kem-poly64\",\n");
+        printf("  \"compiler\": \"%s\",\n", __VERSION__);
+        printf("  \"cpus\": %d,\n", n_cpus);
+        printf("  \"iterations_per_thread\": %zu,\n", iters);
+        printf("  \"results\": [\n");
+    } else {
+        printf("=============================================\n");
+        printf("   Rudraksh KEM Multi-core Scaling\n");
+        printf("=============================================\n");
+        printf("online CPUs: %d, threads up to %d, %zu ops / thread, ", n_cpus, max_threads, iters);
+        if (first_cpu >= 0) printf("pinned from CPU %d\n", first_cpu);
+        else printf("not pinned\n");
+        if (max_threads > n_cpus) printf("note: more threads than CPUs, efficiency will drop by design\n");
+    }
+
+    int first_row = 1;
+    for (int sc = 0; sc < N_SCENARIOS; sc++) {
+        if (!(scenario_mask & (1 << sc))) continue;
+
+        for (int op = 0; op < N_SCALING_OPS; op++) {
+            run_cfg cfg;
+            double base = 0;
+
+            cfg.op = op;
+            cfg.scenario = sc;
+            cfg.iters = iters;
+            cfg.shared = &shared;
+
+            if (!json) {
+                printf("\n[%s keys] %s\n", SCENARIO_NAMES[sc], OP_NAMES[op]);
+                printf("%7s %12s %8s %10s %10s %10s %10s\n",
+                       "threads", "ops/s", "speedup", "efficiency", "p50 (us)", "p99 (us)", "max (us)");
+            }
+
+            for (int k = 0; k < n_counts; k++) {
+                scaling_row row;
+                if (run_point(&cfg, counts[k], first_cpu, n_cpus, &row) != 0) {
+                    fprintf(stderr, "out of memory\n");
+                    return 1;
+                }
+                if (k == 0) base = row.ops_per_sec / row.threads;
+                row.speedup = row.ops_per_sec / base;
+                row.efficiency = row.speedup / row.threads;
+
+                if (json) {
+                    printf("%s    { \"scenario\": \"%s\", \"op\": \"%s\", \"threads\": %d, \"pinned\": %d, "
+                           "\"ops_per_sec\": %.1f, \"speedup\": %.3f, \"efficiency\": %.3f, "
+                           "\"p50_ns\": %llu, \"p99_ns\": %llu, \"max_ns\": %llu }",
+                           first_row ? "" : ",\n", SCENARIO_NAMES[sc], OP_NAMES[op], row.threads, row.pinned,
+                           row.ops_per_sec, row.speedup, row.efficiency,
+                           (unsigned long long)row.lat.median, (unsigned long long)row.lat.p99,
+                           (unsigned long long)row.lat.max);
+                    first_row = 0;
+                } else {
+                    printf("%7d %12.1f %7.2fx %9.1f%% %10.1f %10.1f %10.1f\n", row.threads, row.ops_per_sec,
+                           row.speedup, 100.0 * row.efficiency, row.lat.median / 1e3, row.lat.p99 / 1e3,
+                           row.lat.max / 1e3);
+                }
+            }
+        }
+    }
+
+    if (json) printf("\n  ]\n}\n");
+    return 0;
+}
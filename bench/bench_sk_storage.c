@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "rudraksh_params.h"
+#include "rudraksh_crypto.h"
+
+// ==========================================================
+// 私鑰儲存格式：記憶體 vs. 延遲 Benchmark
+// 用法: bench_sk_storage [金鑰數量 (預設 256)] [快取槽數 (預設 金鑰數/4 與 金鑰數 各跑一次)]
+// 每種格式對所有金鑰各做一次 decaps，報告 bytes/key、
+// 百萬把金鑰的常駐記憶體，以及每次 decaps 的平均延遲
+// ==========================================================
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void report(const char *name, size_t bytes_per_key, double us_per_op, int ok) {
+    printf("%-24s %8zu %12.1f %14.2f   %s\n", name, bytes_per_key,
+           bytes_per_key * 1e6 / (1024.0 * 1024.0), us_per_op, ok ? "ok" : "MISMATCH");
+}
+
+int main(int argc, char **argv) {
+    size_t n = (argc > 1) ? (size_t)atol(argv[1]) : 256;
+    if (n == 0) n = 1;
+    size_t cache_sizes[2] = { n / 4, n };
+    size_t n_sizes = 2;
+    if (argc > 2) {
+        cache_sizes[0] = (size_t)atol(argv[2]);
+        n_sizes = 1;
+    }
+    size_t n_cache = cache_sizes[n_sizes - 1];
+
+    public_key_bitstream *pk = malloc(n * sizeof(*pk));
+    secret_key_bitstream *sk = malloc(n * sizeof(*sk));
+    secret_key_bitstream_ntt *sk_ntt = malloc(n * sizeof(*sk_ntt));
+    secret_key_bitstream_packed *sk_packed = malloc(n * sizeof(*sk_packed));
+    secret_key_bitstream_seed *sk_seed = malloc(n * sizeof(*sk_seed));
+    cipher_text *ct = malloc(n * sizeof(*ct));
+    cipher_text *ct_seed = malloc(n * sizeof(*ct_seed));
+    shared_secret *ss = malloc(n * sizeof(*ss));
+    shared_secret *ss_seed = malloc(n * sizeof(*ss_seed));
+    rudraksh_sk_cache_entry *entries = malloc((n_cache ? n_cache : 1) * sizeof(*entries));
+
+    if (!pk || !sk || !sk_ntt || !sk_packed || !sk_seed || !ct || !ct_seed || !ss || !ss_seed || !entries) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    // 準備金鑰與密文 (不計時)
+    for (size_t i = 0; i < n; i++) {
+        rudraksh_kem_keygen(&pk[i], &sk[i]);
+        rudraksh_sk_to_ntt(&sk_ntt[i], &sk[i]);
+        rudraksh_sk_to_packed(&sk_packed[i], &sk[i]);
+        rudraksh_kem_encapsulate(&pk[i], &ct[i], &ss[i]);
+
+        public_key_bitstream pk_seed;
+        rudraksh_kem_keygen_seed(&pk_seed, &sk_seed[i]);
+        rudraksh_kem_encapsulate(&pk_seed, &ct_seed[i], &ss_seed[i]);
+    }
+
+    printf("=============================================\n");
+    printf("   Secret Key Storage: Memory vs. Latency\n");
+    printf("=============================================\n");
+    printf("keys: %zu\n\n", n);
+    printf("%-24s %8s %12s %14s\n", "format", "B/key", "MiB/1M keys", "decaps us/op");
+
+    shared_secret K;
+    double t0;
+    int ok;
+
+    // 1. 標準格式
+    ok = 1;
+    t0 = now_us();
+    for (size_t i = 0; i < n; i++) {
+        rudraksh_kem_decapsulate(&sk[i], &ct[i], &K);
+        ok &= memcmp(K.bytes, ss[i].bytes, RUDRAKSH_len_K) == 0;
+    }
+    report("standard (13-bit s)", CRYPTO_SECRETKEYBYTES, (now_us() - t0) / n, ok);
+
+    // 2. NTT 域格式
+    ok = 1;
+    t0 = now_us();
+    for (size_t i = 0; i < n; i++) {
+        rudraksh_kem_decapsulate_ntt(&sk_ntt[i], &ct[i], &K);
+        ok &= memcmp(K.bytes, ss[i].bytes, RUDRAKSH_len_K) == 0;
+    }
+    report("ntt", CRYPTO_SECRETKEYBYTES_NTT, (now_us() - t0) / n, ok);
+
+    // 3. 3-bit 打包格式
+    ok = 1;
+    t0 = now_us();
+    for (size_t i = 0; i < n; i++) {
+        rudraksh_kem_decapsulate_packed(&sk_packed[i], &ct[i], &K);
+        ok &= memcmp(K.bytes, ss[i].bytes, RUDRAKSH_len_K) == 0;
+    }
+    report("packed (3-bit s)", CRYPTO_SECRETKEYBYTES_PACKED, (now_us() - t0) / n, ok);
+
+    // 4. seed 格式 (無快取，每次重新生成)
+    ok = 1;
+    t0 = now_us();
+    for (size_t i = 0; i < n; i++) {
+        rudraksh_kem_decapsulate_seed(&sk_seed[i], &ct_seed[i], &K, NULL);
+        ok &= memcmp(K.bytes, ss_seed[i].bytes, RUDRAKSH_len_K) == 0;
+    }
+    report("seed (no cache)", CRYPTO_SECRETKEYBYTES_SEED, (now_us() - t0) / n, ok);
+
+    // 5. seed 格式 + 快取：同一批金鑰跑兩輪，第二輪的命中率取決於快取大小
+    for (size_t c = 0; c < n_sizes; c++) {
+        size_t slots = cache_sizes[c];
+        if (slots == 0) continue;
+
+        rudraksh_sk_cache cache;
+        rudraksh_sk_cache_init(&cache, entries, slots);
+        for (size_t i = 0; i < n; i++) {
+            rudraksh_kem_decapsulate_seed(&sk_seed[i], &ct_seed[i], &K, &cache);
+        }
+
+        cache.hits = cache.misses = 0;
+        ok = 1;
+        t0 = now_us();
+        for (size_t i = 0; i < n; i++) {
+            rudraksh_kem_decapsulate_seed(&sk_seed[i], &ct_seed[i], &K, &cache);
+            ok &= memcmp(K.bytes, ss_seed[i].bytes, RUDRAKSH_len_K) == 0;
+        }
+        double us = (now_us() - t0) / n;
+
+        // 快取為固定大小，不隨金鑰數量成長
+        char name[64];
+        snprintf(name, sizeof(name), "seed + cache (%.0f%% hit)", 100.0 * cache.hits / n);
+        report(name, CRYPTO_SECRETKEYBYTES_SEED, us, ok);
+        printf("  (+ %zu slots x %zu B = %zu bytes fixed cache)\n",
+               slots, sizeof(rudraksh_sk_cache_entry), slots * sizeof(rudraksh_sk_cache_entry));
+
+        rudraksh_sk_cache_clear(&cache);
+    }
+
+    free(pk); free(sk); free(sk_ntt); free(sk_packed); free(sk_seed);
+    free(ct); free(ct_seed); free(ss); free(ss_seed); free(entries);
+    return 0;
+}
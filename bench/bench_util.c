@@ -0,0 +1,204 @@
+#ifndef _WIN32
+#define _GNU_SOURCE // sched_setaffinity
+#endif
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "bench_util.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_RDTSC 1
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#define BENCH_HAVE_PERF 1
+#endif
+
+// ==========================================================
+// 1. 計時
+// ==========================================================
+
+uint64_t bench_cycles(void) {
+#ifdef BENCH_HAVE_RDTSC
+    // lfence 避免 rdtsc 被亂序執行提前
+    _mm_lfence();
+    uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+const char *bench_timer_unit(void) {
+#ifdef BENCH_HAVE_RDTSC
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+uint64_t bench_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// ==========================================================
+// 2. CPU 綁定
+// ==========================================================
+
+int bench_pin_cpu(int cpu) {
+#ifdef _WIN32
+    return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << cpu) != 0 ? 0 : -1;
+#else
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set);
+#endif
+}
+
+int bench_cpu_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return (int)si.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+// ==========================================================
+// 3. 統計
+// ==========================================================
+
+static int cmp_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// 百分位數取最接近的排名 (nearest-rank)
+static uint64_t percentile(const uint64_t *sorted, size_t n, unsigned p) {
+    size_t rank = (n * p + 99) / 100;
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+void bench_compute_stats(uint64_t *samples, size_t n, bench_stats *out) {
+    qsort(samples, n, sizeof(uint64_t), cmp_u64);
+    out->min = samples[0];
+    out->median = percentile(samples, n, 50);
+    out->p90 = percentile(samples, n, 90);
+    out->p99 = percentile(samples, n, 99);
+    out->max = samples[n - 1];
+}
+
+// ==========================================================
+// 4. 硬體效能計數器
+// ==========================================================
+
+static const char *const PERF_NAMES[BENCH_PERF_N] = {
+    "cycles", "instructions", "l1d_misses", "branch_misses"
+};
+
+const char *bench_perf_name(int counter) {
+    return PERF_NAMES[counter];
+}
+
+#ifdef BENCH_HAVE_PERF
+
+static int perf_open_one(uint32_t type, uint64_t config) {
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;    // perf_event_paranoid <= 2 時一般使用者也可開啟
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    return fd < 0 ? -1 : (int)fd;
+}
+
+int bench_perf_open(bench_perf *p) {
+    int n = 0;
+
+    p->fd[BENCH_PERF_CYCLES] = perf_open_one(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    p->fd[BENCH_PERF_INSTRUCTIONS] = perf_open_one(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    p->fd[BENCH_PERF_L1D_MISSES] = perf_open_one(PERF_TYPE_HW_CACHE,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    p->fd[BENCH_PERF_BRANCH_MISSES] = perf_open_one(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+
+    for (int i = 0; i < BENCH_PERF_N; i++) n += p->fd[i] >= 0;
+    return n;
+}
+
+void bench_perf_start(bench_perf *p) {
+    for (int i = 0; i < BENCH_PERF_N; i++) {
+        if (p->fd[i] < 0) continue;
+        ioctl(p->fd[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(p->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+void bench_perf_stop(bench_perf *p) {
+    for (int i = 0; i < BENCH_PERF_N; i++) {
+        if (p->fd[i] >= 0) ioctl(p->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+    }
+}
+
+void bench_perf_read(const bench_perf *p, int64_t out[BENCH_PERF_N]) {
+    for (int i = 0; i < BENCH_PERF_N; i++) {
+        uint64_t v[3]; // value, time_enabled, time_running
+
+        out[i] = -1;
+        if (p->fd[i] < 0 || read(p->fd[i], v, sizeof(v)) != (ssize_t)sizeof(v) || v[2] == 0) continue;
+        // 計數器數量超過 PMU 時會被多工輪流，依實際計數時間比例放大
+        out[i] = (int64_t)((double)v[0] * (double)v[1] / (double)v[2]);
+    }
+}
+
+void bench_perf_close(bench_perf *p) {
+    for (int i = 0; i < BENCH_PERF_N; i++) {
+        if (p->fd[i] >= 0) close(p->fd[i]);
+        p->fd[i] = -1;
+    }
+}
+
+#else
+
+int bench_perf_open(bench_perf *p) {
+    for (int i = 0; i < BENCH_PERF_N; i++) p->fd[i] = -1;
+    return 0;
+}
+
+void bench_perf_start(bench_perf *p) { (void)p; }
+void bench_perf_stop(bench_perf *p) { (void)p; }
+
+void bench_perf_read(const bench_perf *p, int64_t out[BENCH_PERF_N]) {
+    (void)p;
+    for (int i = 0; i < BENCH_PERF_N; i++) out[i] = -1;
+}
+
+void bench_perf_close(bench_perf *p) { (void)p; }
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef RUDRAKSH_BENCH_UTIL_H
+#define RUDRAKSH_BENCH_UTIL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ==========================================================
+// Benchmark 共用工具
+// 計時：x86 使用 rdtsc (TSC ticks)，其他平台使用 clock_gettime (ns)
+// ==========================================================
+
+uint64_t bench_cycles(void);
+const char *bench_timer_unit(void);     // "cycles" 或 "ns"
+uint64_t bench_ns(void);                // 單調時鐘 (ns)，跨執行緒可比較，用於 wall time / 吞吐量
+
+// 將目前執行緒綁定到指定 CPU，回傳 0 代表成功
+int bench_pin_cpu(int cpu);
+int bench_cpu_count(void);              // 線上的邏輯 CPU 數
+
+// 統計 (會排序 samples)
+typedef struct {
+    uint64_t min;
+    uint64_t median;
+    uint64_t p90;
+    uint64_t p99;
+    uint64_t max;
+} bench_stats;
+
+void bench_compute_stats(uint64_t *samples, size_t n, bench_stats *out);
+
+// ==========================================================
+// 硬體效能計數器 (Linux perf_event_open，只計 user space)
+// 各計數器獨立開啟：容器 / VM 常只支援其中一部分，無法開啟的項目讀出 -1
+// 非 Linux 平台一律不可用
+// ==========================================================
+enum {
+    BENCH_PERF_CYCLES,
+    BENCH_PERF_INSTRUCTIONS,
+    BENCH_PERF_L1D_MISSES,
+    BENCH_PERF_BRANCH_MISSES,
+    BENCH_PERF_N
+};
+
+typedef struct {
+    int fd[BENCH_PERF_N];   // -1 代表不可用
+} bench_perf;
+
+int bench_perf_open(bench_perf *p);             // 回傳成功開啟的計數器數量 (0 代表完全不可用)
+void bench_perf_start(bench_perf *p);           // 歸零並開始計數
+void bench_perf_stop(bench_perf *p);
+void bench_perf_read(const bench_perf *p, int64_t out[BENCH_PERF_N]); // 多工時依執行時間比例換算
+void bench_perf_close(bench_perf *p);
+const char *bench_perf_name(int counter);
+
+#endif // RUDRAKSH_BENCH_UTIL_H
@@ -0,0 +1,136 @@
+#include <string.h>
+
+#include "fips202.h"
+
+// ==========================================================
+// Keccak-f[1600] 與 sponge (小端序 lane)
+// ==========================================================
+
+#define ROL(a, offset) (((a) << (offset)) ^ ((a) >> (64 - (offset))))
+
+static const uint64_t KeccakF_RoundConstants[24] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL, 0x8000000080008000ULL,
+    0x000000000000808bULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+    0x000000000000008aULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+    0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800aULL, 0x800000008000000aULL,
+    0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+// rho 旋轉量與 pi 置換順序 (沿 pi 軌跡走一圈)
+static const unsigned KeccakF_Rotc[24] = {
+    1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14, 27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44
+};
+static const unsigned KeccakF_Piln[24] = {
+    10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4, 15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1
+};
+
+void KeccakF1600_StatePermute(uint64_t st[25]) {
+    uint64_t bc[5], t;
+
+    for (int round = 0; round < 24; round++) {
+        // theta
+        for (int i = 0; i < 5; i++) bc[i] = st[i] ^ st[i + 5] ^ st[i + 10] ^ st[i + 15] ^ st[i + 20];
+        for (int i = 0; i < 5; i++) {
+            t = bc[(i + 4) % 5] ^ ROL(bc[(i + 1) % 5], 1);
+            for (int j = 0; j < 25; j += 5) st[j + i] ^= t;
+        }
+
+        // rho + pi
+        t = st[1];
+        for (int i = 0; i < 24; i++) {
+            unsigned j = KeccakF_Piln[i];
+            bc[0] = st[j];
+            st[j] = ROL(t, KeccakF_Rotc[i]);
+            t = bc[0];
+        }
+
+        // chi
+        for (int j = 0; j < 25; j += 5) {
+            for (int i = 0; i < 5; i++) bc[i] = st[j + i];
+            for (int i = 0; i < 5; i++) st[j + i] ^= (~bc[(i + 1) % 5]) & bc[(i + 2) % 5];
+        }
+
+        // iota
+        st[0] ^= KeccakF_RoundConstants[round];
+    }
+}
+
+static uint64_t load64(const uint8_t x[8]) {
+    uint64_t r = 0;
+    for (int i = 0; i < 8; i++) r |= (uint64_t)x[i] << (8 * i);
+    return r;
+}
+
+static void store64(uint8_t x[8], uint64_t u) {
+    for (int i = 0; i < 8; i++) x[i] = (uint8_t)(u >> (8 * i));
+}
+
+// 一次吸收全部輸入並補上 padding (p = 0x06 SHA3，0x1F SHAKE)
+static void keccak_absorb_once(uint64_t s[25], unsigned r, const uint8_t *in, size_t inlen, uint8_t p) {
+    for (int i = 0; i < 25; i++) s[i] = 0;
+
+    while (inlen >= r) {
+        for (unsigned i = 0; i < r / 8; i++) s[i] ^= load64(in + 8 * i);
+        in += r;
+        inlen -= r;
+        KeccakF1600_StatePermute(s);
+    }
+
+    for (size_t i = 0; i < inlen; i++) s[i / 8] ^= (uint64_t)in[i] << (8 * (i % 8));
+    s[inlen / 8] ^= (uint64_t)p << (8 * (inlen % 8));
+    s[(r - 1) / 8] ^= 1ULL << 63;
+}
+
+static void keccak_squeezeblocks(uint8_t *out, size_t nblocks, uint64_t s[25], unsigned r) {
+    while (nblocks > 0) {
+        KeccakF1600_StatePermute(s);
+        for (unsigned i = 0; i < r / 8; i++) store64(out + 8 * i, s[i]);
+        out += r;
+        nblocks--;
+    }
+}
+
+static void keccak_squeeze(uint8_t *out, size_t outlen, uint64_t s[25], unsigned r) {
+    uint8_t block[SHAKE128_RATE];
+    size_t nblocks = outlen / r;
+
+    keccak_squeezeblocks(out, nblocks, s, r);
+    out += nblocks * r;
+    outlen -= nblocks * r;
+    if (outlen > 0) {
+        keccak_squeezeblocks(block, 1, s, r);
+        memcpy(out, block, outlen);
+    }
+}
+
+// ==========================================================
+// SHAKE / SHA3
+// ==========================================================
+
+void shake128_absorb_once(keccak_state *state, const uint8_t *in, size_t inlen) {
+    keccak_absorb_once(state->s, SHAKE128_RATE, in, inlen, 0x1F);
+    state->pos = SHAKE128_RATE;
+}
+
+void shake128_squeezeblocks(uint8_t *out, size_t nblocks, keccak_state *state) {
+    keccak_squeezeblocks(out, nblocks, state->s, SHAKE128_RATE);
+}
+
+void shake256(uint8_t *out, size_t outlen, const uint8_t *in, size_t inlen) {
+    uint64_t s[25];
+    keccak_absorb_once(s, SHAKE256_RATE, in, inlen, 0x1F);
+    keccak_squeeze(out, outlen, s, SHAKE256_RATE);
+}
+
+void sha3_256(uint8_t h[32], const uint8_t *in, size_t inlen) {
+    uint64_t s[25];
+    keccak_absorb_once(s, SHA3_256_RATE, in, inlen, 0x06);
+    keccak_squeeze(h, 32, s, SHA3_256_RATE);
+}
+
+void sha3_512(uint8_t h[64], const uint8_t *in, size_t inlen) {
+    uint64_t s[25];
+    keccak_absorb_once(s, SHA3_512_RATE, in, inlen, 0x06);
+    keccak_squeeze(h, 64, s, SHA3_512_RATE);
+}
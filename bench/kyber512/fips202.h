@@ -0,0 +1,31 @@
+#ifndef KYBER512_FIPS202_H
+#define KYBER512_FIPS202_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==========================================================
+// FIPS 202 (SHA-3 / SHAKE)，Kyber-512 比較用
+// 依 pq-crystals Kyber round-3 reference 的介面改寫 (public domain / CC0)
+// ==========================================================
+
+#define SHAKE128_RATE 168
+#define SHAKE256_RATE 136
+#define SHA3_256_RATE 136
+#define SHA3_512_RATE 72
+
+typedef struct {
+    uint64_t s[25];
+    unsigned int pos;
+} keccak_state;
+
+void KeccakF1600_StatePermute(uint64_t state[25]);
+
+void shake128_absorb_once(keccak_state *state, const uint8_t *in, size_t inlen);
+void shake128_squeezeblocks(uint8_t *out, size_t nblocks, keccak_state *state);
+
+void shake256(uint8_t *out, size_t outlen, const uint8_t *in, size_t inlen);
+void sha3_256(uint8_t h[32], const uint8_t *in, size_t inlen);
+void sha3_512(uint8_t h[64], const uint8_t *in, size_t inlen);
+
+#endif // KYBER512_FIPS202_H
@@ -0,0 +1,18 @@
+#ifndef KYBER512_KAT_RNG_H
+#define KYBER512_KAT_RNG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==========================================================
+// NIST PQC KAT 亂數產生器 (AES-256 CTR_DRBG，無 derivation function)
+// 與 NIST 提供的 rng.c (randombytes_init / randombytes) 行為相同，
+// 只用於重現 PQCkemKAT_*.rsp，不作為一般亂數來源
+// ==========================================================
+
+#define KAT_SEEDBYTES 48
+
+void kat_rng_init(const uint8_t entropy[KAT_SEEDBYTES]);
+void kat_rng_bytes(uint8_t *out, size_t outlen);
+
+#endif // KYBER512_KAT_RNG_H
@@ -0,0 +1,516 @@
+#include <string.h>
+
+#include "kyber512.h"
+#include "fips202.h"
+#include "rudraksh_random.h"
+
+// ==========================================================
+// 1. 模約化 (Montgomery / Barrett)
+// ==========================================================
+
+#define MONT -1044   // 2^16 mod q
+#define QINV -3327   // q^-1 mod 2^16
+
+typedef struct {
+    int16_t coeffs[KYBER_N];
+} kpoly;
+
+typedef struct {
+    kpoly vec[KYBER_K];
+} kpolyvec;
+
+static int16_t montgomery_reduce(int32_t a) {
+    int16_t t = (int16_t)a * QINV;
+    return (int16_t)((a - (int32_t)t * KYBER_Q) >> 16);
+}
+
+static int16_t barrett_reduce(int16_t a) {
+    const int16_t v = ((1 << 26) + KYBER_Q / 2) / KYBER_Q;
+    int16_t t = (int16_t)(((int32_t)v * a + (1 << 25)) >> 26);
+    return a - t * KYBER_Q;
+}
+
+static int16_t fqmul(int16_t a, int16_t b) {
+    return montgomery_reduce((int32_t)a * b);
+}
+
+// ==========================================================
+// 2. NTT (7 層，basemul 在 degree-2 子環上)
+// ==========================================================
+
+// MONT * 17^brv7(i) mod q，取 [-q/2, q/2]
+static const int16_t zetas[128] = {
+    -1044,  -758,  -359, -1517,  1493,  1422,   287,   202,  -171,   622,  1577,   182,   962, -1202, -1474,  1468,
+      573, -1325,   264,   383,  -829,  1458, -1602,  -130,  -681,  1017,   732,   608, -1542,   411,  -205, -1571,
+     1223,   652,  -552,  1015, -1293,  1491,  -282, -1544,   516,    -8,  -320,  -666, -1618, -1162,   126,  1469,
+     -853,   -90,  -271,   830,   107, -1421,  -247,  -951,  -398,   961, -1508,  -725,   448, -1065,   677, -1275,
+    -1103,   430,   555,   843, -1251,   871,  1550,   105,   422,   587,   177,  -235,  -291,  -460,  1574,  1653,
+     -246,   778,  1159,  -147,  -777,  1483,  -602,  1119, -1590,   644,  -872,   349,   418,   329,  -156,   -75,
+      817,  1097,   603,   610,  1322, -1285, -1465,   384, -1215,  -136,  1218, -1335,  -874,   220, -1187, -1659,
+    -1185, -1530, -1278,   794, -1510,  -854,  -870,   478,  -108,  -308,   996,   991,   958, -1460,  1522,  1628
+};
+
+static void ntt(int16_t r[KYBER_N]) {
+    unsigned k = 1;
+    for (unsigned len = 128; len >= 2; len >>= 1) {
+        for (unsigned start = 0; start < KYBER_N; start += 2 * len) {
+            int16_t zeta = zetas[k++];
+            for (unsigned j = start; j < start + len; j++) {
+                int16_t t = fqmul(zeta, r[j + len]);
+                r[j + len] = r[j] - t;
+                r[j] = r[j] + t;
+            }
+        }
+    }
+}
+
+// 輸出乘上 Montgomery 因子 2^16
+static void invntt(int16_t r[KYBER_N]) {
+    const int16_t f = 1441; // mont^2 / 128
+    unsigned k = 127;
+    for (unsigned len = 2; len <= 128; len <<= 1) {
+        for (unsigned start = 0; start < KYBER_N; start += 2 * len) {
+            int16_t zeta = zetas[k--];
+            for (unsigned j = start; j < start + len; j++) {
+                int16_t t = r[j];
+                r[j] = barrett_reduce(t + r[j + len]);
+                r[j + len] = r[j + len] - t;
+                r[j + len] = fqmul(zeta, r[j + len]);
+            }
+        }
+    }
+    for (unsigned j = 0; j < KYBER_N; j++) r[j] = fqmul(r[j], f);
+}
+
+static void basemul(int16_t r[2], const int16_t a[2], const int16_t b[2], int16_t zeta) {
+    r[0] = fqmul(a[1], b[1]);
+    r[0] = fqmul(r[0], zeta);
+    r[0] += fqmul(a[0], b[0]);
+    r[1] = fqmul(a[0], b[1]);
+    r[1] += fqmul(a[1], b[0]);
+}
+
+// ==========================================================
+// 3. 多項式 / 向量
+// ==========================================================
+
+static void poly_reduce(kpoly *r) {
+    for (int i = 0; i < KYBER_N; i++) r->coeffs[i] = barrett_reduce(r->coeffs[i]);
+}
+
+static void poly_add(kpoly *r, const kpoly *a, const kpoly *b) {
+    for (int i = 0; i < KYBER_N; i++) r->coeffs[i] = a->coeffs[i] + b->coeffs[i];
+}
+
+static void poly_sub(kpoly *r, const kpoly *a, const kpoly *b) {
+    for (int i = 0; i < KYBER_N; i++) r->coeffs[i] = a->coeffs[i] - b->coeffs[i];
+}
+
+static void poly_ntt(kpoly *r) {
+    ntt(r->coeffs);
+    poly_reduce(r);
+}
+
+static void poly_tomont(kpoly *r) {
+    const int16_t f = (int16_t)((1ULL << 32) % KYBER_Q);
+    for (int i = 0; i < KYBER_N; i++) r->coeffs[i] = montgomery_reduce((int32_t)r->coeffs[i] * f);
+}
+
+static void poly_basemul_montgomery(kpoly *r, const kpoly *a, const kpoly *b) {
+    for (int i = 0; i < KYBER_N / 4; i++) {
+        basemul(&r->coeffs[4 * i], &a->coeffs[4 * i], &b->coeffs[4 * i], zetas[64 + i]);
+        basemul(&r->coeffs[4 * i + 2], &a->coeffs[4 * i + 2], &b->coeffs[4 * i + 2], -zetas[64 + i]);
+    }
+}
+
+static void poly_tobytes(uint8_t r[KYBER_POLYBYTES], const kpoly *a) {
+    for (int i = 0; i < KYBER_N / 2; i++) {
+        uint16_t t0 = a->coeffs[2 * i];
+        uint16_t t1 = a->coeffs[2 * i + 1];
+        t0 += ((int16_t)t0 >> 15) & KYBER_Q;
+        t1 += ((int16_t)t1 >> 15) & KYBER_Q;
+        r[3 * i + 0] = (uint8_t)(t0 >> 0);
+        r[3 * i + 1] = (uint8_t)((t0 >> 8) | (t1 << 4));
+        r[3 * i + 2] = (uint8_t)(t1 >> 4);
+    }
+}
+
+static void poly_frombytes(kpoly *r, const uint8_t a[KYBER_POLYBYTES]) {
+    for (int i = 0; i < KYBER_N / 2; i++) {
+        r->coeffs[2 * i] = ((a[3 * i + 0] >> 0) | ((uint16_t)a[3 * i + 1] << 8)) & 0xFFF;
+        r->coeffs[2 * i + 1] = ((a[3 * i + 1] >> 4) | ((uint16_t)a[3 * i + 2] << 4)) & 0xFFF;
+    }
+}
+
+static void poly_compress(uint8_t r[KYBER_POLYCOMPRESSEDBYTES], const kpoly *a) {
+    uint8_t t[8];
+    for (int i = 0; i < KYBER_N / 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            int16_t u = a->coeffs[8 * i + j];
+            u += (u >> 15) & KYBER_Q;
+            t[j] = (uint8_t)(((((uint16_t)u << 4) + KYBER_Q / 2) / KYBER_Q) & 15);
+        }
+        r[0] = t[0] | (t[1] << 4);
+        r[1] = t[2] | (t[3] << 4);
+        r[2] = t[4] | (t[5] << 4);
+        r[3] = t[6] | (t[7] << 4);
+        r += 4;
+    }
+}
+
+static void poly_decompress(kpoly *r, const uint8_t a[KYBER_POLYCOMPRESSEDBYTES]) {
+    for (int i = 0; i < KYBER_N / 2; i++) {
+        r->coeffs[2 * i + 0] = (int16_t)((((uint16_t)(a[0] & 15) * KYBER_Q) + 8) >> 4);
+        r->coeffs[2 * i + 1] = (int16_t)((((uint16_t)(a[0] >> 4) * KYBER_Q) + 8) >> 4);
+        a++;
+    }
+}
+
+static void poly_frommsg(kpoly *r, const uint8_t msg[KYBER_SYMBYTES]) {
+    for (int i = 0; i < KYBER_N / 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            int16_t mask = -(int16_t)((msg[i] >> j) & 1);
+            r->coeffs[8 * i + j] = mask & ((KYBER_Q + 1) / 2);
+        }
+    }
+}
+
+static void poly_tomsg(uint8_t msg[KYBER_SYMBYTES], const kpoly *a) {
+    for (int i = 0; i < KYBER_N / 8; i++) {
+        msg[i] = 0;
+        for (int j = 0; j < 8; j++) {
+            uint16_t t = a->coeffs[8 * i + j];
+            t += ((int16_t)t >> 15) & KYBER_Q;
+            t = (((t << 1) + KYBER_Q / 2) / KYBER_Q) & 1;
+            msg[i] |= t << j;
+        }
+    }
+}
+
+static void polyvec_ntt(kpolyvec *r) {
+    for (int i = 0; i < KYBER_K; i++) poly_ntt(&r->vec[i]);
+}
+
+static void polyvec_invntt_tomont(kpolyvec *r) {
+    for (int i = 0; i < KYBER_K; i++) invntt(r->vec[i].coeffs);
+}
+
+static void polyvec_reduce(kpolyvec *r) {
+    for (int i = 0; i < KYBER_K; i++) poly_reduce(&r->vec[i]);
+}
+
+static void polyvec_add(kpolyvec *r, const kpolyvec *a, const kpolyvec *b) {
+    for (int i = 0; i < KYBER_K; i++) poly_add(&r->vec[i], &a->vec[i], &b->vec[i]);
+}
+
+static void polyvec_basemul_acc_montgomery(kpoly *r, const kpolyvec *a, const kpolyvec *b) {
+    kpoly t;
+    poly_basemul_montgomery(r, &a->vec[0], &b->vec[0]);
+    for (int i = 1; i < KYBER_K; i++) {
+        poly_basemul_montgomery(&t, &a->vec[i], &b->vec[i]);
+        poly_add(r, r, &t);
+    }
+    poly_reduce(r);
+}
+
+static void polyvec_compress(uint8_t r[KYBER_POLYVECCOMPRESSEDBYTES], const kpolyvec *a) {
+    uint16_t t[4];
+    for (int i = 0; i < KYBER_K; i++) {
+        for (int j = 0; j < KYBER_N / 4; j++) {
+            for (int k = 0; k < 4; k++) {
+                t[k] = a->vec[i].coeffs[4 * j + k];
+                t[k] += ((int16_t)t[k] >> 15) & KYBER_Q;
+                t[k] = (uint16_t)(((((uint32_t)t[k] << 10) + KYBER_Q / 2) / KYBER_Q) & 0x3ff);
+            }
+            r[0] = (uint8_t)(t[0] >> 0);
+            r[1] = (uint8_t)((t[0] >> 8) | (t[1] << 2));
+            r[2] = (uint8_t)((t[1] >> 6) | (t[2] << 4));
+            r[3] = (uint8_t)((t[2] >> 4) | (t[3] << 6));
+            r[4] = (uint8_t)(t[3] >> 2);
+            r += 5;
+        }
+    }
+}
+
+static void polyvec_decompress(kpolyvec *r, const uint8_t a[KYBER_POLYVECCOMPRESSEDBYTES]) {
+    uint16_t t[4];
+    for (int i = 0; i < KYBER_K; i++) {
+        for (int j = 0; j < KYBER_N / 4; j++) {
+            t[0] = (a[0] >> 0) | ((uint16_t)a[1] << 8);
+            t[1] = (a[1] >> 2) | ((uint16_t)a[2] << 6);
+            t[2] = (a[2] >> 4) | ((uint16_t)a[3] << 4);
+            t[3] = (a[3] >> 6) | ((uint16_t)a[4] << 2);
+            a += 5;
+            for (int k = 0; k < 4; k++) {
+                r->vec[i].coeffs[4 * j + k] = (int16_t)(((uint32_t)(t[k] & 0x3FF) * KYBER_Q + 512) >> 10);
+            }
+        }
+    }
+}
+
+static void polyvec_tobytes(uint8_t r[KYBER_POLYVECBYTES], const kpolyvec *a) {
+    for (int i = 0; i < KYBER_K; i++) poly_tobytes(r + i * KYBER_POLYBYTES, &a->vec[i]);
+}
+
+static void polyvec_frombytes(kpolyvec *r, const uint8_t a[KYBER_POLYVECBYTES]) {
+    for (int i = 0; i < KYBER_K; i++) poly_frombytes(&r->vec[i], a + i * KYBER_POLYBYTES);
+}
+
+// ==========================================================
+// 4. 取樣 (CBD 與 A 的拒絕取樣)
+// ==========================================================
+
+static uint32_t load32_littleendian(const uint8_t x[4]) {
+    return (uint32_t)x[0] | ((uint32_t)x[1] << 8) | ((uint32_t)x[2] << 16) | ((uint32_t)x[3] << 24);
+}
+
+static uint32_t load24_littleendian(const uint8_t x[3]) {
+    return (uint32_t)x[0] | ((uint32_t)x[1] << 8) | ((uint32_t)x[2] << 16);
+}
+
+static void cbd2(kpoly *r, const uint8_t buf[2 * KYBER_N / 4]) {
+    for (int i = 0; i < KYBER_N / 8; i++) {
+        uint32_t t = load32_littleendian(buf + 4 * i);
+        uint32_t d = t & 0x55555555;
+        d += (t >> 1) & 0x55555555;
+        for (int j = 0; j < 8; j++) {
+            int16_t a = (d >> (4 * j + 0)) & 0x3;
+            int16_t b = (d >> (4 * j + 2)) & 0x3;
+            r->coeffs[8 * i + j] = a - b;
+        }
+    }
+}
+
+static void cbd3(kpoly *r, const uint8_t buf[3 * KYBER_N / 4]) {
+    for (int i = 0; i < KYBER_N / 4; i++) {
+        uint32_t t = load24_littleendian(buf + 3 * i);
+        uint32_t d = t & 0x00249249;
+        d += (t >> 1) & 0x00249249;
+        d += (t >> 2) & 0x00249249;
+        for (int j = 0; j < 4; j++) {
+            int16_t a = (d >> (6 * j + 0)) & 0x7;
+            int16_t b = (d >> (6 * j + 3)) & 0x7;
+            r->coeffs[4 * i + j] = a - b;
+        }
+    }
+}
+
+// PRF(seed, nonce) = SHAKE256(seed || nonce)
+static void kyber_prf(uint8_t *out, size_t outlen, const uint8_t key[KYBER_SYMBYTES], uint8_t nonce) {
+    uint8_t extkey[KYBER_SYMBYTES + 1];
+    memcpy(extkey, key, KYBER_SYMBYTES);
+    extkey[KYBER_SYMBYTES] = nonce;
+    shake256(out, outlen, extkey, sizeof(extkey));
+}
+
+static void poly_getnoise_eta1(kpoly *r, const uint8_t seed[KYBER_SYMBYTES], uint8_t nonce) {
+    uint8_t buf[KYBER_ETA1 * KYBER_N / 4];
+    kyber_prf(buf, sizeof(buf), seed, nonce);
+    cbd3(r, buf);
+}
+
+static void poly_getnoise_eta2(kpoly *r, const uint8_t seed[KYBER_SYMBYTES], uint8_t nonce) {
+    uint8_t buf[KYBER_ETA2 * KYBER_N / 4];
+    kyber_prf(buf, sizeof(buf), seed, nonce);
+    cbd2(r, buf);
+}
+
+static unsigned rej_uniform(int16_t *r, unsigned len, const uint8_t *buf, unsigned buflen) {
+    unsigned ctr = 0, pos = 0;
+
+    while (ctr < len && pos + 3 <= buflen) {
+        uint16_t val0 = ((buf[pos + 0] >> 0) | ((uint16_t)buf[pos + 1] << 8)) & 0xFFF;
+        uint16_t val1 = ((buf[pos + 1] >> 4) | ((uint16_t)buf[pos + 2] << 4)) & 0xFFF;
+        pos += 3;
+
+        if (val0 < KYBER_Q) r[ctr++] = (int16_t)val0;
+        if (ctr < len && val1 < KYBER_Q) r[ctr++] = (int16_t)val1;
+    }
+    return ctr;
+}
+
+#define GEN_MATRIX_NBLOCKS ((12 * KYBER_N / 8 * (1 << 12) / KYBER_Q + SHAKE128_RATE) / SHAKE128_RATE)
+
+// A[i][j] = Parse(SHAKE128(rho || j || i))，transposed 時交換 i, j
+static void gen_matrix(kpolyvec a[KYBER_K], const uint8_t seed[KYBER_SYMBYTES], int transposed) {
+    uint8_t buf[GEN_MATRIX_NBLOCKS * SHAKE128_RATE];
+    uint8_t extseed[KYBER_SYMBYTES + 2];
+    keccak_state state;
+
+    memcpy(extseed, seed, KYBER_SYMBYTES);
+    for (int i = 0; i < KYBER_K; i++) {
+        for (int j = 0; j < KYBER_K; j++) {
+            extseed[KYBER_SYMBYTES + 0] = (uint8_t)(transposed ? i : j);
+            extseed[KYBER_SYMBYTES + 1] = (uint8_t)(transposed ? j : i);
+            shake128_absorb_once(&state, extseed, sizeof(extseed));
+
+            shake128_squeezeblocks(buf, GEN_MATRIX_NBLOCKS, &state);
+            unsigned ctr = rej_uniform(a[i].vec[j].coeffs, KYBER_N, buf, sizeof(buf));
+            while (ctr < KYBER_N) {
+                // SHAKE128_RATE 是 3 的倍數，每個區塊都能完整切成 12-bit 樣本
+                shake128_squeezeblocks(buf, 1, &state);
+                ctr += rej_uniform(a[i].vec[j].coeffs + ctr, KYBER_N - ctr, buf, SHAKE128_RATE);
+            }
+        }
+    }
+}
+
+// ==========================================================
+// 5. IND-CPA PKE
+// ==========================================================
+
+static void indcpa_keypair_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES], uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES],
+                                  const uint8_t coins[KYBER_SYMBYTES]) {
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    const uint8_t *publicseed = buf;
+    const uint8_t *noiseseed = buf + KYBER_SYMBYTES;
+    uint8_t nonce = 0;
+    kpolyvec a[KYBER_K], e, pkpv, skpv;
+
+    sha3_512(buf, coins, KYBER_SYMBYTES);
+    gen_matrix(a, publicseed, 0);
+
+    for (int i = 0; i < KYBER_K; i++) poly_getnoise_eta1(&skpv.vec[i], noiseseed, nonce++);
+    for (int i = 0; i < KYBER_K; i++) poly_getnoise_eta1(&e.vec[i], noiseseed, nonce++);
+
+    polyvec_ntt(&skpv);
+    polyvec_ntt(&e);
+
+    for (int i = 0; i < KYBER_K; i++) {
+        polyvec_basemul_acc_montgomery(&pkpv.vec[i], &a[i], &skpv);
+        poly_tomont(&pkpv.vec[i]);
+    }
+    polyvec_add(&pkpv, &pkpv, &e);
+    polyvec_reduce(&pkpv);
+
+    polyvec_tobytes(sk, &skpv);
+    polyvec_tobytes(pk, &pkpv);
+    memcpy(pk + KYBER_POLYVECBYTES, publicseed, KYBER_SYMBYTES);
+}
+
+static void indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES], const uint8_t m[KYBER_SYMBYTES],
+                       const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES], const uint8_t coins[KYBER_SYMBYTES]) {
+    uint8_t seed[KYBER_SYMBYTES];
+    uint8_t nonce = 0;
+    kpolyvec sp, pkpv, ep, at[KYBER_K], b;
+    kpoly v, k, epp;
+
+    polyvec_frombytes(&pkpv, pk);
+    memcpy(seed, pk + KYBER_POLYVECBYTES, KYBER_SYMBYTES);
+    poly_frommsg(&k, m);
+    gen_matrix(at, seed, 1);
+
+    for (int i = 0; i < KYBER_K; i++) poly_getnoise_eta1(&sp.vec[i], coins, nonce++);
+    for (int i = 0; i < KYBER_K; i++) poly_getnoise_eta2(&ep.vec[i], coins, nonce++);
+    poly_getnoise_eta2(&epp, coins, nonce++);
+
+    polyvec_ntt(&sp);
+
+    for (int i = 0; i < KYBER_K; i++) polyvec_basemul_acc_montgomery(&b.vec[i], &at[i], &sp);
+    polyvec_basemul_acc_montgomery(&v, &pkpv, &sp);
+
+    polyvec_invntt_tomont(&b);
+    invntt(v.coeffs);
+
+    polyvec_add(&b, &b, &ep);
+    poly_add(&v, &v, &epp);
+    poly_add(&v, &v, &k);
+    polyvec_reduce(&b);
+    poly_reduce(&v);
+
+    polyvec_compress(c, &b);
+    poly_compress(c + KYBER_POLYVECCOMPRESSEDBYTES, &v);
+}
+
+static void indcpa_dec(uint8_t m[KYBER_SYMBYTES], const uint8_t c[KYBER_INDCPA_BYTES],
+                       const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]) {
+    kpolyvec b, skpv;
+    kpoly v, mp;
+
+    polyvec_decompress(&b, c);
+    poly_decompress(&v, c + KYBER_POLYVECCOMPRESSEDBYTES);
+    polyvec_frombytes(&skpv, sk);
+
+    polyvec_ntt(&b);
+    polyvec_basemul_acc_montgomery(&mp, &skpv, &b);
+    invntt(mp.coeffs);
+
+    poly_sub(&mp, &v, &mp);
+    poly_reduce(&mp);
+
+    poly_tomsg(m, &mp);
+}
+
+// ==========================================================
+// 6. CCA KEM (Fujisaki-Okamoto)
+// ==========================================================
+
+// 常數時間比較，相同回傳 0
+static int verify(const uint8_t *a, const uint8_t *b, size_t len) {
+    uint8_t r = 0;
+    for (size_t i = 0; i < len; i++) r |= a[i] ^ b[i];
+    return (int)((-(uint64_t)r) >> 63);
+}
+
+static void cmov(uint8_t *r, const uint8_t *x, size_t len, uint8_t b) {
+    b = -b;
+    for (size_t i = 0; i < len; i++) r[i] ^= b & (r[i] ^ x[i]);
+}
+
+// coins = d || z，順序同 reference 取用 randombytes 的順序
+int kyber512_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t coins[2 * KYBER_SYMBYTES]) {
+    indcpa_keypair_derand(pk, sk, coins);
+    memcpy(sk + KYBER_INDCPA_SECRETKEYBYTES, pk, KYBER512_PUBLICKEYBYTES);
+    sha3_256(sk + KYBER512_SECRETKEYBYTES - 2 * KYBER_SYMBYTES, pk, KYBER512_PUBLICKEYBYTES);
+    memcpy(sk + KYBER512_SECRETKEYBYTES - KYBER_SYMBYTES, coins + KYBER_SYMBYTES, KYBER_SYMBYTES);
+    return 0;
+}
+
+int kyber512_keypair(uint8_t *pk, uint8_t *sk) {
+    uint8_t coins[2 * KYBER_SYMBYTES];
+    rudraksh_randombytes(coins, sizeof(coins));
+    return kyber512_keypair_derand(pk, sk, coins);
+}
+
+int kyber512_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t coins[KYBER_SYMBYTES]) {
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    uint8_t kr[2 * KYBER_SYMBYTES];
+
+    // m = H(coins)，不直接送出系統亂數
+    sha3_256(buf, coins, KYBER_SYMBYTES);
+    sha3_256(buf + KYBER_SYMBYTES, pk, KYBER512_PUBLICKEYBYTES);
+    sha3_512(kr, buf, 2 * KYBER_SYMBYTES);
+
+    indcpa_enc(ct, buf, pk, kr + KYBER_SYMBYTES);
+
+    sha3_256(kr + KYBER_SYMBYTES, ct, KYBER512_CIPHERTEXTBYTES);
+    shake256(ss, KYBER_SSBYTES, kr, 2 * KYBER_SYMBYTES);
+    return 0;
+}
+
+int kyber512_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk) {
+    uint8_t coins[KYBER_SYMBYTES];
+    rudraksh_randombytes(coins, sizeof(coins));
+    return kyber512_enc_derand(ct, ss, pk, coins);
+}
+
+int kyber512_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk) {
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    uint8_t kr[2 * KYBER_SYMBYTES];
+    uint8_t cmp[KYBER512_CIPHERTEXTBYTES];
+    const uint8_t *pk = sk + KYBER_INDCPA_SECRETKEYBYTES;
+
+    indcpa_dec(buf, ct, sk);
+
+    memcpy(buf + KYBER_SYMBYTES, sk + KYBER512_SECRETKEYBYTES - 2 * KYBER_SYMBYTES, KYBER_SYMBYTES);
+    sha3_512(kr, buf, 2 * KYBER_SYMBYTES);
+
+    indcpa_enc(cmp, buf, pk, kr + KYBER_SYMBYTES);
+    int fail = verify(ct, cmp, KYBER512_CIPHERTEXTBYTES);
+
+    // 失敗時以 z 取代 K̄ (implicit rejection)
+    sha3_256(kr + KYBER_SYMBYTES, ct, KYBER512_CIPHERTEXTBYTES);
+    cmov(kr, sk + KYBER512_SECRETKEYBYTES - KYBER_SYMBYTES, KYBER_SYMBYTES, (uint8_t)fail);
+    shake256(ss, KYBER_SSBYTES, kr, 2 * KYBER_SYMBYTES);
+    return 0;
+}
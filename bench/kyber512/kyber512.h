@@ -0,0 +1,45 @@
+#ifndef KYBER512_H
+#define KYBER512_H
+
+#include <stdint.h>
+
+// ==========================================================
+// CRYSTALS-Kyber-512 (round 3)，只作為 Rudraksh 的效能比較基準
+// 依 pq-crystals reference 實作改寫成單一檔案 (public domain / CC0)，
+// 與 reference 相同使用 SHA3-256 / SHA3-512 / SHAKE128 / SHAKE256
+// 亂數來源沿用 rudraksh_randombytes，讓兩者在相同條件下量測
+// bench_compare 開始前以 NIST KAT (PQCkemKAT_1632.rsp, count = 0) 驗證輸出
+// ==========================================================
+
+#define KYBER_K 2
+#define KYBER_N 256
+#define KYBER_Q 3329
+#define KYBER_ETA1 3
+#define KYBER_ETA2 2
+
+#define KYBER_SYMBYTES 32
+#define KYBER_SSBYTES 32
+
+#define KYBER_POLYBYTES 384
+#define KYBER_POLYVECBYTES (KYBER_K * KYBER_POLYBYTES)
+#define KYBER_POLYCOMPRESSEDBYTES 128                  // d_v = 4
+#define KYBER_POLYVECCOMPRESSEDBYTES (KYBER_K * 320)   // d_u = 10
+
+#define KYBER_INDCPA_PUBLICKEYBYTES (KYBER_POLYVECBYTES + KYBER_SYMBYTES)
+#define KYBER_INDCPA_SECRETKEYBYTES (KYBER_POLYVECBYTES)
+#define KYBER_INDCPA_BYTES (KYBER_POLYVECCOMPRESSEDBYTES + KYBER_POLYCOMPRESSEDBYTES)
+
+#define KYBER512_PUBLICKEYBYTES (KYBER_INDCPA_PUBLICKEYBYTES)                                   // 800
+#define KYBER512_SECRETKEYBYTES (KYBER_INDCPA_SECRETKEYBYTES + KYBER_INDCPA_PUBLICKEYBYTES + 2 * KYBER_SYMBYTES) // 1632
+#define KYBER512_CIPHERTEXTBYTES (KYBER_INDCPA_BYTES)                                           // 768
+#define KYBER512_BYTES (KYBER_SSBYTES)                                                          // 32
+
+int kyber512_keypair(uint8_t *pk, uint8_t *sk);
+int kyber512_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
+int kyber512_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+
+// 固定亂數版本 (KAT 用)：keypair 取 64 bytes (d || z)，enc 取 32 bytes
+int kyber512_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t coins[2 * KYBER_SYMBYTES]);
+int kyber512_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t coins[KYBER_SYMBYTES]);
+
+#endif // KYBER512_H
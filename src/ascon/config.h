@@ -16,4 +16,14 @@
 #define ASCON_UNROLL_LOOPS 1
 #endif
 
+/* bit-interleaved state with 32-bit permutation (default on 32-bit targets) */
+#ifndef ASCON_BI32
+#include <stdint.h>
+#if UINTPTR_MAX > 0xFFFFFFFFu
+#define ASCON_BI32 0
+#else
+#define ASCON_BI32 1
+#endif
+#endif
+
 #endif /* CONFIG_H_ */
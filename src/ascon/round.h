@@ -46,4 +46,86 @@ forceinline void PROUNDS(ascon_state_t* s, int nr) {
   } while (i != END);
 }
 
+/* bit-interleaved 32-bit round: e[i] / o[i] hold the even / odd bits of x[i] */
+
+forceinline void RORBI(uint32_t* re, uint32_t* ro, uint32_t e, uint32_t o,
+                       int n) {
+  /* 64-bit rotation by n on the interleaved halves */
+  if (n & 1) {
+    *re = ROR32(o, (n - 1) / 2);
+    *ro = ROR32(e, (n + 1) / 2);
+  } else {
+    *re = ROR32(e, n / 2);
+    *ro = ROR32(o, n / 2);
+  }
+}
+
+forceinline void LINEARBI(uint32_t* e, uint32_t* o, int a, int b) {
+  /* x ^= ROR(x, a) ^ ROR(x, b) */
+  uint32_t ae, ao, be, bo;
+  RORBI(&ae, &ao, *e, *o, a);
+  RORBI(&be, &bo, *e, *o, b);
+  *e ^= ae ^ be;
+  *o ^= ao ^ bo;
+}
+
+forceinline void SBOXBI(uint32_t* x) {
+  uint32_t t0, t1, t2, t3, t4;
+  x[0] ^= x[4];
+  x[4] ^= x[3];
+  x[2] ^= x[1];
+  t0 = x[0] ^ (~x[1] & x[2]);
+  t2 = x[2] ^ (~x[3] & x[4]);
+  t4 = x[4] ^ (~x[0] & x[1]);
+  t1 = x[1] ^ (~x[2] & x[3]);
+  t3 = x[3] ^ (~x[4] & x[0]);
+  t1 ^= t0;
+  t3 ^= t2;
+  t0 ^= t4;
+  x[0] = t0;
+  x[1] = t1;
+  x[2] = ~t2;
+  x[3] = t3;
+  x[4] = t4;
+}
+
+forceinline void ROUNDBI(uint32_t* e, uint32_t* o, uint8_t C) {
+  /* round constant: even bits of C into e[2], odd bits into o[2] */
+  e[2] ^= (C & 0x01) | (C >> 1 & 0x02) | (C >> 2 & 0x04) | (C >> 3 & 0x08);
+  o[2] ^= (C >> 1 & 0x01) | (C >> 2 & 0x02) | (C >> 3 & 0x04) | (C >> 4 & 0x08);
+  /* s-box layer (bitwise, same on both halves) */
+  SBOXBI(e);
+  SBOXBI(o);
+  /* linear layer (x[2] is complemented by the s-box; rotations commute with ~) */
+  LINEARBI(&e[0], &o[0], 19, 28);
+  LINEARBI(&e[1], &o[1], 61, 39);
+  LINEARBI(&e[2], &o[2], 1, 6);
+  LINEARBI(&e[3], &o[3], 10, 17);
+  LINEARBI(&e[4], &o[4], 7, 41);
+}
+
+forceinline void LOADBI(uint32_t* e, uint32_t* o, const ascon_state_t* s) {
+  /* state words are interleaved (see TOBI in word.h) */
+  int i;
+  for (i = 0; i < 5; i++) {
+    e[i] = (uint32_t)s->x[i];
+    o[i] = (uint32_t)(s->x[i] >> 32);
+  }
+}
+
+forceinline void STOREBI(ascon_state_t* s, const uint32_t* e,
+                         const uint32_t* o) {
+  int i;
+  for (i = 0; i < 5; i++) s->x[i] = (uint64_t)o[i] << 32 | e[i];
+  printstate(" permutation output", s);
+}
+
+forceinline void PROUNDSBI(ascon_state_t* s, int nr) {
+  uint32_t e[5], o[5];
+  int i;
+  LOADBI(e, o, s);
+  for (i = START(nr); i != END; i += INC) ROUNDBI(e, o, RC(i));
+  STOREBI(s, e, o);
+}
+
 #endif /* ROUND_H_ */
@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "config.h"
 #include "forceinline.h"
 #include "lendian.h"
 
@@ -13,13 +14,59 @@ typedef union {
   uint8_t b[8];
 } word_t;
 
+/* bit interleaving: even bits -> low 32 bits, odd bits -> high 32 bits */
+forceinline uint32_t BI_SPLIT32(uint32_t x) {
+  /* even bits -> low 16 bits, odd bits -> high 16 bits (Hacker's Delight 7-2) */
+  uint32_t t;
+  t = (x ^ (x >> 1)) & 0x22222222; x ^= t ^ (t << 1);
+  t = (x ^ (x >> 2)) & 0x0C0C0C0C; x ^= t ^ (t << 2);
+  t = (x ^ (x >> 4)) & 0x00F000F0; x ^= t ^ (t << 4);
+  t = (x ^ (x >> 8)) & 0x0000FF00; x ^= t ^ (t << 8);
+  return x;
+}
+
+forceinline uint32_t BI_JOIN32(uint32_t x) {
+  /* inverse of BI_SPLIT32 (same swaps in reverse order) */
+  uint32_t t;
+  t = (x ^ (x >> 8)) & 0x0000FF00; x ^= t ^ (t << 8);
+  t = (x ^ (x >> 4)) & 0x00F000F0; x ^= t ^ (t << 4);
+  t = (x ^ (x >> 2)) & 0x0C0C0C0C; x ^= t ^ (t << 2);
+  t = (x ^ (x >> 1)) & 0x22222222; x ^= t ^ (t << 1);
+  return x;
+}
+
+forceinline uint64_t TOBI(uint64_t in) {
+  uint32_t lo = BI_SPLIT32((uint32_t)in);
+  uint32_t hi = BI_SPLIT32((uint32_t)(in >> 32));
+  uint32_t e = (lo & 0x0000FFFF) | (hi << 16);
+  uint32_t o = (lo >> 16) | (hi & 0xFFFF0000);
+  return (uint64_t)o << 32 | e;
+}
+
+forceinline uint64_t FROMBI(uint64_t in) {
+  uint32_t e = (uint32_t)in, o = (uint32_t)(in >> 32);
+  uint32_t lo = BI_JOIN32((e & 0x0000FFFF) | (o << 16));
+  uint32_t hi = BI_JOIN32((e >> 16) | (o & 0xFFFF0000));
+  return (uint64_t)hi << 32 | lo;
+}
+
+#if ASCON_BI32
+/* state words are kept bit-interleaved; constants and data are converted */
+#define U64TOWORD(x) TOBI(U64LE(x))
+#define WORDTOU64(x) U64LE(FROMBI(x))
+#define CONSTTOWORD(x) TOBI(x)
+#else
 #define U64TOWORD(x) U64LE(x)
 #define WORDTOU64(x) U64LE(x)
+#define CONSTTOWORD(x) (x)
+#endif
 #define LOAD(b, n) LOADBYTES(b, n)
 #define STORE(b, w, n) STOREBYTES(b, w, n)
 
 forceinline uint64_t ROR(uint64_t x, int n) { return x >> n | x << (-n & 63); }
 
+forceinline uint32_t ROR32(uint32_t x, int n) { return x >> n | x << (-n & 31); }
+
 forceinline uint64_t KEYROT(uint64_t hi2lo, uint64_t lo2hi) {
   return lo2hi << 32 | hi2lo >> 32;
 }
@@ -32,7 +79,7 @@ forceinline int NOTZERO(uint64_t a, uint64_t b) {
   return ((((int)(result & 0xff) - 1) >> 8) & 1) - 1;
 }
 
-forceinline uint64_t PAD(int i) { return 0x01ull << (8 * i); }
+forceinline uint64_t PAD(int i) { return CONSTTOWORD(0x01ull << (8 * i)); }
 
 forceinline uint64_t DSEP() { return 0x80ull << 56; }
 
@@ -1,5 +1,7 @@
 #include "rudraksh_random.h"
 #include "rudraksh_params.h"
+#include "rudraksh_stats.h"
+#include "rudraksh_dispatch.h"
 
 // 位於ascon/xof/opt64 //
 #include "ascon/api.h"
@@ -11,16 +13,35 @@
 // 通常 ascon_state_t 已經在 ascon.h 定義好了
 // typedef struct { uint64_t x[5]; } ascon_state_t;
 
-// P12 實作
-void P12(ascon_state_t* s) { P12ROUNDS(s); }
+// P12 實作 (依 CPU 分派，見 rudraksh_dispatch.h)
+void P12(ascon_state_t* s) { RUDRAKSH_STAT_INC(p12); rudraksh_kernels_active()->ascon_p12(s); }
+// P8 實作 (快速 profile 的吸收 / 擠出置換)
+void P8(ascon_state_t* s) { RUDRAKSH_STAT_INC(p8); rudraksh_kernels_active()->ascon_p8(s); }
+
+// 快速 profile (Ascon-XOFa / Ascon-Hasha)：初始化與吸收結束仍為 P12 (pa)，區塊之間改用 P8 (pb)
+// IV 內含輪數，與標準 profile 的輸出天然分離
+#ifdef RUDRAKSH_SYM_ASCON_FAST
+#define RUDRAKSH_XOF_IV  ASCON_XOFA_IV
+#define RUDRAKSH_HASH_IV ASCON_HASHA_IV
+#define PB(s) P8(s)
+#else
+#define RUDRAKSH_XOF_IV  ASCON_XOF_IV
+#define RUDRAKSH_HASH_IV ASCON_HASH_IV
+#define PB(s) P12(s)
+#endif
+
+// 選用 SHAKE 後端時，PRF / Hash / DRBG 初始化改由 rudraksh_keccak.c 提供
+#ifndef RUDRAKSH_SYM_KECCAK
 
 // ==========================================
 // 1. 初始化 (Init)
 // ==========================================
 void rudraksh_ascon_init(ascon_state_t* s,uint64_t iv) {
     // 參考 hash.c 的 /* initialize */ 部分
-    // 注意：這裡是 XOF，所以 IV 必須是 ASCON_XOF_IV
-    s->x[0] = iv;
+    // 注意：這裡是 XOF，所以 IV 必須是 RUDRAKSH_XOF_IV (標準 profile 為 ASCON_XOF_IV)
+    // 32-bit 建置的狀態為 bit-interleaved 表示法 (ascon/config.h 的 ASCON_BI32)，常數需先轉換
+    // 之後的 LOADBYTES / STOREBYTES / PAD 已內含 interleave / deinterleave
+    s->x[0] = CONSTTOWORD(iv);
     s->x[1] = 0;
     s->x[2] = 0;
     s->x[3] = 0;
@@ -40,7 +61,7 @@ void rudraksh_ascon_absorb(ascon_state_t* s, const unsigned char* in, unsigned l
     // 處理滿塊 (Full Blocks) - 雖然 seed 通常很短，但保持完整性比較好
     while (len >= ASCON_HASH_RATE) {
         s->x[0] ^= LOADBYTES(in, 8);
-        P12(s);
+        PB(s);
         in += ASCON_HASH_RATE;
         len -= ASCON_HASH_RATE;
     }
@@ -67,8 +88,8 @@ void rudraksh_ascon_hash_squeeze(ascon_state_t* s, unsigned char* out, size_t ou
         // 注意：這裡使用 word.h 提供的 STOREBYTES 來處理 Endian
         STOREBYTES(out, s->x[0], 8);
         
-        // 2. 關鍵：執行 P12 置換
-        P12(s);
+        // 2. 關鍵：執行置換 (標準 profile 為 P12，快速 profile 為 P8)
+        PB(s);
         
         // 3. 更新指標
         out += 8;
@@ -79,7 +100,8 @@ void rudraksh_ascon_hash_squeeze(ascon_state_t* s, unsigned char* out, size_t ou
 void rudraksh_hash(uint8_t *output, const uint8_t *input, size_t inlen, size_t outlen)
 {
     ascon_state_t state;
-    rudraksh_ascon_init(&state,ASCON_HASH_IV);
+    RUDRAKSH_STAT_INC(hash);
+    rudraksh_ascon_init(&state,RUDRAKSH_HASH_IV);
     rudraksh_ascon_absorb(&state,input,inlen);
     rudraksh_ascon_hash_squeeze(&state,output,outlen);
 }
@@ -95,7 +117,7 @@ void rudraksh_prf_init_matrixA(RUDRAFKSH_STATE *s, const uint8_t *key, const uin
     input_buf[16] = (uint8_t)(*nonce_i & 0xFF);
     input_buf[17] = (uint8_t)(*nonce_j & 0xFF);
 
-    rudraksh_ascon_init(s,ASCON_XOF_IV);
+    rudraksh_ascon_init(s,RUDRAKSH_XOF_IV);
     rudraksh_ascon_absorb(s,input_buf,RUDRAKSH_PRF_matrixA_IN_BYTES);
 }
 
@@ -108,7 +130,7 @@ void rudraksh_prf_init_cbd(RUDRAFKSH_STATE *s, const uint8_t *key, const uint8_t
     memcpy(input_buf, key, 16);
     input_buf[16] = (uint8_t)(*nonce & 0xFF);
 
-    rudraksh_ascon_init(s,ASCON_XOF_IV);
+    rudraksh_ascon_init(s,RUDRAKSH_XOF_IV);
     rudraksh_ascon_absorb(s,input_buf,RUDRAKSH_PRF_cbd_IN_BYTE);
 }
 
@@ -116,5 +138,33 @@ void rudraksh_prf_init_cbd(RUDRAFKSH_STATE *s, const uint8_t *key, const uint8_t
 void rudraksh_prf_put(RUDRAFKSH_STATE *s,uint8_t *out )
 {
     STOREBYTES(out, s->x[0], 8);
-    P12(s);
-}
\ No newline at end of file
+    PB(s);
+}
+
+// ==========================================
+// 4. Ascon DRBG (XOF 串流)
+// ==========================================
+// 以 32 bytes 種子吸入 XOF，之後連續擠出；輸入長度與 PRF (17/18 bytes) 不同，padding 後不會重疊
+void rudraksh_drbg_init(rudraksh_drbg *d, const uint8_t seed[RUDRAKSH_DRBG_SEEDBYTES])
+{
+    rudraksh_ascon_init(&d->state, RUDRAKSH_XOF_IV);
+    rudraksh_ascon_absorb(&d->state, seed, RUDRAKSH_DRBG_SEEDBYTES);
+}
+
+#endif // RUDRAKSH_SYM_KECCAK
+
+void rudraksh_drbg_generate(rudraksh_drbg *d, uint8_t *out, size_t outlen)
+{
+    uint8_t block[8];
+
+    while (outlen >= 8) {
+        rudraksh_prf_put(&d->state, out);
+        out += 8;
+        outlen -= 8;
+    }
+    // 不足 8 bytes 的尾端：捨棄該 block 剩餘部分
+    if (outlen > 0) {
+        rudraksh_prf_put(&d->state, block);
+        memcpy(out, block, outlen);
+    }
+}
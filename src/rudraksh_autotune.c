@@ -0,0 +1,564 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L // clock_gettime, mkstemp, fdopen
+#endif
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "rudraksh_autotune.h"
+#include "rudraksh_dispatch.h"
+#include "rudraksh_params.h"
+#include "rudraksh_stats.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+// ==========================================================
+// 1. 各策略 (輸入 / 輸出皆為一般域)
+// ==========================================================
+
+// NTT：A、s 轉到 NTT 域後點乘累加，結果再轉回
+static void ntt_matvec(polyvec *b, polymat *A, polyvec *s) {
+    polymat_ntt(A);
+    polyvec_ntt(s);
+    poly_matrix_vec_mul_ntt(b, A, s);
+    polyvec_invntt_tomont(b);
+}
+
+static void ntt_matvec_trans(polyvec *b, polymat *A, polyvec *s) {
+    polymat_ntt(A);
+    polyvec_ntt(s);
+    poly_matrix_trans_vec_mul_ntt(b, A, s);
+    polyvec_invntt_tomont(b);
+}
+
+static void ntt_inner(poly *c, const polyvec *b, const polyvec *s) {
+    polyvec b_hat = *b, s_hat = *s;
+    polyvec_ntt(&b_hat);
+    polyvec_ntt(&s_hat);
+    poly_vector_vector_mul_ntt(c, &b_hat, &s_hat);
+    poly_invntt(c);
+}
+
+// Schoolbook：直接在一般域做 K*K 次卷積，省去 A 的 K*K 次 NTT；s 仍需轉換以符合介面約定
+static void schoolbook_matvec(polyvec *b, polymat *A, polyvec *s) {
+    poly_matrix_vec_mul(b, A, s);
+    polyvec_ntt(s);
+}
+
+static void schoolbook_matvec_trans(polyvec *b, polymat *A, polyvec *s) {
+    poly_matrix_trans_vec_mul(b, A, s);
+    polyvec_ntt(s);
+}
+
+// Karatsuba：同 schoolbook 直接在一般域計算，每個乘積約 2300 次整數乘法，整列累加後才化約
+static void karatsuba_matvec(polyvec *b, polymat *A, polyvec *s) {
+    poly_matrix_vec_mul_karatsuba(b, A, s);
+    polyvec_ntt(s);
+}
+
+static void karatsuba_matvec_trans(polyvec *b, polymat *A, polyvec *s) {
+    poly_matrix_trans_vec_mul_karatsuba(b, A, s);
+    polyvec_ntt(s);
+}
+
+// FFT：32 點複數 FFT (double)，整列在頻域累加後只做一次反轉換
+static void fft_matvec(polyvec *b, polymat *A, polyvec *s) {
+    poly_matrix_vec_mul_fft(b, A, s);
+    polyvec_ntt(s);
+}
+
+static void fft_matvec_trans(polyvec *b, polymat *A, polyvec *s) {
+    poly_matrix_trans_vec_mul_fft(b, A, s);
+    polyvec_ntt(s);
+}
+
+// Kronecker：35-bit 欄位打包成大整數，64-bit limb 相乘，整列在大整數上累加後才拆解
+static void kronecker_matvec(polyvec *b, polymat *A, polyvec *s) {
+    poly_matrix_vec_mul_kronecker(b, A, s);
+    polyvec_ntt(s);
+}
+
+static void kronecker_matvec_trans(polyvec *b, polymat *A, polyvec *s) {
+    poly_matrix_trans_vec_mul_kronecker(b, A, s);
+    polyvec_ntt(s);
+}
+
+// NTT (頻率優先)：A、s 的 NTT 輸出直接寫成頻率優先佈局，以 64 個 K x K GEMV 取代 K * K 次點乘
+static void ntt_fm_matvec(polyvec *b, polymat *A, polyvec *s) {
+    polymat_fm A_fm;
+    polyvec_fm s_fm, b_fm;
+    polymat_ntt_fm(&A_fm, A);
+    polyvec_ntt_fm(&s_fm, s);
+    poly_matrix_vec_mul_fm(&b_fm, &A_fm, &s_fm);
+    polyvec_invntt_fm(b, &b_fm);
+}
+
+static void ntt_fm_matvec_trans(polyvec *b, polymat *A, polyvec *s) {
+    polymat_fm A_fm;
+    polyvec_fm s_fm, b_fm;
+    polymat_ntt_fm(&A_fm, A);
+    polyvec_ntt_fm(&s_fm, s);
+    poly_matrix_trans_vec_mul_fm(&b_fm, &A_fm, &s_fm);
+    polyvec_invntt_fm(b, &b_fm);
+}
+
+static const rudraksh_mul_strategy STRATEGY_NTT = {
+    "ntt", ntt_matvec, ntt_matvec_trans, ntt_inner,
+};
+
+// 內積只有 K 個乘積，頻率優先佈局沒有好處，沿用 NTT
+static const rudraksh_mul_strategy STRATEGY_NTT_FM = {
+    "ntt-fm", ntt_fm_matvec, ntt_fm_matvec_trans, ntt_inner,
+};
+
+static const rudraksh_mul_strategy STRATEGY_SCHOOLBOOK = {
+    "schoolbook", schoolbook_matvec, schoolbook_matvec_trans, poly_vector_vector_mul,
+};
+
+static const rudraksh_mul_strategy STRATEGY_KARATSUBA = {
+    "karatsuba", karatsuba_matvec, karatsuba_matvec_trans, poly_vector_vector_mul_karatsuba,
+};
+
+static const rudraksh_mul_strategy STRATEGY_FFT = {
+    "fft", fft_matvec, fft_matvec_trans, poly_vector_vector_mul_fft,
+};
+
+static const rudraksh_mul_strategy STRATEGY_KRONECKER = {
+    "kronecker", kronecker_matvec, kronecker_matvec_trans, poly_vector_vector_mul_kronecker,
+};
+
+static const rudraksh_mul_strategy *const STRATEGIES[] = {
+    &STRATEGY_NTT,
+    &STRATEGY_SCHOOLBOOK,
+    &STRATEGY_KARATSUBA,
+    &STRATEGY_FFT,
+    &STRATEGY_KRONECKER,
+    &STRATEGY_NTT_FM,
+};
+#define N_STRATEGIES (sizeof(STRATEGIES) / sizeof(STRATEGIES[0]))
+
+static const char *const SHAPE_NAMES[RUDRAKSH_N_SHAPES] = { "matvec", "matvec_t" };
+
+size_t rudraksh_mul_count(void) {
+    return N_STRATEGIES;
+}
+
+const rudraksh_mul_strategy *rudraksh_mul_variant(size_t i) {
+    return i < N_STRATEGIES ? STRATEGIES[i] : NULL;
+}
+
+const char *rudraksh_mul_shape_name(rudraksh_mul_shape shape) {
+    return (unsigned)shape < RUDRAKSH_N_SHAPES ? SHAPE_NAMES[shape] : "?";
+}
+
+static int find_strategy(const char *name) {
+    for (size_t i = 0; i < N_STRATEGIES; i++) {
+        if (strcmp(STRATEGIES[i]->name, name) == 0) return (int)i;
+    }
+    return -1;
+}
+
+// ==========================================================
+// 2. 調校狀態
+// 整個狀態壓成一個 32-bit 字，以 atomic 讀寫：
+//   bit 31 有效、bit 30 手動指定 (不隨 kernel 變體失效)、bit 16-23 調校時的 kernel 變體 index、
+//   bit 4*shape 起的 4 bits 為該形狀的策略 index
+// 初始化 (量測、讀寫快取) 由 tune_lock 序列化：同時需要初始化的其他執行緒不等待，先使用 NTT
+// ==========================================================
+
+#define STATE_VALID  0x80000000u
+#define STATE_PINNED 0x40000000u
+#define STATE_KERN_SHIFT 16
+
+static uint32_t tune_state = 0;
+
+static uint32_t tune_lock = 0;
+static int tune_opt_in = 0;  // 呼叫過 rudraksh_autotune_init / measure (持有 tune_lock 或在 rudraksh_mul_select 時存取)
+
+#if defined(__GNUC__)
+#define LOAD_STATE() __atomic_load_n(&tune_state, __ATOMIC_ACQUIRE)
+#define STORE_STATE(v) __atomic_store_n(&tune_state, (v), __ATOMIC_RELEASE)
+#define TRY_LOCK() (__atomic_exchange_n(&tune_lock, 1, __ATOMIC_ACQUIRE) == 0)
+#define UNLOCK() __atomic_store_n(&tune_lock, 0, __ATOMIC_RELEASE)
+#elif defined(_WIN32)
+#define LOAD_STATE() (tune_state)
+#define STORE_STATE(v) (tune_state = (v))
+#define TRY_LOCK() (InterlockedExchange((volatile LONG *)&tune_lock, 1) == 0)
+#define UNLOCK() InterlockedExchange((volatile LONG *)&tune_lock, 0)
+#else
+#define LOAD_STATE() (tune_state)
+#define STORE_STATE(v) (tune_state = (v))
+#define TRY_LOCK() (tune_lock ? 0 : (tune_lock = 1))
+#define UNLOCK() (tune_lock = 0)
+#endif
+
+// 明確呼叫的初始化需要等待正在進行的調校完成 (量測約數毫秒，讓出 CPU 即可)
+static void lock_wait(void) {
+    while (!TRY_LOCK()) {
+#ifdef _WIN32
+        SwitchToThread();
+#else
+        sched_yield();
+#endif
+    }
+}
+
+static uint64_t tune_cost[RUDRAKSH_N_SHAPES][N_STRATEGIES];
+
+static uint32_t active_kernels_index(void) {
+    const rudraksh_kernels *k = rudraksh_kernels_active();
+    for (size_t i = 0; i < rudraksh_kernels_count(); i++) {
+        if (rudraksh_kernels_variant(i) == k) return (uint32_t)i;
+    }
+    return 0;
+}
+
+static uint32_t make_state(const int choice[RUDRAKSH_N_SHAPES], uint32_t flags) {
+    uint32_t v = STATE_VALID | flags | (active_kernels_index() << STATE_KERN_SHIFT);
+    for (int s = 0; s < RUDRAKSH_N_SHAPES; s++) v |= (uint32_t)choice[s] << (4 * s);
+    return v;
+}
+
+static int state_current(uint32_t v) {
+    if (!(v & STATE_VALID)) return 0;
+    if (v & STATE_PINNED) return 1;
+    return ((v >> STATE_KERN_SHIFT) & 0xFF) == active_kernels_index();
+}
+
+// ==========================================================
+// 3. 量測
+// ==========================================================
+
+#define TUNE_REPS 5
+
+static uint64_t now_ns(void) {
+#ifdef _WIN32
+    LARGE_INTEGER f, c;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&c);
+    return (uint64_t)((double)c.QuadPart * 1e9 / (double)f.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+// 量測用的輸入 / 輸出放在 heap：第一次使用可能發生在 KEM 呼叫內，不能再佔用約 20 KiB 的 stack
+typedef struct {
+    polymat A;
+    polyvec s0, s, b;
+} tune_buffers;
+
+static const uint8_t TUNE_SEED_A[RUDRAKSH_len_K] = { 0x52, 0x75, 0x64, 0x72, 0x61, 0x6B, 0x73, 0x68 };
+
+static uint32_t tune_next(uint32_t *x) {
+    // xorshift32：只需固定、分佈均勻的輸入
+    *x ^= *x << 13;
+    *x ^= *x >> 17;
+    *x ^= *x << 5;
+    return *x;
+}
+
+static uint64_t time_once(const rudraksh_mul_strategy *st, rudraksh_mul_shape shape, tune_buffers *t) {
+    // 就地改寫的輸入在計時範圍外還原；A 每次重新展開，重現 KEM 內「展開 A 後緊接乘法」的狀態
+    // (連續重複同一乘法時浮點 / 256-bit 單元一直保持暖機，FFT 會顯得快約 3 倍，實際 KeyGen 中反而比 NTT 慢)
+    poly_matrixA_generator(&t->A, TUNE_SEED_A);
+    t->s = t->s0;
+
+    uint64_t t0 = now_ns();
+    if (shape == RUDRAKSH_SHAPE_MATVEC) st->matvec(&t->b, &t->A, &t->s);
+    else st->matvec_trans(&t->b, &t->A, &t->s);
+    return now_ns() - t0;
+}
+
+// 回傳 0 成功，-1 代表無法配置量測緩衝 (維持預設 NTT)
+static int measure_all(int choice[RUDRAKSH_N_SHAPES]) {
+    tune_buffers *t = malloc(sizeof(tune_buffers));
+    uint32_t x = 0x2545F491u;
+
+    for (int s = 0; s < RUDRAKSH_N_SHAPES; s++) choice[s] = 0;
+    if (t == NULL) return -1;
+
+#ifdef RUDRAKSH_STATS
+    // 量測不算進呼叫端的事件計數
+    rudraksh_stats saved = rudraksh_stats_tls;
+#endif
+
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        for (int k = 0; k < RUDRAKSH_N; k++) t->s0.vec[i].coeffs[k] = (int16_t)(tune_next(&x) % RUDRAKSH_Q);
+    }
+
+    for (int s = 0; s < RUDRAKSH_N_SHAPES; s++) {
+        for (size_t i = 0; i < N_STRATEGIES; i++) {
+            uint64_t best = UINT64_MAX;
+            time_once(STRATEGIES[i], (rudraksh_mul_shape)s, t); // 暖身 (cache / 分支預測)
+            for (int r = 0; r < TUNE_REPS; r++) {
+                uint64_t ns = time_once(STRATEGIES[i], (rudraksh_mul_shape)s, t);
+                if (ns < best) best = ns;
+            }
+            tune_cost[s][i] = best;
+            if (best < tune_cost[s][choice[s]]) choice[s] = (int)i;
+        }
+    }
+
+#ifdef RUDRAKSH_STATS
+    rudraksh_stats_tls = saved;
+#endif
+    free(t);
+    return 0;
+}
+
+// ==========================================================
+// 4. 快取檔
+// 第一行為版本、策略清單與 NTT 層數簽章，之後每行一個 kernel 變體：
+//   rudraksh-autotune 2 ntt,schoolbook L6
+//   avx512 ntt schoolbook
+// 版本 1 另有 inner 欄位 (已移除)，其檔案因版本不符而視為失效
+// ==========================================================
+
+#define CACHE_VERSION 2
+#define CACHE_LINE 256
+#define CACHE_MAX_RECORDS 16
+
+// 快取檔路徑：RUDRAKSH_AUTOTUNE_CACHE 優先 (空字串代表不使用快取)，否則為 home 目錄下的預設檔案
+static const char *cache_path(char *buf, size_t len) {
+    const char *env = getenv(RUDRAKSH_AUTOTUNE_CACHE_ENV);
+    if (env != NULL) return env[0] != '\0' ? env : NULL;
+
+#ifdef _WIN32
+    const char *home = getenv("USERPROFILE");
+    const char sep = '\\';
+#else
+    const char *home = getenv("HOME");
+    const char sep = '/';
+#endif
+    if (home == NULL || home[0] == '\0') return NULL;
+    if (snprintf(buf, len, "%s%c.rudraksh_autotune", home, sep) >= (int)len) return NULL;
+    return buf;
+}
+
+static void cache_header(char *buf, size_t len) {
+    size_t n = (size_t)snprintf(buf, len, "rudraksh-autotune %d ", CACHE_VERSION);
+    for (size_t i = 0; i < N_STRATEGIES && n < len; i++) {
+        n += (size_t)snprintf(buf + n, len - n, "%s%s", i ? "," : "", STRATEGIES[i]->name);
+    }
+    if (n < len) snprintf(buf + n, len - n, " L%d", RUDRAKSH_NTT_LAYERS);
+}
+
+static void strip_newline(char *line) {
+    line[strcspn(line, "\r\n")] = '\0';
+}
+
+// 從快取讀出目前 kernel 變體的記錄；成功回傳 0
+static int cache_load(const char *path, int choice[RUDRAKSH_N_SHAPES]) {
+    char header[CACHE_LINE], line[CACHE_LINE];
+    const char *kernels = rudraksh_kernels_active()->name;
+    int found = -1;
+
+    FILE *f = fopen(path, "r");
+    if (f == NULL) return -1;
+
+    cache_header(header, sizeof(header));
+    if (fgets(line, sizeof(line), f) != NULL) {
+        strip_newline(line);
+        if (strcmp(line, header) == 0) {
+            while (found != 0 && fgets(line, sizeof(line), f) != NULL) {
+                char name[32], st[RUDRAKSH_N_SHAPES][32];
+                if (sscanf(line, "%31s %31s %31s", name, st[0], st[1]) != 1 + RUDRAKSH_N_SHAPES) continue;
+                if (strcmp(name, kernels) != 0) continue;
+
+                found = 0;
+                for (int s = 0; s < RUDRAKSH_N_SHAPES; s++) {
+                    choice[s] = find_strategy(st[s]);
+                    if (choice[s] < 0) found = -1;
+                }
+            }
+        }
+    }
+    fclose(f);
+    return found;
+}
+
+// 寫入 (取代) 目前 kernel 變體的記錄，其他變體的記錄保留；
+// 先寫入唯一的暫存檔 (mkstemp；Windows 以 pid + tid 命名) 再 rename，多個行程同時寫入時後 rename 者生效
+// 保留的記錄逐行複製到暫存檔，不在 stack 上暫存 (可能在 KEM 呼叫內第一次調校時執行)
+static int cache_store(const char *path, const int choice[RUDRAKSH_N_SHAPES]) {
+    char header[CACHE_LINE], line[CACHE_LINE], tmp[CACHE_LINE + 32];
+    const char *kernels = rudraksh_kernels_active()->name;
+    size_t klen = strlen(kernels);
+    int n_keep = 0;
+    FILE *f;
+
+    cache_header(header, sizeof(header));
+
+#ifdef _WIN32
+    if (snprintf(tmp, sizeof(tmp), "%s.%lu.%lu.tmp", path, (unsigned long)GetCurrentProcessId(),
+                 (unsigned long)GetCurrentThreadId()) >= (int)sizeof(tmp)) return -1;
+    f = fopen(tmp, "w");
+#else
+    if (snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path) >= (int)sizeof(tmp)) return -1;
+    int fd = mkstemp(tmp);
+    if (fd < 0) return -1;
+    f = fdopen(fd, "w");
+    if (f == NULL) {
+        close(fd);
+        remove(tmp);
+    }
+#endif
+    if (f == NULL) return -1;
+
+    fprintf(f, "%s\n", header);
+
+    FILE *old = fopen(path, "r");
+    if (old != NULL) {
+        if (fgets(line, sizeof(line), old) != NULL) {
+            strip_newline(line);
+            if (strcmp(line, header) == 0) {
+                while (n_keep < CACHE_MAX_RECORDS && fgets(line, sizeof(line), old) != NULL) {
+                    strip_newline(line);
+                    if (line[0] == '\0' || (strncmp(line, kernels, klen) == 0 && line[klen] == ' ')) continue;
+                    fprintf(f, "%s\n", line);
+                    n_keep++;
+                }
+            }
+        }
+        fclose(old);
+    }
+
+    fprintf(f, "%s", kernels);
+    for (int s = 0; s < RUDRAKSH_N_SHAPES; s++) fprintf(f, " %s", STRATEGIES[choice[s]]->name);
+    fprintf(f, "\n");
+
+    if (fclose(f) != 0) {
+        remove(tmp);
+        return -1;
+    }
+#ifdef _WIN32
+    remove(path); // Windows 的 rename 不會覆蓋既有檔案
+#endif
+    if (rename(tmp, path) != 0) {
+        remove(tmp);
+        return -1;
+    }
+    return 0;
+}
+
+// ==========================================================
+// 5. 初始化與選擇
+// ==========================================================
+
+// 以下兩個函式需持有 tune_lock
+static int measure_store(void) {
+    char buf[CACHE_LINE];
+    int choice[RUDRAKSH_N_SHAPES];
+
+    int ok = measure_all(choice);
+    STORE_STATE(make_state(choice, 0));
+    if (ok != 0) return -1;
+
+    const char *path = cache_path(buf, sizeof(buf));
+    if (path == NULL) return 0;
+    return cache_store(path, choice);
+}
+
+// opt_in 為 0 且未設定 RUDRAKSH_AUTOTUNE_CACHE 時不量測，直接使用 NTT (回傳 3)
+static int tune_init(int opt_in) {
+    char buf[CACHE_LINE];
+    int choice[RUDRAKSH_N_SHAPES];
+
+    const char *env = getenv(RUDRAKSH_MUL_ENV);
+    if (env != NULL && env[0] != '\0') {
+        int i = find_strategy(env);
+        if (i >= 0) {
+            for (int s = 0; s < RUDRAKSH_N_SHAPES; s++) choice[s] = i;
+            STORE_STATE(make_state(choice, 0));
+            return 2;
+        }
+    }
+
+    const char *cache = getenv(RUDRAKSH_AUTOTUNE_CACHE_ENV);
+    if (!opt_in && (cache == NULL || cache[0] == '\0')) {
+        for (int s = 0; s < RUDRAKSH_N_SHAPES; s++) choice[s] = 0;
+        STORE_STATE(make_state(choice, 0));
+        return 3;
+    }
+
+    const char *path = cache_path(buf, sizeof(buf));
+    if (path != NULL && cache_load(path, choice) == 0) {
+        STORE_STATE(make_state(choice, 0));
+        return 0;
+    }
+
+    measure_store();
+    return 1;
+}
+
+int rudraksh_autotune_measure(void) {
+    lock_wait();
+    tune_opt_in = 1;
+    int ret = measure_store();
+    UNLOCK();
+    return ret;
+}
+
+int rudraksh_autotune_init(void) {
+    lock_wait();
+    tune_opt_in = 1;
+    int ret = tune_init(1);
+    UNLOCK();
+    return ret;
+}
+
+const rudraksh_mul_strategy *rudraksh_mul_choice(rudraksh_mul_shape shape) {
+    uint32_t v = LOAD_STATE();
+    if (!state_current(v)) {
+        // 另一個執行緒正在調校：這次先用 NTT，不等待
+        if (!TRY_LOCK()) return STRATEGIES[0];
+        if (!state_current(LOAD_STATE())) tune_init(tune_opt_in);
+        UNLOCK();
+        v = LOAD_STATE();
+    }
+    return STRATEGIES[(v >> (4 * shape)) & 0xF];
+}
+
+uint64_t rudraksh_autotune_cost(rudraksh_mul_shape shape, size_t strategy) {
+    if ((unsigned)shape >= RUDRAKSH_N_SHAPES || strategy >= N_STRATEGIES) return 0;
+    return tune_cost[shape][strategy];
+}
+
+int rudraksh_mul_select(const char *name) {
+    int choice[RUDRAKSH_N_SHAPES];
+
+    if (name == NULL) {
+        tune_opt_in = 0;
+        STORE_STATE(0);
+        return 0;
+    }
+    int i = find_strategy(name);
+    if (i < 0) return -1;
+    for (int s = 0; s < RUDRAKSH_N_SHAPES; s++) choice[s] = i;
+    STORE_STATE(make_state(choice, STATE_PINNED));
+    return 0;
+}
+
+// ==========================================================
+// 6. 依調校結果計算
+// ==========================================================
+
+void rudraksh_mul_matvec(polyvec *b, polymat *A, polyvec *s) {
+    rudraksh_mul_choice(RUDRAKSH_SHAPE_MATVEC)->matvec(b, A, s);
+}
+
+void rudraksh_mul_matvec_trans(polyvec *b, polymat *A, polyvec *s) {
+    rudraksh_mul_choice(RUDRAKSH_SHAPE_MATVEC_T)->matvec_trans(b, A, s);
+}
+
@@ -0,0 +1,73 @@
+#ifndef RUDRAKSH_AUTOTUNE_H
+#define RUDRAKSH_AUTOTUNE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "rudraksh_math.h"
+
+// ==========================================================
+// 多項式乘法策略自動調校 (Autotune)
+// 同一個運算形狀 (矩陣-向量、轉置矩陣-向量) 可用 NTT (一般或頻率優先佈局)、schoolbook、Karatsuba、FFT 或 Kronecker substitution 等不同策略計算，
+// 哪一個最快取決於微架構與目前的 kernel 變體 (rudraksh_dispatch.h)
+// 調校為 opt-in：預設不量測、不寫檔，所有形狀使用 NTT；
+// 呼叫 rudraksh_autotune_init (或設定 RUDRAKSH_AUTOTUNE_CACHE) 後才對每個形狀量測所有策略並選出最快者，
+// 結果寫入快取檔，之後的行程直接讀取，不必重新量測
+// KEM 內的內積 (b^T s'、s^T u) 輸入本來就在 NTT 域，只剩 K 次點乘與一次 INTT，不參與調校
+//
+// 環境變數：
+//   RUDRAKSH_MUL=<策略名稱>          所有形狀強制使用該策略 (不量測也不讀寫快取)
+//   RUDRAKSH_AUTOTUNE_CACHE=<路徑>   快取檔位置，設定後第一次使用時即調校 (不必呼叫 rudraksh_autotune_init)；
+//                                    設為空字串代表不讀寫快取 (僅 rudraksh_autotune_init 會量測)
+//                                    未設定時 rudraksh_autotune_init 使用 $HOME/.rudraksh_autotune (Windows: %USERPROFILE%)
+// 快取檔以 kernel 變體名稱區分記錄，並帶有策略清單與 NTT 層數簽章；任一項改變時整個檔案視為失效
+// 同一行程內的調校由單一執行緒進行，其他執行緒在調校完成前使用 NTT (結果逐 bit 相同)
+// ==========================================================
+
+#define RUDRAKSH_MUL_ENV            "RUDRAKSH_MUL"
+#define RUDRAKSH_AUTOTUNE_CACHE_ENV "RUDRAKSH_AUTOTUNE_CACHE"
+
+typedef enum {
+    RUDRAKSH_SHAPE_MATVEC = 0,  // b = A s       (KeyGen)
+    RUDRAKSH_SHAPE_MATVEC_T,    // b = A^T s     (Encrypt 的 u)
+    RUDRAKSH_N_SHAPES
+} rudraksh_mul_shape;
+
+// 每個策略對兩個形狀各提供一個實作，輸入 / 輸出皆為一般域 (非 NTT 域)
+// matvec / matvec_trans 會就地改寫輸入以省去複製：
+//   A 呼叫後內容未定義；s 回傳時已轉換到 NTT 域 (呼叫端通常接著需要 s_hat)
+// inner 為同一算法的一般域內積 c = b^T s，供直接呼叫與交叉驗證，不參與調校
+typedef struct {
+    const char *name;
+    void (*matvec)(polyvec *b, polymat *A, polyvec *s);
+    void (*matvec_trans)(polyvec *b, polymat *A, polyvec *s);
+    void (*inner)(poly *c, const polyvec *b, const polyvec *s);
+} rudraksh_mul_strategy;
+
+// 編譯進來的所有策略，index 0 固定為 NTT (未調校時的預設)
+size_t rudraksh_mul_count(void);
+const rudraksh_mul_strategy *rudraksh_mul_variant(size_t i);
+const char *rudraksh_mul_shape_name(rudraksh_mul_shape shape);
+
+// 目前該形狀使用的策略 (第一次呼叫時初始化；kernel 變體切換後會重新初始化)
+const rudraksh_mul_strategy *rudraksh_mul_choice(rudraksh_mul_shape shape);
+
+// 依調校結果計算 (crypto 核心使用)，語意同 rudraksh_mul_strategy
+void rudraksh_mul_matvec(polyvec *b, polymat *A, polyvec *s);
+void rudraksh_mul_matvec_trans(polyvec *b, polymat *A, polyvec *s);
+
+// 啟用調校並立即初始化 (讀取快取，無效時量測並寫回)；之後 kernel 變體切換時同樣重新調校
+// 回傳 0 代表使用快取，1 代表重新量測，2 代表由 RUDRAKSH_MUL 指定
+int rudraksh_autotune_init(void);
+
+// 忽略快取，重新量測所有形狀並寫回快取；回傳 0 成功，-1 代表快取檔寫入失敗 (調校結果仍生效)
+int rudraksh_autotune_measure(void);
+
+// 本行程最近一次量測的耗時 (ns，取多次的最小值)；未量測過時為 0
+uint64_t rudraksh_autotune_cost(rudraksh_mul_shape shape, size_t strategy);
+
+// 強制所有形狀使用指定策略 (測試 / benchmark 用，呼叫時不可有其他執行緒正在運算)
+// name 為 NULL 時回到未調校狀態 (清除調校結果與 rudraksh_autotune_init 的 opt-in)，下次使用時重新初始化；
+// 回傳 0 代表成功，-1 代表未知策略
+int rudraksh_mul_select(const char *name);
+
+#endif // RUDRAKSH_AUTOTUNE_H
@@ -7,6 +7,8 @@
 #include "rudraksh_math.h"
 #include "rudraksh_random.h"
 #include "rudraksh_crypto.h"
+#include "rudraksh_trace.h"
+#include "rudraksh_autotune.h"
 // 假設已包含必要的 params, math, random headers
 
 // ==========================================================
@@ -42,115 +44,265 @@ static void cmov(uint8_t *r, const uint8_t *x, size_t len, uint8_t b) {
     }
 }
 
+
 // ==========================================================
-// 1. Public Key Encryption (PKE) APIs
-//    核心運算層：處理 Internal Struct <-> Math
+// 0. NTT 域核心 (Internal)
+//    b_hat / s_hat 皆已在 NTT 域，供標準格式與 NTT 域格式共用
 // ==========================================================
 
-// PKE KeyGen: 生成內部使用的結構 (Unpacked)
-void rudraksh_pke_keygen(public_key *pk, secret_key *sk)
+// PKE Encrypt 核心: b_hat 為 NTT 域的 b，輸出未壓縮的 u, v
+static void pke_encrypt_ntt_poly(const polyvec *b_hat, const uint8_t *seed_A, const poly *m, const uint8_t *r,
+                                 polyvec *b_prime, poly *c_m_hat)
 {
-    // 1. 初始化變數
-    uint8_t seedbuf[2 * RUDRAKSH_len_K];
-    const uint8_t *seed_A = seedbuf;
-    const uint8_t *seed_se = seedbuf + RUDRAKSH_len_K;
-    
     polymat A;
-    polyvec s, e;
+    polyvec s_prime, e_prime;
+    poly e_prime_prime; 
 
-
-    // 2. 亂數生成
-    rudraksh_randombytes(seedbuf, 2 * RUDRAKSH_len_K);
-
-    // 保存 seed_A 到內部 PK 結構
-    memcpy(pk->seed_A, seed_A, RUDRAKSH_len_K);
-
-    // 生成矩陣 A 和向量 s, e
+    // 1. 重建矩陣 A (使用 PK 的 seed)；是否轉到 NTT 域由乘法策略決定
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_GEN_A);
     poly_matrixA_generator(&A, seed_A);
-    polyvec_cbd_eta(&s, &e, seed_se);
-
-    // 3. 矩陣運算 (NTT Domain)
-    // polyvec_ntt(&s);
-    // polyvec_ntt(&e);
-
-    // 計算 b = A * s + e 
-    // 先計算 A * s 存入 pk->b
-    poly_matrix_vec_mul(&pk->b, &A, &s);
-    
-    // 再加上 e (In-place addition: b = b + e)
-    polyvec_add(&pk->b, &pk->b, &e);
-
-    // 填入 SK
-    sk->s = s;
-}
-
-// PKE Encrypt: 輸入內部 PK，直接輸出序列化的密文 (Bytes)
-void rudraksh_pke_encrypt(public_key *pk, poly *m, uint8_t *r, cipher_text *c)
-{
-    polymat A;
-    polyvec s_prime, e_prime, b_prime;
-    poly e_prime_prime, c_m_hat; 
-
-    // 1. 重建矩陣 A (使用內部 PK 存的 seed)
-    poly_matrixA_generator(&A, pk->seed_A);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_GEN_A);
 
     // 2. 取樣 (使用隨機數 r)
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_SAMPLE);
     polyvec_cbd_eta(&s_prime, &e_prime, r);
     poly_cbd_eta(&e_prime_prime, r, 2 * RUDRAKSH_K); // Nonce offset
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_SAMPLE);
 
-    // 3. NTT 運算
-    // polyvec_ntt(&s_prime);
-
-    // 4. 計算 u (即 b_prime) = A^T * s' + e'
-    poly_matrix_trans_vec_mul(&b_prime, &A, &s_prime);
-    // polyvec_invntt_tomont(&b_prime);
+    // 3. 計算 u (即 b_prime) = A^T * s' + e' (NTT 或 schoolbook，由 autotune 決定)
+    // 回傳時 s' 已轉到 NTT 域，供下面的 b^T * s' 使用
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_MULTIPLY);
+    rudraksh_mul_matvec_trans(b_prime, &A, &s_prime);
     
     // 加誤差 e'
-    polyvec_add(&b_prime, &b_prime, &e_prime);
+    polyvec_add(b_prime, b_prime, &e_prime);
 
-    // 5. 計算 v (即 c_m_hat) = b^T * s' + e'' + Encode(m)
-    poly_vector_vector_mul(&c_m_hat, &pk->b, &s_prime);
-    // poly_invntt(&c_m_hat);
+    // 4. 計算 v (即 c_m_hat) = b^T * s' + e'' + Encode(m)
+    poly_vector_vector_mul_ntt(c_m_hat, b_hat, &s_prime);
+    poly_invntt(c_m_hat);
 
     poly m_encoded;
     poly_encode(&m_encoded, m);
 
     // v = v + e''
-    poly_add(&c_m_hat, &c_m_hat, &e_prime_prime);
+    poly_add(c_m_hat, c_m_hat, &e_prime_prime);
 
     // v = v + Encode(m)
-    poly_add(&c_m_hat, &c_m_hat, &m_encoded);
+    poly_add(c_m_hat, c_m_hat, &m_encoded);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_MULTIPLY);
+}
+
+// 壓縮並寫入 External Ciphertext Bytes
+static void ct_pack(cipher_text *c, const polyvec *u, const poly *v)
+{
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_COMPRESS);
 
-    // 6. 壓縮並寫入 External Ciphertext Bytes
     // u 的部分 (K * N * 10 bits) -> bytes
-    polyvec_compress_u(c->bytes, &b_prime);
+    polyvec_compress_u(c->bytes, u);
 
     // v 的部分 (N * 3 bits) -> bytes (接在 u 後面)
-    poly_compress_v(c->bytes + CRYPTO_CIPHERTEXTBYTES_VEC_U, &c_m_hat);
+    // v 只佔 24 bytes，其餘對齊用的 bytes 必須清零，否則 decaps 比對 c == c* 會失敗
+    memset(c->bytes + CRYPTO_CIPHERTEXTBYTES_VEC_U, 0, CRYPTO_CIPHERTEXTBYTES - CRYPTO_CIPHERTEXTBYTES_VEC_U);
+    poly_compress_v(c->bytes + CRYPTO_CIPHERTEXTBYTES_VEC_U, v);
+    // 對齊區第一個 byte 記錄 profile；其他 profile 的密文在 c == c* 比對時必定不符 (implicit rejection)
+    c->bytes[RUDRAKSH_CT_PROFILE_OFFSET] = RUDRAKSH_PROFILE;
+
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_COMPRESS);
 }
 
-// PKE Decrypt: 輸入 Bytes 密文，內部 SK，輸出內部 Poly m
-void rudraksh_pke_decrypt(cipher_text *c, secret_key *sk, poly *m)
+// PKE Encrypt 核心 (輸出連續的密文 bytes)
+static void pke_encrypt_ntt(const polyvec *b_hat, const uint8_t *seed_A, const poly *m, const uint8_t *r, cipher_text *c)
+{
+    polyvec b_prime;
+    poly c_m_hat;
+
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_ENCRYPT);
+    pke_encrypt_ntt_poly(b_hat, seed_A, m, r, &b_prime, &c_m_hat);
+    ct_pack(c, &b_prime, &c_m_hat);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_ENCRYPT);
+}
+
+// PKE Decrypt 核心: s_hat 為 NTT 域的 s
+static void pke_decrypt_ntt(const cipher_text *c, const polyvec *s_hat, poly *m)
 {
     polyvec u_prime;
     poly v_prime, v_temp;
 
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_DECRYPT);
+
     // 1. 解壓縮 (Unpack Bytes -> Poly)
-    // 從 c->bytes 讀取 u
     polyvec_decompress_u(&u_prime, c->bytes);
-    // 從 c->bytes 偏移處讀取 v
-    poly_decompress_v(&v_prime, c->bytes + CRYPTO_CIPHERTEXTBYTES_VEC_U); //!
+    poly_decompress_v(&v_prime, c->bytes + CRYPTO_CIPHERTEXTBYTES_VEC_U);
 
-    // 2. 運算
-    // polyvec_ntt(&u_prime);
-    poly_vector_vector_mul(&v_temp, &u_prime, &sk->s); // u^T *
-    // poly_invntt(&v_temp);
+    // 2. 運算: s^T * u
+    polyvec_ntt(&u_prime);
+    poly_vector_vector_mul_ntt(&v_temp, &u_prime, s_hat);
+    poly_invntt(&v_temp);
 
     // m'' = v - s^T * u
     poly_sub(&v_temp,&v_prime,&v_temp);
 
     // 3. Decode
     poly_decode(m, &v_temp);
+
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_DECRYPT);
+}
+
+// KEM Encapsulation 核心: pkh = H(pk) (標準格式 pk 的雜湊)，輸出未壓縮的 u, v
+static void kem_encapsulate_ntt_poly(const polyvec *b_hat, const uint8_t *seed_A, const uint8_t *pkh,
+                                     polyvec *u, poly *v, shared_secret *K)
+{
+    poly m = {0};
+    uint8_t msg[RUDRAKSH_len_K] = {0};
+    uint8_t kr[2 * RUDRAKSH_len_K] = {0};
+
+    // 1. 生成隨機訊息 msg
+    rudraksh_randombytes(msg, RUDRAKSH_len_K);
+    arrange_msg(&m, msg); // 轉換為 poly
+
+    // 2. 生成 (K, r)
+    // buffer = pkh || msg
+    uint8_t buf[2 * RUDRAKSH_len_K] = {0};
+    memcpy(buf, pkh, RUDRAKSH_len_K);
+    memcpy(buf + RUDRAKSH_len_K, msg, RUDRAKSH_len_K);
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_HASH_G);
+    rudraksh_hash(kr, buf, 2 * RUDRAKSH_len_K,2*RUDRAKSH_len_K);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_HASH_G);
+
+    // 3. 輸出 Shared Secret K
+    memcpy(K->bytes, kr, RUDRAKSH_len_K);
+
+    // 4. 加密，使用 kr 的後半段作為隨機數 r (壓縮由呼叫端負責)
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_ENCRYPT);
+    pke_encrypt_ntt_poly(b_hat, seed_A, &m, kr + RUDRAKSH_len_K, u, v);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_ENCRYPT);
+}
+
+// KEM Encapsulation 核心 (輸出連續的密文 bytes)
+static void kem_encapsulate_ntt(const polyvec *b_hat, const uint8_t *seed_A, const uint8_t *pkh, cipher_text *c, shared_secret *K)
+{
+    polyvec u;
+    poly v;
+
+    kem_encapsulate_ntt_poly(b_hat, seed_A, pkh, &u, &v, K);
+    ct_pack(c, &u, &v);
+}
+
+// KEM Decapsulation 核心
+static void kem_decapsulate_ntt(const polyvec *s_hat, const polyvec *b_hat, const uint8_t *seed_A,
+                                const uint8_t *pkh, const uint8_t *z, const cipher_text *c, shared_secret *K)
+{
+    poly m_prime = {0};
+    uint8_t msg_prime[RUDRAKSH_len_K] = {0};
+    uint8_t kr_prime[2 * RUDRAKSH_len_K] = {0};
+    uint8_t k_fail[2 * RUDRAKSH_len_K] = {0};
+    cipher_text c_star = {0};
+
+    // 1. 解密 (得到 m')
+    pke_decrypt_ntt(c, s_hat, &m_prime);
+    original_msg(msg_prime, &m_prime); // Poly -> Bytes
+
+    // 2. 重新計算 (K', r')
+    uint8_t buf[2 * RUDRAKSH_len_K] = {0};
+    memcpy(buf, pkh, RUDRAKSH_len_K);
+    memcpy(buf + RUDRAKSH_len_K, msg_prime, RUDRAKSH_len_K);
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_HASH_G);
+    rudraksh_hash(kr_prime, buf, 2 * RUDRAKSH_len_K,2*RUDRAKSH_len_K);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_HASH_G);
+
+    // 3. 重新加密 (得到 c*)
+    poly m_prime_poly;
+    arrange_msg(&m_prime_poly, msg_prime);
+    pke_encrypt_ntt(b_hat, seed_A, &m_prime_poly, kr_prime + RUDRAKSH_len_K, &c_star);
+
+    // 4. 計算失敗時的 Key (K'') = H(c || z)
+    uint8_t fail_input[CRYPTO_CIPHERTEXTBYTES + RUDRAKSH_len_K] = {0};
+    memcpy(fail_input, c->bytes, CRYPTO_CIPHERTEXTBYTES);
+    memcpy(fail_input + CRYPTO_CIPHERTEXTBYTES, z, RUDRAKSH_len_K);
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_HASH_CZ);
+    rudraksh_hash(k_fail, fail_input, sizeof(fail_input),2*RUDRAKSH_len_K);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_HASH_CZ);
+
+    // 5. 驗證 c == c* (Constant Time)
+    // verify 返回 0 代表相等 (成功)，1 代表不等 (失敗)
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_COMPARE);
+    int fail = verify(c->bytes, c_star.bytes, CRYPTO_CIPHERTEXTBYTES);
+
+    // 6. 選擇輸出 Key (Constant Time Select)
+    // 如果 fail=0 (成功)，複製 kr_prime (K')
+    // 如果 fail=1 (失敗)，複製 k_fail (K'')
+    cmov(K->bytes, kr_prime, RUDRAKSH_len_K, (uint8_t)!fail); // 若 !fail 為 1，則搬移 kr_prime
+    cmov(K->bytes, k_fail, RUDRAKSH_len_K, (uint8_t)fail);    // 若 fail 為 1，則搬移 k_fail
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_COMPARE);
+}
+
+// ==========================================================
+// 1. Public Key Encryption (PKE) APIs
+//    核心運算層：處理 Internal Struct <-> Math
+// ==========================================================
+
+// PKE KeyGen 核心: 由 seedbuf = seed_A || seed_se 決定性地生成金鑰
+static void pke_keygen_derand(public_key *pk, secret_key *sk, const uint8_t *seedbuf)
+{
+    // 1. 初始化變數
+    const uint8_t *seed_A = seedbuf;
+    const uint8_t *seed_se = seedbuf + RUDRAKSH_len_K;
+    
+    polymat A;
+    polyvec s, s_hat, e;
+
+    // 保存 seed_A 到內部 PK 結構
+    memcpy(pk->seed_A, seed_A, RUDRAKSH_len_K);
+
+    // 2. 生成矩陣 A 和向量 s, e
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_GEN_A);
+    poly_matrixA_generator(&A, seed_A);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_GEN_A);
+
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_SAMPLE);
+    polyvec_cbd_eta(&s, &e, seed_se);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_SAMPLE);
+
+    // 3. 矩陣運算 (NTT 或 schoolbook，由 autotune 決定)
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_MULTIPLY);
+    s_hat = s; // SK 保存一般域的 s，乘法會就地改寫 s_hat
+
+    // 計算 b = A * s + e 
+    // 先計算 A * s 存入 pk->b
+    rudraksh_mul_matvec(&pk->b, &A, &s_hat);
+    
+    // 再加上 e (In-place addition: b = b + e)
+    polyvec_add(&pk->b, &pk->b, &e);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_MULTIPLY);
+
+    // 填入 SK
+    sk->s = s;
+}
+
+// PKE KeyGen: 生成內部使用的結構 (Unpacked)
+void rudraksh_pke_keygen(public_key *pk, secret_key *sk)
+{
+    uint8_t seedbuf[RUDRAKSH_SEEDBYTES];
+
+    // 亂數生成
+    rudraksh_randombytes(seedbuf, RUDRAKSH_SEEDBYTES);
+    pke_keygen_derand(pk, sk, seedbuf);
+}
+
+// PKE Encrypt: 輸入內部 PK，直接輸出序列化的密文 (Bytes)
+void rudraksh_pke_encrypt(public_key *pk, poly *m, uint8_t *r, cipher_text *c)
+{
+    polyvec b_hat = pk->b;
+    polyvec_ntt(&b_hat);
+    pke_encrypt_ntt(&b_hat, pk->seed_A, m, r, c);
+}
+
+// PKE Decrypt: 輸入 Bytes 密文，內部 SK，輸出內部 Poly m
+void rudraksh_pke_decrypt(cipher_text *c, secret_key *sk, poly *m)
+{
+    polyvec s_hat = sk->s;
+    polyvec_ntt(&s_hat);
+    pke_decrypt_ntt(c, &s_hat, m);
 }
 
 
@@ -159,36 +311,41 @@ void rudraksh_pke_decrypt(cipher_text *c, secret_key *sk, poly *m)
 //    介面層：處理 Pack/Unpack <-> Internal Structs
 // ==========================================================
 
-// KEM KeyGen: 輸出序列化的 Bytes
-void rudraksh_kem_keygen(public_key_bitstream *pkb, secret_key_bitstream *skb)
+// KEM KeyGen (決定性版本): seed = seed_A || seed_se，z 為 decaps 失敗時使用的秘密值
+void rudraksh_kem_keygen_derand(public_key_bitstream *pkb, secret_key_bitstream *skb,
+                                const uint8_t seed[RUDRAKSH_SEEDBYTES], const uint8_t z[RUDRAKSH_len_K])
 {
     // [Internal] 宣告內部運算結構
     public_key pk = {0};
     secret_key sk = {0};
 
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_KEM_KEYGEN);
+
     // 清除記憶體雜訊
     memset(pkb->bytes, 0, CRYPTO_PUBLICKEYBYTES);
     memset(skb->bytes, 0, CRYPTO_SECRETKEYBYTES);
 
     // 1. 執行核心 KeyGen
-    rudraksh_pke_keygen(&pk, &sk);
+    pke_keygen_derand(&pk, &sk, seed);
 
     // 2. 序列化 Public Key (Pack -> pkb->bytes)
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_PACK);
     // b 向量 (13-bit packed)
     polyvec_tobytes_13bit(pkb->bytes, &pk.b);
     // seed_A (直接複製)
     memcpy(pkb->bytes + (CRYPTO_PUBLICKEYBYTES - RUDRAKSH_len_K), pk.seed_A, RUDRAKSH_len_K);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_PACK);
 
     // 3. 準備 Secret Key 的額外資料
     uint8_t pkh[RUDRAKSH_len_K] = {0};
-    uint8_t z[RUDRAKSH_len_K] = {0};
     
     // 計算 H(pk)
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_HASH_PKH);
     rudraksh_hash(pkh, pkb->bytes, CRYPTO_PUBLICKEYBYTES,RUDRAKSH_len_K);
-    // 生成隨機數 z
-    rudraksh_randombytes(z, RUDRAKSH_len_K);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_HASH_PKH);
 
     // 4. 序列化 Secret Key (Pack -> skb->bytes)
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_PACK);
     // 格式: s || pk || pkh || z
     size_t offset = 0;
 
@@ -206,112 +363,592 @@ void rudraksh_kem_keygen(public_key_bitstream *pkb, secret_key_bitstream *skb)
 
     // Copy z
     memcpy(skb->bytes + offset, z, RUDRAKSH_len_K);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_PACK);
 
+    memset(&sk, 0, sizeof(sk));
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_KEM_KEYGEN);
+}
+
+// KEM KeyGen: 輸出序列化的 Bytes
+void rudraksh_kem_keygen(public_key_bitstream *pkb, secret_key_bitstream *skb)
+{
+    uint8_t seedbuf[RUDRAKSH_SEEDBYTES];
+    uint8_t z[RUDRAKSH_len_K];
+
+    // 亂數順序：先 seed_A || seed_se，再 z
+    rudraksh_randombytes(seedbuf, RUDRAKSH_SEEDBYTES);
+    rudraksh_randombytes(z, RUDRAKSH_len_K);
+
+    rudraksh_kem_keygen_derand(pkb, skb, seedbuf, z);
+
+    memset(seedbuf, 0, sizeof(seedbuf));
 }
 
 // KEM Encapsulation: 輸入 PK Bytes, 輸出 CT Bytes 和 Shared Secret Bytes
 void rudraksh_kem_encapsulate(public_key_bitstream *pkb, cipher_text *c, shared_secret *K)
 {
     // [Internal] 宣告內部結構
-    public_key pk = {0};
-    poly m = {0};
-    
-    uint8_t msg[RUDRAKSH_len_K] = {0};
-    uint8_t kr[2 * RUDRAKSH_len_K] = {0};
+    polyvec b_hat;
     uint8_t pkh[RUDRAKSH_len_K] = {0};
 
-    // 1. 反序列化 Public Key (Unpack -> Internal PK)
-    polyvec_frombytes_13bit(&pk.b, pkb->bytes);
-    memcpy(pk.seed_A, pkb->bytes + (CRYPTO_PUBLICKEYBYTES - RUDRAKSH_len_K), RUDRAKSH_len_K);
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_KEM_ENCAPS);
 
-    // 2. 生成隨機訊息 msg
-    rudraksh_randombytes(msg, RUDRAKSH_len_K);
-    arrange_msg(&m, msg); // 轉換為 poly
+    // 1. 反序列化 Public Key (Unpack -> NTT 域 b)
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_UNPACK);
+    polyvec_frombytes_13bit(&b_hat, pkb->bytes);
+    polyvec_ntt(&b_hat);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_UNPACK);
 
-    // 3. 計算 pkh
+    // 2. 計算 pkh
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_HASH_PKH);
     rudraksh_hash(pkh, pkb->bytes, CRYPTO_PUBLICKEYBYTES,RUDRAKSH_len_K);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_HASH_PKH);
 
-    // 4. 生成 (K, r)
-    // buffer = pkh || msg
-    uint8_t buf[2 * RUDRAKSH_len_K] = {0};
-    memcpy(buf, pkh, RUDRAKSH_len_K);
-    memcpy(buf + RUDRAKSH_len_K, msg, RUDRAKSH_len_K);
-    rudraksh_hash(kr, buf, 2 * RUDRAKSH_len_K,2*RUDRAKSH_len_K);
-
-    // 5. 輸出 Shared Secret K
-    memcpy(K->bytes, kr, RUDRAKSH_len_K);
-
-    // 6. 加密 (PKE Encrypt 會自動處理成 c->bytes)
-    // 使用 kr 的後半段作為隨機數 r
-    rudraksh_pke_encrypt(&pk, &m, kr + RUDRAKSH_len_K, c);
+    // 3. 生成 (K, r) 並加密
+    kem_encapsulate_ntt(&b_hat, pkb->bytes + (CRYPTO_PUBLICKEYBYTES - RUDRAKSH_len_K), pkh, c, K);
 
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_KEM_ENCAPS);
 }
 
 // KEM Decapsulation: 輸入 SK Bytes, CT Bytes, 輸出 Shared Secret Bytes
-void rudraksh_kem_decapsulate(secret_key_bitstream *skb, cipher_text *c, shared_secret *K)
+void rudraksh_kem_decapsulate(const secret_key_bitstream *skb, cipher_text *c, shared_secret *K)
 {
     // [Internal] 宣告內部結構
-    secret_key sk = {0};
-    public_key pk = {0};
-    poly m_prime = {0};
-    
-    // 輔助變數
-    uint8_t pkh[RUDRAKSH_len_K] = {0};
-    uint8_t z[RUDRAKSH_len_K] = {0};
-    uint8_t msg_prime[RUDRAKSH_len_K] = {0};
-    uint8_t kr_prime[2 * RUDRAKSH_len_K] = {0};
-    uint8_t k_fail[2 * RUDRAKSH_len_K] = {0};
-    cipher_text c_star = {0};
+    polyvec s_hat, b_hat;
+
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_KEM_DECAPS);
 
-    // 1. 反序列化 Secret Key (Unpack -> Internal SK & PK)
+    // 1. 反序列化 Secret Key (Unpack -> NTT 域 s, b)
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_UNPACK);
     size_t offset = 0;
     
     // Unpack s
-    polyvec_frombytes_13bit(&sk.s, skb->bytes);
+    polyvec_frombytes_13bit(&s_hat, skb->bytes);
+    polyvec_ntt(&s_hat);
     offset += (CRYPTO_SECRETKEYBYTES - CRYPTO_PUBLICKEYBYTES - 2*RUDRAKSH_len_K);
 
     // Unpack pk (從 SK 中還原，用於再加密驗證)
     const uint8_t *pk_bytes_ptr = skb->bytes + offset;
-    polyvec_frombytes_13bit(&pk.b, pk_bytes_ptr);
-    memcpy(pk.seed_A, pk_bytes_ptr + (CRYPTO_PUBLICKEYBYTES - RUDRAKSH_len_K), RUDRAKSH_len_K);
+    polyvec_frombytes_13bit(&b_hat, pk_bytes_ptr);
+    polyvec_ntt(&b_hat);
     offset += CRYPTO_PUBLICKEYBYTES;
 
-    // Copy pkh & z
-    memcpy(pkh, skb->bytes + offset, RUDRAKSH_len_K);
-    offset += RUDRAKSH_len_K;
-    memcpy(z, skb->bytes + offset, RUDRAKSH_len_K);
+    // pkh & z 直接從 SK 讀取
+    const uint8_t *pkh = skb->bytes + offset;
+    const uint8_t *z = pkh + RUDRAKSH_len_K;
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_UNPACK);
 
-    // 2. 解密 (得到 m')
-    rudraksh_pke_decrypt(c, &sk, &m_prime);
-    original_msg(msg_prime, &m_prime); // Poly -> Bytes
+    // 2. 解密、再加密、比較
+    kem_decapsulate_ntt(&s_hat, &b_hat, pk_bytes_ptr + (CRYPTO_PUBLICKEYBYTES - RUDRAKSH_len_K), pkh, z, c, K);
 
-    // 3. 重新計算 (K', r')
-    uint8_t buf[2 * RUDRAKSH_len_K] = {0};
-    memcpy(buf, pkh, RUDRAKSH_len_K);
-    memcpy(buf + RUDRAKSH_len_K, msg_prime, RUDRAKSH_len_K);
-    rudraksh_hash(kr_prime, buf, 2 * RUDRAKSH_len_K,2*RUDRAKSH_len_K);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_KEM_DECAPS);
+}
 
-    // 4. 重新加密 (得到 c*)
-    poly m_prime_poly;
-    arrange_msg(&m_prime_poly, msg_prime);
-    rudraksh_pke_encrypt(&pk, &m_prime_poly, kr_prime + RUDRAKSH_len_K, &c_star);
+// ==========================================================
+// 3. NTT 域金鑰格式 (KEM)
+//    pk: header || b_hat || seedA || pkh
+//    sk: header || s_hat || b_hat || seedA || pkh || z
+//    pkh 仍為標準格式 pk 的雜湊，因此兩種格式可互相 encaps / decaps
+// ==========================================================
 
-    // 5. 計算失敗時的 Key (K'') = H(c || z)
-    uint8_t fail_input[CRYPTO_CIPHERTEXTBYTES + RUDRAKSH_len_K] = {0};
-    memcpy(fail_input, c->bytes, CRYPTO_CIPHERTEXTBYTES);
-    memcpy(fail_input + CRYPTO_CIPHERTEXTBYTES, z, RUDRAKSH_len_K);
-    rudraksh_hash(k_fail, fail_input, sizeof(fail_input),2*RUDRAKSH_len_K);
+// 標準格式 PK -> NTT 域格式 PK
+void rudraksh_pk_to_ntt(public_key_bitstream_ntt *out, const public_key_bitstream *in)
+{
+    polyvec b;
+    uint8_t *p = out->bytes;
 
-    // 6. 驗證 c == c* (Constant Time)
-    // 假設 verify 返回 0 代表相等 (成功)，-1 代表不等 (失敗)
-    int fail = verify(c->bytes, c_star.bytes, CRYPTO_CIPHERTEXTBYTES);
+    *p++ = RUDRAKSH_KEYFMT_NTT;
 
-    // 7. 選擇輸出 Key (Constant Time Select)
-    // 如果 fail=0 (成功)，複製 kr_prime (K')
-    // 如果 fail=-1 (失敗)，複製 k_fail (K'')
-    cmov(K->bytes, kr_prime, RUDRAKSH_len_K, (uint8_t)!fail); // 若 !fail 為 1，則搬移 kr_prime
-    cmov(K->bytes, k_fail, RUDRAKSH_len_K, (uint8_t)fail);    // 若 fail 為 -1 (0xFF)，則搬移 k_fail
-    
-    // 注意：cmov 的實作需確保正確覆蓋。
-    // 簡單邏輯： output = (K' & ~mask) | (K'' & mask)
-}
\ No newline at end of file
+    // b -> b_hat
+    polyvec_frombytes_13bit(&b, in->bytes);
+    polyvec_ntt(&b);
+    polyvec_tobytes_13bit(p, &b);
+    p += CRYPTO_PUBLICKEYBYTES_VECTOR_B;
+
+    // seed_A
+    memcpy(p, in->bytes + CRYPTO_PUBLICKEYBYTES_VECTOR_B, RUDRAKSH_len_K);
+    p += RUDRAKSH_len_K;
+
+    // pkh = H(pk)，encaps 時不必再雜湊 952 bytes
+    rudraksh_hash(p, in->bytes, CRYPTO_PUBLICKEYBYTES, RUDRAKSH_len_K);
+}
+
+// NTT 域格式 PK -> 標準格式 PK
+int rudraksh_pk_from_ntt(public_key_bitstream *out, const public_key_bitstream_ntt *in)
+{
+    polyvec b;
+    const uint8_t *p = in->bytes;
+
+    if (*p++ != RUDRAKSH_KEYFMT_NTT) return -1;
+
+    // b_hat -> b
+    polyvec_frombytes_13bit(&b, p);
+    polyvec_invntt_tomont(&b);
+    polyvec_tobytes_13bit(out->bytes, &b);
+    p += CRYPTO_PUBLICKEYBYTES_VECTOR_B;
+
+    // seed_A
+    memcpy(out->bytes + CRYPTO_PUBLICKEYBYTES_VECTOR_B, p, RUDRAKSH_len_K);
+    return 0;
+}
+
+// 標準格式 SK -> NTT 域格式 SK
+void rudraksh_sk_to_ntt(secret_key_bitstream_ntt *out, const secret_key_bitstream *in)
+{
+    polyvec v;
+    uint8_t *p = out->bytes;
+
+    *p++ = RUDRAKSH_KEYFMT_NTT;
+
+    // s -> s_hat, b -> b_hat (位移與標準格式相同)
+    for (size_t off = 0; off < 2 * CRYPTO_PUBLICKEYBYTES_VECTOR_B; off += CRYPTO_PUBLICKEYBYTES_VECTOR_B) {
+        polyvec_frombytes_13bit(&v, in->bytes + off);
+        polyvec_ntt(&v);
+        polyvec_tobytes_13bit(p + off, &v);
+    }
+
+    // seed_A || pkh || z
+    memcpy(p + 2 * CRYPTO_PUBLICKEYBYTES_VECTOR_B, in->bytes + 2 * CRYPTO_PUBLICKEYBYTES_VECTOR_B, 3 * RUDRAKSH_len_K);
+}
+
+// NTT 域格式 SK -> 標準格式 SK
+int rudraksh_sk_from_ntt(secret_key_bitstream *out, const secret_key_bitstream_ntt *in)
+{
+    polyvec v;
+    const uint8_t *p = in->bytes;
+
+    if (*p++ != RUDRAKSH_KEYFMT_NTT) return -1;
+
+    for (size_t off = 0; off < 2 * CRYPTO_PUBLICKEYBYTES_VECTOR_B; off += CRYPTO_PUBLICKEYBYTES_VECTOR_B) {
+        polyvec_frombytes_13bit(&v, p + off);
+        polyvec_invntt_tomont(&v);
+        polyvec_tobytes_13bit(out->bytes + off, &v);
+    }
+
+    memcpy(out->bytes + 2 * CRYPTO_PUBLICKEYBYTES_VECTOR_B, p + 2 * CRYPTO_PUBLICKEYBYTES_VECTOR_B, 3 * RUDRAKSH_len_K);
+    return 0;
+}
+
+// KEM KeyGen (NTT 域格式)
+void rudraksh_kem_keygen_ntt(public_key_bitstream_ntt *pkb, secret_key_bitstream_ntt *skb)
+{
+    public_key_bitstream pk_std;
+    secret_key_bitstream sk_std;
+
+    rudraksh_kem_keygen(&pk_std, &sk_std);
+    rudraksh_pk_to_ntt(pkb, &pk_std);
+    rudraksh_sk_to_ntt(skb, &sk_std);
+
+    memset(&sk_std, 0, sizeof(sk_std));
+}
+
+// KEM Encapsulation (NTT 域格式): 不需正向 NTT，也不需雜湊 pk
+int rudraksh_kem_encapsulate_ntt(const public_key_bitstream_ntt *pkb, cipher_text *c, shared_secret *K)
+{
+    polyvec b_hat;
+    const uint8_t *p = pkb->bytes;
+
+    if (*p++ != RUDRAKSH_KEYFMT_NTT) return -1;
+
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_KEM_ENCAPS);
+
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_UNPACK);
+    polyvec_frombytes_13bit(&b_hat, p);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_UNPACK);
+
+    kem_encapsulate_ntt(&b_hat, p + CRYPTO_PUBLICKEYBYTES_VECTOR_B,
+                        p + CRYPTO_PUBLICKEYBYTES, c, K);
+
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_KEM_ENCAPS);
+    return 0;
+}
+
+// NTT 域私鑰 (不含 header) 的 decaps 本體，由 ntt / seed 兩種格式共用
+// 不含 KEM_DECAPS 區段，由呼叫端標記，避免 seed 格式產生巢狀的頂層事件
+static void sk_ntt_decapsulate(const uint8_t *p, cipher_text *c, shared_secret *K)
+{
+    polyvec s_hat, b_hat;
+
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_UNPACK);
+    polyvec_frombytes_13bit(&s_hat, p);
+    p += CRYPTO_SECRETKEYBYTES_PKE;
+    polyvec_frombytes_13bit(&b_hat, p);
+
+    // p 指向 b_hat，之後為 seed_A || pkh || z
+    const uint8_t *seed_A = p + CRYPTO_PUBLICKEYBYTES_VECTOR_B;
+    const uint8_t *pkh = seed_A + RUDRAKSH_len_K;
+    const uint8_t *z = pkh + RUDRAKSH_len_K;
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_UNPACK);
+
+    kem_decapsulate_ntt(&s_hat, &b_hat, seed_A, pkh, z, c, K);
+}
+
+// KEM Decapsulation (NTT 域格式)
+int rudraksh_kem_decapsulate_ntt(const secret_key_bitstream_ntt *skb, cipher_text *c, shared_secret *K)
+{
+    if (skb->bytes[0] != RUDRAKSH_KEYFMT_NTT) return -1;
+
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_KEM_DECAPS);
+    sk_ntt_decapsulate(skb->bytes + RUDRAKSH_KEYFMT_HEADERBYTES, c, K);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_KEM_DECAPS);
+    return 0;
+}
+
+
+// ==========================================================
+// 4. 精簡私鑰格式 (KEM)
+//    packed : header || s(3-bit) || pk || pkh || z           (1201 bytes)
+//    seed   : header || seed_A || seed_se                    (33 bytes)
+//    seed 格式的 z = H(seed || RUDRAKSH_KEYFMT_SEED)，載入時重新生成 s, b, pkh
+// ==========================================================
+
+// 標準格式 SK -> 3-bit 打包格式 SK
+// s 有係數超出 [-2, 2] 時回傳 -1，out 清為零 (header 非 packed，之後載入也會被拒絕)
+int rudraksh_sk_to_packed(secret_key_bitstream_packed *out, const secret_key_bitstream *in)
+{
+    polyvec s;
+    uint8_t *p = out->bytes;
+
+    *p++ = RUDRAKSH_KEYFMT_PACKED;
+
+    polyvec_frombytes_13bit(&s, in->bytes);
+    if (polyvec_tobytes_3bit(p, &s) != 0) {
+        memset(&s, 0, sizeof(s));
+        memset(out, 0, sizeof(*out));
+        return -1;
+    }
+    p += CRYPTO_SECRETKEYBYTES_S_3BIT;
+
+    // pk || pkh || z
+    memcpy(p, in->bytes + CRYPTO_SECRETKEYBYTES_PKE, CRYPTO_PUBLICKEYBYTES + 2 * RUDRAKSH_len_K);
+
+    memset(&s, 0, sizeof(s));
+    return 0;
+}
+
+// 3-bit 打包格式 SK -> 標準格式 SK
+int rudraksh_sk_from_packed(secret_key_bitstream *out, const secret_key_bitstream_packed *in)
+{
+    polyvec s;
+    const uint8_t *p = in->bytes;
+
+    if (*p++ != RUDRAKSH_KEYFMT_PACKED) return -1;
+
+    if (polyvec_frombytes_3bit(&s, p) != 0) {
+        memset(&s, 0, sizeof(s));
+        return -1;
+    }
+    polyvec_tobytes_13bit(out->bytes, &s);
+    p += CRYPTO_SECRETKEYBYTES_S_3BIT;
+
+    memcpy(out->bytes + CRYPTO_SECRETKEYBYTES_PKE, p, CRYPTO_PUBLICKEYBYTES + 2 * RUDRAKSH_len_K);
+
+    memset(&s, 0, sizeof(s));
+    return 0;
+}
+
+// KEM Decapsulation (3-bit 打包格式): 直接解包 s，不經過標準格式
+int rudraksh_kem_decapsulate_packed(const secret_key_bitstream_packed *skb, cipher_text *c, shared_secret *K)
+{
+    polyvec s_hat, b_hat;
+    const uint8_t *p = skb->bytes;
+
+    if (*p++ != RUDRAKSH_KEYFMT_PACKED) return -1;
+
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_KEM_DECAPS);
+
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_UNPACK);
+    if (polyvec_frombytes_3bit(&s_hat, p) != 0) {
+        memset(&s_hat, 0, sizeof(s_hat));
+        RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_UNPACK);
+        RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_KEM_DECAPS);
+        return -1;
+    }
+    polyvec_ntt(&s_hat);
+    p += CRYPTO_SECRETKEYBYTES_S_3BIT;
+
+    // p 指向 pk = b || seed_A，之後為 pkh || z
+    polyvec_frombytes_13bit(&b_hat, p);
+    polyvec_ntt(&b_hat);
+
+    const uint8_t *seed_A = p + CRYPTO_PUBLICKEYBYTES_VECTOR_B;
+    const uint8_t *pkh = p + CRYPTO_PUBLICKEYBYTES;
+    const uint8_t *z = pkh + RUDRAKSH_len_K;
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_UNPACK);
+
+    kem_decapsulate_ntt(&s_hat, &b_hat, seed_A, pkh, z, c, K);
+
+    memset(&s_hat, 0, sizeof(s_hat));
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_KEM_DECAPS);
+    return 0;
+}
+
+// seed 格式的 z: 由種子衍生，讓 33 bytes 即可還原完整私鑰
+static void seed_derive_z(uint8_t z[RUDRAKSH_len_K], const uint8_t *seed)
+{
+    uint8_t buf[RUDRAKSH_SEEDBYTES + 1];
+    memcpy(buf, seed, RUDRAKSH_SEEDBYTES);
+    buf[RUDRAKSH_SEEDBYTES] = RUDRAKSH_KEYFMT_SEED; // domain separation
+    rudraksh_hash(z, buf, sizeof(buf), RUDRAKSH_len_K);
+    memset(buf, 0, sizeof(buf));
+}
+
+// KEM KeyGen (seed 格式): pkb 為標準格式，供 encaps 端使用
+void rudraksh_kem_keygen_seed(public_key_bitstream *pkb, secret_key_bitstream_seed *skb)
+{
+    secret_key_bitstream sk_std;
+
+    skb->bytes[0] = RUDRAKSH_KEYFMT_SEED;
+    rudraksh_randombytes(skb->bytes + RUDRAKSH_KEYFMT_HEADERBYTES, RUDRAKSH_SEEDBYTES);
+
+    // 生成 pk (sk_std 丟棄，需要時再由 seed 重建)
+    rudraksh_sk_from_seed(&sk_std, pkb, skb);
+    memset(&sk_std, 0, sizeof(sk_std));
+}
+
+// seed 格式 SK -> 標準格式 SK (重新生成 s, b, pkh, z)，pk_out 可為 NULL
+int rudraksh_sk_from_seed(secret_key_bitstream *out, public_key_bitstream *pk_out, const secret_key_bitstream_seed *in)
+{
+    public_key_bitstream pk_tmp;
+    uint8_t z[RUDRAKSH_len_K];
+    const uint8_t *seed = in->bytes + RUDRAKSH_KEYFMT_HEADERBYTES;
+
+    if (in->bytes[0] != RUDRAKSH_KEYFMT_SEED) return -1;
+
+    seed_derive_z(z, seed);
+    rudraksh_kem_keygen_derand(pk_out ? pk_out : &pk_tmp, out, seed, z);
+
+    memset(z, 0, sizeof(z));
+    return 0;
+}
+
+// seed -> NTT 域格式 SK (快取內存放 NTT 域格式，命中時 decaps 不需 keygen 也不需正向 NTT)
+static void seed_expand_ntt(secret_key_bitstream_ntt *out, const secret_key_bitstream_seed *in)
+{
+    secret_key_bitstream sk_std;
+
+    rudraksh_sk_from_seed(&sk_std, NULL, in);
+    rudraksh_sk_to_ntt(out, &sk_std);
+    memset(&sk_std, 0, sizeof(sk_std));
+}
+
+// 快取初始化：entries 由呼叫端配置 (n_entries 筆)
+void rudraksh_sk_cache_init(rudraksh_sk_cache *cache, rudraksh_sk_cache_entry *entries, size_t n_entries)
+{
+    cache->entries = entries;
+    cache->n_entries = n_entries;
+    cache->hits = 0;
+    cache->misses = 0;
+    memset(entries, 0, n_entries * sizeof(rudraksh_sk_cache_entry));
+}
+
+// 清除快取內容 (展開後的私鑰為秘密資料)
+void rudraksh_sk_cache_clear(rudraksh_sk_cache *cache)
+{
+    memset(cache->entries, 0, cache->n_entries * sizeof(rudraksh_sk_cache_entry));
+}
+
+// 直接映射 (direct-mapped)：槽位 = H(seed) mod n，避免直接以秘密種子的位元做索引
+static rudraksh_sk_cache_entry *sk_cache_lookup(rudraksh_sk_cache *cache, const secret_key_bitstream_seed *in)
+{
+    uint8_t h[8];
+    uint64_t idx = 0;
+
+    rudraksh_hash(h, in->bytes, CRYPTO_SECRETKEYBYTES_SEED, sizeof(h));
+    for (int i = 0; i < 8; i++) idx |= (uint64_t)h[i] << (8 * i);
+
+    rudraksh_sk_cache_entry *e = &cache->entries[idx % cache->n_entries];
+
+    if (e->valid && verify(e->seed, in->bytes + RUDRAKSH_KEYFMT_HEADERBYTES, RUDRAKSH_SEEDBYTES) == 0) {
+        cache->hits++;
+        return e;
+    }
+
+    // 未命中：展開並覆蓋此槽位
+    cache->misses++;
+    seed_expand_ntt(&e->sk, in);
+    memcpy(e->seed, in->bytes + RUDRAKSH_KEYFMT_HEADERBYTES, RUDRAKSH_SEEDBYTES);
+    e->valid = 1;
+    return e;
+}
+
+// KEM Decapsulation (seed 格式): cache 可為 NULL (每次皆重新生成)
+int rudraksh_kem_decapsulate_seed(const secret_key_bitstream_seed *skb, cipher_text *c, shared_secret *K, rudraksh_sk_cache *cache)
+{
+    secret_key_bitstream_ntt sk_ntt;
+
+    if (skb->bytes[0] != RUDRAKSH_KEYFMT_SEED) return -1;
+
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_KEM_DECAPS);
+
+    if (cache != NULL && cache->n_entries > 0) {
+        sk_ntt_decapsulate(sk_cache_lookup(cache, skb)->sk.bytes + RUDRAKSH_KEYFMT_HEADERBYTES, c, K);
+    } else {
+        seed_expand_ntt(&sk_ntt, skb);
+        sk_ntt_decapsulate(sk_ntt.bytes + RUDRAKSH_KEYFMT_HEADERBYTES, c, K);
+        memset(&sk_ntt, 0, sizeof(sk_ntt));
+    }
+
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_KEM_DECAPS);
+    return 0;
+}
+
+
+// ==========================================================
+// 5. Scatter / Gather 密文 I/O (KEM)
+//    密文依序寫入 / 讀自 iov[0..iovcnt-1]，總長度須 >= 760 bytes (多餘部分不動)
+// ==========================================================
+
+#define CT_U_POLY_BYTES (CRYPTO_CIPHERTEXTBYTES_VEC_U / RUDRAKSH_K) // 80 bytes = 64*10 bits
+#define CT_V_BYTES 24                                               // 24 bytes = 64*3 bits
+
+// iov 游標
+typedef struct {
+    const rudraksh_iovec *iov;
+    size_t iovcnt;
+    size_t idx;     // 目前的 segment
+    size_t off;     // segment 內的位移
+} iov_cursor;
+
+static size_t iov_total(const rudraksh_iovec *iov, size_t iovcnt)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < iovcnt; i++) total += iov[i].iov_len;
+    return total;
+}
+
+// 跳過已寫滿 / 長度為 0 的 segment
+static void iov_skip_full(iov_cursor *cur)
+{
+    while (cur->idx < cur->iovcnt && cur->off == cur->iov[cur->idx].iov_len) {
+        cur->idx++;
+        cur->off = 0;
+    }
+}
+
+// 若目前 segment 剩餘空間 >= len，回傳可直接寫入的位置並前進；否則回傳 NULL (游標不動)
+static uint8_t *iov_reserve(iov_cursor *cur, size_t len)
+{
+    iov_skip_full(cur);
+    if (cur->idx == cur->iovcnt || cur->iov[cur->idx].iov_len - cur->off < len) return NULL;
+
+    uint8_t *p = (uint8_t *)cur->iov[cur->idx].iov_base + cur->off;
+    cur->off += len;
+    return p;
+}
+
+// 跨 segment 分段複製 (src 為 NULL 時寫入 0)
+static void iov_write(iov_cursor *cur, const uint8_t *src, size_t len)
+{
+    while (len > 0) {
+        iov_skip_full(cur);
+        size_t n = cur->iov[cur->idx].iov_len - cur->off;
+        if (n > len) n = len;
+
+        uint8_t *dst = (uint8_t *)cur->iov[cur->idx].iov_base + cur->off;
+        if (src) {
+            memcpy(dst, src, n);
+            src += n;
+        } else {
+            memset(dst, 0, n);
+        }
+        cur->off += n;
+        len -= n;
+    }
+}
+
+static void iov_read(iov_cursor *cur, uint8_t *dst, size_t len)
+{
+    while (len > 0) {
+        iov_skip_full(cur);
+        size_t n = cur->iov[cur->idx].iov_len - cur->off;
+        if (n > len) n = len;
+
+        memcpy(dst, (const uint8_t *)cur->iov[cur->idx].iov_base + cur->off, n);
+        cur->off += n;
+        dst += n;
+        len -= n;
+    }
+}
+
+// 壓縮並寫入 iov：每個多項式若落在同一個 segment 內就直接壓縮到 segment 上 (zero-copy)，
+// 跨 segment 的才經由暫存區分段複製
+static void ct_pack_iov(iov_cursor *cur, const polyvec *u, const poly *v)
+{
+    uint8_t tmp[CT_U_POLY_BYTES];
+    uint8_t *p;
+
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_COMPRESS);
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        if ((p = iov_reserve(cur, sizeof(tmp))) != NULL) {
+            poly_compress_u(p, &u->vec[i]);
+        } else {
+            poly_compress_u(tmp, &u->vec[i]);
+            iov_write(cur, tmp, sizeof(tmp));
+        }
+    }
+
+    if ((p = iov_reserve(cur, CT_V_BYTES)) != NULL) {
+        poly_compress_v(p, v);
+    } else {
+        poly_compress_v(tmp, v);
+        iov_write(cur, tmp, CT_V_BYTES);
+    }
+
+    // 對齊區: profile byte，其餘清零
+    const uint8_t profile = RUDRAKSH_PROFILE;
+    iov_write(cur, &profile, 1);
+    iov_write(cur, NULL, CRYPTO_CIPHERTEXTBYTES - RUDRAKSH_CT_PROFILE_OFFSET - 1);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_COMPRESS);
+}
+
+// KEM Encapsulation: 密文直接寫入呼叫端的 iov segments
+int rudraksh_kem_encapsulate_iov(const public_key_bitstream *pkb, const rudraksh_iovec *iov, size_t iovcnt, shared_secret *K)
+{
+    polyvec b_hat, u;
+    poly v;
+    uint8_t pkh[RUDRAKSH_len_K];
+    iov_cursor cur = { iov, iovcnt, 0, 0 };
+
+    if (iov_total(iov, iovcnt) < CRYPTO_CIPHERTEXTBYTES) return -1;
+
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_KEM_ENCAPS);
+
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_UNPACK);
+    polyvec_frombytes_13bit(&b_hat, pkb->bytes);
+    polyvec_ntt(&b_hat);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_UNPACK);
+
+    RUDRAKSH_TRACE_BEGIN(RUDRAKSH_TRACE_HASH_PKH);
+    rudraksh_hash(pkh, pkb->bytes, CRYPTO_PUBLICKEYBYTES, RUDRAKSH_len_K);
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_HASH_PKH);
+
+    kem_encapsulate_ntt_poly(&b_hat, pkb->bytes + CRYPTO_PUBLICKEYBYTES_VECTOR_B, pkh, &u, &v, K);
+    ct_pack_iov(&cur, &u, &v);
+
+    RUDRAKSH_TRACE_END(RUDRAKSH_TRACE_KEM_ENCAPS);
+    return 0;
+}
+
+// KEM Decapsulation: 密文讀自非連續的 iov segments
+// decaps 需對完整密文做 c == c* 比對與 H(c || z)，因此先收集成連續的 760 bytes
+int rudraksh_kem_decapsulate_iov(const secret_key_bitstream *skb, const rudraksh_iovec *iov, size_t iovcnt, shared_secret *K)
+{
+    cipher_text c;
+    iov_cursor cur = { iov, iovcnt, 0, 0 };
+
+    if (iov_total(iov, iovcnt) < CRYPTO_CIPHERTEXTBYTES) return -1;
+
+    iov_read(&cur, c.bytes, CRYPTO_CIPHERTEXTBYTES);
+    rudraksh_kem_decapsulate(skb, &c, K);
+    return 0;
+}
+
+// ==========================================================
+// 對稱式 profile
+// ==========================================================
+
+uint8_t rudraksh_ct_profile(const cipher_text *c)
+{
+    return c->bytes[RUDRAKSH_CT_PROFILE_OFFSET];
+}
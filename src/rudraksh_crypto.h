@@ -28,6 +28,46 @@ typedef struct {
     uint8_t bytes[RUDRAKSH_len_K];
 } shared_secret;
 
+// NTT 域金鑰格式 (header || b_hat || seedA || pkh)
+typedef struct {
+    uint8_t bytes[CRYPTO_PUBLICKEYBYTES_NTT];
+} public_key_bitstream_ntt;
+
+// NTT 域金鑰格式 (header || s_hat || b_hat || seedA || pkh || z)
+typedef struct {
+    uint8_t bytes[CRYPTO_SECRETKEYBYTES_NTT];
+} secret_key_bitstream_ntt;
+
+// 精簡私鑰格式 (header || s(3-bit) || pk || pkh || z)
+typedef struct {
+    uint8_t bytes[CRYPTO_SECRETKEYBYTES_PACKED];
+} secret_key_bitstream_packed;
+
+// 精簡私鑰格式 (header || seedA || seed_se)
+typedef struct {
+    uint8_t bytes[CRYPTO_SECRETKEYBYTES_SEED];
+} secret_key_bitstream_seed;
+
+// seed 格式展開金鑰快取 (direct-mapped，entries 由呼叫端配置)
+typedef struct {
+    uint8_t valid;
+    uint8_t seed[RUDRAKSH_SEEDBYTES];
+    secret_key_bitstream_ntt sk;       // 展開後以 NTT 域格式保存
+} rudraksh_sk_cache_entry;
+
+typedef struct {
+    rudraksh_sk_cache_entry *entries;
+    size_t n_entries;
+    uint64_t hits;
+    uint64_t misses;
+} rudraksh_sk_cache;
+
+// Scatter / Gather 用的 segment (欄位與 POSIX struct iovec 相同)
+typedef struct {
+    void *iov_base;
+    size_t iov_len;
+} rudraksh_iovec;
+
 // ==========================================
 // 2. Internal / Unpacked (運算用，int16_t)
 // ==========================================
@@ -55,10 +95,62 @@ void rudraksh_pke_decrypt(cipher_text *c, secret_key *sk, poly *m);
 // ==========================================================
 // KEM KeyGen
 void rudraksh_kem_keygen(public_key_bitstream *pkb, secret_key_bitstream *skb);
+// KEM KeyGen (決定性版本，seed = seedA || seed_se)
+void rudraksh_kem_keygen_derand(public_key_bitstream *pkb, secret_key_bitstream *skb,
+                                const uint8_t seed[RUDRAKSH_SEEDBYTES], const uint8_t z[RUDRAKSH_len_K]);
 // KEM Encapsulation
 void rudraksh_kem_encapsulate(public_key_bitstream *pkb, cipher_text *c, shared_secret *K);
 // KEM Decapsulation
-void rudraksh_kem_decapsulate(secret_key_bitstream *skb, cipher_text *c, shared_secret *K);    
+void rudraksh_kem_decapsulate(const secret_key_bitstream *skb, cipher_text *c, shared_secret *K);    
+
+// ==========================================================
+// 3. NTT 域金鑰格式 (KEM)
+//    與標準格式產生相同的密文與共享金鑰，僅儲存方式不同
+//    回傳值：0 代表成功，-1 代表格式版本不符
+// ==========================================================
+void rudraksh_kem_keygen_ntt(public_key_bitstream_ntt *pkb, secret_key_bitstream_ntt *skb);
+int rudraksh_kem_encapsulate_ntt(const public_key_bitstream_ntt *pkb, cipher_text *c, shared_secret *K);
+int rudraksh_kem_decapsulate_ntt(const secret_key_bitstream_ntt *skb, cipher_text *c, shared_secret *K);
+
+// 標準格式 <-> NTT 域格式 轉換
+void rudraksh_pk_to_ntt(public_key_bitstream_ntt *out, const public_key_bitstream *in);
+int rudraksh_pk_from_ntt(public_key_bitstream *out, const public_key_bitstream_ntt *in);
+void rudraksh_sk_to_ntt(secret_key_bitstream_ntt *out, const secret_key_bitstream *in);
+int rudraksh_sk_from_ntt(secret_key_bitstream *out, const secret_key_bitstream_ntt *in);
+
+// ==========================================================
+// 4. 精簡私鑰格式 (KEM)
+//    packed: s 以 3-bit 打包 (1201 bytes)
+//    seed  : 只存 32 bytes 種子，載入時重新生成 s, b, pkh (33 bytes)
+//    回傳值：0 代表成功，-1 代表格式版本不符 (packed 另含 s 的係數 / 3-bit 欄位超出 [-2, 2])
+// ==========================================================
+int rudraksh_sk_to_packed(secret_key_bitstream_packed *out, const secret_key_bitstream *in);
+int rudraksh_sk_from_packed(secret_key_bitstream *out, const secret_key_bitstream_packed *in);
+int rudraksh_kem_decapsulate_packed(const secret_key_bitstream_packed *skb, cipher_text *c, shared_secret *K);
+
+// seed 格式只能由 keygen_seed 產生 (標準格式私鑰不保留種子)
+void rudraksh_kem_keygen_seed(public_key_bitstream *pkb, secret_key_bitstream_seed *skb);
+int rudraksh_sk_from_seed(secret_key_bitstream *out, public_key_bitstream *pk_out, const secret_key_bitstream_seed *in);
+int rudraksh_kem_decapsulate_seed(const secret_key_bitstream_seed *skb, cipher_text *c, shared_secret *K, rudraksh_sk_cache *cache);
+
+// 展開金鑰快取 (cache 傳 NULL 則每次 decaps 皆重新生成)
+void rudraksh_sk_cache_init(rudraksh_sk_cache *cache, rudraksh_sk_cache_entry *entries, size_t n_entries);
+void rudraksh_sk_cache_clear(rudraksh_sk_cache *cache);
+
+// ==========================================================
+// 5. Scatter / Gather 密文 I/O (KEM)
+//    密文直接寫入 / 讀自呼叫端的 segments (例如協定封包中的某個位移)
+//    回傳值：0 代表成功，-1 代表 segments 總長度不足 760 bytes
+// ==========================================================
+int rudraksh_kem_encapsulate_iov(const public_key_bitstream *pkb, const rudraksh_iovec *iov, size_t iovcnt, shared_secret *K);
+int rudraksh_kem_decapsulate_iov(const secret_key_bitstream *skb, const rudraksh_iovec *iov, size_t iovcnt, shared_secret *K);
+
+// ==========================================================
+// 6. 對稱式 profile
+//    帶 header 的金鑰格式在載入時即拒絕其他 profile；密文以對齊區的 profile byte 標示
+//    decaps 遇到其他 profile 的密文會走 implicit rejection，需明確判斷時先比對此值與 RUDRAKSH_PROFILE
+// ==========================================================
+uint8_t rudraksh_ct_profile(const cipher_text *c);
 
 
 
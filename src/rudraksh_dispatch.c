@@ -0,0 +1,300 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rudraksh_dispatch.h"
+#include "rudraksh_params.h"
+#include "ascon/permutations.h"
+
+#if defined(__GNUC__) && !defined(__clang__) && (defined(__x86_64__) || defined(__i386__)) && !defined(RUDRAKSH_NO_SIMD)
+#define RUDRAKSH_HAVE_ISA_VARIANTS 1
+#endif
+
+// SWAR 變體需要原生 64-bit 整數運算
+#if UINTPTR_MAX > 0xFFFFFFFFu
+#define RUDRAKSH_HAVE_SWAR 1
+#endif
+
+// ==========================================================
+// 1. 各 ISA 變體 (同一份原始碼重複 include)
+// ==========================================================
+
+// scalar 參考實作：關閉自動向量化
+#ifdef RUDRAKSH_HAVE_ISA_VARIANTS
+#pragma GCC push_options
+#pragma GCC optimize("no-tree-vectorize")
+#endif
+#define RUDRAKSH_KERN_SUFFIX scalar
+#define RUDRAKSH_KERN_NAME "scalar"
+#include "rudraksh_kernels_impl.h"
+#ifdef RUDRAKSH_HAVE_ISA_VARIANTS
+#pragma GCC pop_options
+#endif
+
+// SWAR：其餘 kernel 沿用 scalar 版，只替換多項式算術 (rudraksh_swar.c)
+#ifdef RUDRAKSH_HAVE_SWAR
+static const rudraksh_kernels kernels_swar = {
+    "swar",
+    ntt_scalar,
+    invntt_scalar,
+    basemul_acc_scalar,
+    ntt_fm_scalar,
+    invntt_fm_scalar,
+    gemv_fm_scalar,
+    gemv_t_fm_scalar,
+    ascon_p12_scalar,
+    ascon_p8_scalar,
+    cbd_eta_scalar,
+    compress_u_scalar,
+    tobytes_13bit_scalar,
+    poly_add_swar,
+    poly_sub_swar,
+    poly_encode_swar,
+    poly_decode_swar,
+    poly_basemul_dot_swar,
+};
+#endif
+
+#ifdef RUDRAKSH_HAVE_ISA_VARIANTS
+
+// 位元打包 (compress_u / tobytes_13bit) 經自動向量化後反而慢約 25%，向量變體一律沿用 scalar 版
+#pragma GCC push_options
+#pragma GCC target("sse4.2")
+#define RUDRAKSH_KERN_SUFFIX sse4
+#define RUDRAKSH_KERN_NAME "sse4"
+#define RUDRAKSH_KERN_PACK_SUFFIX scalar
+#include "rudraksh_kernels_impl.h"
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2,bmi2")
+#define RUDRAKSH_KERN_SUFFIX avx2
+#define RUDRAKSH_KERN_NAME "avx2"
+#define RUDRAKSH_KERN_PACK_SUFFIX scalar
+#include "rudraksh_kernels_impl.h"
+#pragma GCC pop_options
+
+// 以 AVX-512 編譯的 Ascon 置換 (64-bit 旋轉被搬進向量暫存器) 實測約慢 2 倍，沿用 AVX2 版
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512bw,avx512vl,bmi2")
+#define RUDRAKSH_KERN_SUFFIX avx512
+#define RUDRAKSH_KERN_NAME "avx512"
+#define RUDRAKSH_KERN_ASCON_SUFFIX avx2
+#define RUDRAKSH_KERN_PACK_SUFFIX scalar
+#include "rudraksh_kernels_impl.h"
+#pragma GCC pop_options
+
+#endif
+
+// 由慢到快排列；自動選擇時取最後一個 CPU 支援的變體 (swar 只在沒有向量變體可用時被選到)
+static const rudraksh_kernels *const VARIANTS[] = {
+    &kernels_scalar,
+#ifdef RUDRAKSH_HAVE_SWAR
+    &kernels_swar,
+#endif
+#ifdef RUDRAKSH_HAVE_ISA_VARIANTS
+    &kernels_sse4,
+    &kernels_avx2,
+    &kernels_avx512,
+#endif
+};
+#define N_VARIANTS (sizeof(VARIANTS) / sizeof(VARIANTS[0]))
+
+// ==========================================================
+// 2. 變體選擇
+// ==========================================================
+
+size_t rudraksh_kernels_count(void) {
+    return N_VARIANTS;
+}
+
+const rudraksh_kernels *rudraksh_kernels_variant(size_t i) {
+    return i < N_VARIANTS ? VARIANTS[i] : NULL;
+}
+
+int rudraksh_kernels_supported(const rudraksh_kernels *k) {
+    if (k == &kernels_scalar) return 1;
+#ifdef RUDRAKSH_HAVE_SWAR
+    if (k == &kernels_swar) return 1;
+#endif
+#ifdef RUDRAKSH_HAVE_ISA_VARIANTS
+    __builtin_cpu_init();
+    if (k == &kernels_sse4) return __builtin_cpu_supports("sse4.2") != 0;
+    if (k == &kernels_avx2) return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2");
+    if (k == &kernels_avx512) {
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+               __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("bmi2");
+    }
+#endif
+    return 0;
+}
+
+static const rudraksh_kernels *find_variant(const char *name) {
+    for (size_t i = 0; i < N_VARIANTS; i++) {
+        if (strcmp(VARIANTS[i]->name, name) == 0) return VARIANTS[i];
+    }
+    return NULL;
+}
+
+// 環境變數指定且 CPU 支援時優先，否則取最快的可用變體
+static const rudraksh_kernels *auto_select(void) {
+    const char *env = getenv(RUDRAKSH_KERNELS_ENV);
+    if (env != NULL && env[0] != '\0') {
+        const rudraksh_kernels *k = find_variant(env);
+        if (k != NULL && rudraksh_kernels_supported(k)) return k;
+    }
+    for (size_t i = N_VARIANTS; i-- > 1;) {
+        if (rudraksh_kernels_supported(VARIANTS[i])) return VARIANTS[i];
+    }
+    return &kernels_scalar;
+}
+
+// 多個執行緒同時初始化時算出的結果相同，只需保證指標的讀寫是 atomic
+static const rudraksh_kernels *active_kernels = NULL;
+
+#if defined(__GNUC__)
+#define LOAD_ACTIVE() __atomic_load_n(&active_kernels, __ATOMIC_ACQUIRE)
+#define STORE_ACTIVE(k) __atomic_store_n(&active_kernels, (k), __ATOMIC_RELEASE)
+#else
+#define LOAD_ACTIVE() (active_kernels)
+#define STORE_ACTIVE(k) (active_kernels = (k))
+#endif
+
+const rudraksh_kernels *rudraksh_kernels_active(void) {
+    const rudraksh_kernels *k = LOAD_ACTIVE();
+    if (k == NULL) {
+        k = auto_select();
+        STORE_ACTIVE(k);
+    }
+    return k;
+}
+
+int rudraksh_kernels_select(const char *name) {
+    if (name == NULL) {
+        STORE_ACTIVE(auto_select());
+        return 0;
+    }
+    const rudraksh_kernels *k = find_variant(name);
+    if (k == NULL || !rudraksh_kernels_supported(k)) return -1;
+    STORE_ACTIVE(k);
+    return 0;
+}
+
+// ==========================================================
+// 3. Self-test (對照 scalar 參考實作)
+// ==========================================================
+
+#define SELFTEST_ROUNDS 64
+
+static uint32_t selftest_next(uint32_t *x) {
+    // xorshift32：只需可重現的測試輸入
+    *x ^= *x << 13;
+    *x ^= *x >> 17;
+    *x ^= *x << 5;
+    return *x;
+}
+
+static void selftest_poly(poly *p, uint32_t *x) {
+    for (int i = 0; i < RUDRAKSH_N; i++) p->coeffs[i] = (int16_t)(selftest_next(x) % RUDRAKSH_Q);
+}
+
+int rudraksh_kernels_selftest(const rudraksh_kernels *k) {
+    const rudraksh_kernels *ref = &kernels_scalar;
+    uint32_t x = 0x9E3779B9u;
+    int bad[17] = {0};
+    polymat_fm A;
+    polyvec_fm v, w1, w2;
+    polymat M;
+    polyvec sv;
+
+    if (k == NULL || !rudraksh_kernels_supported(k)) return -1;
+
+    for (int round = 0; round < SELFTEST_ROUNDS; round++) {
+        poly a, b, r1, r2;
+        uint8_t o1[CRYPTO_CIPHERTEXTBYTES_VEC_U], o2[CRYPTO_CIPHERTEXTBYTES_VEC_U];
+        uint8_t buf[32];
+        ascon_state_t s1, s2;
+
+        selftest_poly(&a, &x);
+        selftest_poly(&b, &x);
+        for (int i = 0; i < 32; i++) buf[i] = (uint8_t)selftest_next(&x);
+        for (int i = 0; i < 5; i++) s1.x[i] = ((uint64_t)selftest_next(&x) << 32) | selftest_next(&x);
+
+        r2 = a; r1 = a;
+        ref->ntt(&r1); k->ntt(&r2);
+        bad[0] |= memcmp(&r1, &r2, sizeof(poly)) != 0;
+
+        ref->invntt(&r1); k->invntt(&r2);
+        bad[1] |= memcmp(&r1, &r2, sizeof(poly)) != 0;
+
+        r1 = b; r2 = b;
+        ref->basemul_acc(&r1, &a, &b); k->basemul_acc(&r2, &a, &b);
+        bad[2] |= memcmp(&r1, &r2, sizeof(poly)) != 0;
+
+        s2 = s1;
+        ref->ascon_p12(&s1); k->ascon_p12(&s2);
+        bad[3] |= memcmp(&s1, &s2, sizeof(s1)) != 0;
+
+        ref->ascon_p8(&s1); k->ascon_p8(&s2);
+        bad[4] |= memcmp(&s1, &s2, sizeof(s1)) != 0;
+
+        ref->cbd_eta(&r1, buf); k->cbd_eta(&r2, buf);
+        bad[5] |= memcmp(&r1, &r2, sizeof(poly)) != 0;
+
+        ref->compress_u(o1, &a); k->compress_u(o2, &a);
+        bad[6] |= memcmp(o1, o2, CRYPTO_CIPHERTEXTBYTES_VEC_U / RUDRAKSH_K) != 0;
+
+        ref->tobytes_13bit(o1, &b); k->tobytes_13bit(o2, &b);
+        bad[7] |= memcmp(o1, o2, RUDRAKSH_N * 13 / 8) != 0;
+
+        // 頻率優先佈局：ntt_fm 的兩份輸出都要與 scalar 版相同，invntt_fm 讀回後還原
+        r1 = a; r2 = a;
+        memset(&w1, 0, sizeof(w1)); memset(&w2, 0, sizeof(w2));
+        ref->ntt_fm(&r1, w1.t[0][0], sizeof(w1.t[0]) / sizeof(int16_t));
+        k->ntt_fm(&r2, w2.t[0][0], sizeof(w2.t[0]) / sizeof(int16_t));
+        bad[8] |= memcmp(&r1, &r2, sizeof(poly)) != 0 || memcmp(&w1, &w2, sizeof(w1)) != 0;
+
+        ref->invntt_fm(&r1, w1.t[0][0], sizeof(w1.t[0]) / sizeof(int16_t));
+        k->invntt_fm(&r2, w2.t[0][0], sizeof(w2.t[0]) / sizeof(int16_t));
+        bad[9] |= memcmp(&r1, &r2, sizeof(poly)) != 0;
+
+        int16_t *pa = &A.t[0][0][0][0], *pv = &v.t[0][0][0];
+        for (size_t i = 0; i < sizeof(A) / sizeof(int16_t); i++) pa[i] = (int16_t)(selftest_next(&x) % RUDRAKSH_Q);
+        for (size_t i = 0; i < sizeof(v) / sizeof(int16_t); i++) pv[i] = (int16_t)(selftest_next(&x) % RUDRAKSH_Q);
+        ref->gemv_fm(&w1, &A, &v); k->gemv_fm(&w2, &A, &v);
+        bad[10] |= memcmp(&w1, &w2, sizeof(w1)) != 0;
+
+        ref->gemv_t_fm(&w1, &A, &v); k->gemv_t_fm(&w2, &A, &v);
+        bad[11] |= memcmp(&w1, &w2, sizeof(w1)) != 0;
+
+        ref->poly_add(&r1, &a, &b); k->poly_add(&r2, &a, &b);
+        bad[12] |= memcmp(&r1, &r2, sizeof(poly)) != 0;
+
+        ref->poly_sub(&r1, &a, &b); k->poly_sub(&r2, &a, &b);
+        bad[13] |= memcmp(&r1, &r2, sizeof(poly)) != 0;
+
+        ref->decode(&r1, &a); k->decode(&r2, &a);
+        bad[14] |= memcmp(&r1, &r2, sizeof(poly)) != 0;
+
+        // encode 的輸入為 decode 的輸出 (0~3)
+        poly m = r1;
+        ref->encode(&r1, &m); k->encode(&r2, &m);
+        bad[15] |= memcmp(&r1, &r2, sizeof(poly)) != 0;
+
+        // K 項點乘和：矩陣的列 (stride 1) 與行 (stride K)
+        for (int i = 0; i < RUDRAKSH_K; i++) {
+            selftest_poly(&sv.vec[i], &x);
+            for (int j = 0; j < RUDRAKSH_K; j++) selftest_poly(&M.matrix[i][j], &x);
+        }
+        ref->basemul_dot(&r1, M.matrix[round % RUDRAKSH_K], 1, sv.vec);
+        k->basemul_dot(&r2, M.matrix[round % RUDRAKSH_K], 1, sv.vec);
+        bad[16] |= memcmp(&r1, &r2, sizeof(poly)) != 0;
+        ref->basemul_dot(&r1, &M.matrix[0][round % RUDRAKSH_K], RUDRAKSH_K, sv.vec);
+        k->basemul_dot(&r2, &M.matrix[0][round % RUDRAKSH_K], RUDRAKSH_K, sv.vec);
+        bad[16] |= memcmp(&r1, &r2, sizeof(poly)) != 0;
+    }
+
+    int fails = 0;
+    for (int i = 0; i < 17; i++) fails += bad[i];
+    return fails;
+}
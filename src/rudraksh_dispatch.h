@@ -0,0 +1,58 @@
+#ifndef RUDRAKSH_DISPATCH_H
+#define RUDRAKSH_DISPATCH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "rudraksh_math.h"
+#include "ascon/ascon.h"
+
+// ==========================================================
+// 執行時 CPU 指令集分派 (Runtime Dispatch)
+// 同一份核心原始碼 (rudraksh_kernels_impl.h) 以 scalar / SSE4.2 / AVX2 / AVX-512 各編譯一次，
+// 第一次使用時依 cpuid 選出最快且 CPU 支援的變體，之後經由函式指標表呼叫
+// 64-bit 平台另有 swar 變體 (多項式算術改用 rudraksh_swar.c 的 SWAR 版本)，沒有向量變體可用時自動選擇
+// 環境變數 RUDRAKSH_KERNELS=scalar|swar|sse4|avx2|avx512 可強制指定變體 (CPU 不支援時忽略)
+// 非 GCC 相容編譯器或非 x86 平台 (以及 NO_SIMD 建置) 只有 scalar / swar 變體
+// ==========================================================
+
+#define RUDRAKSH_KERNELS_ENV "RUDRAKSH_KERNELS"
+
+typedef struct {
+    const char *name;
+    void (*ntt)(poly *p);
+    void (*invntt)(poly *p);
+    void (*basemul_acc)(poly *r, const poly *a, const poly *b);
+    void (*ntt_fm)(poly *p, int16_t *out, size_t stride);          // ntt，另將輸出寫到頻率優先佈局
+    void (*invntt_fm)(poly *p, const int16_t *in, size_t stride);  // invntt，輸入取自頻率優先佈局
+    void (*gemv_fm)(polyvec_fm *b, const polymat_fm *A, const polyvec_fm *s);   // b = A s (每個頻率一個 K x K GEMV)
+    void (*gemv_t_fm)(polyvec_fm *b, const polymat_fm *A, const polyvec_fm *s); // b = A^T s
+    void (*ascon_p12)(ascon_state_t *s);
+    void (*ascon_p8)(ascon_state_t *s);
+    void (*cbd_eta)(poly *e, const uint8_t buf[32]);        // 32 bytes PRF 輸出 -> 64 個係數
+    void (*compress_u)(uint8_t *r, const poly *a);
+    void (*tobytes_13bit)(uint8_t *r, const poly *a);
+    // 多項式算術 (swar 變體以 SWAR 改寫，其餘 kernel 沿用 scalar 版)
+    void (*poly_add)(poly *r, const poly *a, const poly *b);
+    void (*poly_sub)(poly *r, const poly *a, const poly *b);
+    void (*encode)(poly *r, const poly *m);
+    void (*decode)(poly *m, const poly *noisy_poly);
+    void (*basemul_dot)(poly *r, const poly *a, size_t stride, const poly *b); // r = sum_j a[j * stride] * b[j] (K 項)
+} rudraksh_kernels;
+
+// 目前使用的變體 (第一次呼叫時初始化)
+const rudraksh_kernels *rudraksh_kernels_active(void);
+
+// 編譯進來的所有變體，index 0 固定為 scalar 參考實作
+size_t rudraksh_kernels_count(void);
+const rudraksh_kernels *rudraksh_kernels_variant(size_t i);
+// 目前的 CPU 是否能執行該變體：1 可以，0 不行
+int rudraksh_kernels_supported(const rudraksh_kernels *k);
+
+// 切換變體 (測試 / benchmark 用，呼叫時不可有其他執行緒正在運算)
+// name 為 NULL 時回到自動選擇 (含環境變數)；回傳 0 代表成功，-1 代表未知或 CPU 不支援
+int rudraksh_kernels_select(const char *name);
+
+// 以固定的偽隨機輸入比對 k 與 scalar 參考實作的每個 kernel，回傳不一致的 kernel 數量
+int rudraksh_kernels_selftest(const rudraksh_kernels *k);
+
+#endif // RUDRAKSH_DISPATCH_H
@@ -0,0 +1,411 @@
+#include <stdint.h>
+#include <string.h>
+#include "rudraksh_math.h"
+#include "rudraksh_params.h"
+#include "rudraksh_stats.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(RUDRAKSH_NO_SIMD)
+#include <immintrin.h>
+#define RUDRAKSH_HAVE_AVX2_TARGET 1
+#endif
+
+// ==========================================================
+// 浮點 FFT 負循環乘法 (實驗性，一般域)
+// x^64 + 1 = (x^32 - i)(x^32 + i)，實係數多項式在兩個因式上的值互為共軛，只需計算 mod (x^32 - i)：
+//   z_j = a_j + i * a_{j+32} (j < 32) 即為 a mod (x^32 - i)
+//   代入 x = psi * y (psi = e^{i pi / 64}，psi^32 = i) 後變成 y^32 - 1 的循環卷積，以 32 點複數 FFT 計算
+// 乘積 mod (x^32 - i) 的係數 w_j 對應 c_j + i * c_{j+32}，四捨五入後化約到 [0, q)
+//
+// 精確度：係數置中到 [-q/2, q/2]，單一乘積 |c| <= 64 * 3840^2 < 2^30，整列 K = 9 個乘積 < 2^34，
+// 遠小於 double 的 53-bit 尾數；32 點 FFT 的捨入誤差約 1e-6，四捨五入必定得到精確整數
+// 整列乘積在頻域累加 (線性)，每列只做一次反轉換；s 只轉換一次
+// AVX2 + FMA 版於執行時偵測 (同 rudraksh_keccakf1600_x4)，兩個版本的輸出逐 bit 相同
+// ==========================================================
+
+#define FFT_N 32
+
+// 頻域多項式 (SoA：實部 / 虛部分開，方便 SIMD)
+typedef struct {
+    double re[FFT_N];
+    double im[FFT_N];
+} fft_poly;
+
+// e^{-2 pi i k / 32}, k = 0 .. 15
+static const double TW_RE[16] = {
+    1, 0.98078528040323043, 0.92387953251128674, 0.83146961230254524,
+    0.70710678118654757, 0.55557023301960229, 0.38268343236508984, 0.19509032201612833,
+    0.0, -0.19509032201612819, -0.38268343236508973, -0.55557023301960196,
+    -0.70710678118654746, -0.83146961230254535, -0.92387953251128674, -0.98078528040323043,
+};
+static const double TW_IM[16] = {
+    0.0, -0.19509032201612825, -0.38268343236508978, -0.55557023301960218,
+    -0.70710678118654746, -0.83146961230254524, -0.92387953251128674, -0.98078528040323043,
+    -1, -0.98078528040323043, -0.92387953251128674, -0.83146961230254546,
+    -0.70710678118654757, -0.55557023301960218, -0.38268343236508989, -0.19509032201612861,
+};
+
+// psi^j = e^{i pi j / 64}, j = 0 .. 31
+static const double PSI_RE[FFT_N] = {
+    1, 0.99879545620517241, 0.99518472667219693, 0.98917650996478101,
+    0.98078528040323043, 0.97003125319454397, 0.95694033573220882, 0.94154406518302081,
+    0.92387953251128674, 0.90398929312344334, 0.88192126434835505, 0.85772861000027212,
+    0.83146961230254524, 0.80320753148064494, 0.77301045336273699, 0.74095112535495911,
+    0.70710678118654757, 0.67155895484701833, 0.63439328416364549, 0.59569930449243347,
+    0.55557023301960229, 0.51410274419322166, 0.47139673682599781, 0.4275550934302822,
+    0.38268343236508984, 0.33688985339222005, 0.29028467725446233, 0.24298017990326398,
+    0.19509032201612833, 0.14673047445536175, 0.09801714032956077, 0.049067674327418126,
+};
+static const double PSI_IM[FFT_N] = {
+    0.0, 0.049067674327418015, 0.098017140329560604, 0.14673047445536175,
+    0.19509032201612825, 0.24298017990326387, 0.29028467725446233, 0.33688985339222005,
+    0.38268343236508978, 0.42755509343028208, 0.47139673682599764, 0.51410274419322166,
+    0.55557023301960218, 0.59569930449243336, 0.63439328416364549, 0.67155895484701833,
+    0.70710678118654746, 0.74095112535495911, 0.77301045336273699, 0.80320753148064483,
+    0.83146961230254524, 0.85772861000027212, 0.88192126434835494, 0.90398929312344334,
+    0.92387953251128674, 0.94154406518302081, 0.95694033573220894, 0.97003125319454397,
+    0.98078528040323043, 0.98917650996478101, 0.99518472667219682, 0.99879545620517241,
+};
+
+// ==========================================================
+// 1. 共用：置中打包與四捨五入
+// ==========================================================
+
+// 置中與化約都不用分支：係數 (例如剛展開的 A) 沒有規律，逐係數的分支約一半預測失敗，
+// 在 KEM 中會讓整個 matvec 慢 2 倍以上 (重複相同輸入的 benchmark 看不出來，分支預測器會記住)
+static int32_t fft_center(int16_t a) {
+    int32_t v = a % RUDRAKSH_Q;                  // (-q, q)
+    v += RUDRAKSH_Q & (v >> 31);                 // [0, q)
+    v -= RUDRAKSH_Q & ((RUDRAKSH_Q / 2 - v) >> 31); // [-q/2, q/2]
+    return v;
+}
+
+// z_j = a_j + i * a_{j+32}，係數置中到 [-q/2, q/2]
+static void fft_pack(fft_poly *z, const poly *a) {
+    for (int j = 0; j < FFT_N; j++) {
+        z->re[j] = (double)fft_center(a->coeffs[j]);
+        z->im[j] = (double)fft_center(a->coeffs[j + FFT_N]);
+    }
+}
+
+static int16_t fft_round_mod(double x) {
+    // 加上與 x 同號的 0.5 後截斷 = 四捨五入 (誤差遠小於 0.5，不會遇到剛好 .5)
+    int64_t v = (int64_t)(x + 0.5 - (double)(x < 0));
+    v %= RUDRAKSH_Q;
+    v += RUDRAKSH_Q & (v >> 63);
+    return (int16_t)v;
+}
+
+static void fft_unpack(poly *r, const fft_poly *z) {
+    for (int j = 0; j < FFT_N; j++) {
+        r->coeffs[j] = fft_round_mod(z->re[j]);
+        r->coeffs[j + FFT_N] = fft_round_mod(z->im[j]);
+    }
+}
+
+// ==========================================================
+// 2. Scalar 版
+// 正向 DIF (自然順序 -> 位元反轉)、反向 DIT (位元反轉 -> 自然順序)，頻域只做點乘，不需要重排
+// ==========================================================
+
+static void fft_forward_scalar(fft_poly *z) {
+    double *re = z->re, *im = z->im;
+
+    // twist：z_j *= psi^j
+    for (int j = 0; j < FFT_N; j++) {
+        double r = re[j] * PSI_RE[j] - im[j] * PSI_IM[j];
+        im[j] = re[j] * PSI_IM[j] + im[j] * PSI_RE[j];
+        re[j] = r;
+    }
+
+    for (int t = FFT_N / 2; t >= 1; t >>= 1) {
+        int step = (FFT_N / 2) / t;
+        for (int g = 0; g < FFT_N; g += 2 * t) {
+            for (int j = 0; j < t; j++) {
+                double wr = TW_RE[j * step], wi = TW_IM[j * step];
+                double ur = re[g + j], ui = im[g + j];
+                double dr = ur - re[g + j + t], di = ui - im[g + j + t];
+                re[g + j] = ur + re[g + j + t];
+                im[g + j] = ui + im[g + j + t];
+                re[g + j + t] = dr * wr - di * wi;
+                im[g + j + t] = dr * wi + di * wr;
+            }
+        }
+    }
+}
+
+static void fft_inverse_scalar(fft_poly *z) {
+    double *re = z->re, *im = z->im;
+
+    for (int t = 1; t < FFT_N; t <<= 1) {
+        int step = (FFT_N / 2) / t;
+        for (int g = 0; g < FFT_N; g += 2 * t) {
+            for (int j = 0; j < t; j++) {
+                // v = x[j+t] * conj(w)
+                double wr = TW_RE[j * step], wi = TW_IM[j * step];
+                double vr = re[g + j + t] * wr + im[g + j + t] * wi;
+                double vi = im[g + j + t] * wr - re[g + j + t] * wi;
+                double ur = re[g + j], ui = im[g + j];
+                re[g + j] = ur + vr;
+                im[g + j] = ui + vi;
+                re[g + j + t] = ur - vr;
+                im[g + j + t] = ui - vi;
+            }
+        }
+    }
+
+    // untwist 並除以 32：z_j *= conj(psi^j) / 32
+    for (int j = 0; j < FFT_N; j++) {
+        double r = (re[j] * PSI_RE[j] + im[j] * PSI_IM[j]) * (1.0 / FFT_N);
+        im[j] = (im[j] * PSI_RE[j] - re[j] * PSI_IM[j]) * (1.0 / FFT_N);
+        re[j] = r;
+    }
+}
+
+// acc += a * b (頻域點乘)
+static void fft_mul_acc_scalar(fft_poly *acc, const fft_poly *a, const fft_poly *b) {
+    for (int j = 0; j < FFT_N; j++) {
+        acc->re[j] += a->re[j] * b->re[j] - a->im[j] * b->im[j];
+        acc->im[j] += a->re[j] * b->im[j] + a->im[j] * b->re[j];
+    }
+}
+
+// ==========================================================
+// 3. AVX2 + FMA 版
+// 每個 256-bit 暫存器放 4 個係數；t >= 4 的層直接對整個暫存器做蝴蝶運算，
+// t = 2 / t = 1 的層在暫存器內以 permute 配對
+// ==========================================================
+
+#ifdef RUDRAKSH_HAVE_AVX2_TARGET
+
+#define FFT_V (FFT_N / 4)
+
+// (r, i) *= (wr, wi)
+#define CMUL(r, i, wr, wi) do { \
+        __m256d _t = _mm256_fmsub_pd((r), (wr), _mm256_mul_pd((i), (wi))); \
+        (i) = _mm256_fmadd_pd((r), (wi), _mm256_mul_pd((i), (wr))); \
+        (r) = _t; \
+    } while (0)
+
+// 第 t 層 (t = 16 / 8 / 4) 第 j 個暫存器的旋轉因子：TW[(4j + e) * 16 / t]
+__attribute__((target("avx2,fma")))
+static inline void fft_tw_avx2(int t, int j, __m256d *wr, __m256d *wi) {
+    int step = (FFT_N / 2) / t, k = 4 * j * step;
+    *wr = _mm256_setr_pd(TW_RE[k], TW_RE[k + step], TW_RE[k + 2 * step], TW_RE[k + 3 * step]);
+    *wi = _mm256_setr_pd(TW_IM[k], TW_IM[k + step], TW_IM[k + 2 * step], TW_IM[k + 3 * step]);
+}
+
+__attribute__((target("avx2,fma")))
+static void fft_forward_avx2(fft_poly *z) {
+    __m256d re[FFT_V], im[FFT_V], wr, wi;
+
+    for (int v = 0; v < FFT_V; v++) {
+        re[v] = _mm256_loadu_pd(&z->re[4 * v]);
+        im[v] = _mm256_loadu_pd(&z->im[4 * v]);
+        CMUL(re[v], im[v], _mm256_loadu_pd(&PSI_RE[4 * v]), _mm256_loadu_pd(&PSI_IM[4 * v]));
+    }
+
+    // t = 16, 8, 4 (以暫存器為單位 tv = t / 4)
+    for (int tv = FFT_V / 2; tv >= 1; tv >>= 1) {
+        for (int g = 0; g < FFT_V; g += 2 * tv) {
+            for (int j = 0; j < tv; j++) {
+                int a = g + j, b = g + j + tv;
+                __m256d dr = _mm256_sub_pd(re[a], re[b]), di = _mm256_sub_pd(im[a], im[b]);
+                re[a] = _mm256_add_pd(re[a], re[b]);
+                im[a] = _mm256_add_pd(im[a], im[b]);
+                fft_tw_avx2(4 * tv, j, &wr, &wi);
+                CMUL(dr, di, wr, wi);
+                re[b] = dr;
+                im[b] = di;
+            }
+        }
+    }
+
+    // t = 2：[x0 x1 x2 x3] -> [x0+x2, x1+x3, (x0-x2), (x1-x3) * -i]
+    const __m256d sign2 = _mm256_setr_pd(1, 1, -1, -1), sign1 = _mm256_setr_pd(1, -1, 1, -1);
+    const __m256d w2r = _mm256_setr_pd(1, 1, 1, 0), w2i = _mm256_setr_pd(0, 0, 0, -1);
+    for (int v = 0; v < FFT_V; v++) {
+        re[v] = _mm256_fmadd_pd(re[v], sign2, _mm256_permute2f128_pd(re[v], re[v], 0x01));
+        im[v] = _mm256_fmadd_pd(im[v], sign2, _mm256_permute2f128_pd(im[v], im[v], 0x01));
+        CMUL(re[v], im[v], w2r, w2i);
+
+        // t = 1：[x0 x1] -> [x0+x1, x0-x1]
+        re[v] = _mm256_fmadd_pd(re[v], sign1, _mm256_permute_pd(re[v], 0x5));
+        im[v] = _mm256_fmadd_pd(im[v], sign1, _mm256_permute_pd(im[v], 0x5));
+
+        _mm256_storeu_pd(&z->re[4 * v], re[v]);
+        _mm256_storeu_pd(&z->im[4 * v], im[v]);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static void fft_inverse_avx2(fft_poly *z) {
+    __m256d re[FFT_V], im[FFT_V], wr, wi;
+    const __m256d sign2 = _mm256_setr_pd(1, 1, -1, -1), sign1 = _mm256_setr_pd(1, -1, 1, -1);
+    const __m256d w2r = _mm256_setr_pd(1, 1, 1, 0), w2i = _mm256_setr_pd(0, 0, 0, 1);  // conj
+    const __m256d scale = _mm256_set1_pd(1.0 / FFT_N);
+
+    for (int v = 0; v < FFT_V; v++) {
+        re[v] = _mm256_loadu_pd(&z->re[4 * v]);
+        im[v] = _mm256_loadu_pd(&z->im[4 * v]);
+
+        // t = 1
+        re[v] = _mm256_fmadd_pd(re[v], sign1, _mm256_permute_pd(re[v], 0x5));
+        im[v] = _mm256_fmadd_pd(im[v], sign1, _mm256_permute_pd(im[v], 0x5));
+
+        // t = 2：先乘 conj(w) 再做蝴蝶
+        CMUL(re[v], im[v], w2r, w2i);
+        re[v] = _mm256_fmadd_pd(re[v], sign2, _mm256_permute2f128_pd(re[v], re[v], 0x01));
+        im[v] = _mm256_fmadd_pd(im[v], sign2, _mm256_permute2f128_pd(im[v], im[v], 0x01));
+    }
+
+    // t = 4, 8, 16
+    for (int tv = 1; tv < FFT_V; tv <<= 1) {
+        for (int g = 0; g < FFT_V; g += 2 * tv) {
+            for (int j = 0; j < tv; j++) {
+                int a = g + j, b = g + j + tv;
+                fft_tw_avx2(4 * tv, j, &wr, &wi);
+                wi = _mm256_sub_pd(_mm256_setzero_pd(), wi);
+                CMUL(re[b], im[b], wr, wi);
+                __m256d ur = re[a], ui = im[a];
+                re[a] = _mm256_add_pd(ur, re[b]);
+                im[a] = _mm256_add_pd(ui, im[b]);
+                re[b] = _mm256_sub_pd(ur, re[b]);
+                im[b] = _mm256_sub_pd(ui, im[b]);
+            }
+        }
+    }
+
+    // untwist 並除以 32
+    for (int v = 0; v < FFT_V; v++) {
+        __m256d pr = _mm256_mul_pd(_mm256_loadu_pd(&PSI_RE[4 * v]), scale);
+        __m256d pi = _mm256_mul_pd(_mm256_loadu_pd(&PSI_IM[4 * v]), _mm256_set1_pd(-1.0 / FFT_N));
+        CMUL(re[v], im[v], pr, pi);
+        _mm256_storeu_pd(&z->re[4 * v], re[v]);
+        _mm256_storeu_pd(&z->im[4 * v], im[v]);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static void fft_mul_acc_avx2(fft_poly *acc, const fft_poly *a, const fft_poly *b) {
+    for (int v = 0; v < FFT_N; v += 4) {
+        __m256d ar = _mm256_loadu_pd(&a->re[v]), ai = _mm256_loadu_pd(&a->im[v]);
+        __m256d br = _mm256_loadu_pd(&b->re[v]), bi = _mm256_loadu_pd(&b->im[v]);
+        __m256d cr = _mm256_loadu_pd(&acc->re[v]), ci = _mm256_loadu_pd(&acc->im[v]);
+        cr = _mm256_fnmadd_pd(ai, bi, _mm256_fmadd_pd(ar, br, cr));
+        ci = _mm256_fmadd_pd(ai, br, _mm256_fmadd_pd(ar, bi, ci));
+        _mm256_storeu_pd(&acc->re[v], cr);
+        _mm256_storeu_pd(&acc->im[v], ci);
+    }
+}
+
+#undef CMUL
+
+static int fft_have_avx2(void) {
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+
+#endif
+
+// ==========================================================
+// 4. 轉換與點乘 (依 CPU 選擇版本)
+// ==========================================================
+
+static void fft_forward(fft_poly *z, const poly *a) {
+    fft_pack(z, a);
+#ifdef RUDRAKSH_HAVE_AVX2_TARGET
+    if (fft_have_avx2()) {
+        fft_forward_avx2(z);
+        return;
+    }
+#endif
+    fft_forward_scalar(z);
+}
+
+// z 會被改寫
+static void fft_inverse(poly *r, fft_poly *z) {
+#ifdef RUDRAKSH_HAVE_AVX2_TARGET
+    if (fft_have_avx2()) fft_inverse_avx2(z);
+    else fft_inverse_scalar(z);
+#else
+    fft_inverse_scalar(z);
+#endif
+    fft_unpack(r, z);
+}
+
+static void fft_mul_acc(fft_poly *acc, const fft_poly *a, const fft_poly *b) {
+    RUDRAKSH_STAT_INC(poly_mul);
+#ifdef RUDRAKSH_HAVE_AVX2_TARGET
+    if (fft_have_avx2()) {
+        fft_mul_acc_avx2(acc, a, b);
+        return;
+    }
+#endif
+    fft_mul_acc_scalar(acc, a, b);
+}
+
+const char *rudraksh_fft_impl(void) {
+#ifdef RUDRAKSH_HAVE_AVX2_TARGET
+    if (fft_have_avx2()) return "avx2-fma";
+#endif
+    return "scalar";
+}
+
+// ==========================================================
+// 5. 乘法介面 (可直接替換 schoolbook 版本)
+// ==========================================================
+
+// r = r + a * b
+void poly_basemul_acc_fft(poly *r, const poly *a, const poly *b) {
+    fft_poly za, zb, acc;
+    poly prod;
+
+    fft_forward(&za, a);
+    fft_forward(&zb, b);
+    memset(&acc, 0, sizeof(acc));
+    fft_mul_acc(&acc, &za, &zb);
+    fft_inverse(&prod, &acc);
+    poly_add(r, r, &prod);
+}
+
+// b = A * s
+void poly_matrix_vec_mul_fft(polyvec *b, const polymat *A, const polyvec *s) {
+    fft_poly zs[RUDRAKSH_K], za, acc;
+
+    for (int j = 0; j < RUDRAKSH_K; j++) fft_forward(&zs[j], &s->vec[j]);
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        memset(&acc, 0, sizeof(acc));
+        for (int j = 0; j < RUDRAKSH_K; j++) {
+            fft_forward(&za, &A->matrix[i][j]);
+            fft_mul_acc(&acc, &za, &zs[j]);
+        }
+        fft_inverse(&b->vec[i], &acc);
+    }
+}
+
+// b = A^T * s
+void poly_matrix_trans_vec_mul_fft(polyvec *b, const polymat *A, const polyvec *s) {
+    fft_poly zs[RUDRAKSH_K], za, acc;
+
+    for (int j = 0; j < RUDRAKSH_K; j++) fft_forward(&zs[j], &s->vec[j]);
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        memset(&acc, 0, sizeof(acc));
+        for (int j = 0; j < RUDRAKSH_K; j++) {
+            fft_forward(&za, &A->matrix[j][i]);
+            fft_mul_acc(&acc, &za, &zs[j]);
+        }
+        fft_inverse(&b->vec[i], &acc);
+    }
+}
+
+// c = b^T * s
+void poly_vector_vector_mul_fft(poly *c, const polyvec *b, const polyvec *s) {
+    fft_poly zb, zs, acc;
+
+    memset(&acc, 0, sizeof(acc));
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        fft_forward(&zb, &b->vec[i]);
+        fft_forward(&zs, &s->vec[i]);
+        fft_mul_acc(&acc, &zb, &zs);
+    }
+    fft_inverse(c, &acc);
+}
@@ -1,6 +1,8 @@
 #include "rudraksh_math.h"
 #include "rudraksh_params.h"
 #include "rudraksh_random.h" // include ascon_prf
+#include "rudraksh_stats.h"
+#include "rudraksh_dispatch.h"
 
 // ==========================================================
 // 1. matrix_A generator
@@ -54,15 +56,106 @@ inline void poly_generator(poly *p, const uint8_t *seed, const uint8_t i, const
         }
 
         // 4. 拒絕採樣 (Rejection Sampling)
+        RUDRAKSH_STAT_INC(gen_samples);
         if (val < RUDRAKSH_Q)
         {
             p->coeffs[count++] = val;
         }
-        // 如果 val >= 7681，就直接進入下一圈迴圈 (丟棄)
-        // 但 bits_left 已經扣掉了，所以實際上就是丟掉了那 13 bits
+        else
+        {
+            // 如果 val >= 7681，就直接進入下一圈迴圈 (丟棄)
+            // 但 bits_left 已經扣掉了，所以實際上就是丟掉了那 13 bits
+            RUDRAKSH_STAT_INC(gen_rejects);
+        }
     }
 }
 
+#ifdef RUDRAKSH_SYM_KECCAK
+
+// 13-bit 拒絕取樣器：與 poly_generator 相同的位元流切法，但由呼叫端逐一餵入 8-byte word
+typedef struct {
+    poly *p;
+    int count;
+    uint64_t buffer;
+    int bits_left;
+} gen_sampler;
+
+static void sampler_accept(gen_sampler *g, uint16_t val)
+{
+    RUDRAKSH_STAT_INC(gen_samples);
+    if (val < RUDRAKSH_Q) g->p->coeffs[g->count++] = val;
+    else RUDRAKSH_STAT_INC(gen_rejects);
+}
+
+static void sampler_push(gen_sampler *g, uint64_t next_block)
+{
+    // 先用新 word 補齊跨 word 的樣本，再取完 buffer 內所有完整的 13 bits
+    int needed = 13 - g->bits_left;
+    uint16_t val = (uint16_t)(g->buffer | ((next_block & ((1ULL << needed) - 1)) << g->bits_left));
+    g->buffer = next_block >> needed;
+    g->bits_left = 64 - needed;
+    sampler_accept(g, val);
+
+    while (g->count < RUDRAKSH_N && g->bits_left >= 13) {
+        val = g->buffer & 0x1FFF;
+        g->buffer >>= 13;
+        g->bits_left -= 13;
+        sampler_accept(g, val);
+    }
+}
+
+// SHAKE 後端：每 4 個 A 多項式共用一次 4 路 Keccak 置換，結果與逐一呼叫 poly_generator 相同
+void poly_matrixA_generator(polymat *a, const uint8_t *seed)
+{
+    const int total = RUDRAKSH_K * RUDRAKSH_K;
+    int idx = 0;
+
+    for (; idx + 4 <= total; idx += 4)
+    {
+        rudraksh_keccakx4_state state;
+        uint8_t block[4][RUDRAKSH_SHAKE128_RATE];
+        uint8_t ni[4], nj[4];
+        gen_sampler g[4];
+        int pending = 4;
+
+        for (int l = 0; l < 4; l++)
+        {
+            ni[l] = (uint8_t)((idx + l) / RUDRAKSH_K);
+            nj[l] = (uint8_t)((idx + l) % RUDRAKSH_K);
+            g[l].p = &a->matrix[ni[l]][nj[l]];
+            g[l].count = 0;
+            g[l].buffer = 0;
+            g[l].bits_left = 0;
+        }
+        rudraksh_prf_init_matrixA_x4(&state, seed, ni, nj);
+
+        while (pending > 0)
+        {
+            rudraksh_shake128x4_squeezeblock(&state, block);
+            pending = 0;
+            for (int l = 0; l < 4; l++)
+            {
+                for (int w = 0; w < RUDRAKSH_SHAKE128_RATE / 8 && g[l].count < RUDRAKSH_N; w++)
+                {
+                    uint64_t next_block = 0;
+                    for (int b = 0; b < 8; b++) next_block |= (uint64_t)block[l][8 * w + b] << (8 * b);
+                    sampler_push(&g[l], next_block);
+                }
+                pending += g[l].count < RUDRAKSH_N;
+            }
+        }
+    }
+
+    // 剩下不足 4 個 (81 = 4 * 20 + 1)
+    for (; idx < total; idx++)
+    {
+        poly_generator(&a->matrix[idx / RUDRAKSH_K][idx % RUDRAKSH_K], seed,
+                       (uint8_t)(idx / RUDRAKSH_K), (uint8_t)(idx % RUDRAKSH_K));
+    }
+}
+
+#else
+
 void poly_matrixA_generator(polymat *a, const uint8_t *seed)
 {
     for (int i = 0; i < RUDRAKSH_K; i++)
@@ -77,6 +170,8 @@ void poly_matrixA_generator(polymat *a, const uint8_t *seed)
     }
 }
 
+#endif // RUDRAKSH_SYM_KECCAK
+
 // ==========================================================
 // 2. cbd_etc
 // ==========================================================
@@ -116,32 +211,6 @@ void poly_cbd_eta(poly *e, const uint8_t *key, const uint8_t nonce)
     }
 
     // 總共64個poly , 1 poly -> 4bit = 0.5 bytes, 64*0.5 = 32bytes = 8bytes (一次)*4
-    for (int i = 0; i < 32; i++) {
-        uint8_t byte = buffer[i];
-        int16_t a, b;
-
-        // --- 處理低 4 位 (生成第 2*i 個係數) ---
-        // bits 0,1 是第一組 (a)，bits 2,3 是第二組 (b)
-        // 技巧：(x >> 1) & 1 取出 bit 1，(x & 1) 取出 bit 0
-        a = (byte & 0x1) + ((byte >> 1) & 0x1); // HW(第一組)
-        b = ((byte >> 2) & 0x1) + ((byte >> 3) & 0x1); // HW(第二組)
-        int16_t d1 = (int16_t)a - (int16_t)b; // a, b 為漢明重量，d 範圍是 [-2, 2]
-        
-
-        // --- 處理高 4 位 (生成第 2*i+1 個係數) ---
-        // bits 4,5 是第一組，bits 6,7 是第二組
-        a = ((byte >> 4) & 0x1) + ((byte >> 5) & 0x1);
-        b = ((byte >> 6) & 0x1) + ((byte >> 7) & 0x1);
-        int16_t d2 = (int16_t)a - (int16_t)b; // a, b 為漢明重量，d 範圍是 [-2, 2]
-        e->coeffs[2 * i + 1] = a - b;
-
-        // 修改後的 CBD 取樣邏輯片段
-        
-        // 核心修正：符號轉換
-        if (d1 < 0) d1 += RUDRAKSH_Q; 
-        if (d2 < 0) d2 += RUDRAKSH_Q; 
-
-        e->coeffs[2 * i] = d1;
-        e->coeffs[2 * i+1] = d2; // 現在 d 變成了 7680, 7679 等正數
-    }
+    // bytes -> 係數的轉換位於 rudraksh_kernels_impl.h (依 CPU 分派)
+    rudraksh_kernels_active()->cbd_eta(e, buffer);
 }
\ No newline at end of file
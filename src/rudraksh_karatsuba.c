@@ -0,0 +1,132 @@
+#include <stdint.h>
+#include <string.h>
+#include "rudraksh_math.h"
+#include "rudraksh_params.h"
+#include "rudraksh_stats.h"
+
+// ==========================================================
+// Karatsuba 負循環乘法 (一般域，不需要 NTT-friendly 的 q)
+// 64 係數 -> 32 -> 16 兩層 Karatsuba，16 x 16 以 schoolbook 計算：每個乘積 9 * 256 = 2304 次整數乘法 (schoolbook 4096 次)
+//
+// 係數先置中到 [-q/2, q/2]，在 uint32 (Z / 2^32) 上做所有加減乘，不逐步化約：
+//   真正的乘積係數 |c_k| <= 64 * 3840^2 < 2^30，負循環摺疊後 |c_k - c_{k+64}| < 2^31，
+//   Karatsuba 中間值即使超出 32 bits，mod 2^32 的結果仍正確，最後以 int32 解讀即為精確值
+// 每個乘積摺疊後只做一次 % q 累加到 int32 (|acc| < K * q)，整列 (模組維度) 累加完再化約到 [0, q)
+// Toom-3 需要除以 2 (在 Z / 2^32 上不可逆) 且 64 不是 3 的倍數，此處不採用
+// ==========================================================
+
+#define KARA_BASE 16 // 遞迴到此長度後改用 schoolbook
+
+// r[0 .. 2n-2] = a * b (Z / 2^32 上的一般多項式乘法，n 為 2 的冪次)
+static void kara_mul(uint32_t *r, const uint32_t *a, const uint32_t *b, int n) {
+    if (n <= KARA_BASE) {
+        memset(r, 0, (size_t)(2 * n - 1) * sizeof(uint32_t));
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) r[i + j] += a[i] * b[j];
+        }
+        return;
+    }
+
+    int h = n >> 1;
+    uint32_t as[RUDRAKSH_N / 2], bs[RUDRAKSH_N / 2], mid[RUDRAKSH_N - 1];
+
+    for (int i = 0; i < h; i++) {
+        as[i] = a[i] + a[i + h];
+        bs[i] = b[i] + b[i + h];
+    }
+
+    kara_mul(r, a, b, h);                  // z0 = a0 * b0 -> r[0 .. 2h-2]
+    r[2 * h - 1] = 0;
+    kara_mul(r + 2 * h, a + h, b + h, h);  // z2 = a1 * b1 -> r[2h .. 4h-2]
+    kara_mul(mid, as, bs, h);              // (a0 + a1)(b0 + b1)
+
+    // z1 = (a0 + a1)(b0 + b1) - z0 - z2，加到 x^h 的位置
+    for (int i = 0; i < 2 * h - 1; i++) mid[i] -= r[i] + r[2 * h + i];
+    for (int i = 0; i < 2 * h - 1; i++) r[h + i] += mid[i];
+}
+
+// 係數化約並置中到 [-q/2, q/2]
+static void kara_center(uint32_t out[RUDRAKSH_N], const poly *a) {
+    for (int i = 0; i < RUDRAKSH_N; i++) {
+        int32_t v = a->coeffs[i] % RUDRAKSH_Q;
+        if (v > RUDRAKSH_Q / 2) v -= RUDRAKSH_Q;
+        if (v < -(RUDRAKSH_Q / 2)) v += RUDRAKSH_Q;
+        out[i] = (uint32_t)v;
+    }
+}
+
+// acc += a * b mod (x^64 + 1)，每個係數加上 (-q, q) 之間的值
+static void kara_acc(int32_t acc[RUDRAKSH_N], const uint32_t a[RUDRAKSH_N], const uint32_t b[RUDRAKSH_N]) {
+    uint32_t c[2 * RUDRAKSH_N - 1];
+    RUDRAKSH_STAT_INC(poly_mul);
+
+    kara_mul(c, a, b, RUDRAKSH_N);
+    // x^64 = -1
+    for (int i = 0; i < RUDRAKSH_N - 1; i++) acc[i] += (int32_t)(c[i] - c[i + RUDRAKSH_N]) % RUDRAKSH_Q;
+    acc[RUDRAKSH_N - 1] += (int32_t)c[RUDRAKSH_N - 1] % RUDRAKSH_Q;
+}
+
+static void kara_finish(poly *r, const int32_t acc[RUDRAKSH_N]) {
+    for (int i = 0; i < RUDRAKSH_N; i++) {
+        int32_t v = acc[i] % RUDRAKSH_Q;
+        if (v < 0) v += RUDRAKSH_Q;
+        r->coeffs[i] = (int16_t)v;
+    }
+}
+
+// r = r + a * b (與 poly_basemul_acc_serial 相同，可直接替換)
+void poly_basemul_acc_karatsuba(poly *r, const poly *a, const poly *b) {
+    uint32_t ac[RUDRAKSH_N], bc[RUDRAKSH_N];
+    int32_t acc[RUDRAKSH_N];
+
+    for (int i = 0; i < RUDRAKSH_N; i++) acc[i] = r->coeffs[i];
+    kara_center(ac, a);
+    kara_center(bc, b);
+    kara_acc(acc, ac, bc);
+    kara_finish(r, acc);
+}
+
+// b = A * s；s 只置中一次，每一列在 int32 累加 K 個乘積後才化約
+void poly_matrix_vec_mul_karatsuba(polyvec *b, const polymat *A, const polyvec *s) {
+    uint32_t sc[RUDRAKSH_K][RUDRAKSH_N], ac[RUDRAKSH_N];
+    int32_t acc[RUDRAKSH_N];
+
+    for (int j = 0; j < RUDRAKSH_K; j++) kara_center(sc[j], &s->vec[j]);
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        memset(acc, 0, sizeof(acc));
+        for (int j = 0; j < RUDRAKSH_K; j++) {
+            kara_center(ac, &A->matrix[i][j]);
+            kara_acc(acc, ac, sc[j]);
+        }
+        kara_finish(&b->vec[i], acc);
+    }
+}
+
+// b = A^T * s
+void poly_matrix_trans_vec_mul_karatsuba(polyvec *b, const polymat *A, const polyvec *s) {
+    uint32_t sc[RUDRAKSH_K][RUDRAKSH_N], ac[RUDRAKSH_N];
+    int32_t acc[RUDRAKSH_N];
+
+    for (int j = 0; j < RUDRAKSH_K; j++) kara_center(sc[j], &s->vec[j]);
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        memset(acc, 0, sizeof(acc));
+        for (int j = 0; j < RUDRAKSH_K; j++) {
+            kara_center(ac, &A->matrix[j][i]);
+            kara_acc(acc, ac, sc[j]);
+        }
+        kara_finish(&b->vec[i], acc);
+    }
+}
+
+// c = b^T * s
+void poly_vector_vector_mul_karatsuba(poly *c, const polyvec *b, const polyvec *s) {
+    uint32_t bc[RUDRAKSH_N], sc[RUDRAKSH_N];
+    int32_t acc[RUDRAKSH_N] = {0};
+
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        kara_center(bc, &b->vec[i]);
+        kara_center(sc, &s->vec[i]);
+        kara_acc(acc, bc, sc);
+    }
+    kara_finish(c, acc);
+}
@@ -0,0 +1,286 @@
+#include <string.h>
+
+#include "rudraksh_keccak.h"
+#include "rudraksh_random.h"
+#include "rudraksh_params.h"
+#include "rudraksh_stats.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(RUDRAKSH_NO_SIMD)
+#include <immintrin.h>
+#define RUDRAKSH_HAVE_AVX2_TARGET 1
+#endif
+
+// ==========================================================
+// 1. Keccak-f[1600]
+// ==========================================================
+
+#define ROL64(a, n) (((a) << (n)) ^ ((a) >> (64 - (n))))
+
+static const uint64_t KECCAK_RC[24] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL, 0x8000000080008000ULL,
+    0x000000000000808bULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+    0x000000000000008aULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+    0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800aULL, 0x800000008000000aULL,
+    0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+// rho 旋轉量與 pi 置換順序 (沿 pi 軌跡走一圈)
+static const unsigned KECCAK_ROTC[24] = {
+    1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14, 27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44
+};
+static const unsigned KECCAK_PILN[24] = {
+    10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4, 15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1
+};
+
+void rudraksh_keccakf1600(uint64_t st[25]) {
+    uint64_t bc[5], t;
+
+    RUDRAKSH_STAT_INC(p12);
+
+    for (int round = 0; round < 24; round++) {
+        // theta
+        for (int i = 0; i < 5; i++) bc[i] = st[i] ^ st[i + 5] ^ st[i + 10] ^ st[i + 15] ^ st[i + 20];
+        for (int i = 0; i < 5; i++) {
+            t = bc[(i + 4) % 5] ^ ROL64(bc[(i + 1) % 5], 1);
+            for (int j = 0; j < 25; j += 5) st[j + i] ^= t;
+        }
+
+        // rho + pi
+        t = st[1];
+        for (int i = 0; i < 24; i++) {
+            unsigned j = KECCAK_PILN[i];
+            bc[0] = st[j];
+            st[j] = ROL64(t, KECCAK_ROTC[i]);
+            t = bc[0];
+        }
+
+        // chi
+        for (int j = 0; j < 25; j += 5) {
+            for (int i = 0; i < 5; i++) bc[i] = st[j + i];
+            for (int i = 0; i < 5; i++) st[j + i] ^= (~bc[(i + 1) % 5]) & bc[(i + 2) % 5];
+        }
+
+        // iota
+        st[0] ^= KECCAK_RC[round];
+    }
+}
+
+// ==========================================================
+// 2. 4 路 Keccak-f[1600] (AVX2：每個 256-bit 暫存器放 4 個狀態的同一個 lane)
+// ==========================================================
+
+#ifdef RUDRAKSH_HAVE_AVX2_TARGET
+
+#define ROL4(x, n) _mm256_or_si256(_mm256_sllv_epi64((x), _mm256_set1_epi64x(n)), \
+                                   _mm256_srlv_epi64((x), _mm256_set1_epi64x(64 - (n))))
+
+__attribute__((target("avx2")))
+static void keccakf1600_x4_avx2(uint64_t s[25 * 4]) {
+    __m256i st[25], bc[5], t, tmp;
+
+    for (int k = 0; k < 25; k++) st[k] = _mm256_loadu_si256((const __m256i *)&s[4 * k]);
+
+    for (int round = 0; round < 24; round++) {
+        for (int i = 0; i < 5; i++) {
+            bc[i] = _mm256_xor_si256(_mm256_xor_si256(st[i], st[i + 5]),
+                                     _mm256_xor_si256(_mm256_xor_si256(st[i + 10], st[i + 15]), st[i + 20]));
+        }
+        for (int i = 0; i < 5; i++) {
+            t = _mm256_xor_si256(bc[(i + 4) % 5], ROL4(bc[(i + 1) % 5], 1));
+            for (int j = 0; j < 25; j += 5) st[j + i] = _mm256_xor_si256(st[j + i], t);
+        }
+
+        t = st[1];
+        for (int i = 0; i < 24; i++) {
+            unsigned j = KECCAK_PILN[i];
+            tmp = st[j];
+            st[j] = ROL4(t, (long long)KECCAK_ROTC[i]);
+            t = tmp;
+        }
+
+        for (int j = 0; j < 25; j += 5) {
+            for (int i = 0; i < 5; i++) bc[i] = st[j + i];
+            for (int i = 0; i < 5; i++) {
+                st[j + i] = _mm256_xor_si256(st[j + i], _mm256_andnot_si256(bc[(i + 1) % 5], bc[(i + 2) % 5]));
+            }
+        }
+
+        st[0] = _mm256_xor_si256(st[0], _mm256_set1_epi64x((long long)KECCAK_RC[round]));
+    }
+
+    for (int k = 0; k < 25; k++) _mm256_storeu_si256((__m256i *)&s[4 * k], st[k]);
+}
+
+#endif
+
+static void keccakf1600_x4_scalar(uint64_t s[25 * 4]) {
+    uint64_t one[25];
+
+    for (int i = 0; i < 4; i++) {
+        for (int k = 0; k < 25; k++) one[k] = s[4 * k + i];
+        rudraksh_keccakf1600(one);
+        for (int k = 0; k < 25; k++) s[4 * k + i] = one[k];
+    }
+}
+
+void rudraksh_keccakf1600_x4(uint64_t s[25 * 4]) {
+#ifdef RUDRAKSH_HAVE_AVX2_TARGET
+    if (__builtin_cpu_supports("avx2")) {
+        for (int i = 0; i < 4; i++) RUDRAKSH_STAT_INC(p12);
+        keccakf1600_x4_avx2(s);
+        return;
+    }
+#endif
+    keccakf1600_x4_scalar(s);
+}
+
+const char *rudraksh_keccakf1600_x4_impl(void) {
+#ifdef RUDRAKSH_HAVE_AVX2_TARGET
+    if (__builtin_cpu_supports("avx2")) return "avx2";
+#endif
+    return "scalar";
+}
+
+// ==========================================================
+// 3. SHAKE128 / SHAKE256 (lane 以小端序對應 bytes)
+// ==========================================================
+
+static uint64_t load64_le(const uint8_t x[8]) {
+    uint64_t r = 0;
+    for (int i = 0; i < 8; i++) r |= (uint64_t)x[i] << (8 * i);
+    return r;
+}
+
+static void store64_le(uint8_t x[8], uint64_t u) {
+    for (int i = 0; i < 8; i++) x[i] = (uint8_t)(u >> (8 * i));
+}
+
+// 一次吸收全部輸入並補上 SHAKE 的 padding (0x1F ... 0x80)
+static void keccak_absorb_once(uint64_t s[25], unsigned rate, const uint8_t *in, size_t inlen) {
+    memset(s, 0, 25 * sizeof(uint64_t));
+
+    while (inlen >= rate) {
+        for (unsigned i = 0; i < rate / 8; i++) s[i] ^= load64_le(in + 8 * i);
+        rudraksh_keccakf1600(s);
+        in += rate;
+        inlen -= rate;
+    }
+    for (size_t i = 0; i < inlen; i++) s[i / 8] ^= (uint64_t)in[i] << (8 * (i % 8));
+    s[inlen / 8] ^= 0x1FULL << (8 * (inlen % 8));
+    s[(rate - 1) / 8] ^= 1ULL << 63;
+}
+
+void rudraksh_shake128_absorb(rudraksh_keccak_state *s, const uint8_t *in, size_t inlen) {
+    keccak_absorb_once(s->s, RUDRAKSH_SHAKE128_RATE, in, inlen);
+    s->pos = RUDRAKSH_SHAKE128_RATE;
+}
+
+void rudraksh_shake128_squeeze(rudraksh_keccak_state *s, uint8_t *out, size_t outlen) {
+    while (outlen > 0) {
+        if (s->pos == RUDRAKSH_SHAKE128_RATE) {
+            rudraksh_keccakf1600(s->s);
+            s->pos = 0;
+        }
+        out[0] = (uint8_t)(s->s[s->pos / 8] >> (8 * (s->pos % 8)));
+        s->pos++;
+        out++;
+        outlen--;
+    }
+}
+
+// 4 個輸入長度相同 (inlen < rate)
+void rudraksh_shake128x4_absorb(rudraksh_keccakx4_state *s, const uint8_t *const in[4], size_t inlen) {
+    memset(s->s, 0, sizeof(s->s));
+
+    for (int l = 0; l < 4; l++) {
+        for (size_t i = 0; i < inlen; i++) s->s[4 * (i / 8) + l] ^= (uint64_t)in[l][i] << (8 * (i % 8));
+        s->s[4 * (inlen / 8) + l] ^= 0x1FULL << (8 * (inlen % 8));
+        s->s[4 * ((RUDRAKSH_SHAKE128_RATE - 1) / 8) + l] ^= 1ULL << 63;
+    }
+}
+
+void rudraksh_shake128x4_squeezeblock(rudraksh_keccakx4_state *s, uint8_t out[4][RUDRAKSH_SHAKE128_RATE]) {
+    rudraksh_keccakf1600_x4(s->s);
+    for (int l = 0; l < 4; l++) {
+        for (int k = 0; k < RUDRAKSH_SHAKE128_RATE / 8; k++) store64_le(out[l] + 8 * k, s->s[4 * k + l]);
+    }
+}
+
+void rudraksh_shake256(uint8_t *out, size_t outlen, const uint8_t *in, size_t inlen) {
+    uint64_t s[25];
+
+    keccak_absorb_once(s, RUDRAKSH_SHAKE256_RATE, in, inlen);
+    while (outlen > 0) {
+        size_t n = outlen < RUDRAKSH_SHAKE256_RATE ? outlen : RUDRAKSH_SHAKE256_RATE;
+        rudraksh_keccakf1600(s);
+        for (size_t i = 0; i < n; i++) out[i] = (uint8_t)(s[i / 8] >> (8 * (i % 8)));
+        out += n;
+        outlen -= n;
+    }
+}
+
+// ==========================================================
+// 4. SHAKE 版本的 Rudraksh PRF / Hash (取代 rudraksh_ascon.c 的實作)
+//    輸入格式與 Ascon 版本相同：matrix A = key || i || j (18 bytes)，CBD = key || nonce (17 bytes)
+// ==========================================================
+
+#ifdef RUDRAKSH_SYM_KECCAK
+
+void rudraksh_hash(uint8_t *output, const uint8_t *input, size_t inlen, size_t outlen)
+{
+    RUDRAKSH_STAT_INC(hash);
+    rudraksh_shake256(output, outlen, input, inlen);
+}
+
+void rudraksh_prf_init_matrixA(RUDRAFKSH_STATE *s, const uint8_t *key, const uint8_t *nonce_i, const uint8_t *nonce_j)
+{
+    uint8_t input_buf[RUDRAKSH_PRF_matrixA_IN_BYTES];
+
+    memcpy(input_buf, key, 16);
+    input_buf[16] = *nonce_i;
+    input_buf[17] = *nonce_j;
+    rudraksh_shake128_absorb(s, input_buf, RUDRAKSH_PRF_matrixA_IN_BYTES);
+}
+
+// 一次初始化 4 個 A 多項式的 PRF，輸出串流與逐一呼叫 rudraksh_prf_init_matrixA 相同
+void rudraksh_prf_init_matrixA_x4(rudraksh_keccakx4_state *s, const uint8_t *key,
+                                  const uint8_t nonce_i[4], const uint8_t nonce_j[4])
+{
+    uint8_t input_buf[4][RUDRAKSH_PRF_matrixA_IN_BYTES];
+    const uint8_t *in[4] = { input_buf[0], input_buf[1], input_buf[2], input_buf[3] };
+
+    for (int l = 0; l < 4; l++) {
+        memcpy(input_buf[l], key, 16);
+        input_buf[l][16] = nonce_i[l];
+        input_buf[l][17] = nonce_j[l];
+    }
+    rudraksh_shake128x4_absorb(s, in, RUDRAKSH_PRF_matrixA_IN_BYTES);
+}
+
+void rudraksh_prf_init_cbd(RUDRAFKSH_STATE *s, const uint8_t *key, const uint8_t *nonce)
+{
+    uint8_t input_buf[RUDRAKSH_PRF_cbd_IN_BYTE];
+
+    memcpy(input_buf, key, 16);
+    input_buf[16] = *nonce;
+    rudraksh_shake128_absorb(s, input_buf, RUDRAKSH_PRF_cbd_IN_BYTE);
+}
+
+// call 一次 產生 8 bytes (rate = 21 個 lane，用完才置換)
+void rudraksh_prf_put(RUDRAFKSH_STATE *s, uint8_t *out)
+{
+    if (s->pos == RUDRAKSH_SHAKE128_RATE) {
+        rudraksh_keccakf1600(s->s);
+        s->pos = 0;
+    }
+    store64_le(out, s->s[s->pos / 8]);
+    s->pos += 8;
+}
+
+void rudraksh_drbg_init(rudraksh_drbg *d, const uint8_t seed[RUDRAKSH_DRBG_SEEDBYTES])
+{
+    rudraksh_shake128_absorb(&d->state, seed, RUDRAKSH_DRBG_SEEDBYTES);
+}
+
+#endif // RUDRAKSH_SYM_KECCAK
@@ -0,0 +1,39 @@
+#ifndef RUDRAKSH_KECCAK_H
+#define RUDRAKSH_KECCAK_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ==========================================================
+// Keccak-f[1600] / SHAKE (替代的對稱式後端)
+// 編譯時加上 -DRUDRAKSH_SYM_KECCAK (make ... KECCAK=1) 時，
+// rudraksh_prf_* / rudraksh_hash 改以 SHAKE128 / SHAKE256 實作；
+// 置換函式本身一律編譯，供 benchmark 比較
+// ==========================================================
+
+#define RUDRAKSH_SHAKE128_RATE 168
+#define RUDRAKSH_SHAKE256_RATE 136
+
+typedef struct {
+    uint64_t s[25];
+    unsigned pos;           // 目前區塊已輸出的 bytes，等於 rate 時下一次輸出前先置換
+} rudraksh_keccak_state;
+
+// 4 個獨立的 Keccak 狀態交錯存放：第 i 個狀態的 lane k 位於 s[4 * k + i]
+typedef struct {
+    uint64_t s[25 * 4];
+} rudraksh_keccakx4_state;
+
+void rudraksh_keccakf1600(uint64_t s[25]);
+void rudraksh_keccakf1600_x4(uint64_t s[25 * 4]);     // 支援 AVX2 時一次置換 4 個狀態
+const char *rudraksh_keccakf1600_x4_impl(void);       // "avx2" 或 "scalar"
+
+// SHAKE128：一次吸收全部輸入，之後逐區塊擠出
+void rudraksh_shake128_absorb(rudraksh_keccak_state *s, const uint8_t *in, size_t inlen);
+void rudraksh_shake128_squeeze(rudraksh_keccak_state *s, uint8_t *out, size_t outlen);
+void rudraksh_shake128x4_absorb(rudraksh_keccakx4_state *s, const uint8_t *const in[4], size_t inlen);
+void rudraksh_shake128x4_squeezeblock(rudraksh_keccakx4_state *s, uint8_t out[4][RUDRAKSH_SHAKE128_RATE]);
+
+void rudraksh_shake256(uint8_t *out, size_t outlen, const uint8_t *in, size_t inlen);
+
+#endif // RUDRAKSH_KECCAK_H
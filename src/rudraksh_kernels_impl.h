@@ -0,0 +1,273 @@
+// ==========================================================
+// 熱路徑核心 (kernel) 的唯一實作來源
+// 注意：本檔沒有 include guard，由 rudraksh_dispatch.c 在不同的 ISA 設定
+// (#pragma GCC target) 下重複 include，每次產生一組獨立的函式與 rudraksh_kernels 表
+// include 前需定義：
+//   RUDRAKSH_KERN_SUFFIX : 函式名稱後綴 (例如 avx2)
+//   RUDRAKSH_KERN_NAME   : 變體名稱字串 (例如 "avx2")
+// 選用：
+//   RUDRAKSH_KERN_ASCON_SUFFIX : Ascon 置換改用先前 include 的另一個變體 (該 ISA 下較慢時)
+//   RUDRAKSH_KERN_PACK_SUFFIX  : compress_u / tobytes_13bit 改用另一個變體
+// 各變體的原始碼完全相同，差異只在編譯器可使用的指令集 (自動向量化)，
+// 因此輸出必須與 scalar 版逐 bit 相同 (rudraksh_kernels_selftest 會檢查)
+// ==========================================================
+
+#define KERN_CAT2(a, b) a##_##b
+#define KERN_CAT(a, b) KERN_CAT2(a, b)
+#define KERN(name) KERN_CAT(name, RUDRAKSH_KERN_SUFFIX)
+
+// NTT / INTT (含頻率優先佈局版本)：完全展開的直線程式，由 tools/gen_ntt_unrolled.c 產生
+#include "rudraksh_ntt_unrolled.h"
+
+#if RUDRAKSH_NTT_BLOCK == 1
+// NTT 域點乘累加: r = r + a * b (同 fqmul / fqadd)
+static void KERN(basemul_acc)(poly *r, const poly *a, const poly *b) {
+    for (int i = 0; i < RUDRAKSH_N; i++) {
+        int16_t product = (int16_t)((int32_t)a->coeffs[i] * b->coeffs[i] % RUDRAKSH_Q);
+        int16_t res = r->coeffs[i] + product;
+        if (res >= RUDRAKSH_Q) res -= RUDRAKSH_Q;
+        r->coeffs[i] = res;
+    }
+}
+#else
+// 不完整 NTT 的點乘累加：每 d 個係數為 Z_q[x]/(x^d - gamma_k) 的一個元素，r = r + a * b
+// 折回項 (x^d = gamma_k) 改乘預先乘上 gamma_k 的 b (w[0..d-1])，每個輸出為 d 個乘積加 r (< 2^31)，只化約一次
+static void KERN(basemul_acc)(poly *r, const poly *a, const poly *b) {
+    for (int k = 0; k < RUDRAKSH_NTT_BLOCKS; k++) {
+        const int16_t *x = &a->coeffs[k * RUDRAKSH_NTT_BLOCK], *y = &b->coeffs[k * RUDRAKSH_NTT_BLOCK];
+        int16_t *z = &r->coeffs[k * RUDRAKSH_NTT_BLOCK];
+        int32_t w[2 * RUDRAKSH_NTT_BLOCK], acc[RUDRAKSH_NTT_BLOCK];
+
+        for (int v = 0; v < RUDRAKSH_NTT_BLOCK; v++) {
+            w[RUDRAKSH_NTT_BLOCK + v] = y[v];
+            w[v] = (int32_t)y[v] * ntt_gamma[k] % RUDRAKSH_Q;
+        }
+        // z[c] += sum_u x[u] * (u <= c ? y[c - u] : gamma_k * y[c - u + d])
+        for (int c = 0; c < RUDRAKSH_NTT_BLOCK; c++) {
+            acc[c] = z[c];
+            for (int u = 0; u < RUDRAKSH_NTT_BLOCK; u++) acc[c] += (int32_t)x[u] * w[RUDRAKSH_NTT_BLOCK + c - u];
+        }
+        for (int c = 0; c < RUDRAKSH_NTT_BLOCK; c++) z[c] = (int16_t)(acc[c] % RUDRAKSH_Q);
+    }
+}
+#endif
+
+// K 項點乘和：r = sum_j a[j * stride] * b[j] (矩陣的列 stride = 1，行 stride = K)
+static void KERN(basemul_dot)(poly *r, const poly *a, size_t stride, const poly *b) {
+    memset(r->coeffs, 0, sizeof(r->coeffs));
+    for (int j = 0; j < RUDRAKSH_K; j++) KERN(basemul_acc)(r, &a[j * stride], &b[j]);
+}
+
+// 頻率優先的批次小型 GEMV：每個 tile 內對 RUDRAKSH_FM_LANES 個頻率同時計算 K x K 矩陣乘向量
+// 輸入在 [0, q)，K 個乘積在 int32 累加 (9 * 7680^2 < 2^30) 後才化約一次
+// 不完整 NTT (d > 1) 時每個輸出係數累加 K * d 個乘積 (d = 4: 36 * 7680^2 < 2^31)；
+// 折回項 (x^d = gamma) 改乘預先乘上 gamma 的 s (gemv_fm_twist)，因此累加方式與 d = 1 相同
+static inline void KERN(gemv_fm_reduce)(int16_t b[RUDRAKSH_K][RUDRAKSH_FM_LANES],
+                                        const int32_t acc[RUDRAKSH_K][RUDRAKSH_FM_LANES]) {
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        for (int l = 0; l < RUDRAKSH_FM_LANES; l++) b[i][l] = (int16_t)((uint32_t)acc[i][l] % RUDRAKSH_Q);
+    }
+}
+
+// 子環組 g 的 s 係數乘上各 lane 的 gamma：twist[v] = s 的第 v 次項 * gamma (v = 1..d-1)
+static inline void KERN(gemv_fm_twist)(int16_t twist[RUDRAKSH_NTT_BLOCK][RUDRAKSH_K][RUDRAKSH_FM_LANES],
+                                       const polyvec_fm *s, int g) {
+    const int16_t *gamma = &ntt_gamma[g * RUDRAKSH_FM_LANES];
+    for (int v = 1; v < RUDRAKSH_NTT_BLOCK; v++) {
+        for (int j = 0; j < RUDRAKSH_K; j++) {
+            for (int l = 0; l < RUDRAKSH_FM_LANES; l++) {
+                twist[v][j][l] = (int16_t)((int32_t)s->t[v * RUDRAKSH_FM_GROUPS + g][j][l] * gamma[l] % RUDRAKSH_Q);
+            }
+        }
+    }
+}
+
+// 輸出第 c 次項時，A 的第 u 次項要乘的 s：u <= c 取 s 的第 c - u 次項，否則取折回的 twist[c - u + d]
+#define KERN_FM_S(s, twist, g, c, u) \
+    ((u) <= (c) ? (s)->t[((c) - (u)) * RUDRAKSH_FM_GROUPS + (g)] : (twist)[(c) - (u) + RUDRAKSH_NTT_BLOCK])
+
+// b = A s：一次算一列，j 迴圈需完全展開，否則 GCC 會把 (j, l) 合併成一個長迴圈而向量化失敗
+static void KERN(gemv_fm)(polyvec_fm *b, const polymat_fm *A, const polyvec_fm *s) {
+    int16_t twist[RUDRAKSH_NTT_BLOCK][RUDRAKSH_K][RUDRAKSH_FM_LANES];
+    for (int g = 0; g < RUDRAKSH_FM_GROUPS; g++) {
+        KERN(gemv_fm_twist)(twist, s, g);
+        for (int c = 0; c < RUDRAKSH_NTT_BLOCK; c++) {
+            int32_t acc[RUDRAKSH_K][RUDRAKSH_FM_LANES] = {{0}};
+            for (int u = 0; u < RUDRAKSH_NTT_BLOCK; u++) {
+                const int16_t (*a)[RUDRAKSH_K][RUDRAKSH_FM_LANES] = A->t[u * RUDRAKSH_FM_GROUPS + g];
+                const int16_t (*x)[RUDRAKSH_FM_LANES] = KERN_FM_S(s, twist, g, c, u);
+                for (int i = 0; i < RUDRAKSH_K; i++) {
+#pragma GCC unroll 16
+                    for (int j = 0; j < RUDRAKSH_K; j++) {
+                        for (int l = 0; l < RUDRAKSH_FM_LANES; l++) acc[i][l] += (int32_t)a[i][j][l] * x[j][l];
+                    }
+                }
+            }
+            KERN(gemv_fm_reduce)(b->t[c * RUDRAKSH_FM_GROUPS + g], acc);
+        }
+    }
+}
+
+// b = A^T s：A 的第 j 列 (K 個頻率組) 連續，對所有輸出列累加 s[j]
+static void KERN(gemv_t_fm)(polyvec_fm *b, const polymat_fm *A, const polyvec_fm *s) {
+    int16_t twist[RUDRAKSH_NTT_BLOCK][RUDRAKSH_K][RUDRAKSH_FM_LANES];
+    for (int g = 0; g < RUDRAKSH_FM_GROUPS; g++) {
+        KERN(gemv_fm_twist)(twist, s, g);
+        for (int c = 0; c < RUDRAKSH_NTT_BLOCK; c++) {
+            int32_t acc[RUDRAKSH_K][RUDRAKSH_FM_LANES] = {{0}};
+            for (int u = 0; u < RUDRAKSH_NTT_BLOCK; u++) {
+                const int16_t (*a)[RUDRAKSH_K][RUDRAKSH_FM_LANES] = A->t[u * RUDRAKSH_FM_GROUPS + g];
+                const int16_t (*x)[RUDRAKSH_FM_LANES] = KERN_FM_S(s, twist, g, c, u);
+                for (int j = 0; j < RUDRAKSH_K; j++) {
+                    for (int i = 0; i < RUDRAKSH_K; i++) {
+                        for (int l = 0; l < RUDRAKSH_FM_LANES; l++) acc[i][l] += (int32_t)a[j][i][l] * x[j][l];
+                    }
+                }
+            }
+            KERN(gemv_fm_reduce)(b->t[c * RUDRAKSH_FM_GROUPS + g], acc);
+        }
+    }
+}
+
+#undef KERN_FM_S
+
+// 多項式加減 (同 fqadd / fqsub，輸入在 [0, q))
+static void KERN(poly_add)(poly *r, const poly *a, const poly *b) {
+    for (int i = 0; i < RUDRAKSH_N; i++) {
+        int16_t res = a->coeffs[i] + b->coeffs[i];
+        if (res >= RUDRAKSH_Q) res -= RUDRAKSH_Q;
+        r->coeffs[i] = res;
+    }
+}
+
+static void KERN(poly_sub)(poly *r, const poly *a, const poly *b) {
+    for (int i = 0; i < RUDRAKSH_N; i++) {
+        int16_t res = a->coeffs[i] - b->coeffs[i];
+        if (res < 0) res += RUDRAKSH_Q;
+        r->coeffs[i] = res;
+    }
+}
+
+// Encode: m * floor(q / 2^B) = m * 1920 (m 為 0~3)
+static void KERN(encode)(poly *r, const poly *m) {
+    for (int i = 0; i < RUDRAKSH_N; i++) r->coeffs[i] = m->coeffs[i] * (RUDRAKSH_Q / 4);
+}
+
+// Decode: round(4 * x / q) mod 4 (x 在 [0, q))
+static void KERN(decode)(poly *m, const poly *noisy_poly) {
+    for (int i = 0; i < RUDRAKSH_N; i++) {
+        uint32_t t = ((uint32_t)noisy_poly->coeffs[i] << 2) + RUDRAKSH_Q / 2;
+        m->coeffs[i] = (t / RUDRAKSH_Q) & 0x3;
+    }
+}
+
+// Ascon 置換
+#ifdef RUDRAKSH_KERN_ASCON_SUFFIX
+#define KERN_ASCON(name) KERN_CAT(name, RUDRAKSH_KERN_ASCON_SUFFIX)
+#else
+#define KERN_ASCON(name) KERN(name)
+static void KERN(ascon_p12)(ascon_state_t *s) { P12ROUNDS(s); }
+static void KERN(ascon_p8)(ascon_state_t *s) { P8ROUNDS(s); }
+#endif
+
+// CBD (eta = 1) 取樣：32 bytes PRF 輸出 -> 64 個係數 (mod q)
+// 每個係數用 4 bits：HW(低 2 bits) - HW(高 2 bits)，範圍 [-2, 2]
+static void KERN(cbd_eta)(poly *e, const uint8_t buf[32]) {
+    for (int i = 0; i < 32; i++) {
+        uint8_t byte = buf[i];
+        int16_t d1 = (int16_t)((byte & 0x1) + ((byte >> 1) & 0x1)) - (int16_t)(((byte >> 2) & 0x1) + ((byte >> 3) & 0x1));
+        int16_t d2 = (int16_t)(((byte >> 4) & 0x1) + ((byte >> 5) & 0x1)) - (int16_t)(((byte >> 6) & 0x1) + ((byte >> 7) & 0x1));
+
+        // 符號轉換：負數加上 q
+        if (d1 < 0) d1 += RUDRAKSH_Q;
+        if (d2 < 0) d2 += RUDRAKSH_Q;
+
+        e->coeffs[2 * i] = d1;
+        e->coeffs[2 * i + 1] = d2;
+    }
+}
+
+#ifdef RUDRAKSH_KERN_PACK_SUFFIX
+#define KERN_PACK(name) KERN_CAT(name, RUDRAKSH_KERN_PACK_SUFFIX)
+#else
+#define KERN_PACK(name) KERN(name)
+
+// Compress U: 係數 mod q -> 10 bits，4 個係數 (40 bits) -> 5 bytes
+static void KERN(compress_u)(uint8_t *r, const poly *a) {
+    uint16_t t[4];
+    int ctr = 0;
+
+    for (int i = 0; i < RUDRAKSH_N / 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            // round(1024 * x / 7681)
+            uint32_t val = (uint32_t)a->coeffs[4 * i + j];
+            val = (val << 10) + (RUDRAKSH_Q / 2);
+            val = val / RUDRAKSH_Q;
+            t[j] = val & 0x3FF;
+        }
+
+        r[ctr + 0] = (t[0] >> 0);
+        r[ctr + 1] = (t[0] >> 8) | (t[1] << 2);
+        r[ctr + 2] = (t[1] >> 6) | (t[2] << 4);
+        r[ctr + 3] = (t[2] >> 4) | (t[3] << 6);
+        r[ctr + 4] = (t[3] >> 2);
+        ctr += 5;
+    }
+}
+
+// Serialize 13-bit: 8 個係數 (104 bits) -> 13 bytes
+static void KERN(tobytes_13bit)(uint8_t *r, const poly *a) {
+    int ctr = 0;
+    for (int i = 0; i < RUDRAKSH_N / 8; i++) {
+        uint16_t t[8];
+        for (int k = 0; k < 8; k++) t[k] = a->coeffs[8 * i + k] & 0x1FFF;
+
+        r[ctr + 0]  = (t[0] >> 0);
+        r[ctr + 1]  = (t[0] >> 8) | (t[1] << 5);
+        r[ctr + 2]  = (t[1] >> 3);
+        r[ctr + 3]  = (t[1] >> 11) | (t[2] << 2);
+        r[ctr + 4]  = (t[2] >> 6) | (t[3] << 7);
+        r[ctr + 5]  = (t[3] >> 1);
+        r[ctr + 6]  = (t[3] >> 9) | (t[4] << 4);
+        r[ctr + 7]  = (t[4] >> 4);
+        r[ctr + 8]  = (t[4] >> 12) | (t[5] << 1);
+        r[ctr + 9]  = (t[5] >> 7) | (t[6] << 6);
+        r[ctr + 10] = (t[6] >> 2);
+        r[ctr + 11] = (t[6] >> 10) | (t[7] << 3);
+        r[ctr + 12] = (t[7] >> 5);
+        ctr += 13;
+    }
+}
+
+#endif
+
+static const rudraksh_kernels KERN(kernels) = {
+    RUDRAKSH_KERN_NAME,
+    KERN(ntt),
+    KERN(invntt),
+    KERN(basemul_acc),
+    KERN(ntt_fm),
+    KERN(invntt_fm),
+    KERN(gemv_fm),
+    KERN(gemv_t_fm),
+    KERN_ASCON(ascon_p12),
+    KERN_ASCON(ascon_p8),
+    KERN(cbd_eta),
+    KERN_PACK(compress_u),
+    KERN_PACK(tobytes_13bit),
+    KERN(poly_add),
+    KERN(poly_sub),
+    KERN(encode),
+    KERN(decode),
+    KERN(basemul_dot),
+};
+
+#undef KERN
+#undef KERN_ASCON
+#undef KERN_PACK
+#undef KERN_CAT
+#undef KERN_CAT2
+#undef RUDRAKSH_KERN_SUFFIX
+#undef RUDRAKSH_KERN_NAME
+#undef RUDRAKSH_KERN_ASCON_SUFFIX
+#undef RUDRAKSH_KERN_PACK_SUFFIX
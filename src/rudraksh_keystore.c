@@ -0,0 +1,318 @@
+#ifndef _WIN32
+#define _FILE_OFFSET_BITS 64 // keystore 檔案可能超過 2 GB
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rudraksh_keystore.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#define ks_fseek _fseeki64
+#define ks_ftell _ftelli64
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ks_fseek fseeko
+#define ks_ftell ftello
+#endif
+
+// ==========================================================
+// 1. 格式輔助函式
+// ==========================================================
+
+static size_t record_bytes_of(uint32_t key_format) {
+    switch (key_format) {
+        case RUDRAKSH_KEYSTORE_FMT_STANDARD: return CRYPTO_SECRETKEYBYTES;
+        case RUDRAKSH_KEYFMT_NTT:            return CRYPTO_SECRETKEYBYTES_NTT;
+        case RUDRAKSH_KEYFMT_PACKED:         return CRYPTO_SECRETKEYBYTES_PACKED;
+        default:                             return 0; // seed 格式不含 pkh，無法建立索引
+    }
+}
+
+// 記錄中 pkh 的位置
+//   standard : s || pk || pkh || z
+//   ntt      : header || s_hat || b_hat || seedA || pkh || z
+//   packed   : header || s(3-bit) || pk || pkh || z
+const uint8_t *rudraksh_keystore_record_pkh(uint32_t key_format, const uint8_t *record) {
+    switch (key_format) {
+        case RUDRAKSH_KEYSTORE_FMT_STANDARD:
+            return record + CRYPTO_SECRETKEYBYTES_PKE + CRYPTO_PUBLICKEYBYTES;
+        case RUDRAKSH_KEYFMT_NTT:
+            return record + RUDRAKSH_KEYFMT_HEADERBYTES + CRYPTO_SECRETKEYBYTES_PKE + CRYPTO_PUBLICKEYBYTES;
+        case RUDRAKSH_KEYFMT_PACKED:
+            return record + RUDRAKSH_KEYFMT_HEADERBYTES + CRYPTO_SECRETKEYBYTES_S_3BIT + CRYPTO_PUBLICKEYBYTES;
+        default:
+            return NULL;
+    }
+}
+
+// pkh 本身即為雜湊輸出，直接取前 8 bytes 作為起始槽位
+static uint64_t slot_start(const uint8_t *pkh, uint64_t mask) {
+    uint64_t h = 0;
+    for (int i = 0; i < 8; i++) h |= (uint64_t)pkh[i] << (8 * i);
+    return h & mask;
+}
+
+static uint64_t index_offset(void) {
+    return RUDRAKSH_KEYSTORE_HEADERBYTES;
+}
+
+static uint64_t records_offset(const rudraksh_keystore_header *hdr) {
+    return RUDRAKSH_KEYSTORE_HEADERBYTES + hdr->index_slots * sizeof(rudraksh_keystore_slot);
+}
+
+// 寫入 stdio 緩衝並同步到磁碟 (fsync / _commit)，回傳 0 代表成功
+static int ks_sync(FILE *f) {
+    if (fflush(f) != 0) return -1;
+#ifdef _WIN32
+    return _commit(_fileno(f)) == 0 ? 0 : -1;
+#else
+    return fsync(fileno(f)) == 0 ? 0 : -1;
+#endif
+}
+
+// file_bytes 為檔案 (映射) 大小：index 與已提交的記錄都必須在檔案內
+// 一律以除法比較，header 內容任意時也不會溢位 (records_offset 只在通過檢查後使用)
+static int header_valid(const rudraksh_keystore_header *hdr, uint64_t file_bytes) {
+    if (memcmp(hdr->magic, RUDRAKSH_KEYSTORE_MAGIC, sizeof(hdr->magic)) != 0) return 0;
+    if (hdr->version != RUDRAKSH_KEYSTORE_VERSION) return 0;
+    if (hdr->record_bytes == 0 || hdr->record_bytes != record_bytes_of(hdr->key_format)) return 0;
+    if (hdr->index_slots == 0 || (hdr->index_slots & (hdr->index_slots - 1)) != 0) return 0;
+    if (hdr->count > hdr->index_slots / 2) return 0;
+    if (file_bytes < RUDRAKSH_KEYSTORE_HEADERBYTES) return 0;
+    if (hdr->index_slots > (file_bytes - RUDRAKSH_KEYSTORE_HEADERBYTES) / sizeof(rudraksh_keystore_slot)) return 0;
+    if (hdr->count > (file_bytes - records_offset(hdr)) / hdr->record_bytes) return 0;
+    return 1;
+}
+
+// ==========================================================
+// 2. 建立 / 附加 (stdio，寫入端)
+// ==========================================================
+
+int rudraksh_keystore_create(const char *path, uint32_t key_format, uint64_t max_keys) {
+    rudraksh_keystore_header hdr;
+    rudraksh_keystore_slot zero[256];
+
+    if (record_bytes_of(key_format) == 0) return -1;
+
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, RUDRAKSH_KEYSTORE_MAGIC, sizeof(hdr.magic));
+    hdr.version = RUDRAKSH_KEYSTORE_VERSION;
+    hdr.key_format = key_format;
+    hdr.record_bytes = (uint32_t)record_bytes_of(key_format);
+
+    // 負載因子 <= 1/2，linear probing 的平均探測次數維持在 1~2 次
+    hdr.index_slots = 256;
+    while (hdr.index_slots / 2 < max_keys) hdr.index_slots <<= 1;
+
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) return -1;
+
+    int ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1;
+    memset(zero, 0, sizeof(zero));
+    for (uint64_t i = 0; ok && i < hdr.index_slots; i += 256) {
+        ok = fwrite(zero, sizeof(zero), 1, f) == 1;
+    }
+
+    ok &= fclose(f) == 0;
+    return ok ? 0 : -1;
+}
+
+int64_t rudraksh_keystore_append(const char *path, const void *records, size_t n) {
+    rudraksh_keystore_header hdr;
+    rudraksh_keystore_slot *index = NULL;
+    const uint8_t *in = (const uint8_t *)records;
+    int64_t added = -1;
+
+    FILE *f = fopen(path, "r+b");
+    if (f == NULL) return -1;
+
+    if (fread(&hdr, sizeof(hdr), 1, f) != 1) goto done;
+    // 以檔案大小限制 index_slots，避免損壞的 header 造成過大的配置或乘法溢位
+    if (ks_fseek(f, 0, SEEK_END) != 0) goto done;
+    int64_t file_bytes = ks_ftell(f);
+    if (file_bytes < 0 || !header_valid(&hdr, (uint64_t)file_bytes)) goto done;
+    if (ks_fseek(f, (int64_t)index_offset(), SEEK_SET) != 0) goto done;
+    if (hdr.count + n > hdr.index_slots / 2) goto done;
+
+    index = malloc(hdr.index_slots * sizeof(rudraksh_keystore_slot));
+    if (index == NULL) goto done;
+    if (fread(index, sizeof(rudraksh_keystore_slot), hdr.index_slots, f) != hdr.index_slots) goto done;
+
+    // 清除上次未提交 (record > count) 的槽位
+    // 這些槽位都比已提交的記錄晚插入，清除不會切斷已提交記錄的探測鏈
+    for (uint64_t i = 0; i < hdr.index_slots; i++) {
+        if (index[i].record > hdr.count) memset(&index[i], 0, sizeof(index[i]));
+    }
+
+    // 1. 記錄寫在檔尾 (覆蓋上次未提交的部分)；連續的非重複記錄合併成一次 fwrite
+    uint64_t count = hdr.count;
+    uint64_t mask = hdr.index_slots - 1;
+    size_t run_start = 0, run_len = 0;
+
+    if (ks_fseek(f, (int64_t)(records_offset(&hdr) + count * hdr.record_bytes), SEEK_SET) != 0) goto done;
+
+    for (size_t k = 0; k < n; k++) {
+        const uint8_t *rec = in + k * hdr.record_bytes;
+        const uint8_t *pkh = rudraksh_keystore_record_pkh(hdr.key_format, rec);
+        uint64_t i = slot_start(pkh, mask);
+        int dup = 0;
+
+        while (index[i].record != 0) {
+            if (memcmp(index[i].pkh, pkh, RUDRAKSH_len_K) == 0) { dup = 1; break; }
+            i = (i + 1) & mask;
+        }
+
+        if (dup) {
+            if (run_len && fwrite(in + run_start * hdr.record_bytes, hdr.record_bytes, run_len, f) != run_len) goto done;
+            run_len = 0;
+            continue;
+        }
+
+        memcpy(index[i].pkh, pkh, RUDRAKSH_len_K);
+        index[i].record = ++count;
+        if (run_len == 0) run_start = k;
+        run_len++;
+    }
+    if (run_len && fwrite(in + run_start * hdr.record_bytes, hdr.record_bytes, run_len, f) != run_len) goto done;
+
+    // 2. 寫回 index，記錄與 index 同步到磁碟後才更新 count
+    if (ks_fseek(f, (int64_t)index_offset(), SEEK_SET) != 0) goto done;
+    if (fwrite(index, sizeof(rudraksh_keystore_slot), hdr.index_slots, f) != hdr.index_slots) goto done;
+    if (ks_sync(f) != 0) goto done;
+
+    // 3. 最後更新 count 並同步 (commit point)，中途失敗或斷電時讀取端仍只看到舊的記錄
+    added = (int64_t)(count - hdr.count);
+    hdr.count = count;
+    if (ks_fseek(f, 0, SEEK_SET) != 0 || fwrite(&hdr, sizeof(hdr), 1, f) != 1 || ks_sync(f) != 0) added = -1;
+
+done:
+    free(index);
+    if (fclose(f) != 0) added = -1;
+    return added;
+}
+
+// ==========================================================
+// 3. 唯讀映射 (讀取端)
+// ==========================================================
+
+int rudraksh_keystore_open(rudraksh_keystore *ks, const char *path) {
+    memset(ks, 0, sizeof(*ks));
+
+#ifdef _WIN32
+    LARGE_INTEGER size;
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return -1;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart < RUDRAKSH_KEYSTORE_HEADERBYTES) {
+        CloseHandle(file);
+        return -1;
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) {
+        CloseHandle(file);
+        return -1;
+    }
+    void *base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (base == NULL) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return -1;
+    }
+    ks->file_handle = file;
+    ks->map_handle = mapping;
+    ks->map_bytes = (size_t)size.QuadPart;
+#else
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    if (fstat(fd, &st) != 0 || st.st_size < RUDRAKSH_KEYSTORE_HEADERBYTES) {
+        close(fd);
+        return -1;
+    }
+    void *base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        return -1;
+    }
+    // 查詢為隨機存取，關閉預讀
+    madvise(base, (size_t)st.st_size, MADV_RANDOM);
+    ks->fd = fd;
+    ks->map_bytes = (size_t)st.st_size;
+#endif
+
+    ks->base = (const uint8_t *)base;
+    ks->header = (const rudraksh_keystore_header *)ks->base;
+
+    if (!header_valid(ks->header, ks->map_bytes)) {
+        rudraksh_keystore_close(ks);
+        return -1;
+    }
+
+    // 之後的附加會改寫映射中的 count，查詢一律以此快照為準
+    ks->count = ks->header->count;
+    ks->index = (const rudraksh_keystore_slot *)(ks->base + index_offset());
+    ks->records = ks->base + records_offset(ks->header);
+    return 0;
+}
+
+void rudraksh_keystore_close(rudraksh_keystore *ks) {
+    if (ks->base == NULL) return;
+#ifdef _WIN32
+    UnmapViewOfFile((LPCVOID)ks->base);
+    CloseHandle(ks->map_handle);
+    CloseHandle(ks->file_handle);
+#else
+    munmap((void *)ks->base, ks->map_bytes);
+    close(ks->fd);
+#endif
+    memset(ks, 0, sizeof(*ks));
+}
+
+// ==========================================================
+// 4. 查詢與 Decapsulation (zero-copy)
+// ==========================================================
+
+const uint8_t *rudraksh_keystore_find(const rudraksh_keystore *ks, const uint8_t pkh[RUDRAKSH_len_K]) {
+    const rudraksh_keystore_header *hdr = ks->header;
+    uint64_t mask = hdr->index_slots - 1;
+    uint64_t i = slot_start(pkh, mask);
+
+    for (uint64_t probe = 0; probe < hdr->index_slots; probe++) {
+        const rudraksh_keystore_slot *s = &ks->index[i];
+        uint64_t record = s->record; // 槽位可能正被其他行程改寫，只讀一次
+        if (record == 0) return NULL;
+        // record > count 為尚未提交或 open 之後才附加的記錄；另外確認整筆記錄都在映射範圍內
+        if (record <= ks->count && memcmp(s->pkh, pkh, RUDRAKSH_len_K) == 0) {
+            uint64_t offset = (uint64_t)(ks->records - ks->base) + (record - 1) * hdr->record_bytes;
+            if (offset + hdr->record_bytes > ks->map_bytes) return NULL;
+            return ks->base + offset;
+        }
+        i = (i + 1) & mask;
+    }
+    return NULL;
+}
+
+int rudraksh_keystore_decapsulate(const rudraksh_keystore *ks, const uint8_t pkh[RUDRAKSH_len_K],
+                                  cipher_text *c, shared_secret *K) {
+    const uint8_t *rec = rudraksh_keystore_find(ks, pkh);
+    if (rec == NULL) return -1;
+
+    // 記錄皆為 uint8_t 陣列 (alignment 1)，可直接視為對應的 bitstream 結構
+    switch (ks->header->key_format) {
+        case RUDRAKSH_KEYSTORE_FMT_STANDARD:
+            rudraksh_kem_decapsulate((const secret_key_bitstream *)rec, c, K);
+            return 0;
+        case RUDRAKSH_KEYFMT_NTT:
+            return rudraksh_kem_decapsulate_ntt((const secret_key_bitstream_ntt *)rec, c, K);
+        case RUDRAKSH_KEYFMT_PACKED:
+            return rudraksh_kem_decapsulate_packed((const secret_key_bitstream_packed *)rec, c, K);
+        default:
+            return -1;
+    }
+}
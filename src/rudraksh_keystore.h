@@ -0,0 +1,84 @@
+#ifndef RUDRAKSH_KEYSTORE_H
+#define RUDRAKSH_KEYSTORE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "rudraksh_params.h"
+#include "rudraksh_crypto.h"
+
+// ==========================================================
+// Memory-mapped Keystore
+// 檔案格式 (little-endian):
+//   header (64 bytes) || index (index_slots * 24 bytes) || records (count * record_bytes)
+// index 為 open addressing (linear probing)，以私鑰內的 pkh 為 key
+// records 為固定長度、只增不改 (append-only)，讀取端直接在映射記憶體上 decaps
+// ==========================================================
+
+#define RUDRAKSH_KEYSTORE_MAGIC "RDKSTORE"
+#define RUDRAKSH_KEYSTORE_VERSION 1
+#define RUDRAKSH_KEYSTORE_HEADERBYTES 64
+
+// 記錄格式 (標準格式沒有 header byte，以 0x00 | profile 表示；其他 profile 編出的 keystore 會被拒絕開啟)
+#define RUDRAKSH_KEYSTORE_FMT_STANDARD (0x00 | RUDRAKSH_PROFILE) // secret_key_bitstream (1920 bytes)
+// RUDRAKSH_KEYFMT_NTT    : secret_key_bitstream_ntt (1921 bytes)
+// RUDRAKSH_KEYFMT_PACKED : secret_key_bitstream_packed (1201 bytes)
+
+typedef struct {
+    char magic[8];          // "RDKSTORE"
+    uint32_t version;
+    uint32_t key_format;    // 記錄格式
+    uint32_t record_bytes;  // 每筆記錄大小
+    uint32_t reserved;
+    uint64_t index_slots;   // 2 的冪次，最多存放 index_slots / 2 把金鑰
+    uint64_t count;         // 已提交的記錄數 (最後寫入，作為 commit point)
+    uint8_t pad[24];
+} rudraksh_keystore_header;
+
+typedef struct {
+    uint8_t pkh[RUDRAKSH_len_K];
+    uint64_t record;        // 記錄編號 + 1 (0 代表空槽)
+} rudraksh_keystore_slot;
+
+// 唯讀映射後的 keystore
+// 映射長度固定為 open 當時的檔案大小；之後其他行程附加的記錄不在映射範圍內，
+// 查詢只看 open 時的 count (重新 open 才看得到新記錄)
+typedef struct {
+    const uint8_t *base;
+    size_t map_bytes;
+    uint64_t count;         // open 時已提交的記錄數
+    const rudraksh_keystore_header *header;
+    const rudraksh_keystore_slot *index;
+    const uint8_t *records;
+#ifdef _WIN32
+    void *file_handle;
+    void *map_handle;
+#else
+    int fd;
+#endif
+} rudraksh_keystore;
+
+// 建立空的 keystore 檔案，max_keys 決定 index 大小 (之後無法擴充)
+// 回傳值：0 代表成功，-1 代表失敗
+int rudraksh_keystore_create(const char *path, uint32_t key_format, uint64_t max_keys);
+
+// 批次附加 n 筆記錄 (records 為連續的 n * record_bytes)，pkh 重複的記錄會略過
+// 記錄與 index 先寫入並同步到磁碟，最後才寫入 count 並再次同步 (中途斷電時 count 不會涵蓋未寫完的記錄)
+// 回傳值：實際新增的筆數，-1 代表失敗 (檔案錯誤或容量不足，此時不寫入任何記錄)
+int64_t rudraksh_keystore_append(const char *path, const void *records, size_t n);
+
+// 唯讀映射 / 解除映射
+int rudraksh_keystore_open(rudraksh_keystore *ks, const char *path);
+void rudraksh_keystore_close(rudraksh_keystore *ks);
+
+// 以 pkh 查詢，回傳指向映射記憶體中的記錄 (zero-copy)，找不到 (或為 open 之後才附加的記錄) 回傳 NULL
+const uint8_t *rudraksh_keystore_find(const rudraksh_keystore *ks, const uint8_t pkh[RUDRAKSH_len_K]);
+
+// 以 pkh 找到私鑰並直接在映射記憶體上 decaps
+// 回傳值：0 代表成功，-1 代表找不到金鑰
+int rudraksh_keystore_decapsulate(const rudraksh_keystore *ks, const uint8_t pkh[RUDRAKSH_len_K],
+                                  cipher_text *c, shared_secret *K);
+
+// 記錄中 pkh 的位置 (依格式不同)
+const uint8_t *rudraksh_keystore_record_pkh(uint32_t key_format, const uint8_t *record);
+
+#endif // RUDRAKSH_KEYSTORE_H
@@ -0,0 +1,173 @@
+#include <stdint.h>
+#include <string.h>
+#include "rudraksh_math.h"
+#include "rudraksh_params.h"
+#include "rudraksh_stats.h"
+
+// ==========================================================
+// Kronecker substitution 負循環乘法 (一般域，只用 64-bit 整數乘法)
+// 多項式 a(x) 代入 x = 2^W 打包成一個大整數 (每個係數佔 W bits)，兩個大整數相乘後
+// 每 W bits 就是乘積多項式的一個係數，再依 x^64 = -1 摺疊並 mod q
+//
+// 打包寬度分析 (係數取 [0, q) 的非負代表，打包與拆解都不需要處理借位)：
+//   單一乘積的係數最多 64 項相加：64 * (q-1)^2 = 3,774,873,600 < 2^32
+//   整列 K = 9 個乘積直接在大整數上累加後才拆解：9 * 64 * (q-1)^2 = 33,973,862,400 < 2^35
+//   因此 W = 35：64 個係數剛好 35 個 64-bit limb，乘積 70 個 limb；每列只拆解一次
+// 大整數乘法為 comba 形式的 schoolbook (35 x 35 = 1225 次 64 x 64 -> 128-bit 乘法)，
+// 有 unsigned __int128 時直接使用，否則以 32-bit 分段計算
+// ==========================================================
+
+#define KRON_W 35
+#define KRON_LIMBS (RUDRAKSH_N * KRON_W / 64)   // 35
+#define KRON_MASK ((1ULL << KRON_W) - 1)
+
+#if RUDRAKSH_N * KRON_W % 64 != 0
+#error "KRON_W * RUDRAKSH_N must be a multiple of 64"
+#endif
+#if RUDRAKSH_K * RUDRAKSH_N * (RUDRAKSH_Q - 1) * (RUDRAKSH_Q - 1) >= (1LL << KRON_W)
+#error "KRON_W too small for K-way accumulation"
+#endif
+
+// ==========================================================
+// 1. 64 x 64 -> 128-bit 乘法
+// ==========================================================
+
+#if defined(__SIZEOF_INT128__)
+static inline void mul64(uint64_t a, uint64_t b, uint64_t *lo, uint64_t *hi) {
+    unsigned __int128 p = (unsigned __int128)a * b;
+    *lo = (uint64_t)p;
+    *hi = (uint64_t)(p >> 64);
+}
+#else
+static inline void mul64(uint64_t a, uint64_t b, uint64_t *lo, uint64_t *hi) {
+    uint64_t a0 = (uint32_t)a, a1 = a >> 32, b0 = (uint32_t)b, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = (p00 >> 32) + (uint32_t)p01 + (uint32_t)p10;
+    *lo = (mid << 32) | (uint32_t)p00;
+    *hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+}
+#endif
+
+// ==========================================================
+// 2. 打包 / 大整數乘法 / 拆解
+// ==========================================================
+
+// x = 2^W 代入 a(x)，係數化約到 [0, q)
+static void kron_pack(uint64_t r[KRON_LIMBS], const poly *a) {
+    memset(r, 0, KRON_LIMBS * sizeof(uint64_t));
+    for (int i = 0; i < RUDRAKSH_N; i++) {
+        int32_t c = a->coeffs[i] % RUDRAKSH_Q;
+        if (c < 0) c += RUDRAKSH_Q;
+
+        unsigned pos = (unsigned)i * KRON_W, limb = pos / 64, off = pos % 64;
+        r[limb] |= (uint64_t)c << off;
+        if (off + KRON_W > 64) r[limb + 1] |= (uint64_t)c >> (64 - off);
+    }
+}
+
+// acc += a * b (comba：逐欄累加到 3 個 word，再與 acc 對應的 limb 相加)
+// 累加結果每個 W-bit 欄位都不會溢位 (見上方分析)，因此整數總和不會超出 2 * KRON_LIMBS 個 limb
+static void kron_mul_acc(uint64_t acc[2 * KRON_LIMBS], const uint64_t a[KRON_LIMBS], const uint64_t b[KRON_LIMBS]) {
+    uint64_t t0 = 0, t1 = 0, t2 = 0;
+    RUDRAKSH_STAT_INC(poly_mul);
+
+    for (int k = 0; k < 2 * KRON_LIMBS - 1; k++) {
+        int lo = k < KRON_LIMBS ? 0 : k - KRON_LIMBS + 1;
+        int hi = k < KRON_LIMBS ? k : KRON_LIMBS - 1;
+
+        uint64_t c = (t0 += acc[k]) < acc[k];
+        t1 += c;
+        t2 += t1 < c;
+
+        for (int i = lo; i <= hi; i++) {
+            uint64_t pl, ph;
+            mul64(a[i], b[k - i], &pl, &ph);
+            t0 += pl;
+            ph += t0 < pl;          // ph <= 2^64 - 2，不會溢位
+            t1 += ph;
+            t2 += t1 < ph;
+        }
+        acc[k] = t0;
+        t0 = t1;
+        t1 = t2;
+        t2 = 0;
+    }
+    acc[2 * KRON_LIMBS - 1] += t0;
+}
+
+// 取出第 i 個 W-bit 欄位 (乘積多項式的第 i 個係數)
+static inline uint64_t kron_field(const uint64_t acc[2 * KRON_LIMBS], int i) {
+    unsigned pos = (unsigned)i * KRON_W, limb = pos / 64, off = pos % 64;
+    uint64_t v = acc[limb] >> off;
+    if (off + KRON_W > 64) v |= acc[limb + 1] << (64 - off);
+    return v & KRON_MASK;
+}
+
+// r = acc mod (x^64 + 1, q)
+static void kron_unpack(poly *r, const uint64_t acc[2 * KRON_LIMBS]) {
+    for (int i = 0; i < RUDRAKSH_N; i++) {
+        int64_t lo = (int64_t)kron_field(acc, i);
+        int64_t hi = i < RUDRAKSH_N - 1 ? (int64_t)kron_field(acc, i + RUDRAKSH_N) : 0;
+        int64_t v = (lo - hi) % RUDRAKSH_Q;
+        if (v < 0) v += RUDRAKSH_Q;
+        r->coeffs[i] = (int16_t)v;
+    }
+}
+
+// ==========================================================
+// 3. 乘法介面 (可直接替換 schoolbook 版本)
+// ==========================================================
+
+// r = r + a * b
+void poly_basemul_acc_kronecker(poly *r, const poly *a, const poly *b) {
+    uint64_t pa[KRON_LIMBS], pb[KRON_LIMBS], acc[2 * KRON_LIMBS] = {0};
+    poly prod;
+
+    kron_pack(pa, a);
+    kron_pack(pb, b);
+    kron_mul_acc(acc, pa, pb);
+    kron_unpack(&prod, acc);
+    poly_add(r, r, &prod);
+}
+
+// b = A * s；s 只打包一次，每列在大整數上累加 K 個乘積後才拆解
+void poly_matrix_vec_mul_kronecker(polyvec *b, const polymat *A, const polyvec *s) {
+    uint64_t ps[RUDRAKSH_K][KRON_LIMBS], pa[KRON_LIMBS], acc[2 * KRON_LIMBS];
+
+    for (int j = 0; j < RUDRAKSH_K; j++) kron_pack(ps[j], &s->vec[j]);
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        memset(acc, 0, sizeof(acc));
+        for (int j = 0; j < RUDRAKSH_K; j++) {
+            kron_pack(pa, &A->matrix[i][j]);
+            kron_mul_acc(acc, pa, ps[j]);
+        }
+        kron_unpack(&b->vec[i], acc);
+    }
+}
+
+// b = A^T * s
+void poly_matrix_trans_vec_mul_kronecker(polyvec *b, const polymat *A, const polyvec *s) {
+    uint64_t ps[RUDRAKSH_K][KRON_LIMBS], pa[KRON_LIMBS], acc[2 * KRON_LIMBS];
+
+    for (int j = 0; j < RUDRAKSH_K; j++) kron_pack(ps[j], &s->vec[j]);
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        memset(acc, 0, sizeof(acc));
+        for (int j = 0; j < RUDRAKSH_K; j++) {
+            kron_pack(pa, &A->matrix[j][i]);
+            kron_mul_acc(acc, pa, ps[j]);
+        }
+        kron_unpack(&b->vec[i], acc);
+    }
+}
+
+// c = b^T * s
+void poly_vector_vector_mul_kronecker(poly *c, const polyvec *b, const polyvec *s) {
+    uint64_t pb[KRON_LIMBS], ps[KRON_LIMBS], acc[2 * KRON_LIMBS] = {0};
+
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        kron_pack(pb, &b->vec[i]);
+        kron_pack(ps, &s->vec[i]);
+        kron_mul_acc(acc, pb, ps);
+    }
+    kron_unpack(c, acc);
+}
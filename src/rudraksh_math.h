@@ -2,6 +2,7 @@
 #define RUDRAKSH_MATH_H
 
 #include <stdint.h>
+#include <stddef.h>
 #include "rudraksh_params.h"
 
 // ==========================================================
@@ -28,11 +29,36 @@ typedef struct {
     poly matrix[RUDRAKSH_K][RUDRAKSH_K];
 } polymat;
 
+// 頻率優先 (frequency-major) 佈局：NTT 域的 A s 拆成 64 個獨立的 K x K 矩陣-向量乘法 (每個頻率一個)
+// 頻率分成 RUDRAKSH_FM_LANES 個一組的 tile，tile 內依 [列][行][頻率] 存放：
+//   同一組頻率的 K * K 個值連續 (cache 友善)，同一個 (i, j) 的相鄰頻率也連續 (跨頻率向量化不需 strided load)
+// 不完整 NTT (RUDRAKSH_NTT_BLOCK = d > 1) 時 lane 對應子環，第 c 次項係數放在第 c 組 tile：
+//   NTT 域位置 p = k * d + c (第 k 個子環的第 c 項) -> tile = c * (TILES / d) + k / LANES，lane = k % LANES
+#define RUDRAKSH_FM_LANES 16
+#define RUDRAKSH_FM_TILES (RUDRAKSH_N / RUDRAKSH_FM_LANES)
+#define RUDRAKSH_FM_GROUPS (RUDRAKSH_FM_TILES / RUDRAKSH_NTT_BLOCK) // 每個係數次數佔用的 tile 數
+// NTT 域位置 p 在頻率優先佈局中的位置 (tile * RUDRAKSH_FM_LANES + lane)
+#define RUDRAKSH_FM_POS(p) \
+    ((p) % RUDRAKSH_NTT_BLOCK * (RUDRAKSH_N / RUDRAKSH_NTT_BLOCK) + (p) / RUDRAKSH_NTT_BLOCK)
+
+#if RUDRAKSH_NTT_BLOCK > RUDRAKSH_FM_TILES
+#error "frequency-major layout needs RUDRAKSH_NTT_BLOCK <= RUDRAKSH_FM_TILES"
+#endif
+
+typedef struct {
+    int16_t t[RUDRAKSH_FM_TILES][RUDRAKSH_K][RUDRAKSH_K][RUDRAKSH_FM_LANES];
+} polymat_fm;
+
+typedef struct {
+    int16_t t[RUDRAKSH_FM_TILES][RUDRAKSH_K][RUDRAKSH_FM_LANES];
+} polyvec_fm;
+
 // ==========================================================
 // 3. 全域變數宣告
 // ==========================================================
 extern const int16_t zetas[RUDRAKSH_N];
 extern const int16_t zetas_inv[RUDRAKSH_N];
+extern const int16_t ntt_gamma[RUDRAKSH_NTT_BLOCKS]; // 第 k 個子環為 Z_q[x]/(x^d - ntt_gamma[k])
 
 // ==========================================================
 // 4. 數學核心函式 (Member A)
@@ -62,6 +88,38 @@ void poly_basemul_acc_serial(poly *r, const poly *a, const poly *b);
 void poly_matrix_trans_vec_mul(polyvec *b, const polymat *A, const polyvec *s); // matrix (轉置) - vector 乘法
 void poly_matrix_vec_mul(polyvec *b, const polymat *A, const polyvec *s);        // matrix - vector 乘法
 void poly_vector_vector_mul(poly *c, const polyvec *b, const polyvec *s); // vector - vector 乘法
+    // Karatsuba 一般域乘法 (rudraksh_karatsuba.c，可直接替換上面的 schoolbook 版本)
+void poly_basemul_acc_karatsuba(poly *r, const poly *a, const poly *b);
+void poly_matrix_trans_vec_mul_karatsuba(polyvec *b, const polymat *A, const polyvec *s);
+void poly_matrix_vec_mul_karatsuba(polyvec *b, const polymat *A, const polyvec *s);
+void poly_vector_vector_mul_karatsuba(poly *c, const polyvec *b, const polyvec *s);
+    // 浮點 FFT 一般域乘法 (rudraksh_fft.c，實驗性；AVX2 + FMA 於執行時偵測)
+void poly_basemul_acc_fft(poly *r, const poly *a, const poly *b);
+void poly_matrix_trans_vec_mul_fft(polyvec *b, const polymat *A, const polyvec *s);
+void poly_matrix_vec_mul_fft(polyvec *b, const polymat *A, const polyvec *s);
+void poly_vector_vector_mul_fft(poly *c, const polyvec *b, const polyvec *s);
+const char *rudraksh_fft_impl(void); // "avx2-fma" 或 "scalar"
+    // Kronecker substitution 一般域乘法 (rudraksh_kronecker.c，只用 64-bit 整數乘法，不需要 SIMD)
+void poly_basemul_acc_kronecker(poly *r, const poly *a, const poly *b);
+void poly_matrix_trans_vec_mul_kronecker(polyvec *b, const polymat *A, const polyvec *s);
+void poly_matrix_vec_mul_kronecker(polyvec *b, const polymat *A, const polyvec *s);
+void poly_vector_vector_mul_kronecker(poly *c, const polyvec *b, const polyvec *s);
+    // NTT 域乘法 (輸入/輸出皆在 NTT 域)
+void poly_matrix_trans_vec_mul_ntt(polyvec *b, const polymat *A, const polyvec *s);
+void poly_matrix_vec_mul_ntt(polyvec *b, const polymat *A, const polyvec *s);
+void poly_vector_vector_mul_ntt(poly *c, const polyvec *b, const polyvec *s);
+    // 頻率優先佈局 (轉換合併在 NTT 的最後一層 / INTT 的第一層)
+void polymat_ntt_fm(polymat_fm *r, polymat *a);        // a 就地轉為 NTT 域 (同 polymat_ntt)，並輸出頻率優先的副本 r
+void polyvec_ntt_fm(polyvec_fm *r, polyvec *a);        // 同上 (向量)
+void polyvec_invntt_fm(polyvec *r, const polyvec_fm *a); // r = INTT(a)，輸出一般佈局
+void poly_matrix_vec_mul_fm(polyvec_fm *b, const polymat_fm *A, const polyvec_fm *s);       // b = A s (NTT 域)
+void poly_matrix_trans_vec_mul_fm(polyvec_fm *b, const polymat_fm *A, const polyvec_fm *s); // b = A^T s (NTT 域)
+    // SWAR 多項式算術 (rudraksh_swar.c，64-bit 平台 "swar" kernel 變體的實作；一般經由 poly_add 等函式分派)
+void poly_add_swar(poly *r, const poly *a, const poly *b);
+void poly_sub_swar(poly *r, const poly *a, const poly *b);
+void poly_encode_swar(poly *r, const poly *m);
+void poly_decode_swar(poly *m, const poly *noisy_poly);
+void poly_basemul_dot_swar(poly *r, const poly *a, size_t stride, const poly *b); // r = sum_j a[j * stride] * b[j] (K 項，NTT 域)
 
 
 // ==========================================================
@@ -94,6 +152,7 @@ void poly_decompress_v(poly *r, const uint8_t *a);
 void polyvec_cbd_eta(polyvec *s,polyvec *e, const uint8_t *key); // 生成 s or e with eta=1
 void poly_cbd_eta(poly *e, const uint8_t *key, const uint8_t nonce); // 生成 e'' with eta=2
 void poly_matrixA_generator(polymat *a, const uint8_t *seed); // 生成矩陣 A (ascon xof)
+void poly_generator(poly *p, const uint8_t *seed, const uint8_t i, const uint8_t j); // 生成 A[i][j] (單一多項式)
 
 // 13-bit Serialization (For PK/SK)
 void poly_tobytes_13bit(uint8_t *r, const poly *a);
@@ -102,10 +161,17 @@ void poly_frombytes_13bit(poly *r, const uint8_t *a);
 // Vector Wrappers
 void polyvec_tobytes_13bit(uint8_t *r, const polyvec *a);
 void polyvec_frombytes_13bit(polyvec *r, const uint8_t *a);
+// 3-bit Serialization (精簡私鑰的 s，係數須在 [-2, 2])
+// 回傳 0 代表成功，-1 代表有係數 / 欄位超出 [-2, 2] (r 仍會寫入，呼叫端應捨棄)
+int poly_tobytes_3bit(uint8_t *r, const poly *a);
+int poly_frombytes_3bit(poly *r, const uint8_t *a);
+int polyvec_tobytes_3bit(uint8_t *r, const polyvec *a);
+int polyvec_frombytes_3bit(polyvec *r, const uint8_t *a);
 void polyvec_compress_u(uint8_t *r, const polyvec *a);
 void polyvec_decompress_u(polyvec *r, const uint8_t *a);
 void polyvec_ntt(polyvec *r);
 void polyvec_invntt_tomont(polyvec *r);
+void polymat_ntt(polymat *r);
 // 可能要加入多項式矩陣乘法和加法的函式宣告
 
 #endif // RUDRAKSH_MATH_H
\ No newline at end of file
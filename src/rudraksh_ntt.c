@@ -2,6 +2,8 @@
 #include <string.h>
 #include "rudraksh_math.h"
 #include "rudraksh_params.h"
+#include "rudraksh_stats.h"
+#include "rudraksh_dispatch.h"
 
 // 這是我們在 step 2 生成的數據，透過 extern 引用
 extern const int16_t zetas[RUDRAKSH_N];
@@ -52,72 +54,19 @@ void polyvec_zero(polyvec *pv) {
 // =========================================================
 // 2.NTT / INTT
 // =========================================================
-#define INV_2 3841
-// 需使用 Python 生成的正確表
-// static const int16_t zetas[64] = { /* ... */ };
-// static const int16_t zetas_inv[64] = { /* ... */ };
-
-// 論文 Algorithm 1 的化約函數 (保持不變)
-static int16_t rudraksh_reduce(int32_t c) {
-    int32_t c0 = c & 0x1FFF;
-    int32_t c1 = (c >> 13) & 0xF;
-    int32_t c2 = (c >> 17) & 0xF;
-    int32_t c3 = (c >> 21) & 0xF;
-    int32_t c4 = (c >> 25) & 0x1;
-    int32_t temp0 = c4 + c3;
-    int32_t temp1 = temp0 + c2;
-    int32_t temp2 = temp1 + c1;
-    int32_t temp3 = (temp2 << 1) - temp0;
-    int32_t temp4 = (temp3 << 4) - temp1;
-    int32_t temp5 = (temp4 << 4) - temp2;
-    int32_t temp6 = temp5 + c0;
-    int32_t res = (-(c4 << 12)) + temp6;
-    while (res < 0) res += RUDRAKSH_Q;
-    while (res >= RUDRAKSH_Q) res -= RUDRAKSH_Q;
-    return (int16_t)res;
-}
-
-// 正向 NTT: Cooley-Tukey DIF (輸入自然順序 -> 輸出位元反轉)
+// 實作位於 rudraksh_kernels_impl.h，依 CPU 分派到 scalar / SSE4.2 / AVX2 / AVX-512 變體
+// (完全展開的直線程式，由 tools/gen_ntt_unrolled.c 產生到 rudraksh_ntt_unrolled.h；正向 Cooley-Tukey、反向 Gentleman-Sande)
+
+// 正向 NTT (輸入自然順序 -> 輸出位元反轉)
 void poly_ntt(poly *p) {
-    int t = 32, k = 1;
-    for (int m = 1; m < 64; m <<= 1) {
-        for (int i = 0; i < m; i++) {
-            int16_t zeta = zetas[k++]; // zetas 必須按位元反轉順序預生成
-            for (int j = i * 2 * t; j < i * 2 * t + t; j++) {
-                int16_t u = p->coeffs[j];
-                int16_t v = p->coeffs[j + t];
-                p->coeffs[j] = rudraksh_reduce(u + v);
-                // 負循環關鍵：先減後乘
-                p->coeffs[j + t] = rudraksh_reduce((int32_t)(u - v + RUDRAKSH_Q) * zeta);
-            }
-        }
-        t >>= 1;
-    }
+    RUDRAKSH_STAT_INC(ntt);
+    rudraksh_kernels_active()->ntt(p);
 }
 
-// 反向 INTT: Gentleman-Sande DIT (輸入位元反轉 -> 輸出自然順序)
+// 反向 INTT (輸入位元反轉 -> 輸出自然順序)
 void poly_invntt(poly *p) {
-    int t = 1;
-    for (int m = 32; m >= 1; m >>= 1) {
-        int start_k = m; 
-        for (int i = 0; i < m; i++) {
-            // 注意：這裡使用反向因子，且順序與正向對稱
-            int16_t zeta_inv = zetas_inv[start_k++]; 
-            for (int j = i * 2 * t; j < i * 2 * t + t; j++) {
-                int16_t u = p->coeffs[j];
-                // 負循環關鍵：先乘後加減
-                int16_t v = rudraksh_reduce((int32_t)p->coeffs[j + t] * zeta_inv);
-                
-                int16_t res_u = rudraksh_reduce(u + v);
-                int16_t res_v = rudraksh_reduce(u - v + RUDRAKSH_Q);
-                
-                // 論文第 16 頁：每一層除以 2 (INV_2 = 3841)
-                p->coeffs[j] = rudraksh_reduce((int32_t)res_u * INV_2);
-                p->coeffs[j + t] = rudraksh_reduce((int32_t)res_v * INV_2);
-            }
-        }
-        t <<= 1;
-    }
+    RUDRAKSH_STAT_INC(invntt);
+    rudraksh_kernels_active()->invntt(p);
 }
 
 
@@ -128,16 +77,14 @@ void poly_invntt(poly *p) {
 // 多項式點對點乘法 (Point-wise Multiplication)
 // r = a * b (在 NTT 域中)
 void poly_basemul_acc(poly *r, const poly *a, const poly *b) {
-    for (int i = 0; i < RUDRAKSH_N; i++) {
-        // r[i] = r[i] + (a[i] * b[i])
-        int16_t product = fqmul(a->coeffs[i], b->coeffs[i]);
-        r->coeffs[i] = fqadd(r->coeffs[i], product);
-    }
+    RUDRAKSH_STAT_INC(poly_mul);
+    rudraksh_kernels_active()->basemul_acc(r, a, b);
 }
 
 // 非 NTT 域多項式乘法累加 (Schoolbook Multiplication)
 void poly_basemul_acc_serial(poly *r, const poly *a, const poly *b) {
     int32_t c[2 * RUDRAKSH_N] = {0}; // 用於存放中間結果，長度需要 2N
+    RUDRAKSH_STAT_INC(poly_mul);
 
     // 1. 執行標準卷積
     for (int i = 0; i < RUDRAKSH_N; i++) {
@@ -196,15 +143,89 @@ void poly_vector_vector_mul(poly *c, const polyvec *b, const polyvec *s) {
     }
 }
 
+// ---------------------------------------------------------
+// NTT 域版本：輸入皆已經過 poly_ntt，結果仍在 NTT 域 (需自行 invntt)
+// ---------------------------------------------------------
+
+// 每個輸出多項式為 K 項點乘和 (kernel 的 basemul_dot，swar 變體延遲化約)
+
+// b = A^T * s (NTT 域)：第 i 行，相鄰元素相隔 K 個多項式
+void poly_matrix_trans_vec_mul_ntt(polyvec *b, const polymat *A, const polyvec *s) {
+    const rudraksh_kernels *k = rudraksh_kernels_active();
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        RUDRAKSH_STAT_ADD(poly_mul, RUDRAKSH_K);
+        k->basemul_dot(&b->vec[i], &A->matrix[0][i], RUDRAKSH_K, s->vec);
+    }
+}
+
+// b = A * s (NTT 域)
+void poly_matrix_vec_mul_ntt(polyvec *b, const polymat *A, const polyvec *s) {
+    const rudraksh_kernels *k = rudraksh_kernels_active();
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        RUDRAKSH_STAT_ADD(poly_mul, RUDRAKSH_K);
+        k->basemul_dot(&b->vec[i], A->matrix[i], 1, s->vec);
+    }
+}
+
+// c = b^T * s (NTT 域)
+void poly_vector_vector_mul_ntt(poly *c, const polyvec *b, const polyvec *s) {
+    RUDRAKSH_STAT_ADD(poly_mul, RUDRAKSH_K);
+    rudraksh_kernels_active()->basemul_dot(c, b->vec, 1, s->vec);
+}
+
+// ---------------------------------------------------------
+// 頻率優先佈局 (polymat_fm / polyvec_fm)：NTT 域的矩陣-向量乘法拆成 64 個 K x K GEMV
+// 佈局轉換合併在 NTT 最後一層的輸出與 INTT 第一層的輸入，不另做轉置
+// ---------------------------------------------------------
+
+#define FM_MAT_STRIDE (RUDRAKSH_K * RUDRAKSH_K * RUDRAKSH_FM_LANES) // 相鄰 tile 的距離
+#define FM_VEC_STRIDE (RUDRAKSH_K * RUDRAKSH_FM_LANES)
+
+void polymat_ntt_fm(polymat_fm *r, polymat *a) {
+    const rudraksh_kernels *k = rudraksh_kernels_active();
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        for (int j = 0; j < RUDRAKSH_K; j++) {
+            RUDRAKSH_STAT_INC(ntt);
+            k->ntt_fm(&a->matrix[i][j], r->t[0][i][j], FM_MAT_STRIDE);
+        }
+    }
+}
+
+void polyvec_ntt_fm(polyvec_fm *r, polyvec *a) {
+    const rudraksh_kernels *k = rudraksh_kernels_active();
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        RUDRAKSH_STAT_INC(ntt);
+        k->ntt_fm(&a->vec[i], r->t[0][i], FM_VEC_STRIDE);
+    }
+}
+
+void polyvec_invntt_fm(polyvec *r, const polyvec_fm *a) {
+    const rudraksh_kernels *k = rudraksh_kernels_active();
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        RUDRAKSH_STAT_INC(invntt);
+        k->invntt_fm(&r->vec[i], a->t[0][i], FM_VEC_STRIDE);
+    }
+}
+
+// b = A * s (NTT 域，頻率優先)
+void poly_matrix_vec_mul_fm(polyvec_fm *b, const polymat_fm *A, const polyvec_fm *s) {
+    RUDRAKSH_STAT_ADD(poly_mul, RUDRAKSH_K * RUDRAKSH_K);
+    rudraksh_kernels_active()->gemv_fm(b, A, s);
+}
+
+// b = A^T * s (NTT 域，頻率優先)
+void poly_matrix_trans_vec_mul_fm(polyvec_fm *b, const polymat_fm *A, const polyvec_fm *s) {
+    RUDRAKSH_STAT_ADD(poly_mul, RUDRAKSH_K * RUDRAKSH_K);
+    rudraksh_kernels_active()->gemv_t_fm(b, A, s);
+}
+
 // =========================================================
 // 3. poly(vec) 加法/減法
 // =========================================================
 
-// 單一多項式加法: r = a + b
+// 單一多項式加法: r = a + b (輸入在 [0, q)；逐係數 fqadd，swar 變體 4 個係數一起算)
 void poly_add(poly *r, const poly *a, const poly *b) {
-    for (int i = 0; i < RUDRAKSH_N; i++) {
-        r->coeffs[i] = fqadd(a->coeffs[i], b->coeffs[i]);
-    }
+    rudraksh_kernels_active()->poly_add(r, a, b);
 }
 
 // 多項式向量加法: r = a + b
@@ -216,9 +237,7 @@ void polyvec_add(polyvec *r, const polyvec *a, const polyvec *b) {
 
 // 多項式向量減法: r = a - b
 void poly_sub(poly *r, const poly *a, const poly *b) {
-    for (int i = 0; i < RUDRAKSH_N; i++) {
-        r->coeffs[i] = fqsub(a->coeffs[i], b->coeffs[i]);
-    }
+    rudraksh_kernels_active()->poly_sub(r, a, b);
 }
 
 //
\ No newline at end of file
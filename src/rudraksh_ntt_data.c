@@ -1,29 +1,55 @@
 /* * Twiddle Factors for Rudraksh (KEM-poly64)
  * Modulus Q = 7681, Zeta = 202, Size N = 64
- * Order: Natural Order (powers of zeta: 0, 1, 2, ..., N-1)
+ * Order: Bit-reversed (zetas[k] = zeta^brv6(k), zetas_inv[k] = zeta^-brv6(k))
+ * 由 tools/gen_table.c 產生
  */
 
 #include "rudraksh_math.h"
 
 // 這是全域常數，供 NTT 運算時查表使用
 const int16_t zetas[RUDRAKSH_N] = {
-      1, 7154, 1366, 2132, 7351, 4928, 2399, 3092,
-    5773, 6986, 5212, 3074, 7479, 6601,  584, 7153,
-    3844, 1996, 4781, 7462, 6526, 1886, 4556, 3141,
-    1003, 1408, 2880, 3078, 6974, 3901, 2044, 5833,
-      62, 5731,  201, 1607, 2583, 5977, 2799, 7360,
-    4600, 2996,  542, 6244, 2838, 2169, 5484, 5669,
-     217,  856, 4544, 1784, 5200, 1717, 5956, 2717,
-     738, 2805, 1897, 6492, 2252, 3751, 3832,  639,
+        1, 3383, 5756, 1213, 5953, 7098,  527,  849,
+     2132,   97, 5235, 5300, 2784, 1366, 2138, 5033,
+     2399, 4681, 5887, 6569, 2268, 7006, 4589, 1286,
+     6803, 2273,  330, 2645, 4027, 4928, 5835, 7316,
+      202, 7438, 2881, 6915, 4270, 5130, 6601, 2516,
+      528, 4232, 5173, 2941, 1655, 7097, 1740, 2774,
+      695,  799, 6300, 5806, 4957, 1908, 5258, 6299,
+     6988, 5967, 5212, 4301, 6949, 4607, 3477, 3080,
 };
 // 反向 INTT 旋轉因子表 (n=64, q=7681)
 const int16_t zetas_inv[64] = {
-      1, 7098, 2446, 2648, 7006, 1794,  365, 2273,
-    5173, 2774, 2551, 2881, 3080, 1714, 6300, 6299,
-    6584, 2028, 5088, 6243, 3099, 5999, 6688, 2844,
-    1478, 6279, 5118, 4115,  880, 1587, 1800, 2897,
-    1115, 2840,  535, 3016,  113, 3250, 7563, 7346,
-    7145, 5248, 2395, 1657,  793, 6222, 4066, 2951,
-    5805, 3006, 4542, 1959, 6616, 6415, 6550, 6488,
-    4236, 3694, 7268, 2668, 5713, 2875, 2259, 4135,
+        1, 4298, 6468, 1925, 6832, 7154,  583, 1728,
+     2648, 5543, 6315, 4897, 2381, 2446, 7584, 5549,
+      365, 1846, 2753, 3654, 5036, 7351, 5408,  878,
+     6395, 3092,  675, 5413, 1112, 1794, 3000, 5282,
+     4601, 4204, 3074,  732, 3380, 2469, 1714,  693,
+     1382, 2423, 5773, 2724, 1875, 1381, 6882, 6986,
+     4907, 5941,  584, 6026, 4740, 2508, 3449, 7153,
+     5165, 1080, 2551, 3411,  766, 4800,  243, 7479,
 };
+// NTT 域子環常數 (依 RUDRAKSH_NTT_LAYERS；完整 NTT 時即每個點的求值點)
+#if RUDRAKSH_NTT_LAYERS == 6
+const int16_t ntt_gamma[RUDRAKSH_NTT_BLOCKS] = {
+      202, 7479, 7438,  243, 2881, 4800, 6915,  766,
+     4270, 3411, 5130, 2551, 6601, 1080, 2516, 5165,
+      528, 7153, 4232, 3449, 5173, 2508, 2941, 4740,
+     1655, 6026, 7097,  584, 1740, 5941, 2774, 4907,
+      695, 6986,  799, 6882, 6300, 1381, 5806, 1875,
+     4957, 2724, 1908, 5773, 5258, 2423, 6299, 1382,
+     6988,  693, 5967, 1714, 5212, 2469, 4301, 3380,
+     6949,  732, 4607, 3074, 3477, 4204, 3080, 4601,
+};
+#elif RUDRAKSH_NTT_LAYERS == 5
+const int16_t ntt_gamma[RUDRAKSH_NTT_BLOCKS] = {
+     2399, 5282, 4681, 3000, 5887, 1794, 6569, 1112,
+     2268, 5413, 7006,  675, 4589, 3092, 1286, 6395,
+     6803,  878, 2273, 5408,  330, 7351, 2645, 5036,
+     4027, 3654, 4928, 2753, 5835, 1846, 7316,  365,
+};
+#elif RUDRAKSH_NTT_LAYERS == 4
+const int16_t ntt_gamma[RUDRAKSH_NTT_BLOCKS] = {
+     2132, 5549,   97, 7584, 5235, 2446, 5300, 2381,
+     2784, 4897, 1366, 6315, 2138, 5543, 5033, 2648,
+};
+#endif
@@ -0,0 +1,7348 @@
+// ==========================================================
+// 完全展開的 n = 64 負循環 NTT / INTT (q = 7681, zeta = 202)，依 RUDRAKSH_NTT_LAYERS 選擇層數
+// 由 tools/gen_ntt_unrolled.c 產生，請勿手動修改 (make lgen_ntt 重新產生)
+// 本檔沒有 include guard，由 rudraksh_kernels_impl.h 在各 ISA 設定下重複 include (KERN 由該檔定義)
+// 每層標示的 |r| 為產生器追蹤的值域上界，只在可能超出 int32 時插入 Barrett 化約
+// ==========================================================
+
+// |a| < 2^31：a >= 0 時結果在 [0, 2q)，a < 0 時在 (-q, q)
+static inline int32_t KERN(barrett)(int32_t a) {
+    int32_t t = (int32_t)(((int64_t)a * 559167) >> 32);
+    return a - t * 7681;
+}
+
+// (-q, 2q) -> [0, q)，無分支
+static inline int16_t KERN(canon)(int32_t a) {
+    a += (a >> 31) & 7681;
+    a -= 7681;
+    a += (a >> 31) & 7681;
+    return (int16_t)a;
+}
+
+#if RUDRAKSH_NTT_LAYERS == 6
+
+// 正向 NTT (6 層，輸入自然順序 -> 輸出位元反轉)，輸入可為任意 int16，輸出在 [0, q)
+static void KERN(ntt)(poly *p) {
+    int32_t r0 = p->coeffs[0];
+    int32_t r1 = p->coeffs[1];
+    int32_t r2 = p->coeffs[2];
+    int32_t r3 = p->coeffs[3];
+    int32_t r4 = p->coeffs[4];
+    int32_t r5 = p->coeffs[5];
+    int32_t r6 = p->coeffs[6];
+    int32_t r7 = p->coeffs[7];
+    int32_t r8 = p->coeffs[8];
+    int32_t r9 = p->coeffs[9];
+    int32_t r10 = p->coeffs[10];
+    int32_t r11 = p->coeffs[11];
+    int32_t r12 = p->coeffs[12];
+    int32_t r13 = p->coeffs[13];
+    int32_t r14 = p->coeffs[14];
+    int32_t r15 = p->coeffs[15];
+    int32_t r16 = p->coeffs[16];
+    int32_t r17 = p->coeffs[17];
+    int32_t r18 = p->coeffs[18];
+    int32_t r19 = p->coeffs[19];
+    int32_t r20 = p->coeffs[20];
+    int32_t r21 = p->coeffs[21];
+    int32_t r22 = p->coeffs[22];
+    int32_t r23 = p->coeffs[23];
+    int32_t r24 = p->coeffs[24];
+    int32_t r25 = p->coeffs[25];
+    int32_t r26 = p->coeffs[26];
+    int32_t r27 = p->coeffs[27];
+    int32_t r28 = p->coeffs[28];
+    int32_t r29 = p->coeffs[29];
+    int32_t r30 = p->coeffs[30];
+    int32_t r31 = p->coeffs[31];
+    int32_t r32 = p->coeffs[32];
+    int32_t r33 = p->coeffs[33];
+    int32_t r34 = p->coeffs[34];
+    int32_t r35 = p->coeffs[35];
+    int32_t r36 = p->coeffs[36];
+    int32_t r37 = p->coeffs[37];
+    int32_t r38 = p->coeffs[38];
+    int32_t r39 = p->coeffs[39];
+    int32_t r40 = p->coeffs[40];
+    int32_t r41 = p->coeffs[41];
+    int32_t r42 = p->coeffs[42];
+    int32_t r43 = p->coeffs[43];
+    int32_t r44 = p->coeffs[44];
+    int32_t r45 = p->coeffs[45];
+    int32_t r46 = p->coeffs[46];
+    int32_t r47 = p->coeffs[47];
+    int32_t r48 = p->coeffs[48];
+    int32_t r49 = p->coeffs[49];
+    int32_t r50 = p->coeffs[50];
+    int32_t r51 = p->coeffs[51];
+    int32_t r52 = p->coeffs[52];
+    int32_t r53 = p->coeffs[53];
+    int32_t r54 = p->coeffs[54];
+    int32_t r55 = p->coeffs[55];
+    int32_t r56 = p->coeffs[56];
+    int32_t r57 = p->coeffs[57];
+    int32_t r58 = p->coeffs[58];
+    int32_t r59 = p->coeffs[59];
+    int32_t r60 = p->coeffs[60];
+    int32_t r61 = p->coeffs[61];
+    int32_t r62 = p->coeffs[62];
+    int32_t r63 = p->coeffs[63];
+    int32_t t;
+
+    // 第 1 層 (t = 32)，輸入 |r| <= 32768
+    t = KERN(barrett)(r32 * 3383);
+    r32 = r0 - t; r0 += t;
+    t = KERN(barrett)(r33 * 3383);
+    r33 = r1 - t; r1 += t;
+    t = KERN(barrett)(r34 * 3383);
+    r34 = r2 - t; r2 += t;
+    t = KERN(barrett)(r35 * 3383);
+    r35 = r3 - t; r3 += t;
+    t = KERN(barrett)(r36 * 3383);
+    r36 = r4 - t; r4 += t;
+    t = KERN(barrett)(r37 * 3383);
+    r37 = r5 - t; r5 += t;
+    t = KERN(barrett)(r38 * 3383);
+    r38 = r6 - t; r6 += t;
+    t = KERN(barrett)(r39 * 3383);
+    r39 = r7 - t; r7 += t;
+    t = KERN(barrett)(r40 * 3383);
+    r40 = r8 - t; r8 += t;
+    t = KERN(barrett)(r41 * 3383);
+    r41 = r9 - t; r9 += t;
+    t = KERN(barrett)(r42 * 3383);
+    r42 = r10 - t; r10 += t;
+    t = KERN(barrett)(r43 * 3383);
+    r43 = r11 - t; r11 += t;
+    t = KERN(barrett)(r44 * 3383);
+    r44 = r12 - t; r12 += t;
+    t = KERN(barrett)(r45 * 3383);
+    r45 = r13 - t; r13 += t;
+    t = KERN(barrett)(r46 * 3383);
+    r46 = r14 - t; r14 += t;
+    t = KERN(barrett)(r47 * 3383);
+    r47 = r15 - t; r15 += t;
+    t = KERN(barrett)(r48 * 3383);
+    r48 = r16 - t; r16 += t;
+    t = KERN(barrett)(r49 * 3383);
+    r49 = r17 - t; r17 += t;
+    t = KERN(barrett)(r50 * 3383);
+    r50 = r18 - t; r18 += t;
+    t = KERN(barrett)(r51 * 3383);
+    r51 = r19 - t; r19 += t;
+    t = KERN(barrett)(r52 * 3383);
+    r52 = r20 - t; r20 += t;
+    t = KERN(barrett)(r53 * 3383);
+    r53 = r21 - t; r21 += t;
+    t = KERN(barrett)(r54 * 3383);
+    r54 = r22 - t; r22 += t;
+    t = KERN(barrett)(r55 * 3383);
+    r55 = r23 - t; r23 += t;
+    t = KERN(barrett)(r56 * 3383);
+    r56 = r24 - t; r24 += t;
+    t = KERN(barrett)(r57 * 3383);
+    r57 = r25 - t; r25 += t;
+    t = KERN(barrett)(r58 * 3383);
+    r58 = r26 - t; r26 += t;
+    t = KERN(barrett)(r59 * 3383);
+    r59 = r27 - t; r27 += t;
+    t = KERN(barrett)(r60 * 3383);
+    r60 = r28 - t; r28 += t;
+    t = KERN(barrett)(r61 * 3383);
+    r61 = r29 - t; r29 += t;
+    t = KERN(barrett)(r62 * 3383);
+    r62 = r30 - t; r30 += t;
+    t = KERN(barrett)(r63 * 3383);
+    r63 = r31 - t; r31 += t;
+
+    // 第 2 層 (t = 16)，輸入 |r| <= 48129
+    t = KERN(barrett)(r16 * -1925);
+    r16 = r0 - t; r0 += t;
+    t = KERN(barrett)(r17 * -1925);
+    r17 = r1 - t; r1 += t;
+    t = KERN(barrett)(r18 * -1925);
+    r18 = r2 - t; r2 += t;
+    t = KERN(barrett)(r19 * -1925);
+    r19 = r3 - t; r3 += t;
+    t = KERN(barrett)(r20 * -1925);
+    r20 = r4 - t; r4 += t;
+    t = KERN(barrett)(r21 * -1925);
+    r21 = r5 - t; r5 += t;
+    t = KERN(barrett)(r22 * -1925);
+    r22 = r6 - t; r6 += t;
+    t = KERN(barrett)(r23 * -1925);
+    r23 = r7 - t; r7 += t;
+    t = KERN(barrett)(r24 * -1925);
+    r24 = r8 - t; r8 += t;
+    t = KERN(barrett)(r25 * -1925);
+    r25 = r9 - t; r9 += t;
+    t = KERN(barrett)(r26 * -1925);
+    r26 = r10 - t; r10 += t;
+    t = KERN(barrett)(r27 * -1925);
+    r27 = r11 - t; r11 += t;
+    t = KERN(barrett)(r28 * -1925);
+    r28 = r12 - t; r12 += t;
+    t = KERN(barrett)(r29 * -1925);
+    r29 = r13 - t; r13 += t;
+    t = KERN(barrett)(r30 * -1925);
+    r30 = r14 - t; r14 += t;
+    t = KERN(barrett)(r31 * -1925);
+    r31 = r15 - t; r15 += t;
+    t = KERN(barrett)(r48 * 1213);
+    r48 = r32 - t; r32 += t;
+    t = KERN(barrett)(r49 * 1213);
+    r49 = r33 - t; r33 += t;
+    t = KERN(barrett)(r50 * 1213);
+    r50 = r34 - t; r34 += t;
+    t = KERN(barrett)(r51 * 1213);
+    r51 = r35 - t; r35 += t;
+    t = KERN(barrett)(r52 * 1213);
+    r52 = r36 - t; r36 += t;
+    t = KERN(barrett)(r53 * 1213);
+    r53 = r37 - t; r37 += t;
+    t = KERN(barrett)(r54 * 1213);
+    r54 = r38 - t; r38 += t;
+    t = KERN(barrett)(r55 * 1213);
+    r55 = r39 - t; r39 += t;
+    t = KERN(barrett)(r56 * 1213);
+    r56 = r40 - t; r40 += t;
+    t = KERN(barrett)(r57 * 1213);
+    r57 = r41 - t; r41 += t;
+    t = KERN(barrett)(r58 * 1213);
+    r58 = r42 - t; r42 += t;
+    t = KERN(barrett)(r59 * 1213);
+    r59 = r43 - t; r43 += t;
+    t = KERN(barrett)(r60 * 1213);
+    r60 = r44 - t; r44 += t;
+    t = KERN(barrett)(r61 * 1213);
+    r61 = r45 - t; r45 += t;
+    t = KERN(barrett)(r62 * 1213);
+    r62 = r46 - t; r46 += t;
+    t = KERN(barrett)(r63 * 1213);
+    r63 = r47 - t; r47 += t;
+
+    // 第 3 層 (t = 8)，輸入 |r| <= 63490
+    t = KERN(barrett)(r8 * -1728);
+    r8 = r0 - t; r0 += t;
+    t = KERN(barrett)(r9 * -1728);
+    r9 = r1 - t; r1 += t;
+    t = KERN(barrett)(r10 * -1728);
+    r10 = r2 - t; r2 += t;
+    t = KERN(barrett)(r11 * -1728);
+    r11 = r3 - t; r3 += t;
+    t = KERN(barrett)(r12 * -1728);
+    r12 = r4 - t; r4 += t;
+    t = KERN(barrett)(r13 * -1728);
+    r13 = r5 - t; r5 += t;
+    t = KERN(barrett)(r14 * -1728);
+    r14 = r6 - t; r6 += t;
+    t = KERN(barrett)(r15 * -1728);
+    r15 = r7 - t; r7 += t;
+    t = KERN(barrett)(r24 * -583);
+    r24 = r16 - t; r16 += t;
+    t = KERN(barrett)(r25 * -583);
+    r25 = r17 - t; r17 += t;
+    t = KERN(barrett)(r26 * -583);
+    r26 = r18 - t; r18 += t;
+    t = KERN(barrett)(r27 * -583);
+    r27 = r19 - t; r19 += t;
+    t = KERN(barrett)(r28 * -583);
+    r28 = r20 - t; r20 += t;
+    t = KERN(barrett)(r29 * -583);
+    r29 = r21 - t; r21 += t;
+    t = KERN(barrett)(r30 * -583);
+    r30 = r22 - t; r22 += t;
+    t = KERN(barrett)(r31 * -583);
+    r31 = r23 - t; r23 += t;
+    t = KERN(barrett)(r40 * 527);
+    r40 = r32 - t; r32 += t;
+    t = KERN(barrett)(r41 * 527);
+    r41 = r33 - t; r33 += t;
+    t = KERN(barrett)(r42 * 527);
+    r42 = r34 - t; r34 += t;
+    t = KERN(barrett)(r43 * 527);
+    r43 = r35 - t; r35 += t;
+    t = KERN(barrett)(r44 * 527);
+    r44 = r36 - t; r36 += t;
+    t = KERN(barrett)(r45 * 527);
+    r45 = r37 - t; r37 += t;
+    t = KERN(barrett)(r46 * 527);
+    r46 = r38 - t; r38 += t;
+    t = KERN(barrett)(r47 * 527);
+    r47 = r39 - t; r39 += t;
+    t = KERN(barrett)(r56 * 849);
+    r56 = r48 - t; r48 += t;
+    t = KERN(barrett)(r57 * 849);
+    r57 = r49 - t; r49 += t;
+    t = KERN(barrett)(r58 * 849);
+    r58 = r50 - t; r50 += t;
+    t = KERN(barrett)(r59 * 849);
+    r59 = r51 - t; r51 += t;
+    t = KERN(barrett)(r60 * 849);
+    r60 = r52 - t; r52 += t;
+    t = KERN(barrett)(r61 * 849);
+    r61 = r53 - t; r53 += t;
+    t = KERN(barrett)(r62 * 849);
+    r62 = r54 - t; r54 += t;
+    t = KERN(barrett)(r63 * 849);
+    r63 = r55 - t; r55 += t;
+
+    // 第 4 層 (t = 4)，輸入 |r| <= 78851
+    t = KERN(barrett)(r4 * 2132);
+    r4 = r0 - t; r0 += t;
+    t = KERN(barrett)(r5 * 2132);
+    r5 = r1 - t; r1 += t;
+    t = KERN(barrett)(r6 * 2132);
+    r6 = r2 - t; r2 += t;
+    t = KERN(barrett)(r7 * 2132);
+    r7 = r3 - t; r3 += t;
+    t = KERN(barrett)(r12 * 97);
+    r12 = r8 - t; r8 += t;
+    t = KERN(barrett)(r13 * 97);
+    r13 = r9 - t; r9 += t;
+    t = KERN(barrett)(r14 * 97);
+    r14 = r10 - t; r10 += t;
+    t = KERN(barrett)(r15 * 97);
+    r15 = r11 - t; r11 += t;
+    t = KERN(barrett)(r20 * -2446);
+    r20 = r16 - t; r16 += t;
+    t = KERN(barrett)(r21 * -2446);
+    r21 = r17 - t; r17 += t;
+    t = KERN(barrett)(r22 * -2446);
+    r22 = r18 - t; r18 += t;
+    t = KERN(barrett)(r23 * -2446);
+    r23 = r19 - t; r19 += t;
+    t = KERN(barrett)(r28 * -2381);
+    r28 = r24 - t; r24 += t;
+    t = KERN(barrett)(r29 * -2381);
+    r29 = r25 - t; r25 += t;
+    t = KERN(barrett)(r30 * -2381);
+    r30 = r26 - t; r26 += t;
+    t = KERN(barrett)(r31 * -2381);
+    r31 = r27 - t; r27 += t;
+    t = KERN(barrett)(r36 * 2784);
+    r36 = r32 - t; r32 += t;
+    t = KERN(barrett)(r37 * 2784);
+    r37 = r33 - t; r33 += t;
+    t = KERN(barrett)(r38 * 2784);
+    r38 = r34 - t; r34 += t;
+    t = KERN(barrett)(r39 * 2784);
+    r39 = r35 - t; r35 += t;
+    t = KERN(barrett)(r44 * 1366);
+    r44 = r40 - t; r40 += t;
+    t = KERN(barrett)(r45 * 1366);
+    r45 = r41 - t; r41 += t;
+    t = KERN(barrett)(r46 * 1366);
+    r46 = r42 - t; r42 += t;
+    t = KERN(barrett)(r47 * 1366);
+    r47 = r43 - t; r43 += t;
+    t = KERN(barrett)(r52 * 2138);
+    r52 = r48 - t; r48 += t;
+    t = KERN(barrett)(r53 * 2138);
+    r53 = r49 - t; r49 += t;
+    t = KERN(barrett)(r54 * 2138);
+    r54 = r50 - t; r50 += t;
+    t = KERN(barrett)(r55 * 2138);
+    r55 = r51 - t; r51 += t;
+    t = KERN(barrett)(r60 * -2648);
+    r60 = r56 - t; r56 += t;
+    t = KERN(barrett)(r61 * -2648);
+    r61 = r57 - t; r57 += t;
+    t = KERN(barrett)(r62 * -2648);
+    r62 = r58 - t; r58 += t;
+    t = KERN(barrett)(r63 * -2648);
+    r63 = r59 - t; r59 += t;
+
+    // 第 5 層 (t = 2)，輸入 |r| <= 94212
+    t = KERN(barrett)(r2 * 2399);
+    r2 = r0 - t; r0 += t;
+    t = KERN(barrett)(r3 * 2399);
+    r3 = r1 - t; r1 += t;
+    t = KERN(barrett)(r6 * -3000);
+    r6 = r4 - t; r4 += t;
+    t = KERN(barrett)(r7 * -3000);
+    r7 = r5 - t; r5 += t;
+    t = KERN(barrett)(r10 * -1794);
+    r10 = r8 - t; r8 += t;
+    t = KERN(barrett)(r11 * -1794);
+    r11 = r9 - t; r9 += t;
+    t = KERN(barrett)(r14 * -1112);
+    r14 = r12 - t; r12 += t;
+    t = KERN(barrett)(r15 * -1112);
+    r15 = r13 - t; r13 += t;
+    t = KERN(barrett)(r18 * 2268);
+    r18 = r16 - t; r16 += t;
+    t = KERN(barrett)(r19 * 2268);
+    r19 = r17 - t; r17 += t;
+    t = KERN(barrett)(r22 * -675);
+    r22 = r20 - t; r20 += t;
+    t = KERN(barrett)(r23 * -675);
+    r23 = r21 - t; r21 += t;
+    t = KERN(barrett)(r26 * -3092);
+    r26 = r24 - t; r24 += t;
+    t = KERN(barrett)(r27 * -3092);
+    r27 = r25 - t; r25 += t;
+    t = KERN(barrett)(r30 * 1286);
+    r30 = r28 - t; r28 += t;
+    t = KERN(barrett)(r31 * 1286);
+    r31 = r29 - t; r29 += t;
+    t = KERN(barrett)(r34 * -878);
+    r34 = r32 - t; r32 += t;
+    t = KERN(barrett)(r35 * -878);
+    r35 = r33 - t; r33 += t;
+    t = KERN(barrett)(r38 * 2273);
+    r38 = r36 - t; r36 += t;
+    t = KERN(barrett)(r39 * 2273);
+    r39 = r37 - t; r37 += t;
+    t = KERN(barrett)(r42 * 330);
+    r42 = r40 - t; r40 += t;
+    t = KERN(barrett)(r43 * 330);
+    r43 = r41 - t; r41 += t;
+    t = KERN(barrett)(r46 * 2645);
+    r46 = r44 - t; r44 += t;
+    t = KERN(barrett)(r47 * 2645);
+    r47 = r45 - t; r45 += t;
+    t = KERN(barrett)(r50 * -3654);
+    r50 = r48 - t; r48 += t;
+    t = KERN(barrett)(r51 * -3654);
+    r51 = r49 - t; r49 += t;
+    t = KERN(barrett)(r54 * -2753);
+    r54 = r52 - t; r52 += t;
+    t = KERN(barrett)(r55 * -2753);
+    r55 = r53 - t; r53 += t;
+    t = KERN(barrett)(r58 * -1846);
+    r58 = r56 - t; r56 += t;
+    t = KERN(barrett)(r59 * -1846);
+    r59 = r57 - t; r57 += t;
+    t = KERN(barrett)(r62 * -365);
+    r62 = r60 - t; r60 += t;
+    t = KERN(barrett)(r63 * -365);
+    r63 = r61 - t; r61 += t;
+
+    // 第 6 層 (t = 1)，輸入 |r| <= 109573
+    t = KERN(barrett)(r1 * 202);
+    r1 = r0 - t; r0 += t;
+    t = KERN(barrett)(r3 * -243);
+    r3 = r2 - t; r2 += t;
+    t = KERN(barrett)(r5 * 2881);
+    r5 = r4 - t; r4 += t;
+    t = KERN(barrett)(r7 * -766);
+    r7 = r6 - t; r6 += t;
+    t = KERN(barrett)(r9 * -3411);
+    r9 = r8 - t; r8 += t;
+    t = KERN(barrett)(r11 * -2551);
+    r11 = r10 - t; r10 += t;
+    t = KERN(barrett)(r13 * -1080);
+    r13 = r12 - t; r12 += t;
+    t = KERN(barrett)(r15 * 2516);
+    r15 = r14 - t; r14 += t;
+    t = KERN(barrett)(r17 * 528);
+    r17 = r16 - t; r16 += t;
+    t = KERN(barrett)(r19 * -3449);
+    r19 = r18 - t; r18 += t;
+    t = KERN(barrett)(r21 * -2508);
+    r21 = r20 - t; r20 += t;
+    t = KERN(barrett)(r23 * 2941);
+    r23 = r22 - t; r22 += t;
+    t = KERN(barrett)(r25 * 1655);
+    r25 = r24 - t; r24 += t;
+    t = KERN(barrett)(r27 * -584);
+    r27 = r26 - t; r26 += t;
+    t = KERN(barrett)(r29 * 1740);
+    r29 = r28 - t; r28 += t;
+    t = KERN(barrett)(r31 * 2774);
+    r31 = r30 - t; r30 += t;
+    t = KERN(barrett)(r33 * 695);
+    r33 = r32 - t; r32 += t;
+    t = KERN(barrett)(r35 * 799);
+    r35 = r34 - t; r34 += t;
+    t = KERN(barrett)(r37 * -1381);
+    r37 = r36 - t; r36 += t;
+    t = KERN(barrett)(r39 * -1875);
+    r39 = r38 - t; r38 += t;
+    t = KERN(barrett)(r41 * -2724);
+    r41 = r40 - t; r40 += t;
+    t = KERN(barrett)(r43 * 1908);
+    r43 = r42 - t; r42 += t;
+    t = KERN(barrett)(r45 * -2423);
+    r45 = r44 - t; r44 += t;
+    t = KERN(barrett)(r47 * -1382);
+    r47 = r46 - t; r46 += t;
+    t = KERN(barrett)(r49 * -693);
+    r49 = r48 - t; r48 += t;
+    t = KERN(barrett)(r51 * -1714);
+    r51 = r50 - t; r50 += t;
+    t = KERN(barrett)(r53 * -2469);
+    r53 = r52 - t; r52 += t;
+    t = KERN(barrett)(r55 * -3380);
+    r55 = r54 - t; r54 += t;
+    t = KERN(barrett)(r57 * -732);
+    r57 = r56 - t; r56 += t;
+    t = KERN(barrett)(r59 * -3074);
+    r59 = r58 - t; r58 += t;
+    t = KERN(barrett)(r61 * 3477);
+    r61 = r60 - t; r60 += t;
+    t = KERN(barrett)(r63 * 3080);
+    r63 = r62 - t; r62 += t;
+
+    // 輸出化約，|r| <= 124934
+    r0 = KERN(barrett)(r0);
+    r1 = KERN(barrett)(r1);
+    r2 = KERN(barrett)(r2);
+    r3 = KERN(barrett)(r3);
+    r4 = KERN(barrett)(r4);
+    r5 = KERN(barrett)(r5);
+    r6 = KERN(barrett)(r6);
+    r7 = KERN(barrett)(r7);
+    r8 = KERN(barrett)(r8);
+    r9 = KERN(barrett)(r9);
+    r10 = KERN(barrett)(r10);
+    r11 = KERN(barrett)(r11);
+    r12 = KERN(barrett)(r12);
+    r13 = KERN(barrett)(r13);
+    r14 = KERN(barrett)(r14);
+    r15 = KERN(barrett)(r15);
+    r16 = KERN(barrett)(r16);
+    r17 = KERN(barrett)(r17);
+    r18 = KERN(barrett)(r18);
+    r19 = KERN(barrett)(r19);
+    r20 = KERN(barrett)(r20);
+    r21 = KERN(barrett)(r21);
+    r22 = KERN(barrett)(r22);
+    r23 = KERN(barrett)(r23);
+    r24 = KERN(barrett)(r24);
+    r25 = KERN(barrett)(r25);
+    r26 = KERN(barrett)(r26);
+    r27 = KERN(barrett)(r27);
+    r28 = KERN(barrett)(r28);
+    r29 = KERN(barrett)(r29);
+    r30 = KERN(barrett)(r30);
+    r31 = KERN(barrett)(r31);
+    r32 = KERN(barrett)(r32);
+    r33 = KERN(barrett)(r33);
+    r34 = KERN(barrett)(r34);
+    r35 = KERN(barrett)(r35);
+    r36 = KERN(barrett)(r36);
+    r37 = KERN(barrett)(r37);
+    r38 = KERN(barrett)(r38);
+    r39 = KERN(barrett)(r39);
+    r40 = KERN(barrett)(r40);
+    r41 = KERN(barrett)(r41);
+    r42 = KERN(barrett)(r42);
+    r43 = KERN(barrett)(r43);
+    r44 = KERN(barrett)(r44);
+    r45 = KERN(barrett)(r45);
+    r46 = KERN(barrett)(r46);
+    r47 = KERN(barrett)(r47);
+    r48 = KERN(barrett)(r48);
+    r49 = KERN(barrett)(r49);
+    r50 = KERN(barrett)(r50);
+    r51 = KERN(barrett)(r51);
+    r52 = KERN(barrett)(r52);
+    r53 = KERN(barrett)(r53);
+    r54 = KERN(barrett)(r54);
+    r55 = KERN(barrett)(r55);
+    r56 = KERN(barrett)(r56);
+    r57 = KERN(barrett)(r57);
+    r58 = KERN(barrett)(r58);
+    r59 = KERN(barrett)(r59);
+    r60 = KERN(barrett)(r60);
+    r61 = KERN(barrett)(r61);
+    r62 = KERN(barrett)(r62);
+    r63 = KERN(barrett)(r63);
+    p->coeffs[0] = KERN(canon)(r0);
+    p->coeffs[1] = KERN(canon)(r1);
+    p->coeffs[2] = KERN(canon)(r2);
+    p->coeffs[3] = KERN(canon)(r3);
+    p->coeffs[4] = KERN(canon)(r4);
+    p->coeffs[5] = KERN(canon)(r5);
+    p->coeffs[6] = KERN(canon)(r6);
+    p->coeffs[7] = KERN(canon)(r7);
+    p->coeffs[8] = KERN(canon)(r8);
+    p->coeffs[9] = KERN(canon)(r9);
+    p->coeffs[10] = KERN(canon)(r10);
+    p->coeffs[11] = KERN(canon)(r11);
+    p->coeffs[12] = KERN(canon)(r12);
+    p->coeffs[13] = KERN(canon)(r13);
+    p->coeffs[14] = KERN(canon)(r14);
+    p->coeffs[15] = KERN(canon)(r15);
+    p->coeffs[16] = KERN(canon)(r16);
+    p->coeffs[17] = KERN(canon)(r17);
+    p->coeffs[18] = KERN(canon)(r18);
+    p->coeffs[19] = KERN(canon)(r19);
+    p->coeffs[20] = KERN(canon)(r20);
+    p->coeffs[21] = KERN(canon)(r21);
+    p->coeffs[22] = KERN(canon)(r22);
+    p->coeffs[23] = KERN(canon)(r23);
+    p->coeffs[24] = KERN(canon)(r24);
+    p->coeffs[25] = KERN(canon)(r25);
+    p->coeffs[26] = KERN(canon)(r26);
+    p->coeffs[27] = KERN(canon)(r27);
+    p->coeffs[28] = KERN(canon)(r28);
+    p->coeffs[29] = KERN(canon)(r29);
+    p->coeffs[30] = KERN(canon)(r30);
+    p->coeffs[31] = KERN(canon)(r31);
+    p->coeffs[32] = KERN(canon)(r32);
+    p->coeffs[33] = KERN(canon)(r33);
+    p->coeffs[34] = KERN(canon)(r34);
+    p->coeffs[35] = KERN(canon)(r35);
+    p->coeffs[36] = KERN(canon)(r36);
+    p->coeffs[37] = KERN(canon)(r37);
+    p->coeffs[38] = KERN(canon)(r38);
+    p->coeffs[39] = KERN(canon)(r39);
+    p->coeffs[40] = KERN(canon)(r40);
+    p->coeffs[41] = KERN(canon)(r41);
+    p->coeffs[42] = KERN(canon)(r42);
+    p->coeffs[43] = KERN(canon)(r43);
+    p->coeffs[44] = KERN(canon)(r44);
+    p->coeffs[45] = KERN(canon)(r45);
+    p->coeffs[46] = KERN(canon)(r46);
+    p->coeffs[47] = KERN(canon)(r47);
+    p->coeffs[48] = KERN(canon)(r48);
+    p->coeffs[49] = KERN(canon)(r49);
+    p->coeffs[50] = KERN(canon)(r50);
+    p->coeffs[51] = KERN(canon)(r51);
+    p->coeffs[52] = KERN(canon)(r52);
+    p->coeffs[53] = KERN(canon)(r53);
+    p->coeffs[54] = KERN(canon)(r54);
+    p->coeffs[55] = KERN(canon)(r55);
+    p->coeffs[56] = KERN(canon)(r56);
+    p->coeffs[57] = KERN(canon)(r57);
+    p->coeffs[58] = KERN(canon)(r58);
+    p->coeffs[59] = KERN(canon)(r59);
+    p->coeffs[60] = KERN(canon)(r60);
+    p->coeffs[61] = KERN(canon)(r61);
+    p->coeffs[62] = KERN(canon)(r62);
+    p->coeffs[63] = KERN(canon)(r63);
+}
+
+// 同 ntt，輸出同時寫到頻率優先佈局 (out 指向該多項式在第 0 個 tile 的起點，stride 為相鄰 tile 的距離)
+static void KERN(ntt_fm)(poly *p, int16_t *out, size_t stride) {
+    int32_t r0 = p->coeffs[0];
+    int32_t r1 = p->coeffs[1];
+    int32_t r2 = p->coeffs[2];
+    int32_t r3 = p->coeffs[3];
+    int32_t r4 = p->coeffs[4];
+    int32_t r5 = p->coeffs[5];
+    int32_t r6 = p->coeffs[6];
+    int32_t r7 = p->coeffs[7];
+    int32_t r8 = p->coeffs[8];
+    int32_t r9 = p->coeffs[9];
+    int32_t r10 = p->coeffs[10];
+    int32_t r11 = p->coeffs[11];
+    int32_t r12 = p->coeffs[12];
+    int32_t r13 = p->coeffs[13];
+    int32_t r14 = p->coeffs[14];
+    int32_t r15 = p->coeffs[15];
+    int32_t r16 = p->coeffs[16];
+    int32_t r17 = p->coeffs[17];
+    int32_t r18 = p->coeffs[18];
+    int32_t r19 = p->coeffs[19];
+    int32_t r20 = p->coeffs[20];
+    int32_t r21 = p->coeffs[21];
+    int32_t r22 = p->coeffs[22];
+    int32_t r23 = p->coeffs[23];
+    int32_t r24 = p->coeffs[24];
+    int32_t r25 = p->coeffs[25];
+    int32_t r26 = p->coeffs[26];
+    int32_t r27 = p->coeffs[27];
+    int32_t r28 = p->coeffs[28];
+    int32_t r29 = p->coeffs[29];
+    int32_t r30 = p->coeffs[30];
+    int32_t r31 = p->coeffs[31];
+    int32_t r32 = p->coeffs[32];
+    int32_t r33 = p->coeffs[33];
+    int32_t r34 = p->coeffs[34];
+    int32_t r35 = p->coeffs[35];
+    int32_t r36 = p->coeffs[36];
+    int32_t r37 = p->coeffs[37];
+    int32_t r38 = p->coeffs[38];
+    int32_t r39 = p->coeffs[39];
+    int32_t r40 = p->coeffs[40];
+    int32_t r41 = p->coeffs[41];
+    int32_t r42 = p->coeffs[42];
+    int32_t r43 = p->coeffs[43];
+    int32_t r44 = p->coeffs[44];
+    int32_t r45 = p->coeffs[45];
+    int32_t r46 = p->coeffs[46];
+    int32_t r47 = p->coeffs[47];
+    int32_t r48 = p->coeffs[48];
+    int32_t r49 = p->coeffs[49];
+    int32_t r50 = p->coeffs[50];
+    int32_t r51 = p->coeffs[51];
+    int32_t r52 = p->coeffs[52];
+    int32_t r53 = p->coeffs[53];
+    int32_t r54 = p->coeffs[54];
+    int32_t r55 = p->coeffs[55];
+    int32_t r56 = p->coeffs[56];
+    int32_t r57 = p->coeffs[57];
+    int32_t r58 = p->coeffs[58];
+    int32_t r59 = p->coeffs[59];
+    int32_t r60 = p->coeffs[60];
+    int32_t r61 = p->coeffs[61];
+    int32_t r62 = p->coeffs[62];
+    int32_t r63 = p->coeffs[63];
+    int32_t t;
+
+    // 第 1 層 (t = 32)，輸入 |r| <= 32768
+    t = KERN(barrett)(r32 * 3383);
+    r32 = r0 - t; r0 += t;
+    t = KERN(barrett)(r33 * 3383);
+    r33 = r1 - t; r1 += t;
+    t = KERN(barrett)(r34 * 3383);
+    r34 = r2 - t; r2 += t;
+    t = KERN(barrett)(r35 * 3383);
+    r35 = r3 - t; r3 += t;
+    t = KERN(barrett)(r36 * 3383);
+    r36 = r4 - t; r4 += t;
+    t = KERN(barrett)(r37 * 3383);
+    r37 = r5 - t; r5 += t;
+    t = KERN(barrett)(r38 * 3383);
+    r38 = r6 - t; r6 += t;
+    t = KERN(barrett)(r39 * 3383);
+    r39 = r7 - t; r7 += t;
+    t = KERN(barrett)(r40 * 3383);
+    r40 = r8 - t; r8 += t;
+    t = KERN(barrett)(r41 * 3383);
+    r41 = r9 - t; r9 += t;
+    t = KERN(barrett)(r42 * 3383);
+    r42 = r10 - t; r10 += t;
+    t = KERN(barrett)(r43 * 3383);
+    r43 = r11 - t; r11 += t;
+    t = KERN(barrett)(r44 * 3383);
+    r44 = r12 - t; r12 += t;
+    t = KERN(barrett)(r45 * 3383);
+    r45 = r13 - t; r13 += t;
+    t = KERN(barrett)(r46 * 3383);
+    r46 = r14 - t; r14 += t;
+    t = KERN(barrett)(r47 * 3383);
+    r47 = r15 - t; r15 += t;
+    t = KERN(barrett)(r48 * 3383);
+    r48 = r16 - t; r16 += t;
+    t = KERN(barrett)(r49 * 3383);
+    r49 = r17 - t; r17 += t;
+    t = KERN(barrett)(r50 * 3383);
+    r50 = r18 - t; r18 += t;
+    t = KERN(barrett)(r51 * 3383);
+    r51 = r19 - t; r19 += t;
+    t = KERN(barrett)(r52 * 3383);
+    r52 = r20 - t; r20 += t;
+    t = KERN(barrett)(r53 * 3383);
+    r53 = r21 - t; r21 += t;
+    t = KERN(barrett)(r54 * 3383);
+    r54 = r22 - t; r22 += t;
+    t = KERN(barrett)(r55 * 3383);
+    r55 = r23 - t; r23 += t;
+    t = KERN(barrett)(r56 * 3383);
+    r56 = r24 - t; r24 += t;
+    t = KERN(barrett)(r57 * 3383);
+    r57 = r25 - t; r25 += t;
+    t = KERN(barrett)(r58 * 3383);
+    r58 = r26 - t; r26 += t;
+    t = KERN(barrett)(r59 * 3383);
+    r59 = r27 - t; r27 += t;
+    t = KERN(barrett)(r60 * 3383);
+    r60 = r28 - t; r28 += t;
+    t = KERN(barrett)(r61 * 3383);
+    r61 = r29 - t; r29 += t;
+    t = KERN(barrett)(r62 * 3383);
+    r62 = r30 - t; r30 += t;
+    t = KERN(barrett)(r63 * 3383);
+    r63 = r31 - t; r31 += t;
+
+    // 第 2 層 (t = 16)，輸入 |r| <= 48129
+    t = KERN(barrett)(r16 * -1925);
+    r16 = r0 - t; r0 += t;
+    t = KERN(barrett)(r17 * -1925);
+    r17 = r1 - t; r1 += t;
+    t = KERN(barrett)(r18 * -1925);
+    r18 = r2 - t; r2 += t;
+    t = KERN(barrett)(r19 * -1925);
+    r19 = r3 - t; r3 += t;
+    t = KERN(barrett)(r20 * -1925);
+    r20 = r4 - t; r4 += t;
+    t = KERN(barrett)(r21 * -1925);
+    r21 = r5 - t; r5 += t;
+    t = KERN(barrett)(r22 * -1925);
+    r22 = r6 - t; r6 += t;
+    t = KERN(barrett)(r23 * -1925);
+    r23 = r7 - t; r7 += t;
+    t = KERN(barrett)(r24 * -1925);
+    r24 = r8 - t; r8 += t;
+    t = KERN(barrett)(r25 * -1925);
+    r25 = r9 - t; r9 += t;
+    t = KERN(barrett)(r26 * -1925);
+    r26 = r10 - t; r10 += t;
+    t = KERN(barrett)(r27 * -1925);
+    r27 = r11 - t; r11 += t;
+    t = KERN(barrett)(r28 * -1925);
+    r28 = r12 - t; r12 += t;
+    t = KERN(barrett)(r29 * -1925);
+    r29 = r13 - t; r13 += t;
+    t = KERN(barrett)(r30 * -1925);
+    r30 = r14 - t; r14 += t;
+    t = KERN(barrett)(r31 * -1925);
+    r31 = r15 - t; r15 += t;
+    t = KERN(barrett)(r48 * 1213);
+    r48 = r32 - t; r32 += t;
+    t = KERN(barrett)(r49 * 1213);
+    r49 = r33 - t; r33 += t;
+    t = KERN(barrett)(r50 * 1213);
+    r50 = r34 - t; r34 += t;
+    t = KERN(barrett)(r51 * 1213);
+    r51 = r35 - t; r35 += t;
+    t = KERN(barrett)(r52 * 1213);
+    r52 = r36 - t; r36 += t;
+    t = KERN(barrett)(r53 * 1213);
+    r53 = r37 - t; r37 += t;
+    t = KERN(barrett)(r54 * 1213);
+    r54 = r38 - t; r38 += t;
+    t = KERN(barrett)(r55 * 1213);
+    r55 = r39 - t; r39 += t;
+    t = KERN(barrett)(r56 * 1213);
+    r56 = r40 - t; r40 += t;
+    t = KERN(barrett)(r57 * 1213);
+    r57 = r41 - t; r41 += t;
+    t = KERN(barrett)(r58 * 1213);
+    r58 = r42 - t; r42 += t;
+    t = KERN(barrett)(r59 * 1213);
+    r59 = r43 - t; r43 += t;
+    t = KERN(barrett)(r60 * 1213);
+    r60 = r44 - t; r44 += t;
+    t = KERN(barrett)(r61 * 1213);
+    r61 = r45 - t; r45 += t;
+    t = KERN(barrett)(r62 * 1213);
+    r62 = r46 - t; r46 += t;
+    t = KERN(barrett)(r63 * 1213);
+    r63 = r47 - t; r47 += t;
+
+    // 第 3 層 (t = 8)，輸入 |r| <= 63490
+    t = KERN(barrett)(r8 * -1728);
+    r8 = r0 - t; r0 += t;
+    t = KERN(barrett)(r9 * -1728);
+    r9 = r1 - t; r1 += t;
+    t = KERN(barrett)(r10 * -1728);
+    r10 = r2 - t; r2 += t;
+    t = KERN(barrett)(r11 * -1728);
+    r11 = r3 - t; r3 += t;
+    t = KERN(barrett)(r12 * -1728);
+    r12 = r4 - t; r4 += t;
+    t = KERN(barrett)(r13 * -1728);
+    r13 = r5 - t; r5 += t;
+    t = KERN(barrett)(r14 * -1728);
+    r14 = r6 - t; r6 += t;
+    t = KERN(barrett)(r15 * -1728);
+    r15 = r7 - t; r7 += t;
+    t = KERN(barrett)(r24 * -583);
+    r24 = r16 - t; r16 += t;
+    t = KERN(barrett)(r25 * -583);
+    r25 = r17 - t; r17 += t;
+    t = KERN(barrett)(r26 * -583);
+    r26 = r18 - t; r18 += t;
+    t = KERN(barrett)(r27 * -583);
+    r27 = r19 - t; r19 += t;
+    t = KERN(barrett)(r28 * -583);
+    r28 = r20 - t; r20 += t;
+    t = KERN(barrett)(r29 * -583);
+    r29 = r21 - t; r21 += t;
+    t = KERN(barrett)(r30 * -583);
+    r30 = r22 - t; r22 += t;
+    t = KERN(barrett)(r31 * -583);
+    r31 = r23 - t; r23 += t;
+    t = KERN(barrett)(r40 * 527);
+    r40 = r32 - t; r32 += t;
+    t = KERN(barrett)(r41 * 527);
+    r41 = r33 - t; r33 += t;
+    t = KERN(barrett)(r42 * 527);
+    r42 = r34 - t; r34 += t;
+    t = KERN(barrett)(r43 * 527);
+    r43 = r35 - t; r35 += t;
+    t = KERN(barrett)(r44 * 527);
+    r44 = r36 - t; r36 += t;
+    t = KERN(barrett)(r45 * 527);
+    r45 = r37 - t; r37 += t;
+    t = KERN(barrett)(r46 * 527);
+    r46 = r38 - t; r38 += t;
+    t = KERN(barrett)(r47 * 527);
+    r47 = r39 - t; r39 += t;
+    t = KERN(barrett)(r56 * 849);
+    r56 = r48 - t; r48 += t;
+    t = KERN(barrett)(r57 * 849);
+    r57 = r49 - t; r49 += t;
+    t = KERN(barrett)(r58 * 849);
+    r58 = r50 - t; r50 += t;
+    t = KERN(barrett)(r59 * 849);
+    r59 = r51 - t; r51 += t;
+    t = KERN(barrett)(r60 * 849);
+    r60 = r52 - t; r52 += t;
+    t = KERN(barrett)(r61 * 849);
+    r61 = r53 - t; r53 += t;
+    t = KERN(barrett)(r62 * 849);
+    r62 = r54 - t; r54 += t;
+    t = KERN(barrett)(r63 * 849);
+    r63 = r55 - t; r55 += t;
+
+    // 第 4 層 (t = 4)，輸入 |r| <= 78851
+    t = KERN(barrett)(r4 * 2132);
+    r4 = r0 - t; r0 += t;
+    t = KERN(barrett)(r5 * 2132);
+    r5 = r1 - t; r1 += t;
+    t = KERN(barrett)(r6 * 2132);
+    r6 = r2 - t; r2 += t;
+    t = KERN(barrett)(r7 * 2132);
+    r7 = r3 - t; r3 += t;
+    t = KERN(barrett)(r12 * 97);
+    r12 = r8 - t; r8 += t;
+    t = KERN(barrett)(r13 * 97);
+    r13 = r9 - t; r9 += t;
+    t = KERN(barrett)(r14 * 97);
+    r14 = r10 - t; r10 += t;
+    t = KERN(barrett)(r15 * 97);
+    r15 = r11 - t; r11 += t;
+    t = KERN(barrett)(r20 * -2446);
+    r20 = r16 - t; r16 += t;
+    t = KERN(barrett)(r21 * -2446);
+    r21 = r17 - t; r17 += t;
+    t = KERN(barrett)(r22 * -2446);
+    r22 = r18 - t; r18 += t;
+    t = KERN(barrett)(r23 * -2446);
+    r23 = r19 - t; r19 += t;
+    t = KERN(barrett)(r28 * -2381);
+    r28 = r24 - t; r24 += t;
+    t = KERN(barrett)(r29 * -2381);
+    r29 = r25 - t; r25 += t;
+    t = KERN(barrett)(r30 * -2381);
+    r30 = r26 - t; r26 += t;
+    t = KERN(barrett)(r31 * -2381);
+    r31 = r27 - t; r27 += t;
+    t = KERN(barrett)(r36 * 2784);
+    r36 = r32 - t; r32 += t;
+    t = KERN(barrett)(r37 * 2784);
+    r37 = r33 - t; r33 += t;
+    t = KERN(barrett)(r38 * 2784);
+    r38 = r34 - t; r34 += t;
+    t = KERN(barrett)(r39 * 2784);
+    r39 = r35 - t; r35 += t;
+    t = KERN(barrett)(r44 * 1366);
+    r44 = r40 - t; r40 += t;
+    t = KERN(barrett)(r45 * 1366);
+    r45 = r41 - t; r41 += t;
+    t = KERN(barrett)(r46 * 1366);
+    r46 = r42 - t; r42 += t;
+    t = KERN(barrett)(r47 * 1366);
+    r47 = r43 - t; r43 += t;
+    t = KERN(barrett)(r52 * 2138);
+    r52 = r48 - t; r48 += t;
+    t = KERN(barrett)(r53 * 2138);
+    r53 = r49 - t; r49 += t;
+    t = KERN(barrett)(r54 * 2138);
+    r54 = r50 - t; r50 += t;
+    t = KERN(barrett)(r55 * 2138);
+    r55 = r51 - t; r51 += t;
+    t = KERN(barrett)(r60 * -2648);
+    r60 = r56 - t; r56 += t;
+    t = KERN(barrett)(r61 * -2648);
+    r61 = r57 - t; r57 += t;
+    t = KERN(barrett)(r62 * -2648);
+    r62 = r58 - t; r58 += t;
+    t = KERN(barrett)(r63 * -2648);
+    r63 = r59 - t; r59 += t;
+
+    // 第 5 層 (t = 2)，輸入 |r| <= 94212
+    t = KERN(barrett)(r2 * 2399);
+    r2 = r0 - t; r0 += t;
+    t = KERN(barrett)(r3 * 2399);
+    r3 = r1 - t; r1 += t;
+    t = KERN(barrett)(r6 * -3000);
+    r6 = r4 - t; r4 += t;
+    t = KERN(barrett)(r7 * -3000);
+    r7 = r5 - t; r5 += t;
+    t = KERN(barrett)(r10 * -1794);
+    r10 = r8 - t; r8 += t;
+    t = KERN(barrett)(r11 * -1794);
+    r11 = r9 - t; r9 += t;
+    t = KERN(barrett)(r14 * -1112);
+    r14 = r12 - t; r12 += t;
+    t = KERN(barrett)(r15 * -1112);
+    r15 = r13 - t; r13 += t;
+    t = KERN(barrett)(r18 * 2268);
+    r18 = r16 - t; r16 += t;
+    t = KERN(barrett)(r19 * 2268);
+    r19 = r17 - t; r17 += t;
+    t = KERN(barrett)(r22 * -675);
+    r22 = r20 - t; r20 += t;
+    t = KERN(barrett)(r23 * -675);
+    r23 = r21 - t; r21 += t;
+    t = KERN(barrett)(r26 * -3092);
+    r26 = r24 - t; r24 += t;
+    t = KERN(barrett)(r27 * -3092);
+    r27 = r25 - t; r25 += t;
+    t = KERN(barrett)(r30 * 1286);
+    r30 = r28 - t; r28 += t;
+    t = KERN(barrett)(r31 * 1286);
+    r31 = r29 - t; r29 += t;
+    t = KERN(barrett)(r34 * -878);
+    r34 = r32 - t; r32 += t;
+    t = KERN(barrett)(r35 * -878);
+    r35 = r33 - t; r33 += t;
+    t = KERN(barrett)(r38 * 2273);
+    r38 = r36 - t; r36 += t;
+    t = KERN(barrett)(r39 * 2273);
+    r39 = r37 - t; r37 += t;
+    t = KERN(barrett)(r42 * 330);
+    r42 = r40 - t; r40 += t;
+    t = KERN(barrett)(r43 * 330);
+    r43 = r41 - t; r41 += t;
+    t = KERN(barrett)(r46 * 2645);
+    r46 = r44 - t; r44 += t;
+    t = KERN(barrett)(r47 * 2645);
+    r47 = r45 - t; r45 += t;
+    t = KERN(barrett)(r50 * -3654);
+    r50 = r48 - t; r48 += t;
+    t = KERN(barrett)(r51 * -3654);
+    r51 = r49 - t; r49 += t;
+    t = KERN(barrett)(r54 * -2753);
+    r54 = r52 - t; r52 += t;
+    t = KERN(barrett)(r55 * -2753);
+    r55 = r53 - t; r53 += t;
+    t = KERN(barrett)(r58 * -1846);
+    r58 = r56 - t; r56 += t;
+    t = KERN(barrett)(r59 * -1846);
+    r59 = r57 - t; r57 += t;
+    t = KERN(barrett)(r62 * -365);
+    r62 = r60 - t; r60 += t;
+    t = KERN(barrett)(r63 * -365);
+    r63 = r61 - t; r61 += t;
+
+    // 第 6 層 (t = 1)，輸入 |r| <= 109573
+    t = KERN(barrett)(r1 * 202);
+    r1 = r0 - t; r0 += t;
+    t = KERN(barrett)(r3 * -243);
+    r3 = r2 - t; r2 += t;
+    t = KERN(barrett)(r5 * 2881);
+    r5 = r4 - t; r4 += t;
+    t = KERN(barrett)(r7 * -766);
+    r7 = r6 - t; r6 += t;
+    t = KERN(barrett)(r9 * -3411);
+    r9 = r8 - t; r8 += t;
+    t = KERN(barrett)(r11 * -2551);
+    r11 = r10 - t; r10 += t;
+    t = KERN(barrett)(r13 * -1080);
+    r13 = r12 - t; r12 += t;
+    t = KERN(barrett)(r15 * 2516);
+    r15 = r14 - t; r14 += t;
+    t = KERN(barrett)(r17 * 528);
+    r17 = r16 - t; r16 += t;
+    t = KERN(barrett)(r19 * -3449);
+    r19 = r18 - t; r18 += t;
+    t = KERN(barrett)(r21 * -2508);
+    r21 = r20 - t; r20 += t;
+    t = KERN(barrett)(r23 * 2941);
+    r23 = r22 - t; r22 += t;
+    t = KERN(barrett)(r25 * 1655);
+    r25 = r24 - t; r24 += t;
+    t = KERN(barrett)(r27 * -584);
+    r27 = r26 - t; r26 += t;
+    t = KERN(barrett)(r29 * 1740);
+    r29 = r28 - t; r28 += t;
+    t = KERN(barrett)(r31 * 2774);
+    r31 = r30 - t; r30 += t;
+    t = KERN(barrett)(r33 * 695);
+    r33 = r32 - t; r32 += t;
+    t = KERN(barrett)(r35 * 799);
+    r35 = r34 - t; r34 += t;
+    t = KERN(barrett)(r37 * -1381);
+    r37 = r36 - t; r36 += t;
+    t = KERN(barrett)(r39 * -1875);
+    r39 = r38 - t; r38 += t;
+    t = KERN(barrett)(r41 * -2724);
+    r41 = r40 - t; r40 += t;
+    t = KERN(barrett)(r43 * 1908);
+    r43 = r42 - t; r42 += t;
+    t = KERN(barrett)(r45 * -2423);
+    r45 = r44 - t; r44 += t;
+    t = KERN(barrett)(r47 * -1382);
+    r47 = r46 - t; r46 += t;
+    t = KERN(barrett)(r49 * -693);
+    r49 = r48 - t; r48 += t;
+    t = KERN(barrett)(r51 * -1714);
+    r51 = r50 - t; r50 += t;
+    t = KERN(barrett)(r53 * -2469);
+    r53 = r52 - t; r52 += t;
+    t = KERN(barrett)(r55 * -3380);
+    r55 = r54 - t; r54 += t;
+    t = KERN(barrett)(r57 * -732);
+    r57 = r56 - t; r56 += t;
+    t = KERN(barrett)(r59 * -3074);
+    r59 = r58 - t; r58 += t;
+    t = KERN(barrett)(r61 * 3477);
+    r61 = r60 - t; r60 += t;
+    t = KERN(barrett)(r63 * 3080);
+    r63 = r62 - t; r62 += t;
+
+    // 輸出化約，|r| <= 124934
+    r0 = KERN(barrett)(r0);
+    r1 = KERN(barrett)(r1);
+    r2 = KERN(barrett)(r2);
+    r3 = KERN(barrett)(r3);
+    r4 = KERN(barrett)(r4);
+    r5 = KERN(barrett)(r5);
+    r6 = KERN(barrett)(r6);
+    r7 = KERN(barrett)(r7);
+    r8 = KERN(barrett)(r8);
+    r9 = KERN(barrett)(r9);
+    r10 = KERN(barrett)(r10);
+    r11 = KERN(barrett)(r11);
+    r12 = KERN(barrett)(r12);
+    r13 = KERN(barrett)(r13);
+    r14 = KERN(barrett)(r14);
+    r15 = KERN(barrett)(r15);
+    r16 = KERN(barrett)(r16);
+    r17 = KERN(barrett)(r17);
+    r18 = KERN(barrett)(r18);
+    r19 = KERN(barrett)(r19);
+    r20 = KERN(barrett)(r20);
+    r21 = KERN(barrett)(r21);
+    r22 = KERN(barrett)(r22);
+    r23 = KERN(barrett)(r23);
+    r24 = KERN(barrett)(r24);
+    r25 = KERN(barrett)(r25);
+    r26 = KERN(barrett)(r26);
+    r27 = KERN(barrett)(r27);
+    r28 = KERN(barrett)(r28);
+    r29 = KERN(barrett)(r29);
+    r30 = KERN(barrett)(r30);
+    r31 = KERN(barrett)(r31);
+    r32 = KERN(barrett)(r32);
+    r33 = KERN(barrett)(r33);
+    r34 = KERN(barrett)(r34);
+    r35 = KERN(barrett)(r35);
+    r36 = KERN(barrett)(r36);
+    r37 = KERN(barrett)(r37);
+    r38 = KERN(barrett)(r38);
+    r39 = KERN(barrett)(r39);
+    r40 = KERN(barrett)(r40);
+    r41 = KERN(barrett)(r41);
+    r42 = KERN(barrett)(r42);
+    r43 = KERN(barrett)(r43);
+    r44 = KERN(barrett)(r44);
+    r45 = KERN(barrett)(r45);
+    r46 = KERN(barrett)(r46);
+    r47 = KERN(barrett)(r47);
+    r48 = KERN(barrett)(r48);
+    r49 = KERN(barrett)(r49);
+    r50 = KERN(barrett)(r50);
+    r51 = KERN(barrett)(r51);
+    r52 = KERN(barrett)(r52);
+    r53 = KERN(barrett)(r53);
+    r54 = KERN(barrett)(r54);
+    r55 = KERN(barrett)(r55);
+    r56 = KERN(barrett)(r56);
+    r57 = KERN(barrett)(r57);
+    r58 = KERN(barrett)(r58);
+    r59 = KERN(barrett)(r59);
+    r60 = KERN(barrett)(r60);
+    r61 = KERN(barrett)(r61);
+    r62 = KERN(barrett)(r62);
+    r63 = KERN(barrett)(r63);
+    out[0 * stride + 0] = p->coeffs[0] = KERN(canon)(r0);
+    out[0 * stride + 1] = p->coeffs[1] = KERN(canon)(r1);
+    out[0 * stride + 2] = p->coeffs[2] = KERN(canon)(r2);
+    out[0 * stride + 3] = p->coeffs[3] = KERN(canon)(r3);
+    out[0 * stride + 4] = p->coeffs[4] = KERN(canon)(r4);
+    out[0 * stride + 5] = p->coeffs[5] = KERN(canon)(r5);
+    out[0 * stride + 6] = p->coeffs[6] = KERN(canon)(r6);
+    out[0 * stride + 7] = p->coeffs[7] = KERN(canon)(r7);
+    out[0 * stride + 8] = p->coeffs[8] = KERN(canon)(r8);
+    out[0 * stride + 9] = p->coeffs[9] = KERN(canon)(r9);
+    out[0 * stride + 10] = p->coeffs[10] = KERN(canon)(r10);
+    out[0 * stride + 11] = p->coeffs[11] = KERN(canon)(r11);
+    out[0 * stride + 12] = p->coeffs[12] = KERN(canon)(r12);
+    out[0 * stride + 13] = p->coeffs[13] = KERN(canon)(r13);
+    out[0 * stride + 14] = p->coeffs[14] = KERN(canon)(r14);
+    out[0 * stride + 15] = p->coeffs[15] = KERN(canon)(r15);
+    out[1 * stride + 0] = p->coeffs[16] = KERN(canon)(r16);
+    out[1 * stride + 1] = p->coeffs[17] = KERN(canon)(r17);
+    out[1 * stride + 2] = p->coeffs[18] = KERN(canon)(r18);
+    out[1 * stride + 3] = p->coeffs[19] = KERN(canon)(r19);
+    out[1 * stride + 4] = p->coeffs[20] = KERN(canon)(r20);
+    out[1 * stride + 5] = p->coeffs[21] = KERN(canon)(r21);
+    out[1 * stride + 6] = p->coeffs[22] = KERN(canon)(r22);
+    out[1 * stride + 7] = p->coeffs[23] = KERN(canon)(r23);
+    out[1 * stride + 8] = p->coeffs[24] = KERN(canon)(r24);
+    out[1 * stride + 9] = p->coeffs[25] = KERN(canon)(r25);
+    out[1 * stride + 10] = p->coeffs[26] = KERN(canon)(r26);
+    out[1 * stride + 11] = p->coeffs[27] = KERN(canon)(r27);
+    out[1 * stride + 12] = p->coeffs[28] = KERN(canon)(r28);
+    out[1 * stride + 13] = p->coeffs[29] = KERN(canon)(r29);
+    out[1 * stride + 14] = p->coeffs[30] = KERN(canon)(r30);
+    out[1 * stride + 15] = p->coeffs[31] = KERN(canon)(r31);
+    out[2 * stride + 0] = p->coeffs[32] = KERN(canon)(r32);
+    out[2 * stride + 1] = p->coeffs[33] = KERN(canon)(r33);
+    out[2 * stride + 2] = p->coeffs[34] = KERN(canon)(r34);
+    out[2 * stride + 3] = p->coeffs[35] = KERN(canon)(r35);
+    out[2 * stride + 4] = p->coeffs[36] = KERN(canon)(r36);
+    out[2 * stride + 5] = p->coeffs[37] = KERN(canon)(r37);
+    out[2 * stride + 6] = p->coeffs[38] = KERN(canon)(r38);
+    out[2 * stride + 7] = p->coeffs[39] = KERN(canon)(r39);
+    out[2 * stride + 8] = p->coeffs[40] = KERN(canon)(r40);
+    out[2 * stride + 9] = p->coeffs[41] = KERN(canon)(r41);
+    out[2 * stride + 10] = p->coeffs[42] = KERN(canon)(r42);
+    out[2 * stride + 11] = p->coeffs[43] = KERN(canon)(r43);
+    out[2 * stride + 12] = p->coeffs[44] = KERN(canon)(r44);
+    out[2 * stride + 13] = p->coeffs[45] = KERN(canon)(r45);
+    out[2 * stride + 14] = p->coeffs[46] = KERN(canon)(r46);
+    out[2 * stride + 15] = p->coeffs[47] = KERN(canon)(r47);
+    out[3 * stride + 0] = p->coeffs[48] = KERN(canon)(r48);
+    out[3 * stride + 1] = p->coeffs[49] = KERN(canon)(r49);
+    out[3 * stride + 2] = p->coeffs[50] = KERN(canon)(r50);
+    out[3 * stride + 3] = p->coeffs[51] = KERN(canon)(r51);
+    out[3 * stride + 4] = p->coeffs[52] = KERN(canon)(r52);
+    out[3 * stride + 5] = p->coeffs[53] = KERN(canon)(r53);
+    out[3 * stride + 6] = p->coeffs[54] = KERN(canon)(r54);
+    out[3 * stride + 7] = p->coeffs[55] = KERN(canon)(r55);
+    out[3 * stride + 8] = p->coeffs[56] = KERN(canon)(r56);
+    out[3 * stride + 9] = p->coeffs[57] = KERN(canon)(r57);
+    out[3 * stride + 10] = p->coeffs[58] = KERN(canon)(r58);
+    out[3 * stride + 11] = p->coeffs[59] = KERN(canon)(r59);
+    out[3 * stride + 12] = p->coeffs[60] = KERN(canon)(r60);
+    out[3 * stride + 13] = p->coeffs[61] = KERN(canon)(r61);
+    out[3 * stride + 14] = p->coeffs[62] = KERN(canon)(r62);
+    out[3 * stride + 15] = p->coeffs[63] = KERN(canon)(r63);
+}
+
+// 反向 INTT (6 層，輸入位元反轉 -> 輸出自然順序)，輸入可為任意 int16，輸出在 [0, q)
+static void KERN(invntt)(poly *p) {
+    int32_t r0 = p->coeffs[0];
+    int32_t r1 = p->coeffs[1];
+    int32_t r2 = p->coeffs[2];
+    int32_t r3 = p->coeffs[3];
+    int32_t r4 = p->coeffs[4];
+    int32_t r5 = p->coeffs[5];
+    int32_t r6 = p->coeffs[6];
+    int32_t r7 = p->coeffs[7];
+    int32_t r8 = p->coeffs[8];
+    int32_t r9 = p->coeffs[9];
+    int32_t r10 = p->coeffs[10];
+    int32_t r11 = p->coeffs[11];
+    int32_t r12 = p->coeffs[12];
+    int32_t r13 = p->coeffs[13];
+    int32_t r14 = p->coeffs[14];
+    int32_t r15 = p->coeffs[15];
+    int32_t r16 = p->coeffs[16];
+    int32_t r17 = p->coeffs[17];
+    int32_t r18 = p->coeffs[18];
+    int32_t r19 = p->coeffs[19];
+    int32_t r20 = p->coeffs[20];
+    int32_t r21 = p->coeffs[21];
+    int32_t r22 = p->coeffs[22];
+    int32_t r23 = p->coeffs[23];
+    int32_t r24 = p->coeffs[24];
+    int32_t r25 = p->coeffs[25];
+    int32_t r26 = p->coeffs[26];
+    int32_t r27 = p->coeffs[27];
+    int32_t r28 = p->coeffs[28];
+    int32_t r29 = p->coeffs[29];
+    int32_t r30 = p->coeffs[30];
+    int32_t r31 = p->coeffs[31];
+    int32_t r32 = p->coeffs[32];
+    int32_t r33 = p->coeffs[33];
+    int32_t r34 = p->coeffs[34];
+    int32_t r35 = p->coeffs[35];
+    int32_t r36 = p->coeffs[36];
+    int32_t r37 = p->coeffs[37];
+    int32_t r38 = p->coeffs[38];
+    int32_t r39 = p->coeffs[39];
+    int32_t r40 = p->coeffs[40];
+    int32_t r41 = p->coeffs[41];
+    int32_t r42 = p->coeffs[42];
+    int32_t r43 = p->coeffs[43];
+    int32_t r44 = p->coeffs[44];
+    int32_t r45 = p->coeffs[45];
+    int32_t r46 = p->coeffs[46];
+    int32_t r47 = p->coeffs[47];
+    int32_t r48 = p->coeffs[48];
+    int32_t r49 = p->coeffs[49];
+    int32_t r50 = p->coeffs[50];
+    int32_t r51 = p->coeffs[51];
+    int32_t r52 = p->coeffs[52];
+    int32_t r53 = p->coeffs[53];
+    int32_t r54 = p->coeffs[54];
+    int32_t r55 = p->coeffs[55];
+    int32_t r56 = p->coeffs[56];
+    int32_t r57 = p->coeffs[57];
+    int32_t r58 = p->coeffs[58];
+    int32_t r59 = p->coeffs[59];
+    int32_t r60 = p->coeffs[60];
+    int32_t r61 = p->coeffs[61];
+    int32_t r62 = p->coeffs[62];
+    int32_t r63 = p->coeffs[63];
+    int32_t t;
+    int32_t u;
+
+    // 第 1 層 (t = 1)，輸入 |r| <= 32768
+    u = r0; r0 = u + r1; r1 = u - r1;
+    t = KERN(barrett)(r1 * -3080);
+    r1 = t;
+    u = r2; r2 = u + r3; r3 = u - r3;
+    t = KERN(barrett)(r3 * -3477);
+    r3 = t;
+    u = r4; r4 = u + r5; r5 = u - r5;
+    t = KERN(barrett)(r5 * 3074);
+    r5 = t;
+    u = r6; r6 = u + r7; r7 = u - r7;
+    t = KERN(barrett)(r7 * 732);
+    r7 = t;
+    u = r8; r8 = u + r9; r9 = u - r9;
+    t = KERN(barrett)(r9 * 3380);
+    r9 = t;
+    u = r10; r10 = u + r11; r11 = u - r11;
+    t = KERN(barrett)(r11 * 2469);
+    r11 = t;
+    u = r12; r12 = u + r13; r13 = u - r13;
+    t = KERN(barrett)(r13 * 1714);
+    r13 = t;
+    u = r14; r14 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * 693);
+    r15 = t;
+    u = r16; r16 = u + r17; r17 = u - r17;
+    t = KERN(barrett)(r17 * 1382);
+    r17 = t;
+    u = r18; r18 = u + r19; r19 = u - r19;
+    t = KERN(barrett)(r19 * 2423);
+    r19 = t;
+    u = r20; r20 = u + r21; r21 = u - r21;
+    t = KERN(barrett)(r21 * -1908);
+    r21 = t;
+    u = r22; r22 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * 2724);
+    r23 = t;
+    u = r24; r24 = u + r25; r25 = u - r25;
+    t = KERN(barrett)(r25 * 1875);
+    r25 = t;
+    u = r26; r26 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * 1381);
+    r27 = t;
+    u = r28; r28 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -799);
+    r29 = t;
+    u = r30; r30 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -695);
+    r31 = t;
+    u = r32; r32 = u + r33; r33 = u - r33;
+    t = KERN(barrett)(r33 * -2774);
+    r33 = t;
+    u = r34; r34 = u + r35; r35 = u - r35;
+    t = KERN(barrett)(r35 * -1740);
+    r35 = t;
+    u = r36; r36 = u + r37; r37 = u - r37;
+    t = KERN(barrett)(r37 * 584);
+    r37 = t;
+    u = r38; r38 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * -1655);
+    r39 = t;
+    u = r40; r40 = u + r41; r41 = u - r41;
+    t = KERN(barrett)(r41 * -2941);
+    r41 = t;
+    u = r42; r42 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * 2508);
+    r43 = t;
+    u = r44; r44 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 3449);
+    r45 = t;
+    u = r46; r46 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * -528);
+    r47 = t;
+    u = r48; r48 = u + r49; r49 = u - r49;
+    t = KERN(barrett)(r49 * -2516);
+    r49 = t;
+    u = r50; r50 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * 1080);
+    r51 = t;
+    u = r52; r52 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * 2551);
+    r53 = t;
+    u = r54; r54 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * 3411);
+    r55 = t;
+    u = r56; r56 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 766);
+    r57 = t;
+    u = r58; r58 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * -2881);
+    r59 = t;
+    u = r60; r60 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 243);
+    r61 = t;
+    u = r62; r62 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -202);
+    r63 = t;
+
+    // 第 2 層 (t = 2)，輸入 |r| <= 65536
+    u = r0; r0 = u + r2; r2 = u - r2;
+    t = KERN(barrett)(r2 * 365);
+    r2 = t;
+    u = r1; r1 = u + r3; r3 = u - r3;
+    t = KERN(barrett)(r3 * 365);
+    r3 = t;
+    u = r4; r4 = u + r6; r6 = u - r6;
+    t = KERN(barrett)(r6 * 1846);
+    r6 = t;
+    u = r5; r5 = u + r7; r7 = u - r7;
+    t = KERN(barrett)(r7 * 1846);
+    r7 = t;
+    u = r8; r8 = u + r10; r10 = u - r10;
+    t = KERN(barrett)(r10 * 2753);
+    r10 = t;
+    u = r9; r9 = u + r11; r11 = u - r11;
+    t = KERN(barrett)(r11 * 2753);
+    r11 = t;
+    u = r12; r12 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * 3654);
+    r14 = t;
+    u = r13; r13 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * 3654);
+    r15 = t;
+    u = r16; r16 = u + r18; r18 = u - r18;
+    t = KERN(barrett)(r18 * -2645);
+    r18 = t;
+    u = r17; r17 = u + r19; r19 = u - r19;
+    t = KERN(barrett)(r19 * -2645);
+    r19 = t;
+    u = r20; r20 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -330);
+    r22 = t;
+    u = r21; r21 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -330);
+    r23 = t;
+    u = r24; r24 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -2273);
+    r26 = t;
+    u = r25; r25 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -2273);
+    r27 = t;
+    u = r28; r28 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * 878);
+    r30 = t;
+    u = r29; r29 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * 878);
+    r31 = t;
+    u = r32; r32 = u + r34; r34 = u - r34;
+    t = KERN(barrett)(r34 * -1286);
+    r34 = t;
+    u = r33; r33 = u + r35; r35 = u - r35;
+    t = KERN(barrett)(r35 * -1286);
+    r35 = t;
+    u = r36; r36 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * 3092);
+    r38 = t;
+    u = r37; r37 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * 3092);
+    r39 = t;
+    u = r40; r40 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * 675);
+    r42 = t;
+    u = r41; r41 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * 675);
+    r43 = t;
+    u = r44; r44 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * -2268);
+    r46 = t;
+    u = r45; r45 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * -2268);
+    r47 = t;
+    u = r48; r48 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * 1112);
+    r50 = t;
+    u = r49; r49 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * 1112);
+    r51 = t;
+    u = r52; r52 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * 1794);
+    r54 = t;
+    u = r53; r53 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * 1794);
+    r55 = t;
+    u = r56; r56 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 3000);
+    r58 = t;
+    u = r57; r57 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 3000);
+    r59 = t;
+    u = r60; r60 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * -2399);
+    r62 = t;
+    u = r61; r61 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -2399);
+    r63 = t;
+
+    // 第 3 層 (t = 4)，輸入 |r| <= 131072
+    u = r0; r0 = u + r4; r4 = u - r4;
+    t = KERN(barrett)(r4 * 2648);
+    r4 = t;
+    u = r1; r1 = u + r5; r5 = u - r5;
+    t = KERN(barrett)(r5 * 2648);
+    r5 = t;
+    u = r2; r2 = u + r6; r6 = u - r6;
+    t = KERN(barrett)(r6 * 2648);
+    r6 = t;
+    u = r3; r3 = u + r7; r7 = u - r7;
+    t = KERN(barrett)(r7 * 2648);
+    r7 = t;
+    u = r8; r8 = u + r12; r12 = u - r12;
+    t = KERN(barrett)(r12 * -2138);
+    r12 = t;
+    u = r9; r9 = u + r13; r13 = u - r13;
+    t = KERN(barrett)(r13 * -2138);
+    r13 = t;
+    u = r10; r10 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * -2138);
+    r14 = t;
+    u = r11; r11 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * -2138);
+    r15 = t;
+    u = r16; r16 = u + r20; r20 = u - r20;
+    t = KERN(barrett)(r20 * -1366);
+    r20 = t;
+    u = r17; r17 = u + r21; r21 = u - r21;
+    t = KERN(barrett)(r21 * -1366);
+    r21 = t;
+    u = r18; r18 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -1366);
+    r22 = t;
+    u = r19; r19 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -1366);
+    r23 = t;
+    u = r24; r24 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -2784);
+    r28 = t;
+    u = r25; r25 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -2784);
+    r29 = t;
+    u = r26; r26 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -2784);
+    r30 = t;
+    u = r27; r27 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -2784);
+    r31 = t;
+    u = r32; r32 = u + r36; r36 = u - r36;
+    t = KERN(barrett)(r36 * 2381);
+    r36 = t;
+    u = r33; r33 = u + r37; r37 = u - r37;
+    t = KERN(barrett)(r37 * 2381);
+    r37 = t;
+    u = r34; r34 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * 2381);
+    r38 = t;
+    u = r35; r35 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * 2381);
+    r39 = t;
+    u = r40; r40 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * 2446);
+    r44 = t;
+    u = r41; r41 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 2446);
+    r45 = t;
+    u = r42; r42 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * 2446);
+    r46 = t;
+    u = r43; r43 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * 2446);
+    r47 = t;
+    u = r48; r48 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * -97);
+    r52 = t;
+    u = r49; r49 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * -97);
+    r53 = t;
+    u = r50; r50 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * -97);
+    r54 = t;
+    u = r51; r51 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * -97);
+    r55 = t;
+    u = r56; r56 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * -2132);
+    r60 = t;
+    u = r57; r57 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * -2132);
+    r61 = t;
+    u = r58; r58 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * -2132);
+    r62 = t;
+    u = r59; r59 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -2132);
+    r63 = t;
+
+    // 第 4 層 (t = 8)，輸入 |r| <= 262144
+    u = r0; r0 = u + r8; r8 = u - r8;
+    t = KERN(barrett)(r8 * -849);
+    r8 = t;
+    u = r1; r1 = u + r9; r9 = u - r9;
+    t = KERN(barrett)(r9 * -849);
+    r9 = t;
+    u = r2; r2 = u + r10; r10 = u - r10;
+    t = KERN(barrett)(r10 * -849);
+    r10 = t;
+    u = r3; r3 = u + r11; r11 = u - r11;
+    t = KERN(barrett)(r11 * -849);
+    r11 = t;
+    u = r4; r4 = u + r12; r12 = u - r12;
+    t = KERN(barrett)(r12 * -849);
+    r12 = t;
+    u = r5; r5 = u + r13; r13 = u - r13;
+    t = KERN(barrett)(r13 * -849);
+    r13 = t;
+    u = r6; r6 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * -849);
+    r14 = t;
+    u = r7; r7 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * -849);
+    r15 = t;
+    u = r16; r16 = u + r24; r24 = u - r24;
+    t = KERN(barrett)(r24 * -527);
+    r24 = t;
+    u = r17; r17 = u + r25; r25 = u - r25;
+    t = KERN(barrett)(r25 * -527);
+    r25 = t;
+    u = r18; r18 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -527);
+    r26 = t;
+    u = r19; r19 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -527);
+    r27 = t;
+    u = r20; r20 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -527);
+    r28 = t;
+    u = r21; r21 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -527);
+    r29 = t;
+    u = r22; r22 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -527);
+    r30 = t;
+    u = r23; r23 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -527);
+    r31 = t;
+    u = r32; r32 = u + r40; r40 = u - r40;
+    t = KERN(barrett)(r40 * 583);
+    r40 = t;
+    u = r33; r33 = u + r41; r41 = u - r41;
+    t = KERN(barrett)(r41 * 583);
+    r41 = t;
+    u = r34; r34 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * 583);
+    r42 = t;
+    u = r35; r35 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * 583);
+    r43 = t;
+    u = r36; r36 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * 583);
+    r44 = t;
+    u = r37; r37 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 583);
+    r45 = t;
+    u = r38; r38 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * 583);
+    r46 = t;
+    u = r39; r39 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * 583);
+    r47 = t;
+    u = r48; r48 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * 1728);
+    r56 = t;
+    u = r49; r49 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 1728);
+    r57 = t;
+    u = r50; r50 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 1728);
+    r58 = t;
+    u = r51; r51 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 1728);
+    r59 = t;
+    u = r52; r52 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * 1728);
+    r60 = t;
+    u = r53; r53 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 1728);
+    r61 = t;
+    u = r54; r54 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * 1728);
+    r62 = t;
+    u = r55; r55 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * 1728);
+    r63 = t;
+
+    // 第 5 層 (t = 16)，輸入 |r| <= 524288
+    u = r0; r0 = u + r16; r16 = u - r16;
+    t = KERN(barrett)(r16 * -1213);
+    r16 = t;
+    u = r1; r1 = u + r17; r17 = u - r17;
+    t = KERN(barrett)(r17 * -1213);
+    r17 = t;
+    u = r2; r2 = u + r18; r18 = u - r18;
+    t = KERN(barrett)(r18 * -1213);
+    r18 = t;
+    u = r3; r3 = u + r19; r19 = u - r19;
+    t = KERN(barrett)(r19 * -1213);
+    r19 = t;
+    u = r4; r4 = u + r20; r20 = u - r20;
+    t = KERN(barrett)(r20 * -1213);
+    r20 = t;
+    u = r5; r5 = u + r21; r21 = u - r21;
+    t = KERN(barrett)(r21 * -1213);
+    r21 = t;
+    u = r6; r6 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -1213);
+    r22 = t;
+    u = r7; r7 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -1213);
+    r23 = t;
+    u = r8; r8 = u + r24; r24 = u - r24;
+    t = KERN(barrett)(r24 * -1213);
+    r24 = t;
+    u = r9; r9 = u + r25; r25 = u - r25;
+    t = KERN(barrett)(r25 * -1213);
+    r25 = t;
+    u = r10; r10 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -1213);
+    r26 = t;
+    u = r11; r11 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -1213);
+    r27 = t;
+    u = r12; r12 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -1213);
+    r28 = t;
+    u = r13; r13 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -1213);
+    r29 = t;
+    u = r14; r14 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -1213);
+    r30 = t;
+    u = r15; r15 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -1213);
+    r31 = t;
+    u = r32; r32 = u + r48; r48 = u - r48;
+    t = KERN(barrett)(r48 * 1925);
+    r48 = t;
+    u = r33; r33 = u + r49; r49 = u - r49;
+    t = KERN(barrett)(r49 * 1925);
+    r49 = t;
+    u = r34; r34 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * 1925);
+    r50 = t;
+    u = r35; r35 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * 1925);
+    r51 = t;
+    u = r36; r36 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * 1925);
+    r52 = t;
+    u = r37; r37 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * 1925);
+    r53 = t;
+    u = r38; r38 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * 1925);
+    r54 = t;
+    u = r39; r39 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * 1925);
+    r55 = t;
+    u = r40; r40 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * 1925);
+    r56 = t;
+    u = r41; r41 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 1925);
+    r57 = t;
+    u = r42; r42 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 1925);
+    r58 = t;
+    u = r43; r43 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 1925);
+    r59 = t;
+    u = r44; r44 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * 1925);
+    r60 = t;
+    u = r45; r45 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 1925);
+    r61 = t;
+    u = r46; r46 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * 1925);
+    r62 = t;
+    u = r47; r47 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * 1925);
+    r63 = t;
+
+    // 第 6 層 (t = 32)，輸入 |r| <= 1048576
+    u = r0; r0 = u + r32; r32 = u - r32;
+    r32 = KERN(barrett)(r32);
+    t = KERN(barrett)(r32 * -1133);
+    r32 = t;
+    t = KERN(barrett)(r0 * -120);
+    r0 = t;
+    u = r1; r1 = u + r33; r33 = u - r33;
+    t = KERN(barrett)(r33 * -1133);
+    r33 = t;
+    t = KERN(barrett)(r1 * -120);
+    r1 = t;
+    u = r2; r2 = u + r34; r34 = u - r34;
+    t = KERN(barrett)(r34 * -1133);
+    r34 = t;
+    t = KERN(barrett)(r2 * -120);
+    r2 = t;
+    u = r3; r3 = u + r35; r35 = u - r35;
+    t = KERN(barrett)(r35 * -1133);
+    r35 = t;
+    t = KERN(barrett)(r3 * -120);
+    r3 = t;
+    u = r4; r4 = u + r36; r36 = u - r36;
+    t = KERN(barrett)(r36 * -1133);
+    r36 = t;
+    t = KERN(barrett)(r4 * -120);
+    r4 = t;
+    u = r5; r5 = u + r37; r37 = u - r37;
+    t = KERN(barrett)(r37 * -1133);
+    r37 = t;
+    t = KERN(barrett)(r5 * -120);
+    r5 = t;
+    u = r6; r6 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * -1133);
+    r38 = t;
+    t = KERN(barrett)(r6 * -120);
+    r6 = t;
+    u = r7; r7 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * -1133);
+    r39 = t;
+    t = KERN(barrett)(r7 * -120);
+    r7 = t;
+    u = r8; r8 = u + r40; r40 = u - r40;
+    t = KERN(barrett)(r40 * -1133);
+    r40 = t;
+    t = KERN(barrett)(r8 * -120);
+    r8 = t;
+    u = r9; r9 = u + r41; r41 = u - r41;
+    t = KERN(barrett)(r41 * -1133);
+    r41 = t;
+    t = KERN(barrett)(r9 * -120);
+    r9 = t;
+    u = r10; r10 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * -1133);
+    r42 = t;
+    t = KERN(barrett)(r10 * -120);
+    r10 = t;
+    u = r11; r11 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * -1133);
+    r43 = t;
+    t = KERN(barrett)(r11 * -120);
+    r11 = t;
+    u = r12; r12 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * -1133);
+    r44 = t;
+    t = KERN(barrett)(r12 * -120);
+    r12 = t;
+    u = r13; r13 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * -1133);
+    r45 = t;
+    t = KERN(barrett)(r13 * -120);
+    r13 = t;
+    u = r14; r14 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * -1133);
+    r46 = t;
+    t = KERN(barrett)(r14 * -120);
+    r14 = t;
+    u = r15; r15 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * -1133);
+    r47 = t;
+    t = KERN(barrett)(r15 * -120);
+    r15 = t;
+    u = r16; r16 = u + r48; r48 = u - r48;
+    t = KERN(barrett)(r48 * -1133);
+    r48 = t;
+    t = KERN(barrett)(r16 * -120);
+    r16 = t;
+    u = r17; r17 = u + r49; r49 = u - r49;
+    t = KERN(barrett)(r49 * -1133);
+    r49 = t;
+    t = KERN(barrett)(r17 * -120);
+    r17 = t;
+    u = r18; r18 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * -1133);
+    r50 = t;
+    t = KERN(barrett)(r18 * -120);
+    r18 = t;
+    u = r19; r19 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * -1133);
+    r51 = t;
+    t = KERN(barrett)(r19 * -120);
+    r19 = t;
+    u = r20; r20 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * -1133);
+    r52 = t;
+    t = KERN(barrett)(r20 * -120);
+    r20 = t;
+    u = r21; r21 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * -1133);
+    r53 = t;
+    t = KERN(barrett)(r21 * -120);
+    r21 = t;
+    u = r22; r22 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * -1133);
+    r54 = t;
+    t = KERN(barrett)(r22 * -120);
+    r22 = t;
+    u = r23; r23 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * -1133);
+    r55 = t;
+    t = KERN(barrett)(r23 * -120);
+    r23 = t;
+    u = r24; r24 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * -1133);
+    r56 = t;
+    t = KERN(barrett)(r24 * -120);
+    r24 = t;
+    u = r25; r25 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * -1133);
+    r57 = t;
+    t = KERN(barrett)(r25 * -120);
+    r25 = t;
+    u = r26; r26 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * -1133);
+    r58 = t;
+    t = KERN(barrett)(r26 * -120);
+    r26 = t;
+    u = r27; r27 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * -1133);
+    r59 = t;
+    t = KERN(barrett)(r27 * -120);
+    r27 = t;
+    u = r28; r28 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * -1133);
+    r60 = t;
+    t = KERN(barrett)(r28 * -120);
+    r28 = t;
+    u = r29; r29 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * -1133);
+    r61 = t;
+    t = KERN(barrett)(r29 * -120);
+    r29 = t;
+    u = r30; r30 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * -1133);
+    r62 = t;
+    t = KERN(barrett)(r30 * -120);
+    r30 = t;
+    u = r31; r31 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -1133);
+    r63 = t;
+    t = KERN(barrett)(r31 * -120);
+    r31 = t;
+
+    // 輸出化約，|r| <= 15361
+    p->coeffs[0] = KERN(canon)(r0);
+    p->coeffs[1] = KERN(canon)(r1);
+    p->coeffs[2] = KERN(canon)(r2);
+    p->coeffs[3] = KERN(canon)(r3);
+    p->coeffs[4] = KERN(canon)(r4);
+    p->coeffs[5] = KERN(canon)(r5);
+    p->coeffs[6] = KERN(canon)(r6);
+    p->coeffs[7] = KERN(canon)(r7);
+    p->coeffs[8] = KERN(canon)(r8);
+    p->coeffs[9] = KERN(canon)(r9);
+    p->coeffs[10] = KERN(canon)(r10);
+    p->coeffs[11] = KERN(canon)(r11);
+    p->coeffs[12] = KERN(canon)(r12);
+    p->coeffs[13] = KERN(canon)(r13);
+    p->coeffs[14] = KERN(canon)(r14);
+    p->coeffs[15] = KERN(canon)(r15);
+    p->coeffs[16] = KERN(canon)(r16);
+    p->coeffs[17] = KERN(canon)(r17);
+    p->coeffs[18] = KERN(canon)(r18);
+    p->coeffs[19] = KERN(canon)(r19);
+    p->coeffs[20] = KERN(canon)(r20);
+    p->coeffs[21] = KERN(canon)(r21);
+    p->coeffs[22] = KERN(canon)(r22);
+    p->coeffs[23] = KERN(canon)(r23);
+    p->coeffs[24] = KERN(canon)(r24);
+    p->coeffs[25] = KERN(canon)(r25);
+    p->coeffs[26] = KERN(canon)(r26);
+    p->coeffs[27] = KERN(canon)(r27);
+    p->coeffs[28] = KERN(canon)(r28);
+    p->coeffs[29] = KERN(canon)(r29);
+    p->coeffs[30] = KERN(canon)(r30);
+    p->coeffs[31] = KERN(canon)(r31);
+    p->coeffs[32] = KERN(canon)(r32);
+    p->coeffs[33] = KERN(canon)(r33);
+    p->coeffs[34] = KERN(canon)(r34);
+    p->coeffs[35] = KERN(canon)(r35);
+    p->coeffs[36] = KERN(canon)(r36);
+    p->coeffs[37] = KERN(canon)(r37);
+    p->coeffs[38] = KERN(canon)(r38);
+    p->coeffs[39] = KERN(canon)(r39);
+    p->coeffs[40] = KERN(canon)(r40);
+    p->coeffs[41] = KERN(canon)(r41);
+    p->coeffs[42] = KERN(canon)(r42);
+    p->coeffs[43] = KERN(canon)(r43);
+    p->coeffs[44] = KERN(canon)(r44);
+    p->coeffs[45] = KERN(canon)(r45);
+    p->coeffs[46] = KERN(canon)(r46);
+    p->coeffs[47] = KERN(canon)(r47);
+    p->coeffs[48] = KERN(canon)(r48);
+    p->coeffs[49] = KERN(canon)(r49);
+    p->coeffs[50] = KERN(canon)(r50);
+    p->coeffs[51] = KERN(canon)(r51);
+    p->coeffs[52] = KERN(canon)(r52);
+    p->coeffs[53] = KERN(canon)(r53);
+    p->coeffs[54] = KERN(canon)(r54);
+    p->coeffs[55] = KERN(canon)(r55);
+    p->coeffs[56] = KERN(canon)(r56);
+    p->coeffs[57] = KERN(canon)(r57);
+    p->coeffs[58] = KERN(canon)(r58);
+    p->coeffs[59] = KERN(canon)(r59);
+    p->coeffs[60] = KERN(canon)(r60);
+    p->coeffs[61] = KERN(canon)(r61);
+    p->coeffs[62] = KERN(canon)(r62);
+    p->coeffs[63] = KERN(canon)(r63);
+}
+
+// 同 invntt，輸入取自頻率優先佈局 (in 指向該多項式在第 0 個 tile 的起點)
+static void KERN(invntt_fm)(poly *p, const int16_t *in, size_t stride) {
+    int32_t r0 = in[0 * stride + 0];
+    int32_t r1 = in[0 * stride + 1];
+    int32_t r2 = in[0 * stride + 2];
+    int32_t r3 = in[0 * stride + 3];
+    int32_t r4 = in[0 * stride + 4];
+    int32_t r5 = in[0 * stride + 5];
+    int32_t r6 = in[0 * stride + 6];
+    int32_t r7 = in[0 * stride + 7];
+    int32_t r8 = in[0 * stride + 8];
+    int32_t r9 = in[0 * stride + 9];
+    int32_t r10 = in[0 * stride + 10];
+    int32_t r11 = in[0 * stride + 11];
+    int32_t r12 = in[0 * stride + 12];
+    int32_t r13 = in[0 * stride + 13];
+    int32_t r14 = in[0 * stride + 14];
+    int32_t r15 = in[0 * stride + 15];
+    int32_t r16 = in[1 * stride + 0];
+    int32_t r17 = in[1 * stride + 1];
+    int32_t r18 = in[1 * stride + 2];
+    int32_t r19 = in[1 * stride + 3];
+    int32_t r20 = in[1 * stride + 4];
+    int32_t r21 = in[1 * stride + 5];
+    int32_t r22 = in[1 * stride + 6];
+    int32_t r23 = in[1 * stride + 7];
+    int32_t r24 = in[1 * stride + 8];
+    int32_t r25 = in[1 * stride + 9];
+    int32_t r26 = in[1 * stride + 10];
+    int32_t r27 = in[1 * stride + 11];
+    int32_t r28 = in[1 * stride + 12];
+    int32_t r29 = in[1 * stride + 13];
+    int32_t r30 = in[1 * stride + 14];
+    int32_t r31 = in[1 * stride + 15];
+    int32_t r32 = in[2 * stride + 0];
+    int32_t r33 = in[2 * stride + 1];
+    int32_t r34 = in[2 * stride + 2];
+    int32_t r35 = in[2 * stride + 3];
+    int32_t r36 = in[2 * stride + 4];
+    int32_t r37 = in[2 * stride + 5];
+    int32_t r38 = in[2 * stride + 6];
+    int32_t r39 = in[2 * stride + 7];
+    int32_t r40 = in[2 * stride + 8];
+    int32_t r41 = in[2 * stride + 9];
+    int32_t r42 = in[2 * stride + 10];
+    int32_t r43 = in[2 * stride + 11];
+    int32_t r44 = in[2 * stride + 12];
+    int32_t r45 = in[2 * stride + 13];
+    int32_t r46 = in[2 * stride + 14];
+    int32_t r47 = in[2 * stride + 15];
+    int32_t r48 = in[3 * stride + 0];
+    int32_t r49 = in[3 * stride + 1];
+    int32_t r50 = in[3 * stride + 2];
+    int32_t r51 = in[3 * stride + 3];
+    int32_t r52 = in[3 * stride + 4];
+    int32_t r53 = in[3 * stride + 5];
+    int32_t r54 = in[3 * stride + 6];
+    int32_t r55 = in[3 * stride + 7];
+    int32_t r56 = in[3 * stride + 8];
+    int32_t r57 = in[3 * stride + 9];
+    int32_t r58 = in[3 * stride + 10];
+    int32_t r59 = in[3 * stride + 11];
+    int32_t r60 = in[3 * stride + 12];
+    int32_t r61 = in[3 * stride + 13];
+    int32_t r62 = in[3 * stride + 14];
+    int32_t r63 = in[3 * stride + 15];
+    int32_t t;
+    int32_t u;
+
+    // 第 1 層 (t = 1)，輸入 |r| <= 32768
+    u = r0; r0 = u + r1; r1 = u - r1;
+    t = KERN(barrett)(r1 * -3080);
+    r1 = t;
+    u = r2; r2 = u + r3; r3 = u - r3;
+    t = KERN(barrett)(r3 * -3477);
+    r3 = t;
+    u = r4; r4 = u + r5; r5 = u - r5;
+    t = KERN(barrett)(r5 * 3074);
+    r5 = t;
+    u = r6; r6 = u + r7; r7 = u - r7;
+    t = KERN(barrett)(r7 * 732);
+    r7 = t;
+    u = r8; r8 = u + r9; r9 = u - r9;
+    t = KERN(barrett)(r9 * 3380);
+    r9 = t;
+    u = r10; r10 = u + r11; r11 = u - r11;
+    t = KERN(barrett)(r11 * 2469);
+    r11 = t;
+    u = r12; r12 = u + r13; r13 = u - r13;
+    t = KERN(barrett)(r13 * 1714);
+    r13 = t;
+    u = r14; r14 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * 693);
+    r15 = t;
+    u = r16; r16 = u + r17; r17 = u - r17;
+    t = KERN(barrett)(r17 * 1382);
+    r17 = t;
+    u = r18; r18 = u + r19; r19 = u - r19;
+    t = KERN(barrett)(r19 * 2423);
+    r19 = t;
+    u = r20; r20 = u + r21; r21 = u - r21;
+    t = KERN(barrett)(r21 * -1908);
+    r21 = t;
+    u = r22; r22 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * 2724);
+    r23 = t;
+    u = r24; r24 = u + r25; r25 = u - r25;
+    t = KERN(barrett)(r25 * 1875);
+    r25 = t;
+    u = r26; r26 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * 1381);
+    r27 = t;
+    u = r28; r28 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -799);
+    r29 = t;
+    u = r30; r30 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -695);
+    r31 = t;
+    u = r32; r32 = u + r33; r33 = u - r33;
+    t = KERN(barrett)(r33 * -2774);
+    r33 = t;
+    u = r34; r34 = u + r35; r35 = u - r35;
+    t = KERN(barrett)(r35 * -1740);
+    r35 = t;
+    u = r36; r36 = u + r37; r37 = u - r37;
+    t = KERN(barrett)(r37 * 584);
+    r37 = t;
+    u = r38; r38 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * -1655);
+    r39 = t;
+    u = r40; r40 = u + r41; r41 = u - r41;
+    t = KERN(barrett)(r41 * -2941);
+    r41 = t;
+    u = r42; r42 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * 2508);
+    r43 = t;
+    u = r44; r44 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 3449);
+    r45 = t;
+    u = r46; r46 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * -528);
+    r47 = t;
+    u = r48; r48 = u + r49; r49 = u - r49;
+    t = KERN(barrett)(r49 * -2516);
+    r49 = t;
+    u = r50; r50 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * 1080);
+    r51 = t;
+    u = r52; r52 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * 2551);
+    r53 = t;
+    u = r54; r54 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * 3411);
+    r55 = t;
+    u = r56; r56 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 766);
+    r57 = t;
+    u = r58; r58 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * -2881);
+    r59 = t;
+    u = r60; r60 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 243);
+    r61 = t;
+    u = r62; r62 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -202);
+    r63 = t;
+
+    // 第 2 層 (t = 2)，輸入 |r| <= 65536
+    u = r0; r0 = u + r2; r2 = u - r2;
+    t = KERN(barrett)(r2 * 365);
+    r2 = t;
+    u = r1; r1 = u + r3; r3 = u - r3;
+    t = KERN(barrett)(r3 * 365);
+    r3 = t;
+    u = r4; r4 = u + r6; r6 = u - r6;
+    t = KERN(barrett)(r6 * 1846);
+    r6 = t;
+    u = r5; r5 = u + r7; r7 = u - r7;
+    t = KERN(barrett)(r7 * 1846);
+    r7 = t;
+    u = r8; r8 = u + r10; r10 = u - r10;
+    t = KERN(barrett)(r10 * 2753);
+    r10 = t;
+    u = r9; r9 = u + r11; r11 = u - r11;
+    t = KERN(barrett)(r11 * 2753);
+    r11 = t;
+    u = r12; r12 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * 3654);
+    r14 = t;
+    u = r13; r13 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * 3654);
+    r15 = t;
+    u = r16; r16 = u + r18; r18 = u - r18;
+    t = KERN(barrett)(r18 * -2645);
+    r18 = t;
+    u = r17; r17 = u + r19; r19 = u - r19;
+    t = KERN(barrett)(r19 * -2645);
+    r19 = t;
+    u = r20; r20 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -330);
+    r22 = t;
+    u = r21; r21 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -330);
+    r23 = t;
+    u = r24; r24 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -2273);
+    r26 = t;
+    u = r25; r25 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -2273);
+    r27 = t;
+    u = r28; r28 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * 878);
+    r30 = t;
+    u = r29; r29 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * 878);
+    r31 = t;
+    u = r32; r32 = u + r34; r34 = u - r34;
+    t = KERN(barrett)(r34 * -1286);
+    r34 = t;
+    u = r33; r33 = u + r35; r35 = u - r35;
+    t = KERN(barrett)(r35 * -1286);
+    r35 = t;
+    u = r36; r36 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * 3092);
+    r38 = t;
+    u = r37; r37 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * 3092);
+    r39 = t;
+    u = r40; r40 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * 675);
+    r42 = t;
+    u = r41; r41 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * 675);
+    r43 = t;
+    u = r44; r44 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * -2268);
+    r46 = t;
+    u = r45; r45 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * -2268);
+    r47 = t;
+    u = r48; r48 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * 1112);
+    r50 = t;
+    u = r49; r49 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * 1112);
+    r51 = t;
+    u = r52; r52 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * 1794);
+    r54 = t;
+    u = r53; r53 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * 1794);
+    r55 = t;
+    u = r56; r56 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 3000);
+    r58 = t;
+    u = r57; r57 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 3000);
+    r59 = t;
+    u = r60; r60 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * -2399);
+    r62 = t;
+    u = r61; r61 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -2399);
+    r63 = t;
+
+    // 第 3 層 (t = 4)，輸入 |r| <= 131072
+    u = r0; r0 = u + r4; r4 = u - r4;
+    t = KERN(barrett)(r4 * 2648);
+    r4 = t;
+    u = r1; r1 = u + r5; r5 = u - r5;
+    t = KERN(barrett)(r5 * 2648);
+    r5 = t;
+    u = r2; r2 = u + r6; r6 = u - r6;
+    t = KERN(barrett)(r6 * 2648);
+    r6 = t;
+    u = r3; r3 = u + r7; r7 = u - r7;
+    t = KERN(barrett)(r7 * 2648);
+    r7 = t;
+    u = r8; r8 = u + r12; r12 = u - r12;
+    t = KERN(barrett)(r12 * -2138);
+    r12 = t;
+    u = r9; r9 = u + r13; r13 = u - r13;
+    t = KERN(barrett)(r13 * -2138);
+    r13 = t;
+    u = r10; r10 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * -2138);
+    r14 = t;
+    u = r11; r11 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * -2138);
+    r15 = t;
+    u = r16; r16 = u + r20; r20 = u - r20;
+    t = KERN(barrett)(r20 * -1366);
+    r20 = t;
+    u = r17; r17 = u + r21; r21 = u - r21;
+    t = KERN(barrett)(r21 * -1366);
+    r21 = t;
+    u = r18; r18 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -1366);
+    r22 = t;
+    u = r19; r19 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -1366);
+    r23 = t;
+    u = r24; r24 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -2784);
+    r28 = t;
+    u = r25; r25 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -2784);
+    r29 = t;
+    u = r26; r26 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -2784);
+    r30 = t;
+    u = r27; r27 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -2784);
+    r31 = t;
+    u = r32; r32 = u + r36; r36 = u - r36;
+    t = KERN(barrett)(r36 * 2381);
+    r36 = t;
+    u = r33; r33 = u + r37; r37 = u - r37;
+    t = KERN(barrett)(r37 * 2381);
+    r37 = t;
+    u = r34; r34 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * 2381);
+    r38 = t;
+    u = r35; r35 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * 2381);
+    r39 = t;
+    u = r40; r40 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * 2446);
+    r44 = t;
+    u = r41; r41 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 2446);
+    r45 = t;
+    u = r42; r42 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * 2446);
+    r46 = t;
+    u = r43; r43 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * 2446);
+    r47 = t;
+    u = r48; r48 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * -97);
+    r52 = t;
+    u = r49; r49 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * -97);
+    r53 = t;
+    u = r50; r50 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * -97);
+    r54 = t;
+    u = r51; r51 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * -97);
+    r55 = t;
+    u = r56; r56 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * -2132);
+    r60 = t;
+    u = r57; r57 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * -2132);
+    r61 = t;
+    u = r58; r58 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * -2132);
+    r62 = t;
+    u = r59; r59 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -2132);
+    r63 = t;
+
+    // 第 4 層 (t = 8)，輸入 |r| <= 262144
+    u = r0; r0 = u + r8; r8 = u - r8;
+    t = KERN(barrett)(r8 * -849);
+    r8 = t;
+    u = r1; r1 = u + r9; r9 = u - r9;
+    t = KERN(barrett)(r9 * -849);
+    r9 = t;
+    u = r2; r2 = u + r10; r10 = u - r10;
+    t = KERN(barrett)(r10 * -849);
+    r10 = t;
+    u = r3; r3 = u + r11; r11 = u - r11;
+    t = KERN(barrett)(r11 * -849);
+    r11 = t;
+    u = r4; r4 = u + r12; r12 = u - r12;
+    t = KERN(barrett)(r12 * -849);
+    r12 = t;
+    u = r5; r5 = u + r13; r13 = u - r13;
+    t = KERN(barrett)(r13 * -849);
+    r13 = t;
+    u = r6; r6 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * -849);
+    r14 = t;
+    u = r7; r7 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * -849);
+    r15 = t;
+    u = r16; r16 = u + r24; r24 = u - r24;
+    t = KERN(barrett)(r24 * -527);
+    r24 = t;
+    u = r17; r17 = u + r25; r25 = u - r25;
+    t = KERN(barrett)(r25 * -527);
+    r25 = t;
+    u = r18; r18 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -527);
+    r26 = t;
+    u = r19; r19 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -527);
+    r27 = t;
+    u = r20; r20 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -527);
+    r28 = t;
+    u = r21; r21 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -527);
+    r29 = t;
+    u = r22; r22 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -527);
+    r30 = t;
+    u = r23; r23 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -527);
+    r31 = t;
+    u = r32; r32 = u + r40; r40 = u - r40;
+    t = KERN(barrett)(r40 * 583);
+    r40 = t;
+    u = r33; r33 = u + r41; r41 = u - r41;
+    t = KERN(barrett)(r41 * 583);
+    r41 = t;
+    u = r34; r34 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * 583);
+    r42 = t;
+    u = r35; r35 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * 583);
+    r43 = t;
+    u = r36; r36 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * 583);
+    r44 = t;
+    u = r37; r37 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 583);
+    r45 = t;
+    u = r38; r38 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * 583);
+    r46 = t;
+    u = r39; r39 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * 583);
+    r47 = t;
+    u = r48; r48 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * 1728);
+    r56 = t;
+    u = r49; r49 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 1728);
+    r57 = t;
+    u = r50; r50 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 1728);
+    r58 = t;
+    u = r51; r51 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 1728);
+    r59 = t;
+    u = r52; r52 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * 1728);
+    r60 = t;
+    u = r53; r53 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 1728);
+    r61 = t;
+    u = r54; r54 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * 1728);
+    r62 = t;
+    u = r55; r55 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * 1728);
+    r63 = t;
+
+    // 第 5 層 (t = 16)，輸入 |r| <= 524288
+    u = r0; r0 = u + r16; r16 = u - r16;
+    t = KERN(barrett)(r16 * -1213);
+    r16 = t;
+    u = r1; r1 = u + r17; r17 = u - r17;
+    t = KERN(barrett)(r17 * -1213);
+    r17 = t;
+    u = r2; r2 = u + r18; r18 = u - r18;
+    t = KERN(barrett)(r18 * -1213);
+    r18 = t;
+    u = r3; r3 = u + r19; r19 = u - r19;
+    t = KERN(barrett)(r19 * -1213);
+    r19 = t;
+    u = r4; r4 = u + r20; r20 = u - r20;
+    t = KERN(barrett)(r20 * -1213);
+    r20 = t;
+    u = r5; r5 = u + r21; r21 = u - r21;
+    t = KERN(barrett)(r21 * -1213);
+    r21 = t;
+    u = r6; r6 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -1213);
+    r22 = t;
+    u = r7; r7 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -1213);
+    r23 = t;
+    u = r8; r8 = u + r24; r24 = u - r24;
+    t = KERN(barrett)(r24 * -1213);
+    r24 = t;
+    u = r9; r9 = u + r25; r25 = u - r25;
+    t = KERN(barrett)(r25 * -1213);
+    r25 = t;
+    u = r10; r10 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -1213);
+    r26 = t;
+    u = r11; r11 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -1213);
+    r27 = t;
+    u = r12; r12 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -1213);
+    r28 = t;
+    u = r13; r13 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -1213);
+    r29 = t;
+    u = r14; r14 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -1213);
+    r30 = t;
+    u = r15; r15 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -1213);
+    r31 = t;
+    u = r32; r32 = u + r48; r48 = u - r48;
+    t = KERN(barrett)(r48 * 1925);
+    r48 = t;
+    u = r33; r33 = u + r49; r49 = u - r49;
+    t = KERN(barrett)(r49 * 1925);
+    r49 = t;
+    u = r34; r34 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * 1925);
+    r50 = t;
+    u = r35; r35 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * 1925);
+    r51 = t;
+    u = r36; r36 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * 1925);
+    r52 = t;
+    u = r37; r37 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * 1925);
+    r53 = t;
+    u = r38; r38 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * 1925);
+    r54 = t;
+    u = r39; r39 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * 1925);
+    r55 = t;
+    u = r40; r40 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * 1925);
+    r56 = t;
+    u = r41; r41 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 1925);
+    r57 = t;
+    u = r42; r42 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 1925);
+    r58 = t;
+    u = r43; r43 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 1925);
+    r59 = t;
+    u = r44; r44 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * 1925);
+    r60 = t;
+    u = r45; r45 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 1925);
+    r61 = t;
+    u = r46; r46 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * 1925);
+    r62 = t;
+    u = r47; r47 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * 1925);
+    r63 = t;
+
+    // 第 6 層 (t = 32)，輸入 |r| <= 1048576
+    u = r0; r0 = u + r32; r32 = u - r32;
+    r32 = KERN(barrett)(r32);
+    t = KERN(barrett)(r32 * -1133);
+    r32 = t;
+    t = KERN(barrett)(r0 * -120);
+    r0 = t;
+    u = r1; r1 = u + r33; r33 = u - r33;
+    t = KERN(barrett)(r33 * -1133);
+    r33 = t;
+    t = KERN(barrett)(r1 * -120);
+    r1 = t;
+    u = r2; r2 = u + r34; r34 = u - r34;
+    t = KERN(barrett)(r34 * -1133);
+    r34 = t;
+    t = KERN(barrett)(r2 * -120);
+    r2 = t;
+    u = r3; r3 = u + r35; r35 = u - r35;
+    t = KERN(barrett)(r35 * -1133);
+    r35 = t;
+    t = KERN(barrett)(r3 * -120);
+    r3 = t;
+    u = r4; r4 = u + r36; r36 = u - r36;
+    t = KERN(barrett)(r36 * -1133);
+    r36 = t;
+    t = KERN(barrett)(r4 * -120);
+    r4 = t;
+    u = r5; r5 = u + r37; r37 = u - r37;
+    t = KERN(barrett)(r37 * -1133);
+    r37 = t;
+    t = KERN(barrett)(r5 * -120);
+    r5 = t;
+    u = r6; r6 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * -1133);
+    r38 = t;
+    t = KERN(barrett)(r6 * -120);
+    r6 = t;
+    u = r7; r7 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * -1133);
+    r39 = t;
+    t = KERN(barrett)(r7 * -120);
+    r7 = t;
+    u = r8; r8 = u + r40; r40 = u - r40;
+    t = KERN(barrett)(r40 * -1133);
+    r40 = t;
+    t = KERN(barrett)(r8 * -120);
+    r8 = t;
+    u = r9; r9 = u + r41; r41 = u - r41;
+    t = KERN(barrett)(r41 * -1133);
+    r41 = t;
+    t = KERN(barrett)(r9 * -120);
+    r9 = t;
+    u = r10; r10 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * -1133);
+    r42 = t;
+    t = KERN(barrett)(r10 * -120);
+    r10 = t;
+    u = r11; r11 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * -1133);
+    r43 = t;
+    t = KERN(barrett)(r11 * -120);
+    r11 = t;
+    u = r12; r12 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * -1133);
+    r44 = t;
+    t = KERN(barrett)(r12 * -120);
+    r12 = t;
+    u = r13; r13 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * -1133);
+    r45 = t;
+    t = KERN(barrett)(r13 * -120);
+    r13 = t;
+    u = r14; r14 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * -1133);
+    r46 = t;
+    t = KERN(barrett)(r14 * -120);
+    r14 = t;
+    u = r15; r15 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * -1133);
+    r47 = t;
+    t = KERN(barrett)(r15 * -120);
+    r15 = t;
+    u = r16; r16 = u + r48; r48 = u - r48;
+    t = KERN(barrett)(r48 * -1133);
+    r48 = t;
+    t = KERN(barrett)(r16 * -120);
+    r16 = t;
+    u = r17; r17 = u + r49; r49 = u - r49;
+    t = KERN(barrett)(r49 * -1133);
+    r49 = t;
+    t = KERN(barrett)(r17 * -120);
+    r17 = t;
+    u = r18; r18 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * -1133);
+    r50 = t;
+    t = KERN(barrett)(r18 * -120);
+    r18 = t;
+    u = r19; r19 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * -1133);
+    r51 = t;
+    t = KERN(barrett)(r19 * -120);
+    r19 = t;
+    u = r20; r20 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * -1133);
+    r52 = t;
+    t = KERN(barrett)(r20 * -120);
+    r20 = t;
+    u = r21; r21 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * -1133);
+    r53 = t;
+    t = KERN(barrett)(r21 * -120);
+    r21 = t;
+    u = r22; r22 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * -1133);
+    r54 = t;
+    t = KERN(barrett)(r22 * -120);
+    r22 = t;
+    u = r23; r23 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * -1133);
+    r55 = t;
+    t = KERN(barrett)(r23 * -120);
+    r23 = t;
+    u = r24; r24 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * -1133);
+    r56 = t;
+    t = KERN(barrett)(r24 * -120);
+    r24 = t;
+    u = r25; r25 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * -1133);
+    r57 = t;
+    t = KERN(barrett)(r25 * -120);
+    r25 = t;
+    u = r26; r26 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * -1133);
+    r58 = t;
+    t = KERN(barrett)(r26 * -120);
+    r26 = t;
+    u = r27; r27 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * -1133);
+    r59 = t;
+    t = KERN(barrett)(r27 * -120);
+    r27 = t;
+    u = r28; r28 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * -1133);
+    r60 = t;
+    t = KERN(barrett)(r28 * -120);
+    r28 = t;
+    u = r29; r29 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * -1133);
+    r61 = t;
+    t = KERN(barrett)(r29 * -120);
+    r29 = t;
+    u = r30; r30 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * -1133);
+    r62 = t;
+    t = KERN(barrett)(r30 * -120);
+    r30 = t;
+    u = r31; r31 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -1133);
+    r63 = t;
+    t = KERN(barrett)(r31 * -120);
+    r31 = t;
+
+    // 輸出化約，|r| <= 15361
+    p->coeffs[0] = KERN(canon)(r0);
+    p->coeffs[1] = KERN(canon)(r1);
+    p->coeffs[2] = KERN(canon)(r2);
+    p->coeffs[3] = KERN(canon)(r3);
+    p->coeffs[4] = KERN(canon)(r4);
+    p->coeffs[5] = KERN(canon)(r5);
+    p->coeffs[6] = KERN(canon)(r6);
+    p->coeffs[7] = KERN(canon)(r7);
+    p->coeffs[8] = KERN(canon)(r8);
+    p->coeffs[9] = KERN(canon)(r9);
+    p->coeffs[10] = KERN(canon)(r10);
+    p->coeffs[11] = KERN(canon)(r11);
+    p->coeffs[12] = KERN(canon)(r12);
+    p->coeffs[13] = KERN(canon)(r13);
+    p->coeffs[14] = KERN(canon)(r14);
+    p->coeffs[15] = KERN(canon)(r15);
+    p->coeffs[16] = KERN(canon)(r16);
+    p->coeffs[17] = KERN(canon)(r17);
+    p->coeffs[18] = KERN(canon)(r18);
+    p->coeffs[19] = KERN(canon)(r19);
+    p->coeffs[20] = KERN(canon)(r20);
+    p->coeffs[21] = KERN(canon)(r21);
+    p->coeffs[22] = KERN(canon)(r22);
+    p->coeffs[23] = KERN(canon)(r23);
+    p->coeffs[24] = KERN(canon)(r24);
+    p->coeffs[25] = KERN(canon)(r25);
+    p->coeffs[26] = KERN(canon)(r26);
+    p->coeffs[27] = KERN(canon)(r27);
+    p->coeffs[28] = KERN(canon)(r28);
+    p->coeffs[29] = KERN(canon)(r29);
+    p->coeffs[30] = KERN(canon)(r30);
+    p->coeffs[31] = KERN(canon)(r31);
+    p->coeffs[32] = KERN(canon)(r32);
+    p->coeffs[33] = KERN(canon)(r33);
+    p->coeffs[34] = KERN(canon)(r34);
+    p->coeffs[35] = KERN(canon)(r35);
+    p->coeffs[36] = KERN(canon)(r36);
+    p->coeffs[37] = KERN(canon)(r37);
+    p->coeffs[38] = KERN(canon)(r38);
+    p->coeffs[39] = KERN(canon)(r39);
+    p->coeffs[40] = KERN(canon)(r40);
+    p->coeffs[41] = KERN(canon)(r41);
+    p->coeffs[42] = KERN(canon)(r42);
+    p->coeffs[43] = KERN(canon)(r43);
+    p->coeffs[44] = KERN(canon)(r44);
+    p->coeffs[45] = KERN(canon)(r45);
+    p->coeffs[46] = KERN(canon)(r46);
+    p->coeffs[47] = KERN(canon)(r47);
+    p->coeffs[48] = KERN(canon)(r48);
+    p->coeffs[49] = KERN(canon)(r49);
+    p->coeffs[50] = KERN(canon)(r50);
+    p->coeffs[51] = KERN(canon)(r51);
+    p->coeffs[52] = KERN(canon)(r52);
+    p->coeffs[53] = KERN(canon)(r53);
+    p->coeffs[54] = KERN(canon)(r54);
+    p->coeffs[55] = KERN(canon)(r55);
+    p->coeffs[56] = KERN(canon)(r56);
+    p->coeffs[57] = KERN(canon)(r57);
+    p->coeffs[58] = KERN(canon)(r58);
+    p->coeffs[59] = KERN(canon)(r59);
+    p->coeffs[60] = KERN(canon)(r60);
+    p->coeffs[61] = KERN(canon)(r61);
+    p->coeffs[62] = KERN(canon)(r62);
+    p->coeffs[63] = KERN(canon)(r63);
+}
+
+#elif RUDRAKSH_NTT_LAYERS == 5
+
+// 正向 NTT (5 層，輸入自然順序 -> 輸出位元反轉)，輸入可為任意 int16，輸出在 [0, q)
+static void KERN(ntt)(poly *p) {
+    int32_t r0 = p->coeffs[0];
+    int32_t r1 = p->coeffs[1];
+    int32_t r2 = p->coeffs[2];
+    int32_t r3 = p->coeffs[3];
+    int32_t r4 = p->coeffs[4];
+    int32_t r5 = p->coeffs[5];
+    int32_t r6 = p->coeffs[6];
+    int32_t r7 = p->coeffs[7];
+    int32_t r8 = p->coeffs[8];
+    int32_t r9 = p->coeffs[9];
+    int32_t r10 = p->coeffs[10];
+    int32_t r11 = p->coeffs[11];
+    int32_t r12 = p->coeffs[12];
+    int32_t r13 = p->coeffs[13];
+    int32_t r14 = p->coeffs[14];
+    int32_t r15 = p->coeffs[15];
+    int32_t r16 = p->coeffs[16];
+    int32_t r17 = p->coeffs[17];
+    int32_t r18 = p->coeffs[18];
+    int32_t r19 = p->coeffs[19];
+    int32_t r20 = p->coeffs[20];
+    int32_t r21 = p->coeffs[21];
+    int32_t r22 = p->coeffs[22];
+    int32_t r23 = p->coeffs[23];
+    int32_t r24 = p->coeffs[24];
+    int32_t r25 = p->coeffs[25];
+    int32_t r26 = p->coeffs[26];
+    int32_t r27 = p->coeffs[27];
+    int32_t r28 = p->coeffs[28];
+    int32_t r29 = p->coeffs[29];
+    int32_t r30 = p->coeffs[30];
+    int32_t r31 = p->coeffs[31];
+    int32_t r32 = p->coeffs[32];
+    int32_t r33 = p->coeffs[33];
+    int32_t r34 = p->coeffs[34];
+    int32_t r35 = p->coeffs[35];
+    int32_t r36 = p->coeffs[36];
+    int32_t r37 = p->coeffs[37];
+    int32_t r38 = p->coeffs[38];
+    int32_t r39 = p->coeffs[39];
+    int32_t r40 = p->coeffs[40];
+    int32_t r41 = p->coeffs[41];
+    int32_t r42 = p->coeffs[42];
+    int32_t r43 = p->coeffs[43];
+    int32_t r44 = p->coeffs[44];
+    int32_t r45 = p->coeffs[45];
+    int32_t r46 = p->coeffs[46];
+    int32_t r47 = p->coeffs[47];
+    int32_t r48 = p->coeffs[48];
+    int32_t r49 = p->coeffs[49];
+    int32_t r50 = p->coeffs[50];
+    int32_t r51 = p->coeffs[51];
+    int32_t r52 = p->coeffs[52];
+    int32_t r53 = p->coeffs[53];
+    int32_t r54 = p->coeffs[54];
+    int32_t r55 = p->coeffs[55];
+    int32_t r56 = p->coeffs[56];
+    int32_t r57 = p->coeffs[57];
+    int32_t r58 = p->coeffs[58];
+    int32_t r59 = p->coeffs[59];
+    int32_t r60 = p->coeffs[60];
+    int32_t r61 = p->coeffs[61];
+    int32_t r62 = p->coeffs[62];
+    int32_t r63 = p->coeffs[63];
+    int32_t t;
+
+    // 第 1 層 (t = 32)，輸入 |r| <= 32768
+    t = KERN(barrett)(r32 * 3383);
+    r32 = r0 - t; r0 += t;
+    t = KERN(barrett)(r33 * 3383);
+    r33 = r1 - t; r1 += t;
+    t = KERN(barrett)(r34 * 3383);
+    r34 = r2 - t; r2 += t;
+    t = KERN(barrett)(r35 * 3383);
+    r35 = r3 - t; r3 += t;
+    t = KERN(barrett)(r36 * 3383);
+    r36 = r4 - t; r4 += t;
+    t = KERN(barrett)(r37 * 3383);
+    r37 = r5 - t; r5 += t;
+    t = KERN(barrett)(r38 * 3383);
+    r38 = r6 - t; r6 += t;
+    t = KERN(barrett)(r39 * 3383);
+    r39 = r7 - t; r7 += t;
+    t = KERN(barrett)(r40 * 3383);
+    r40 = r8 - t; r8 += t;
+    t = KERN(barrett)(r41 * 3383);
+    r41 = r9 - t; r9 += t;
+    t = KERN(barrett)(r42 * 3383);
+    r42 = r10 - t; r10 += t;
+    t = KERN(barrett)(r43 * 3383);
+    r43 = r11 - t; r11 += t;
+    t = KERN(barrett)(r44 * 3383);
+    r44 = r12 - t; r12 += t;
+    t = KERN(barrett)(r45 * 3383);
+    r45 = r13 - t; r13 += t;
+    t = KERN(barrett)(r46 * 3383);
+    r46 = r14 - t; r14 += t;
+    t = KERN(barrett)(r47 * 3383);
+    r47 = r15 - t; r15 += t;
+    t = KERN(barrett)(r48 * 3383);
+    r48 = r16 - t; r16 += t;
+    t = KERN(barrett)(r49 * 3383);
+    r49 = r17 - t; r17 += t;
+    t = KERN(barrett)(r50 * 3383);
+    r50 = r18 - t; r18 += t;
+    t = KERN(barrett)(r51 * 3383);
+    r51 = r19 - t; r19 += t;
+    t = KERN(barrett)(r52 * 3383);
+    r52 = r20 - t; r20 += t;
+    t = KERN(barrett)(r53 * 3383);
+    r53 = r21 - t; r21 += t;
+    t = KERN(barrett)(r54 * 3383);
+    r54 = r22 - t; r22 += t;
+    t = KERN(barrett)(r55 * 3383);
+    r55 = r23 - t; r23 += t;
+    t = KERN(barrett)(r56 * 3383);
+    r56 = r24 - t; r24 += t;
+    t = KERN(barrett)(r57 * 3383);
+    r57 = r25 - t; r25 += t;
+    t = KERN(barrett)(r58 * 3383);
+    r58 = r26 - t; r26 += t;
+    t = KERN(barrett)(r59 * 3383);
+    r59 = r27 - t; r27 += t;
+    t = KERN(barrett)(r60 * 3383);
+    r60 = r28 - t; r28 += t;
+    t = KERN(barrett)(r61 * 3383);
+    r61 = r29 - t; r29 += t;
+    t = KERN(barrett)(r62 * 3383);
+    r62 = r30 - t; r30 += t;
+    t = KERN(barrett)(r63 * 3383);
+    r63 = r31 - t; r31 += t;
+
+    // 第 2 層 (t = 16)，輸入 |r| <= 48129
+    t = KERN(barrett)(r16 * -1925);
+    r16 = r0 - t; r0 += t;
+    t = KERN(barrett)(r17 * -1925);
+    r17 = r1 - t; r1 += t;
+    t = KERN(barrett)(r18 * -1925);
+    r18 = r2 - t; r2 += t;
+    t = KERN(barrett)(r19 * -1925);
+    r19 = r3 - t; r3 += t;
+    t = KERN(barrett)(r20 * -1925);
+    r20 = r4 - t; r4 += t;
+    t = KERN(barrett)(r21 * -1925);
+    r21 = r5 - t; r5 += t;
+    t = KERN(barrett)(r22 * -1925);
+    r22 = r6 - t; r6 += t;
+    t = KERN(barrett)(r23 * -1925);
+    r23 = r7 - t; r7 += t;
+    t = KERN(barrett)(r24 * -1925);
+    r24 = r8 - t; r8 += t;
+    t = KERN(barrett)(r25 * -1925);
+    r25 = r9 - t; r9 += t;
+    t = KERN(barrett)(r26 * -1925);
+    r26 = r10 - t; r10 += t;
+    t = KERN(barrett)(r27 * -1925);
+    r27 = r11 - t; r11 += t;
+    t = KERN(barrett)(r28 * -1925);
+    r28 = r12 - t; r12 += t;
+    t = KERN(barrett)(r29 * -1925);
+    r29 = r13 - t; r13 += t;
+    t = KERN(barrett)(r30 * -1925);
+    r30 = r14 - t; r14 += t;
+    t = KERN(barrett)(r31 * -1925);
+    r31 = r15 - t; r15 += t;
+    t = KERN(barrett)(r48 * 1213);
+    r48 = r32 - t; r32 += t;
+    t = KERN(barrett)(r49 * 1213);
+    r49 = r33 - t; r33 += t;
+    t = KERN(barrett)(r50 * 1213);
+    r50 = r34 - t; r34 += t;
+    t = KERN(barrett)(r51 * 1213);
+    r51 = r35 - t; r35 += t;
+    t = KERN(barrett)(r52 * 1213);
+    r52 = r36 - t; r36 += t;
+    t = KERN(barrett)(r53 * 1213);
+    r53 = r37 - t; r37 += t;
+    t = KERN(barrett)(r54 * 1213);
+    r54 = r38 - t; r38 += t;
+    t = KERN(barrett)(r55 * 1213);
+    r55 = r39 - t; r39 += t;
+    t = KERN(barrett)(r56 * 1213);
+    r56 = r40 - t; r40 += t;
+    t = KERN(barrett)(r57 * 1213);
+    r57 = r41 - t; r41 += t;
+    t = KERN(barrett)(r58 * 1213);
+    r58 = r42 - t; r42 += t;
+    t = KERN(barrett)(r59 * 1213);
+    r59 = r43 - t; r43 += t;
+    t = KERN(barrett)(r60 * 1213);
+    r60 = r44 - t; r44 += t;
+    t = KERN(barrett)(r61 * 1213);
+    r61 = r45 - t; r45 += t;
+    t = KERN(barrett)(r62 * 1213);
+    r62 = r46 - t; r46 += t;
+    t = KERN(barrett)(r63 * 1213);
+    r63 = r47 - t; r47 += t;
+
+    // 第 3 層 (t = 8)，輸入 |r| <= 63490
+    t = KERN(barrett)(r8 * -1728);
+    r8 = r0 - t; r0 += t;
+    t = KERN(barrett)(r9 * -1728);
+    r9 = r1 - t; r1 += t;
+    t = KERN(barrett)(r10 * -1728);
+    r10 = r2 - t; r2 += t;
+    t = KERN(barrett)(r11 * -1728);
+    r11 = r3 - t; r3 += t;
+    t = KERN(barrett)(r12 * -1728);
+    r12 = r4 - t; r4 += t;
+    t = KERN(barrett)(r13 * -1728);
+    r13 = r5 - t; r5 += t;
+    t = KERN(barrett)(r14 * -1728);
+    r14 = r6 - t; r6 += t;
+    t = KERN(barrett)(r15 * -1728);
+    r15 = r7 - t; r7 += t;
+    t = KERN(barrett)(r24 * -583);
+    r24 = r16 - t; r16 += t;
+    t = KERN(barrett)(r25 * -583);
+    r25 = r17 - t; r17 += t;
+    t = KERN(barrett)(r26 * -583);
+    r26 = r18 - t; r18 += t;
+    t = KERN(barrett)(r27 * -583);
+    r27 = r19 - t; r19 += t;
+    t = KERN(barrett)(r28 * -583);
+    r28 = r20 - t; r20 += t;
+    t = KERN(barrett)(r29 * -583);
+    r29 = r21 - t; r21 += t;
+    t = KERN(barrett)(r30 * -583);
+    r30 = r22 - t; r22 += t;
+    t = KERN(barrett)(r31 * -583);
+    r31 = r23 - t; r23 += t;
+    t = KERN(barrett)(r40 * 527);
+    r40 = r32 - t; r32 += t;
+    t = KERN(barrett)(r41 * 527);
+    r41 = r33 - t; r33 += t;
+    t = KERN(barrett)(r42 * 527);
+    r42 = r34 - t; r34 += t;
+    t = KERN(barrett)(r43 * 527);
+    r43 = r35 - t; r35 += t;
+    t = KERN(barrett)(r44 * 527);
+    r44 = r36 - t; r36 += t;
+    t = KERN(barrett)(r45 * 527);
+    r45 = r37 - t; r37 += t;
+    t = KERN(barrett)(r46 * 527);
+    r46 = r38 - t; r38 += t;
+    t = KERN(barrett)(r47 * 527);
+    r47 = r39 - t; r39 += t;
+    t = KERN(barrett)(r56 * 849);
+    r56 = r48 - t; r48 += t;
+    t = KERN(barrett)(r57 * 849);
+    r57 = r49 - t; r49 += t;
+    t = KERN(barrett)(r58 * 849);
+    r58 = r50 - t; r50 += t;
+    t = KERN(barrett)(r59 * 849);
+    r59 = r51 - t; r51 += t;
+    t = KERN(barrett)(r60 * 849);
+    r60 = r52 - t; r52 += t;
+    t = KERN(barrett)(r61 * 849);
+    r61 = r53 - t; r53 += t;
+    t = KERN(barrett)(r62 * 849);
+    r62 = r54 - t; r54 += t;
+    t = KERN(barrett)(r63 * 849);
+    r63 = r55 - t; r55 += t;
+
+    // 第 4 層 (t = 4)，輸入 |r| <= 78851
+    t = KERN(barrett)(r4 * 2132);
+    r4 = r0 - t; r0 += t;
+    t = KERN(barrett)(r5 * 2132);
+    r5 = r1 - t; r1 += t;
+    t = KERN(barrett)(r6 * 2132);
+    r6 = r2 - t; r2 += t;
+    t = KERN(barrett)(r7 * 2132);
+    r7 = r3 - t; r3 += t;
+    t = KERN(barrett)(r12 * 97);
+    r12 = r8 - t; r8 += t;
+    t = KERN(barrett)(r13 * 97);
+    r13 = r9 - t; r9 += t;
+    t = KERN(barrett)(r14 * 97);
+    r14 = r10 - t; r10 += t;
+    t = KERN(barrett)(r15 * 97);
+    r15 = r11 - t; r11 += t;
+    t = KERN(barrett)(r20 * -2446);
+    r20 = r16 - t; r16 += t;
+    t = KERN(barrett)(r21 * -2446);
+    r21 = r17 - t; r17 += t;
+    t = KERN(barrett)(r22 * -2446);
+    r22 = r18 - t; r18 += t;
+    t = KERN(barrett)(r23 * -2446);
+    r23 = r19 - t; r19 += t;
+    t = KERN(barrett)(r28 * -2381);
+    r28 = r24 - t; r24 += t;
+    t = KERN(barrett)(r29 * -2381);
+    r29 = r25 - t; r25 += t;
+    t = KERN(barrett)(r30 * -2381);
+    r30 = r26 - t; r26 += t;
+    t = KERN(barrett)(r31 * -2381);
+    r31 = r27 - t; r27 += t;
+    t = KERN(barrett)(r36 * 2784);
+    r36 = r32 - t; r32 += t;
+    t = KERN(barrett)(r37 * 2784);
+    r37 = r33 - t; r33 += t;
+    t = KERN(barrett)(r38 * 2784);
+    r38 = r34 - t; r34 += t;
+    t = KERN(barrett)(r39 * 2784);
+    r39 = r35 - t; r35 += t;
+    t = KERN(barrett)(r44 * 1366);
+    r44 = r40 - t; r40 += t;
+    t = KERN(barrett)(r45 * 1366);
+    r45 = r41 - t; r41 += t;
+    t = KERN(barrett)(r46 * 1366);
+    r46 = r42 - t; r42 += t;
+    t = KERN(barrett)(r47 * 1366);
+    r47 = r43 - t; r43 += t;
+    t = KERN(barrett)(r52 * 2138);
+    r52 = r48 - t; r48 += t;
+    t = KERN(barrett)(r53 * 2138);
+    r53 = r49 - t; r49 += t;
+    t = KERN(barrett)(r54 * 2138);
+    r54 = r50 - t; r50 += t;
+    t = KERN(barrett)(r55 * 2138);
+    r55 = r51 - t; r51 += t;
+    t = KERN(barrett)(r60 * -2648);
+    r60 = r56 - t; r56 += t;
+    t = KERN(barrett)(r61 * -2648);
+    r61 = r57 - t; r57 += t;
+    t = KERN(barrett)(r62 * -2648);
+    r62 = r58 - t; r58 += t;
+    t = KERN(barrett)(r63 * -2648);
+    r63 = r59 - t; r59 += t;
+
+    // 第 5 層 (t = 2)，輸入 |r| <= 94212
+    t = KERN(barrett)(r2 * 2399);
+    r2 = r0 - t; r0 += t;
+    t = KERN(barrett)(r3 * 2399);
+    r3 = r1 - t; r1 += t;
+    t = KERN(barrett)(r6 * -3000);
+    r6 = r4 - t; r4 += t;
+    t = KERN(barrett)(r7 * -3000);
+    r7 = r5 - t; r5 += t;
+    t = KERN(barrett)(r10 * -1794);
+    r10 = r8 - t; r8 += t;
+    t = KERN(barrett)(r11 * -1794);
+    r11 = r9 - t; r9 += t;
+    t = KERN(barrett)(r14 * -1112);
+    r14 = r12 - t; r12 += t;
+    t = KERN(barrett)(r15 * -1112);
+    r15 = r13 - t; r13 += t;
+    t = KERN(barrett)(r18 * 2268);
+    r18 = r16 - t; r16 += t;
+    t = KERN(barrett)(r19 * 2268);
+    r19 = r17 - t; r17 += t;
+    t = KERN(barrett)(r22 * -675);
+    r22 = r20 - t; r20 += t;
+    t = KERN(barrett)(r23 * -675);
+    r23 = r21 - t; r21 += t;
+    t = KERN(barrett)(r26 * -3092);
+    r26 = r24 - t; r24 += t;
+    t = KERN(barrett)(r27 * -3092);
+    r27 = r25 - t; r25 += t;
+    t = KERN(barrett)(r30 * 1286);
+    r30 = r28 - t; r28 += t;
+    t = KERN(barrett)(r31 * 1286);
+    r31 = r29 - t; r29 += t;
+    t = KERN(barrett)(r34 * -878);
+    r34 = r32 - t; r32 += t;
+    t = KERN(barrett)(r35 * -878);
+    r35 = r33 - t; r33 += t;
+    t = KERN(barrett)(r38 * 2273);
+    r38 = r36 - t; r36 += t;
+    t = KERN(barrett)(r39 * 2273);
+    r39 = r37 - t; r37 += t;
+    t = KERN(barrett)(r42 * 330);
+    r42 = r40 - t; r40 += t;
+    t = KERN(barrett)(r43 * 330);
+    r43 = r41 - t; r41 += t;
+    t = KERN(barrett)(r46 * 2645);
+    r46 = r44 - t; r44 += t;
+    t = KERN(barrett)(r47 * 2645);
+    r47 = r45 - t; r45 += t;
+    t = KERN(barrett)(r50 * -3654);
+    r50 = r48 - t; r48 += t;
+    t = KERN(barrett)(r51 * -3654);
+    r51 = r49 - t; r49 += t;
+    t = KERN(barrett)(r54 * -2753);
+    r54 = r52 - t; r52 += t;
+    t = KERN(barrett)(r55 * -2753);
+    r55 = r53 - t; r53 += t;
+    t = KERN(barrett)(r58 * -1846);
+    r58 = r56 - t; r56 += t;
+    t = KERN(barrett)(r59 * -1846);
+    r59 = r57 - t; r57 += t;
+    t = KERN(barrett)(r62 * -365);
+    r62 = r60 - t; r60 += t;
+    t = KERN(barrett)(r63 * -365);
+    r63 = r61 - t; r61 += t;
+
+    // 輸出化約，|r| <= 109573
+    r0 = KERN(barrett)(r0);
+    r1 = KERN(barrett)(r1);
+    r2 = KERN(barrett)(r2);
+    r3 = KERN(barrett)(r3);
+    r4 = KERN(barrett)(r4);
+    r5 = KERN(barrett)(r5);
+    r6 = KERN(barrett)(r6);
+    r7 = KERN(barrett)(r7);
+    r8 = KERN(barrett)(r8);
+    r9 = KERN(barrett)(r9);
+    r10 = KERN(barrett)(r10);
+    r11 = KERN(barrett)(r11);
+    r12 = KERN(barrett)(r12);
+    r13 = KERN(barrett)(r13);
+    r14 = KERN(barrett)(r14);
+    r15 = KERN(barrett)(r15);
+    r16 = KERN(barrett)(r16);
+    r17 = KERN(barrett)(r17);
+    r18 = KERN(barrett)(r18);
+    r19 = KERN(barrett)(r19);
+    r20 = KERN(barrett)(r20);
+    r21 = KERN(barrett)(r21);
+    r22 = KERN(barrett)(r22);
+    r23 = KERN(barrett)(r23);
+    r24 = KERN(barrett)(r24);
+    r25 = KERN(barrett)(r25);
+    r26 = KERN(barrett)(r26);
+    r27 = KERN(barrett)(r27);
+    r28 = KERN(barrett)(r28);
+    r29 = KERN(barrett)(r29);
+    r30 = KERN(barrett)(r30);
+    r31 = KERN(barrett)(r31);
+    r32 = KERN(barrett)(r32);
+    r33 = KERN(barrett)(r33);
+    r34 = KERN(barrett)(r34);
+    r35 = KERN(barrett)(r35);
+    r36 = KERN(barrett)(r36);
+    r37 = KERN(barrett)(r37);
+    r38 = KERN(barrett)(r38);
+    r39 = KERN(barrett)(r39);
+    r40 = KERN(barrett)(r40);
+    r41 = KERN(barrett)(r41);
+    r42 = KERN(barrett)(r42);
+    r43 = KERN(barrett)(r43);
+    r44 = KERN(barrett)(r44);
+    r45 = KERN(barrett)(r45);
+    r46 = KERN(barrett)(r46);
+    r47 = KERN(barrett)(r47);
+    r48 = KERN(barrett)(r48);
+    r49 = KERN(barrett)(r49);
+    r50 = KERN(barrett)(r50);
+    r51 = KERN(barrett)(r51);
+    r52 = KERN(barrett)(r52);
+    r53 = KERN(barrett)(r53);
+    r54 = KERN(barrett)(r54);
+    r55 = KERN(barrett)(r55);
+    r56 = KERN(barrett)(r56);
+    r57 = KERN(barrett)(r57);
+    r58 = KERN(barrett)(r58);
+    r59 = KERN(barrett)(r59);
+    r60 = KERN(barrett)(r60);
+    r61 = KERN(barrett)(r61);
+    r62 = KERN(barrett)(r62);
+    r63 = KERN(barrett)(r63);
+    p->coeffs[0] = KERN(canon)(r0);
+    p->coeffs[1] = KERN(canon)(r1);
+    p->coeffs[2] = KERN(canon)(r2);
+    p->coeffs[3] = KERN(canon)(r3);
+    p->coeffs[4] = KERN(canon)(r4);
+    p->coeffs[5] = KERN(canon)(r5);
+    p->coeffs[6] = KERN(canon)(r6);
+    p->coeffs[7] = KERN(canon)(r7);
+    p->coeffs[8] = KERN(canon)(r8);
+    p->coeffs[9] = KERN(canon)(r9);
+    p->coeffs[10] = KERN(canon)(r10);
+    p->coeffs[11] = KERN(canon)(r11);
+    p->coeffs[12] = KERN(canon)(r12);
+    p->coeffs[13] = KERN(canon)(r13);
+    p->coeffs[14] = KERN(canon)(r14);
+    p->coeffs[15] = KERN(canon)(r15);
+    p->coeffs[16] = KERN(canon)(r16);
+    p->coeffs[17] = KERN(canon)(r17);
+    p->coeffs[18] = KERN(canon)(r18);
+    p->coeffs[19] = KERN(canon)(r19);
+    p->coeffs[20] = KERN(canon)(r20);
+    p->coeffs[21] = KERN(canon)(r21);
+    p->coeffs[22] = KERN(canon)(r22);
+    p->coeffs[23] = KERN(canon)(r23);
+    p->coeffs[24] = KERN(canon)(r24);
+    p->coeffs[25] = KERN(canon)(r25);
+    p->coeffs[26] = KERN(canon)(r26);
+    p->coeffs[27] = KERN(canon)(r27);
+    p->coeffs[28] = KERN(canon)(r28);
+    p->coeffs[29] = KERN(canon)(r29);
+    p->coeffs[30] = KERN(canon)(r30);
+    p->coeffs[31] = KERN(canon)(r31);
+    p->coeffs[32] = KERN(canon)(r32);
+    p->coeffs[33] = KERN(canon)(r33);
+    p->coeffs[34] = KERN(canon)(r34);
+    p->coeffs[35] = KERN(canon)(r35);
+    p->coeffs[36] = KERN(canon)(r36);
+    p->coeffs[37] = KERN(canon)(r37);
+    p->coeffs[38] = KERN(canon)(r38);
+    p->coeffs[39] = KERN(canon)(r39);
+    p->coeffs[40] = KERN(canon)(r40);
+    p->coeffs[41] = KERN(canon)(r41);
+    p->coeffs[42] = KERN(canon)(r42);
+    p->coeffs[43] = KERN(canon)(r43);
+    p->coeffs[44] = KERN(canon)(r44);
+    p->coeffs[45] = KERN(canon)(r45);
+    p->coeffs[46] = KERN(canon)(r46);
+    p->coeffs[47] = KERN(canon)(r47);
+    p->coeffs[48] = KERN(canon)(r48);
+    p->coeffs[49] = KERN(canon)(r49);
+    p->coeffs[50] = KERN(canon)(r50);
+    p->coeffs[51] = KERN(canon)(r51);
+    p->coeffs[52] = KERN(canon)(r52);
+    p->coeffs[53] = KERN(canon)(r53);
+    p->coeffs[54] = KERN(canon)(r54);
+    p->coeffs[55] = KERN(canon)(r55);
+    p->coeffs[56] = KERN(canon)(r56);
+    p->coeffs[57] = KERN(canon)(r57);
+    p->coeffs[58] = KERN(canon)(r58);
+    p->coeffs[59] = KERN(canon)(r59);
+    p->coeffs[60] = KERN(canon)(r60);
+    p->coeffs[61] = KERN(canon)(r61);
+    p->coeffs[62] = KERN(canon)(r62);
+    p->coeffs[63] = KERN(canon)(r63);
+}
+
+// 同 ntt，輸出同時寫到頻率優先佈局 (out 指向該多項式在第 0 個 tile 的起點，stride 為相鄰 tile 的距離)
+static void KERN(ntt_fm)(poly *p, int16_t *out, size_t stride) {
+    int32_t r0 = p->coeffs[0];
+    int32_t r1 = p->coeffs[1];
+    int32_t r2 = p->coeffs[2];
+    int32_t r3 = p->coeffs[3];
+    int32_t r4 = p->coeffs[4];
+    int32_t r5 = p->coeffs[5];
+    int32_t r6 = p->coeffs[6];
+    int32_t r7 = p->coeffs[7];
+    int32_t r8 = p->coeffs[8];
+    int32_t r9 = p->coeffs[9];
+    int32_t r10 = p->coeffs[10];
+    int32_t r11 = p->coeffs[11];
+    int32_t r12 = p->coeffs[12];
+    int32_t r13 = p->coeffs[13];
+    int32_t r14 = p->coeffs[14];
+    int32_t r15 = p->coeffs[15];
+    int32_t r16 = p->coeffs[16];
+    int32_t r17 = p->coeffs[17];
+    int32_t r18 = p->coeffs[18];
+    int32_t r19 = p->coeffs[19];
+    int32_t r20 = p->coeffs[20];
+    int32_t r21 = p->coeffs[21];
+    int32_t r22 = p->coeffs[22];
+    int32_t r23 = p->coeffs[23];
+    int32_t r24 = p->coeffs[24];
+    int32_t r25 = p->coeffs[25];
+    int32_t r26 = p->coeffs[26];
+    int32_t r27 = p->coeffs[27];
+    int32_t r28 = p->coeffs[28];
+    int32_t r29 = p->coeffs[29];
+    int32_t r30 = p->coeffs[30];
+    int32_t r31 = p->coeffs[31];
+    int32_t r32 = p->coeffs[32];
+    int32_t r33 = p->coeffs[33];
+    int32_t r34 = p->coeffs[34];
+    int32_t r35 = p->coeffs[35];
+    int32_t r36 = p->coeffs[36];
+    int32_t r37 = p->coeffs[37];
+    int32_t r38 = p->coeffs[38];
+    int32_t r39 = p->coeffs[39];
+    int32_t r40 = p->coeffs[40];
+    int32_t r41 = p->coeffs[41];
+    int32_t r42 = p->coeffs[42];
+    int32_t r43 = p->coeffs[43];
+    int32_t r44 = p->coeffs[44];
+    int32_t r45 = p->coeffs[45];
+    int32_t r46 = p->coeffs[46];
+    int32_t r47 = p->coeffs[47];
+    int32_t r48 = p->coeffs[48];
+    int32_t r49 = p->coeffs[49];
+    int32_t r50 = p->coeffs[50];
+    int32_t r51 = p->coeffs[51];
+    int32_t r52 = p->coeffs[52];
+    int32_t r53 = p->coeffs[53];
+    int32_t r54 = p->coeffs[54];
+    int32_t r55 = p->coeffs[55];
+    int32_t r56 = p->coeffs[56];
+    int32_t r57 = p->coeffs[57];
+    int32_t r58 = p->coeffs[58];
+    int32_t r59 = p->coeffs[59];
+    int32_t r60 = p->coeffs[60];
+    int32_t r61 = p->coeffs[61];
+    int32_t r62 = p->coeffs[62];
+    int32_t r63 = p->coeffs[63];
+    int32_t t;
+
+    // 第 1 層 (t = 32)，輸入 |r| <= 32768
+    t = KERN(barrett)(r32 * 3383);
+    r32 = r0 - t; r0 += t;
+    t = KERN(barrett)(r33 * 3383);
+    r33 = r1 - t; r1 += t;
+    t = KERN(barrett)(r34 * 3383);
+    r34 = r2 - t; r2 += t;
+    t = KERN(barrett)(r35 * 3383);
+    r35 = r3 - t; r3 += t;
+    t = KERN(barrett)(r36 * 3383);
+    r36 = r4 - t; r4 += t;
+    t = KERN(barrett)(r37 * 3383);
+    r37 = r5 - t; r5 += t;
+    t = KERN(barrett)(r38 * 3383);
+    r38 = r6 - t; r6 += t;
+    t = KERN(barrett)(r39 * 3383);
+    r39 = r7 - t; r7 += t;
+    t = KERN(barrett)(r40 * 3383);
+    r40 = r8 - t; r8 += t;
+    t = KERN(barrett)(r41 * 3383);
+    r41 = r9 - t; r9 += t;
+    t = KERN(barrett)(r42 * 3383);
+    r42 = r10 - t; r10 += t;
+    t = KERN(barrett)(r43 * 3383);
+    r43 = r11 - t; r11 += t;
+    t = KERN(barrett)(r44 * 3383);
+    r44 = r12 - t; r12 += t;
+    t = KERN(barrett)(r45 * 3383);
+    r45 = r13 - t; r13 += t;
+    t = KERN(barrett)(r46 * 3383);
+    r46 = r14 - t; r14 += t;
+    t = KERN(barrett)(r47 * 3383);
+    r47 = r15 - t; r15 += t;
+    t = KERN(barrett)(r48 * 3383);
+    r48 = r16 - t; r16 += t;
+    t = KERN(barrett)(r49 * 3383);
+    r49 = r17 - t; r17 += t;
+    t = KERN(barrett)(r50 * 3383);
+    r50 = r18 - t; r18 += t;
+    t = KERN(barrett)(r51 * 3383);
+    r51 = r19 - t; r19 += t;
+    t = KERN(barrett)(r52 * 3383);
+    r52 = r20 - t; r20 += t;
+    t = KERN(barrett)(r53 * 3383);
+    r53 = r21 - t; r21 += t;
+    t = KERN(barrett)(r54 * 3383);
+    r54 = r22 - t; r22 += t;
+    t = KERN(barrett)(r55 * 3383);
+    r55 = r23 - t; r23 += t;
+    t = KERN(barrett)(r56 * 3383);
+    r56 = r24 - t; r24 += t;
+    t = KERN(barrett)(r57 * 3383);
+    r57 = r25 - t; r25 += t;
+    t = KERN(barrett)(r58 * 3383);
+    r58 = r26 - t; r26 += t;
+    t = KERN(barrett)(r59 * 3383);
+    r59 = r27 - t; r27 += t;
+    t = KERN(barrett)(r60 * 3383);
+    r60 = r28 - t; r28 += t;
+    t = KERN(barrett)(r61 * 3383);
+    r61 = r29 - t; r29 += t;
+    t = KERN(barrett)(r62 * 3383);
+    r62 = r30 - t; r30 += t;
+    t = KERN(barrett)(r63 * 3383);
+    r63 = r31 - t; r31 += t;
+
+    // 第 2 層 (t = 16)，輸入 |r| <= 48129
+    t = KERN(barrett)(r16 * -1925);
+    r16 = r0 - t; r0 += t;
+    t = KERN(barrett)(r17 * -1925);
+    r17 = r1 - t; r1 += t;
+    t = KERN(barrett)(r18 * -1925);
+    r18 = r2 - t; r2 += t;
+    t = KERN(barrett)(r19 * -1925);
+    r19 = r3 - t; r3 += t;
+    t = KERN(barrett)(r20 * -1925);
+    r20 = r4 - t; r4 += t;
+    t = KERN(barrett)(r21 * -1925);
+    r21 = r5 - t; r5 += t;
+    t = KERN(barrett)(r22 * -1925);
+    r22 = r6 - t; r6 += t;
+    t = KERN(barrett)(r23 * -1925);
+    r23 = r7 - t; r7 += t;
+    t = KERN(barrett)(r24 * -1925);
+    r24 = r8 - t; r8 += t;
+    t = KERN(barrett)(r25 * -1925);
+    r25 = r9 - t; r9 += t;
+    t = KERN(barrett)(r26 * -1925);
+    r26 = r10 - t; r10 += t;
+    t = KERN(barrett)(r27 * -1925);
+    r27 = r11 - t; r11 += t;
+    t = KERN(barrett)(r28 * -1925);
+    r28 = r12 - t; r12 += t;
+    t = KERN(barrett)(r29 * -1925);
+    r29 = r13 - t; r13 += t;
+    t = KERN(barrett)(r30 * -1925);
+    r30 = r14 - t; r14 += t;
+    t = KERN(barrett)(r31 * -1925);
+    r31 = r15 - t; r15 += t;
+    t = KERN(barrett)(r48 * 1213);
+    r48 = r32 - t; r32 += t;
+    t = KERN(barrett)(r49 * 1213);
+    r49 = r33 - t; r33 += t;
+    t = KERN(barrett)(r50 * 1213);
+    r50 = r34 - t; r34 += t;
+    t = KERN(barrett)(r51 * 1213);
+    r51 = r35 - t; r35 += t;
+    t = KERN(barrett)(r52 * 1213);
+    r52 = r36 - t; r36 += t;
+    t = KERN(barrett)(r53 * 1213);
+    r53 = r37 - t; r37 += t;
+    t = KERN(barrett)(r54 * 1213);
+    r54 = r38 - t; r38 += t;
+    t = KERN(barrett)(r55 * 1213);
+    r55 = r39 - t; r39 += t;
+    t = KERN(barrett)(r56 * 1213);
+    r56 = r40 - t; r40 += t;
+    t = KERN(barrett)(r57 * 1213);
+    r57 = r41 - t; r41 += t;
+    t = KERN(barrett)(r58 * 1213);
+    r58 = r42 - t; r42 += t;
+    t = KERN(barrett)(r59 * 1213);
+    r59 = r43 - t; r43 += t;
+    t = KERN(barrett)(r60 * 1213);
+    r60 = r44 - t; r44 += t;
+    t = KERN(barrett)(r61 * 1213);
+    r61 = r45 - t; r45 += t;
+    t = KERN(barrett)(r62 * 1213);
+    r62 = r46 - t; r46 += t;
+    t = KERN(barrett)(r63 * 1213);
+    r63 = r47 - t; r47 += t;
+
+    // 第 3 層 (t = 8)，輸入 |r| <= 63490
+    t = KERN(barrett)(r8 * -1728);
+    r8 = r0 - t; r0 += t;
+    t = KERN(barrett)(r9 * -1728);
+    r9 = r1 - t; r1 += t;
+    t = KERN(barrett)(r10 * -1728);
+    r10 = r2 - t; r2 += t;
+    t = KERN(barrett)(r11 * -1728);
+    r11 = r3 - t; r3 += t;
+    t = KERN(barrett)(r12 * -1728);
+    r12 = r4 - t; r4 += t;
+    t = KERN(barrett)(r13 * -1728);
+    r13 = r5 - t; r5 += t;
+    t = KERN(barrett)(r14 * -1728);
+    r14 = r6 - t; r6 += t;
+    t = KERN(barrett)(r15 * -1728);
+    r15 = r7 - t; r7 += t;
+    t = KERN(barrett)(r24 * -583);
+    r24 = r16 - t; r16 += t;
+    t = KERN(barrett)(r25 * -583);
+    r25 = r17 - t; r17 += t;
+    t = KERN(barrett)(r26 * -583);
+    r26 = r18 - t; r18 += t;
+    t = KERN(barrett)(r27 * -583);
+    r27 = r19 - t; r19 += t;
+    t = KERN(barrett)(r28 * -583);
+    r28 = r20 - t; r20 += t;
+    t = KERN(barrett)(r29 * -583);
+    r29 = r21 - t; r21 += t;
+    t = KERN(barrett)(r30 * -583);
+    r30 = r22 - t; r22 += t;
+    t = KERN(barrett)(r31 * -583);
+    r31 = r23 - t; r23 += t;
+    t = KERN(barrett)(r40 * 527);
+    r40 = r32 - t; r32 += t;
+    t = KERN(barrett)(r41 * 527);
+    r41 = r33 - t; r33 += t;
+    t = KERN(barrett)(r42 * 527);
+    r42 = r34 - t; r34 += t;
+    t = KERN(barrett)(r43 * 527);
+    r43 = r35 - t; r35 += t;
+    t = KERN(barrett)(r44 * 527);
+    r44 = r36 - t; r36 += t;
+    t = KERN(barrett)(r45 * 527);
+    r45 = r37 - t; r37 += t;
+    t = KERN(barrett)(r46 * 527);
+    r46 = r38 - t; r38 += t;
+    t = KERN(barrett)(r47 * 527);
+    r47 = r39 - t; r39 += t;
+    t = KERN(barrett)(r56 * 849);
+    r56 = r48 - t; r48 += t;
+    t = KERN(barrett)(r57 * 849);
+    r57 = r49 - t; r49 += t;
+    t = KERN(barrett)(r58 * 849);
+    r58 = r50 - t; r50 += t;
+    t = KERN(barrett)(r59 * 849);
+    r59 = r51 - t; r51 += t;
+    t = KERN(barrett)(r60 * 849);
+    r60 = r52 - t; r52 += t;
+    t = KERN(barrett)(r61 * 849);
+    r61 = r53 - t; r53 += t;
+    t = KERN(barrett)(r62 * 849);
+    r62 = r54 - t; r54 += t;
+    t = KERN(barrett)(r63 * 849);
+    r63 = r55 - t; r55 += t;
+
+    // 第 4 層 (t = 4)，輸入 |r| <= 78851
+    t = KERN(barrett)(r4 * 2132);
+    r4 = r0 - t; r0 += t;
+    t = KERN(barrett)(r5 * 2132);
+    r5 = r1 - t; r1 += t;
+    t = KERN(barrett)(r6 * 2132);
+    r6 = r2 - t; r2 += t;
+    t = KERN(barrett)(r7 * 2132);
+    r7 = r3 - t; r3 += t;
+    t = KERN(barrett)(r12 * 97);
+    r12 = r8 - t; r8 += t;
+    t = KERN(barrett)(r13 * 97);
+    r13 = r9 - t; r9 += t;
+    t = KERN(barrett)(r14 * 97);
+    r14 = r10 - t; r10 += t;
+    t = KERN(barrett)(r15 * 97);
+    r15 = r11 - t; r11 += t;
+    t = KERN(barrett)(r20 * -2446);
+    r20 = r16 - t; r16 += t;
+    t = KERN(barrett)(r21 * -2446);
+    r21 = r17 - t; r17 += t;
+    t = KERN(barrett)(r22 * -2446);
+    r22 = r18 - t; r18 += t;
+    t = KERN(barrett)(r23 * -2446);
+    r23 = r19 - t; r19 += t;
+    t = KERN(barrett)(r28 * -2381);
+    r28 = r24 - t; r24 += t;
+    t = KERN(barrett)(r29 * -2381);
+    r29 = r25 - t; r25 += t;
+    t = KERN(barrett)(r30 * -2381);
+    r30 = r26 - t; r26 += t;
+    t = KERN(barrett)(r31 * -2381);
+    r31 = r27 - t; r27 += t;
+    t = KERN(barrett)(r36 * 2784);
+    r36 = r32 - t; r32 += t;
+    t = KERN(barrett)(r37 * 2784);
+    r37 = r33 - t; r33 += t;
+    t = KERN(barrett)(r38 * 2784);
+    r38 = r34 - t; r34 += t;
+    t = KERN(barrett)(r39 * 2784);
+    r39 = r35 - t; r35 += t;
+    t = KERN(barrett)(r44 * 1366);
+    r44 = r40 - t; r40 += t;
+    t = KERN(barrett)(r45 * 1366);
+    r45 = r41 - t; r41 += t;
+    t = KERN(barrett)(r46 * 1366);
+    r46 = r42 - t; r42 += t;
+    t = KERN(barrett)(r47 * 1366);
+    r47 = r43 - t; r43 += t;
+    t = KERN(barrett)(r52 * 2138);
+    r52 = r48 - t; r48 += t;
+    t = KERN(barrett)(r53 * 2138);
+    r53 = r49 - t; r49 += t;
+    t = KERN(barrett)(r54 * 2138);
+    r54 = r50 - t; r50 += t;
+    t = KERN(barrett)(r55 * 2138);
+    r55 = r51 - t; r51 += t;
+    t = KERN(barrett)(r60 * -2648);
+    r60 = r56 - t; r56 += t;
+    t = KERN(barrett)(r61 * -2648);
+    r61 = r57 - t; r57 += t;
+    t = KERN(barrett)(r62 * -2648);
+    r62 = r58 - t; r58 += t;
+    t = KERN(barrett)(r63 * -2648);
+    r63 = r59 - t; r59 += t;
+
+    // 第 5 層 (t = 2)，輸入 |r| <= 94212
+    t = KERN(barrett)(r2 * 2399);
+    r2 = r0 - t; r0 += t;
+    t = KERN(barrett)(r3 * 2399);
+    r3 = r1 - t; r1 += t;
+    t = KERN(barrett)(r6 * -3000);
+    r6 = r4 - t; r4 += t;
+    t = KERN(barrett)(r7 * -3000);
+    r7 = r5 - t; r5 += t;
+    t = KERN(barrett)(r10 * -1794);
+    r10 = r8 - t; r8 += t;
+    t = KERN(barrett)(r11 * -1794);
+    r11 = r9 - t; r9 += t;
+    t = KERN(barrett)(r14 * -1112);
+    r14 = r12 - t; r12 += t;
+    t = KERN(barrett)(r15 * -1112);
+    r15 = r13 - t; r13 += t;
+    t = KERN(barrett)(r18 * 2268);
+    r18 = r16 - t; r16 += t;
+    t = KERN(barrett)(r19 * 2268);
+    r19 = r17 - t; r17 += t;
+    t = KERN(barrett)(r22 * -675);
+    r22 = r20 - t; r20 += t;
+    t = KERN(barrett)(r23 * -675);
+    r23 = r21 - t; r21 += t;
+    t = KERN(barrett)(r26 * -3092);
+    r26 = r24 - t; r24 += t;
+    t = KERN(barrett)(r27 * -3092);
+    r27 = r25 - t; r25 += t;
+    t = KERN(barrett)(r30 * 1286);
+    r30 = r28 - t; r28 += t;
+    t = KERN(barrett)(r31 * 1286);
+    r31 = r29 - t; r29 += t;
+    t = KERN(barrett)(r34 * -878);
+    r34 = r32 - t; r32 += t;
+    t = KERN(barrett)(r35 * -878);
+    r35 = r33 - t; r33 += t;
+    t = KERN(barrett)(r38 * 2273);
+    r38 = r36 - t; r36 += t;
+    t = KERN(barrett)(r39 * 2273);
+    r39 = r37 - t; r37 += t;
+    t = KERN(barrett)(r42 * 330);
+    r42 = r40 - t; r40 += t;
+    t = KERN(barrett)(r43 * 330);
+    r43 = r41 - t; r41 += t;
+    t = KERN(barrett)(r46 * 2645);
+    r46 = r44 - t; r44 += t;
+    t = KERN(barrett)(r47 * 2645);
+    r47 = r45 - t; r45 += t;
+    t = KERN(barrett)(r50 * -3654);
+    r50 = r48 - t; r48 += t;
+    t = KERN(barrett)(r51 * -3654);
+    r51 = r49 - t; r49 += t;
+    t = KERN(barrett)(r54 * -2753);
+    r54 = r52 - t; r52 += t;
+    t = KERN(barrett)(r55 * -2753);
+    r55 = r53 - t; r53 += t;
+    t = KERN(barrett)(r58 * -1846);
+    r58 = r56 - t; r56 += t;
+    t = KERN(barrett)(r59 * -1846);
+    r59 = r57 - t; r57 += t;
+    t = KERN(barrett)(r62 * -365);
+    r62 = r60 - t; r60 += t;
+    t = KERN(barrett)(r63 * -365);
+    r63 = r61 - t; r61 += t;
+
+    // 輸出化約，|r| <= 109573
+    r0 = KERN(barrett)(r0);
+    r1 = KERN(barrett)(r1);
+    r2 = KERN(barrett)(r2);
+    r3 = KERN(barrett)(r3);
+    r4 = KERN(barrett)(r4);
+    r5 = KERN(barrett)(r5);
+    r6 = KERN(barrett)(r6);
+    r7 = KERN(barrett)(r7);
+    r8 = KERN(barrett)(r8);
+    r9 = KERN(barrett)(r9);
+    r10 = KERN(barrett)(r10);
+    r11 = KERN(barrett)(r11);
+    r12 = KERN(barrett)(r12);
+    r13 = KERN(barrett)(r13);
+    r14 = KERN(barrett)(r14);
+    r15 = KERN(barrett)(r15);
+    r16 = KERN(barrett)(r16);
+    r17 = KERN(barrett)(r17);
+    r18 = KERN(barrett)(r18);
+    r19 = KERN(barrett)(r19);
+    r20 = KERN(barrett)(r20);
+    r21 = KERN(barrett)(r21);
+    r22 = KERN(barrett)(r22);
+    r23 = KERN(barrett)(r23);
+    r24 = KERN(barrett)(r24);
+    r25 = KERN(barrett)(r25);
+    r26 = KERN(barrett)(r26);
+    r27 = KERN(barrett)(r27);
+    r28 = KERN(barrett)(r28);
+    r29 = KERN(barrett)(r29);
+    r30 = KERN(barrett)(r30);
+    r31 = KERN(barrett)(r31);
+    r32 = KERN(barrett)(r32);
+    r33 = KERN(barrett)(r33);
+    r34 = KERN(barrett)(r34);
+    r35 = KERN(barrett)(r35);
+    r36 = KERN(barrett)(r36);
+    r37 = KERN(barrett)(r37);
+    r38 = KERN(barrett)(r38);
+    r39 = KERN(barrett)(r39);
+    r40 = KERN(barrett)(r40);
+    r41 = KERN(barrett)(r41);
+    r42 = KERN(barrett)(r42);
+    r43 = KERN(barrett)(r43);
+    r44 = KERN(barrett)(r44);
+    r45 = KERN(barrett)(r45);
+    r46 = KERN(barrett)(r46);
+    r47 = KERN(barrett)(r47);
+    r48 = KERN(barrett)(r48);
+    r49 = KERN(barrett)(r49);
+    r50 = KERN(barrett)(r50);
+    r51 = KERN(barrett)(r51);
+    r52 = KERN(barrett)(r52);
+    r53 = KERN(barrett)(r53);
+    r54 = KERN(barrett)(r54);
+    r55 = KERN(barrett)(r55);
+    r56 = KERN(barrett)(r56);
+    r57 = KERN(barrett)(r57);
+    r58 = KERN(barrett)(r58);
+    r59 = KERN(barrett)(r59);
+    r60 = KERN(barrett)(r60);
+    r61 = KERN(barrett)(r61);
+    r62 = KERN(barrett)(r62);
+    r63 = KERN(barrett)(r63);
+    out[0 * stride + 0] = p->coeffs[0] = KERN(canon)(r0);
+    out[2 * stride + 0] = p->coeffs[1] = KERN(canon)(r1);
+    out[0 * stride + 1] = p->coeffs[2] = KERN(canon)(r2);
+    out[2 * stride + 1] = p->coeffs[3] = KERN(canon)(r3);
+    out[0 * stride + 2] = p->coeffs[4] = KERN(canon)(r4);
+    out[2 * stride + 2] = p->coeffs[5] = KERN(canon)(r5);
+    out[0 * stride + 3] = p->coeffs[6] = KERN(canon)(r6);
+    out[2 * stride + 3] = p->coeffs[7] = KERN(canon)(r7);
+    out[0 * stride + 4] = p->coeffs[8] = KERN(canon)(r8);
+    out[2 * stride + 4] = p->coeffs[9] = KERN(canon)(r9);
+    out[0 * stride + 5] = p->coeffs[10] = KERN(canon)(r10);
+    out[2 * stride + 5] = p->coeffs[11] = KERN(canon)(r11);
+    out[0 * stride + 6] = p->coeffs[12] = KERN(canon)(r12);
+    out[2 * stride + 6] = p->coeffs[13] = KERN(canon)(r13);
+    out[0 * stride + 7] = p->coeffs[14] = KERN(canon)(r14);
+    out[2 * stride + 7] = p->coeffs[15] = KERN(canon)(r15);
+    out[0 * stride + 8] = p->coeffs[16] = KERN(canon)(r16);
+    out[2 * stride + 8] = p->coeffs[17] = KERN(canon)(r17);
+    out[0 * stride + 9] = p->coeffs[18] = KERN(canon)(r18);
+    out[2 * stride + 9] = p->coeffs[19] = KERN(canon)(r19);
+    out[0 * stride + 10] = p->coeffs[20] = KERN(canon)(r20);
+    out[2 * stride + 10] = p->coeffs[21] = KERN(canon)(r21);
+    out[0 * stride + 11] = p->coeffs[22] = KERN(canon)(r22);
+    out[2 * stride + 11] = p->coeffs[23] = KERN(canon)(r23);
+    out[0 * stride + 12] = p->coeffs[24] = KERN(canon)(r24);
+    out[2 * stride + 12] = p->coeffs[25] = KERN(canon)(r25);
+    out[0 * stride + 13] = p->coeffs[26] = KERN(canon)(r26);
+    out[2 * stride + 13] = p->coeffs[27] = KERN(canon)(r27);
+    out[0 * stride + 14] = p->coeffs[28] = KERN(canon)(r28);
+    out[2 * stride + 14] = p->coeffs[29] = KERN(canon)(r29);
+    out[0 * stride + 15] = p->coeffs[30] = KERN(canon)(r30);
+    out[2 * stride + 15] = p->coeffs[31] = KERN(canon)(r31);
+    out[1 * stride + 0] = p->coeffs[32] = KERN(canon)(r32);
+    out[3 * stride + 0] = p->coeffs[33] = KERN(canon)(r33);
+    out[1 * stride + 1] = p->coeffs[34] = KERN(canon)(r34);
+    out[3 * stride + 1] = p->coeffs[35] = KERN(canon)(r35);
+    out[1 * stride + 2] = p->coeffs[36] = KERN(canon)(r36);
+    out[3 * stride + 2] = p->coeffs[37] = KERN(canon)(r37);
+    out[1 * stride + 3] = p->coeffs[38] = KERN(canon)(r38);
+    out[3 * stride + 3] = p->coeffs[39] = KERN(canon)(r39);
+    out[1 * stride + 4] = p->coeffs[40] = KERN(canon)(r40);
+    out[3 * stride + 4] = p->coeffs[41] = KERN(canon)(r41);
+    out[1 * stride + 5] = p->coeffs[42] = KERN(canon)(r42);
+    out[3 * stride + 5] = p->coeffs[43] = KERN(canon)(r43);
+    out[1 * stride + 6] = p->coeffs[44] = KERN(canon)(r44);
+    out[3 * stride + 6] = p->coeffs[45] = KERN(canon)(r45);
+    out[1 * stride + 7] = p->coeffs[46] = KERN(canon)(r46);
+    out[3 * stride + 7] = p->coeffs[47] = KERN(canon)(r47);
+    out[1 * stride + 8] = p->coeffs[48] = KERN(canon)(r48);
+    out[3 * stride + 8] = p->coeffs[49] = KERN(canon)(r49);
+    out[1 * stride + 9] = p->coeffs[50] = KERN(canon)(r50);
+    out[3 * stride + 9] = p->coeffs[51] = KERN(canon)(r51);
+    out[1 * stride + 10] = p->coeffs[52] = KERN(canon)(r52);
+    out[3 * stride + 10] = p->coeffs[53] = KERN(canon)(r53);
+    out[1 * stride + 11] = p->coeffs[54] = KERN(canon)(r54);
+    out[3 * stride + 11] = p->coeffs[55] = KERN(canon)(r55);
+    out[1 * stride + 12] = p->coeffs[56] = KERN(canon)(r56);
+    out[3 * stride + 12] = p->coeffs[57] = KERN(canon)(r57);
+    out[1 * stride + 13] = p->coeffs[58] = KERN(canon)(r58);
+    out[3 * stride + 13] = p->coeffs[59] = KERN(canon)(r59);
+    out[1 * stride + 14] = p->coeffs[60] = KERN(canon)(r60);
+    out[3 * stride + 14] = p->coeffs[61] = KERN(canon)(r61);
+    out[1 * stride + 15] = p->coeffs[62] = KERN(canon)(r62);
+    out[3 * stride + 15] = p->coeffs[63] = KERN(canon)(r63);
+}
+
+// 反向 INTT (5 層，輸入位元反轉 -> 輸出自然順序)，輸入可為任意 int16，輸出在 [0, q)
+static void KERN(invntt)(poly *p) {
+    int32_t r0 = p->coeffs[0];
+    int32_t r1 = p->coeffs[1];
+    int32_t r2 = p->coeffs[2];
+    int32_t r3 = p->coeffs[3];
+    int32_t r4 = p->coeffs[4];
+    int32_t r5 = p->coeffs[5];
+    int32_t r6 = p->coeffs[6];
+    int32_t r7 = p->coeffs[7];
+    int32_t r8 = p->coeffs[8];
+    int32_t r9 = p->coeffs[9];
+    int32_t r10 = p->coeffs[10];
+    int32_t r11 = p->coeffs[11];
+    int32_t r12 = p->coeffs[12];
+    int32_t r13 = p->coeffs[13];
+    int32_t r14 = p->coeffs[14];
+    int32_t r15 = p->coeffs[15];
+    int32_t r16 = p->coeffs[16];
+    int32_t r17 = p->coeffs[17];
+    int32_t r18 = p->coeffs[18];
+    int32_t r19 = p->coeffs[19];
+    int32_t r20 = p->coeffs[20];
+    int32_t r21 = p->coeffs[21];
+    int32_t r22 = p->coeffs[22];
+    int32_t r23 = p->coeffs[23];
+    int32_t r24 = p->coeffs[24];
+    int32_t r25 = p->coeffs[25];
+    int32_t r26 = p->coeffs[26];
+    int32_t r27 = p->coeffs[27];
+    int32_t r28 = p->coeffs[28];
+    int32_t r29 = p->coeffs[29];
+    int32_t r30 = p->coeffs[30];
+    int32_t r31 = p->coeffs[31];
+    int32_t r32 = p->coeffs[32];
+    int32_t r33 = p->coeffs[33];
+    int32_t r34 = p->coeffs[34];
+    int32_t r35 = p->coeffs[35];
+    int32_t r36 = p->coeffs[36];
+    int32_t r37 = p->coeffs[37];
+    int32_t r38 = p->coeffs[38];
+    int32_t r39 = p->coeffs[39];
+    int32_t r40 = p->coeffs[40];
+    int32_t r41 = p->coeffs[41];
+    int32_t r42 = p->coeffs[42];
+    int32_t r43 = p->coeffs[43];
+    int32_t r44 = p->coeffs[44];
+    int32_t r45 = p->coeffs[45];
+    int32_t r46 = p->coeffs[46];
+    int32_t r47 = p->coeffs[47];
+    int32_t r48 = p->coeffs[48];
+    int32_t r49 = p->coeffs[49];
+    int32_t r50 = p->coeffs[50];
+    int32_t r51 = p->coeffs[51];
+    int32_t r52 = p->coeffs[52];
+    int32_t r53 = p->coeffs[53];
+    int32_t r54 = p->coeffs[54];
+    int32_t r55 = p->coeffs[55];
+    int32_t r56 = p->coeffs[56];
+    int32_t r57 = p->coeffs[57];
+    int32_t r58 = p->coeffs[58];
+    int32_t r59 = p->coeffs[59];
+    int32_t r60 = p->coeffs[60];
+    int32_t r61 = p->coeffs[61];
+    int32_t r62 = p->coeffs[62];
+    int32_t r63 = p->coeffs[63];
+    int32_t t;
+    int32_t u;
+
+    // 第 1 層 (t = 2)，輸入 |r| <= 32768
+    u = r0; r0 = u + r2; r2 = u - r2;
+    t = KERN(barrett)(r2 * 365);
+    r2 = t;
+    u = r1; r1 = u + r3; r3 = u - r3;
+    t = KERN(barrett)(r3 * 365);
+    r3 = t;
+    u = r4; r4 = u + r6; r6 = u - r6;
+    t = KERN(barrett)(r6 * 1846);
+    r6 = t;
+    u = r5; r5 = u + r7; r7 = u - r7;
+    t = KERN(barrett)(r7 * 1846);
+    r7 = t;
+    u = r8; r8 = u + r10; r10 = u - r10;
+    t = KERN(barrett)(r10 * 2753);
+    r10 = t;
+    u = r9; r9 = u + r11; r11 = u - r11;
+    t = KERN(barrett)(r11 * 2753);
+    r11 = t;
+    u = r12; r12 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * 3654);
+    r14 = t;
+    u = r13; r13 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * 3654);
+    r15 = t;
+    u = r16; r16 = u + r18; r18 = u - r18;
+    t = KERN(barrett)(r18 * -2645);
+    r18 = t;
+    u = r17; r17 = u + r19; r19 = u - r19;
+    t = KERN(barrett)(r19 * -2645);
+    r19 = t;
+    u = r20; r20 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -330);
+    r22 = t;
+    u = r21; r21 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -330);
+    r23 = t;
+    u = r24; r24 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -2273);
+    r26 = t;
+    u = r25; r25 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -2273);
+    r27 = t;
+    u = r28; r28 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * 878);
+    r30 = t;
+    u = r29; r29 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * 878);
+    r31 = t;
+    u = r32; r32 = u + r34; r34 = u - r34;
+    t = KERN(barrett)(r34 * -1286);
+    r34 = t;
+    u = r33; r33 = u + r35; r35 = u - r35;
+    t = KERN(barrett)(r35 * -1286);
+    r35 = t;
+    u = r36; r36 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * 3092);
+    r38 = t;
+    u = r37; r37 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * 3092);
+    r39 = t;
+    u = r40; r40 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * 675);
+    r42 = t;
+    u = r41; r41 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * 675);
+    r43 = t;
+    u = r44; r44 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * -2268);
+    r46 = t;
+    u = r45; r45 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * -2268);
+    r47 = t;
+    u = r48; r48 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * 1112);
+    r50 = t;
+    u = r49; r49 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * 1112);
+    r51 = t;
+    u = r52; r52 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * 1794);
+    r54 = t;
+    u = r53; r53 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * 1794);
+    r55 = t;
+    u = r56; r56 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 3000);
+    r58 = t;
+    u = r57; r57 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 3000);
+    r59 = t;
+    u = r60; r60 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * -2399);
+    r62 = t;
+    u = r61; r61 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -2399);
+    r63 = t;
+
+    // 第 2 層 (t = 4)，輸入 |r| <= 65536
+    u = r0; r0 = u + r4; r4 = u - r4;
+    t = KERN(barrett)(r4 * 2648);
+    r4 = t;
+    u = r1; r1 = u + r5; r5 = u - r5;
+    t = KERN(barrett)(r5 * 2648);
+    r5 = t;
+    u = r2; r2 = u + r6; r6 = u - r6;
+    t = KERN(barrett)(r6 * 2648);
+    r6 = t;
+    u = r3; r3 = u + r7; r7 = u - r7;
+    t = KERN(barrett)(r7 * 2648);
+    r7 = t;
+    u = r8; r8 = u + r12; r12 = u - r12;
+    t = KERN(barrett)(r12 * -2138);
+    r12 = t;
+    u = r9; r9 = u + r13; r13 = u - r13;
+    t = KERN(barrett)(r13 * -2138);
+    r13 = t;
+    u = r10; r10 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * -2138);
+    r14 = t;
+    u = r11; r11 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * -2138);
+    r15 = t;
+    u = r16; r16 = u + r20; r20 = u - r20;
+    t = KERN(barrett)(r20 * -1366);
+    r20 = t;
+    u = r17; r17 = u + r21; r21 = u - r21;
+    t = KERN(barrett)(r21 * -1366);
+    r21 = t;
+    u = r18; r18 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -1366);
+    r22 = t;
+    u = r19; r19 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -1366);
+    r23 = t;
+    u = r24; r24 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -2784);
+    r28 = t;
+    u = r25; r25 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -2784);
+    r29 = t;
+    u = r26; r26 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -2784);
+    r30 = t;
+    u = r27; r27 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -2784);
+    r31 = t;
+    u = r32; r32 = u + r36; r36 = u - r36;
+    t = KERN(barrett)(r36 * 2381);
+    r36 = t;
+    u = r33; r33 = u + r37; r37 = u - r37;
+    t = KERN(barrett)(r37 * 2381);
+    r37 = t;
+    u = r34; r34 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * 2381);
+    r38 = t;
+    u = r35; r35 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * 2381);
+    r39 = t;
+    u = r40; r40 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * 2446);
+    r44 = t;
+    u = r41; r41 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 2446);
+    r45 = t;
+    u = r42; r42 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * 2446);
+    r46 = t;
+    u = r43; r43 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * 2446);
+    r47 = t;
+    u = r48; r48 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * -97);
+    r52 = t;
+    u = r49; r49 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * -97);
+    r53 = t;
+    u = r50; r50 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * -97);
+    r54 = t;
+    u = r51; r51 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * -97);
+    r55 = t;
+    u = r56; r56 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * -2132);
+    r60 = t;
+    u = r57; r57 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * -2132);
+    r61 = t;
+    u = r58; r58 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * -2132);
+    r62 = t;
+    u = r59; r59 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -2132);
+    r63 = t;
+
+    // 第 3 層 (t = 8)，輸入 |r| <= 131072
+    u = r0; r0 = u + r8; r8 = u - r8;
+    t = KERN(barrett)(r8 * -849);
+    r8 = t;
+    u = r1; r1 = u + r9; r9 = u - r9;
+    t = KERN(barrett)(r9 * -849);
+    r9 = t;
+    u = r2; r2 = u + r10; r10 = u - r10;
+    t = KERN(barrett)(r10 * -849);
+    r10 = t;
+    u = r3; r3 = u + r11; r11 = u - r11;
+    t = KERN(barrett)(r11 * -849);
+    r11 = t;
+    u = r4; r4 = u + r12; r12 = u - r12;
+    t = KERN(barrett)(r12 * -849);
+    r12 = t;
+    u = r5; r5 = u + r13; r13 = u - r13;
+    t = KERN(barrett)(r13 * -849);
+    r13 = t;
+    u = r6; r6 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * -849);
+    r14 = t;
+    u = r7; r7 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * -849);
+    r15 = t;
+    u = r16; r16 = u + r24; r24 = u - r24;
+    t = KERN(barrett)(r24 * -527);
+    r24 = t;
+    u = r17; r17 = u + r25; r25 = u - r25;
+    t = KERN(barrett)(r25 * -527);
+    r25 = t;
+    u = r18; r18 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -527);
+    r26 = t;
+    u = r19; r19 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -527);
+    r27 = t;
+    u = r20; r20 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -527);
+    r28 = t;
+    u = r21; r21 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -527);
+    r29 = t;
+    u = r22; r22 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -527);
+    r30 = t;
+    u = r23; r23 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -527);
+    r31 = t;
+    u = r32; r32 = u + r40; r40 = u - r40;
+    t = KERN(barrett)(r40 * 583);
+    r40 = t;
+    u = r33; r33 = u + r41; r41 = u - r41;
+    t = KERN(barrett)(r41 * 583);
+    r41 = t;
+    u = r34; r34 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * 583);
+    r42 = t;
+    u = r35; r35 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * 583);
+    r43 = t;
+    u = r36; r36 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * 583);
+    r44 = t;
+    u = r37; r37 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 583);
+    r45 = t;
+    u = r38; r38 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * 583);
+    r46 = t;
+    u = r39; r39 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * 583);
+    r47 = t;
+    u = r48; r48 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * 1728);
+    r56 = t;
+    u = r49; r49 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 1728);
+    r57 = t;
+    u = r50; r50 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 1728);
+    r58 = t;
+    u = r51; r51 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 1728);
+    r59 = t;
+    u = r52; r52 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * 1728);
+    r60 = t;
+    u = r53; r53 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 1728);
+    r61 = t;
+    u = r54; r54 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * 1728);
+    r62 = t;
+    u = r55; r55 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * 1728);
+    r63 = t;
+
+    // 第 4 層 (t = 16)，輸入 |r| <= 262144
+    u = r0; r0 = u + r16; r16 = u - r16;
+    t = KERN(barrett)(r16 * -1213);
+    r16 = t;
+    u = r1; r1 = u + r17; r17 = u - r17;
+    t = KERN(barrett)(r17 * -1213);
+    r17 = t;
+    u = r2; r2 = u + r18; r18 = u - r18;
+    t = KERN(barrett)(r18 * -1213);
+    r18 = t;
+    u = r3; r3 = u + r19; r19 = u - r19;
+    t = KERN(barrett)(r19 * -1213);
+    r19 = t;
+    u = r4; r4 = u + r20; r20 = u - r20;
+    t = KERN(barrett)(r20 * -1213);
+    r20 = t;
+    u = r5; r5 = u + r21; r21 = u - r21;
+    t = KERN(barrett)(r21 * -1213);
+    r21 = t;
+    u = r6; r6 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -1213);
+    r22 = t;
+    u = r7; r7 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -1213);
+    r23 = t;
+    u = r8; r8 = u + r24; r24 = u - r24;
+    t = KERN(barrett)(r24 * -1213);
+    r24 = t;
+    u = r9; r9 = u + r25; r25 = u - r25;
+    t = KERN(barrett)(r25 * -1213);
+    r25 = t;
+    u = r10; r10 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -1213);
+    r26 = t;
+    u = r11; r11 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -1213);
+    r27 = t;
+    u = r12; r12 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -1213);
+    r28 = t;
+    u = r13; r13 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -1213);
+    r29 = t;
+    u = r14; r14 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -1213);
+    r30 = t;
+    u = r15; r15 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -1213);
+    r31 = t;
+    u = r32; r32 = u + r48; r48 = u - r48;
+    t = KERN(barrett)(r48 * 1925);
+    r48 = t;
+    u = r33; r33 = u + r49; r49 = u - r49;
+    t = KERN(barrett)(r49 * 1925);
+    r49 = t;
+    u = r34; r34 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * 1925);
+    r50 = t;
+    u = r35; r35 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * 1925);
+    r51 = t;
+    u = r36; r36 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * 1925);
+    r52 = t;
+    u = r37; r37 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * 1925);
+    r53 = t;
+    u = r38; r38 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * 1925);
+    r54 = t;
+    u = r39; r39 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * 1925);
+    r55 = t;
+    u = r40; r40 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * 1925);
+    r56 = t;
+    u = r41; r41 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 1925);
+    r57 = t;
+    u = r42; r42 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 1925);
+    r58 = t;
+    u = r43; r43 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 1925);
+    r59 = t;
+    u = r44; r44 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * 1925);
+    r60 = t;
+    u = r45; r45 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 1925);
+    r61 = t;
+    u = r46; r46 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * 1925);
+    r62 = t;
+    u = r47; r47 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * 1925);
+    r63 = t;
+
+    // 第 5 層 (t = 32)，輸入 |r| <= 524288
+    u = r0; r0 = u + r32; r32 = u - r32;
+    r32 = KERN(barrett)(r32);
+    t = KERN(barrett)(r32 * -2266);
+    r32 = t;
+    t = KERN(barrett)(r0 * -240);
+    r0 = t;
+    u = r1; r1 = u + r33; r33 = u - r33;
+    r33 = KERN(barrett)(r33);
+    t = KERN(barrett)(r33 * -2266);
+    r33 = t;
+    t = KERN(barrett)(r1 * -240);
+    r1 = t;
+    u = r2; r2 = u + r34; r34 = u - r34;
+    t = KERN(barrett)(r34 * -2266);
+    r34 = t;
+    t = KERN(barrett)(r2 * -240);
+    r2 = t;
+    u = r3; r3 = u + r35; r35 = u - r35;
+    t = KERN(barrett)(r35 * -2266);
+    r35 = t;
+    t = KERN(barrett)(r3 * -240);
+    r3 = t;
+    u = r4; r4 = u + r36; r36 = u - r36;
+    t = KERN(barrett)(r36 * -2266);
+    r36 = t;
+    t = KERN(barrett)(r4 * -240);
+    r4 = t;
+    u = r5; r5 = u + r37; r37 = u - r37;
+    t = KERN(barrett)(r37 * -2266);
+    r37 = t;
+    t = KERN(barrett)(r5 * -240);
+    r5 = t;
+    u = r6; r6 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * -2266);
+    r38 = t;
+    t = KERN(barrett)(r6 * -240);
+    r6 = t;
+    u = r7; r7 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * -2266);
+    r39 = t;
+    t = KERN(barrett)(r7 * -240);
+    r7 = t;
+    u = r8; r8 = u + r40; r40 = u - r40;
+    t = KERN(barrett)(r40 * -2266);
+    r40 = t;
+    t = KERN(barrett)(r8 * -240);
+    r8 = t;
+    u = r9; r9 = u + r41; r41 = u - r41;
+    t = KERN(barrett)(r41 * -2266);
+    r41 = t;
+    t = KERN(barrett)(r9 * -240);
+    r9 = t;
+    u = r10; r10 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * -2266);
+    r42 = t;
+    t = KERN(barrett)(r10 * -240);
+    r10 = t;
+    u = r11; r11 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * -2266);
+    r43 = t;
+    t = KERN(barrett)(r11 * -240);
+    r11 = t;
+    u = r12; r12 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * -2266);
+    r44 = t;
+    t = KERN(barrett)(r12 * -240);
+    r12 = t;
+    u = r13; r13 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * -2266);
+    r45 = t;
+    t = KERN(barrett)(r13 * -240);
+    r13 = t;
+    u = r14; r14 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * -2266);
+    r46 = t;
+    t = KERN(barrett)(r14 * -240);
+    r14 = t;
+    u = r15; r15 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * -2266);
+    r47 = t;
+    t = KERN(barrett)(r15 * -240);
+    r15 = t;
+    u = r16; r16 = u + r48; r48 = u - r48;
+    t = KERN(barrett)(r48 * -2266);
+    r48 = t;
+    t = KERN(barrett)(r16 * -240);
+    r16 = t;
+    u = r17; r17 = u + r49; r49 = u - r49;
+    t = KERN(barrett)(r49 * -2266);
+    r49 = t;
+    t = KERN(barrett)(r17 * -240);
+    r17 = t;
+    u = r18; r18 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * -2266);
+    r50 = t;
+    t = KERN(barrett)(r18 * -240);
+    r18 = t;
+    u = r19; r19 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * -2266);
+    r51 = t;
+    t = KERN(barrett)(r19 * -240);
+    r19 = t;
+    u = r20; r20 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * -2266);
+    r52 = t;
+    t = KERN(barrett)(r20 * -240);
+    r20 = t;
+    u = r21; r21 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * -2266);
+    r53 = t;
+    t = KERN(barrett)(r21 * -240);
+    r21 = t;
+    u = r22; r22 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * -2266);
+    r54 = t;
+    t = KERN(barrett)(r22 * -240);
+    r22 = t;
+    u = r23; r23 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * -2266);
+    r55 = t;
+    t = KERN(barrett)(r23 * -240);
+    r23 = t;
+    u = r24; r24 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * -2266);
+    r56 = t;
+    t = KERN(barrett)(r24 * -240);
+    r24 = t;
+    u = r25; r25 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * -2266);
+    r57 = t;
+    t = KERN(barrett)(r25 * -240);
+    r25 = t;
+    u = r26; r26 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * -2266);
+    r58 = t;
+    t = KERN(barrett)(r26 * -240);
+    r26 = t;
+    u = r27; r27 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * -2266);
+    r59 = t;
+    t = KERN(barrett)(r27 * -240);
+    r27 = t;
+    u = r28; r28 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * -2266);
+    r60 = t;
+    t = KERN(barrett)(r28 * -240);
+    r28 = t;
+    u = r29; r29 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * -2266);
+    r61 = t;
+    t = KERN(barrett)(r29 * -240);
+    r29 = t;
+    u = r30; r30 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * -2266);
+    r62 = t;
+    t = KERN(barrett)(r30 * -240);
+    r30 = t;
+    u = r31; r31 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -2266);
+    r63 = t;
+    t = KERN(barrett)(r31 * -240);
+    r31 = t;
+
+    // 輸出化約，|r| <= 15361
+    p->coeffs[0] = KERN(canon)(r0);
+    p->coeffs[1] = KERN(canon)(r1);
+    p->coeffs[2] = KERN(canon)(r2);
+    p->coeffs[3] = KERN(canon)(r3);
+    p->coeffs[4] = KERN(canon)(r4);
+    p->coeffs[5] = KERN(canon)(r5);
+    p->coeffs[6] = KERN(canon)(r6);
+    p->coeffs[7] = KERN(canon)(r7);
+    p->coeffs[8] = KERN(canon)(r8);
+    p->coeffs[9] = KERN(canon)(r9);
+    p->coeffs[10] = KERN(canon)(r10);
+    p->coeffs[11] = KERN(canon)(r11);
+    p->coeffs[12] = KERN(canon)(r12);
+    p->coeffs[13] = KERN(canon)(r13);
+    p->coeffs[14] = KERN(canon)(r14);
+    p->coeffs[15] = KERN(canon)(r15);
+    p->coeffs[16] = KERN(canon)(r16);
+    p->coeffs[17] = KERN(canon)(r17);
+    p->coeffs[18] = KERN(canon)(r18);
+    p->coeffs[19] = KERN(canon)(r19);
+    p->coeffs[20] = KERN(canon)(r20);
+    p->coeffs[21] = KERN(canon)(r21);
+    p->coeffs[22] = KERN(canon)(r22);
+    p->coeffs[23] = KERN(canon)(r23);
+    p->coeffs[24] = KERN(canon)(r24);
+    p->coeffs[25] = KERN(canon)(r25);
+    p->coeffs[26] = KERN(canon)(r26);
+    p->coeffs[27] = KERN(canon)(r27);
+    p->coeffs[28] = KERN(canon)(r28);
+    p->coeffs[29] = KERN(canon)(r29);
+    p->coeffs[30] = KERN(canon)(r30);
+    p->coeffs[31] = KERN(canon)(r31);
+    p->coeffs[32] = KERN(canon)(r32);
+    p->coeffs[33] = KERN(canon)(r33);
+    p->coeffs[34] = KERN(canon)(r34);
+    p->coeffs[35] = KERN(canon)(r35);
+    p->coeffs[36] = KERN(canon)(r36);
+    p->coeffs[37] = KERN(canon)(r37);
+    p->coeffs[38] = KERN(canon)(r38);
+    p->coeffs[39] = KERN(canon)(r39);
+    p->coeffs[40] = KERN(canon)(r40);
+    p->coeffs[41] = KERN(canon)(r41);
+    p->coeffs[42] = KERN(canon)(r42);
+    p->coeffs[43] = KERN(canon)(r43);
+    p->coeffs[44] = KERN(canon)(r44);
+    p->coeffs[45] = KERN(canon)(r45);
+    p->coeffs[46] = KERN(canon)(r46);
+    p->coeffs[47] = KERN(canon)(r47);
+    p->coeffs[48] = KERN(canon)(r48);
+    p->coeffs[49] = KERN(canon)(r49);
+    p->coeffs[50] = KERN(canon)(r50);
+    p->coeffs[51] = KERN(canon)(r51);
+    p->coeffs[52] = KERN(canon)(r52);
+    p->coeffs[53] = KERN(canon)(r53);
+    p->coeffs[54] = KERN(canon)(r54);
+    p->coeffs[55] = KERN(canon)(r55);
+    p->coeffs[56] = KERN(canon)(r56);
+    p->coeffs[57] = KERN(canon)(r57);
+    p->coeffs[58] = KERN(canon)(r58);
+    p->coeffs[59] = KERN(canon)(r59);
+    p->coeffs[60] = KERN(canon)(r60);
+    p->coeffs[61] = KERN(canon)(r61);
+    p->coeffs[62] = KERN(canon)(r62);
+    p->coeffs[63] = KERN(canon)(r63);
+}
+
+// 同 invntt，輸入取自頻率優先佈局 (in 指向該多項式在第 0 個 tile 的起點)
+static void KERN(invntt_fm)(poly *p, const int16_t *in, size_t stride) {
+    int32_t r0 = in[0 * stride + 0];
+    int32_t r1 = in[2 * stride + 0];
+    int32_t r2 = in[0 * stride + 1];
+    int32_t r3 = in[2 * stride + 1];
+    int32_t r4 = in[0 * stride + 2];
+    int32_t r5 = in[2 * stride + 2];
+    int32_t r6 = in[0 * stride + 3];
+    int32_t r7 = in[2 * stride + 3];
+    int32_t r8 = in[0 * stride + 4];
+    int32_t r9 = in[2 * stride + 4];
+    int32_t r10 = in[0 * stride + 5];
+    int32_t r11 = in[2 * stride + 5];
+    int32_t r12 = in[0 * stride + 6];
+    int32_t r13 = in[2 * stride + 6];
+    int32_t r14 = in[0 * stride + 7];
+    int32_t r15 = in[2 * stride + 7];
+    int32_t r16 = in[0 * stride + 8];
+    int32_t r17 = in[2 * stride + 8];
+    int32_t r18 = in[0 * stride + 9];
+    int32_t r19 = in[2 * stride + 9];
+    int32_t r20 = in[0 * stride + 10];
+    int32_t r21 = in[2 * stride + 10];
+    int32_t r22 = in[0 * stride + 11];
+    int32_t r23 = in[2 * stride + 11];
+    int32_t r24 = in[0 * stride + 12];
+    int32_t r25 = in[2 * stride + 12];
+    int32_t r26 = in[0 * stride + 13];
+    int32_t r27 = in[2 * stride + 13];
+    int32_t r28 = in[0 * stride + 14];
+    int32_t r29 = in[2 * stride + 14];
+    int32_t r30 = in[0 * stride + 15];
+    int32_t r31 = in[2 * stride + 15];
+    int32_t r32 = in[1 * stride + 0];
+    int32_t r33 = in[3 * stride + 0];
+    int32_t r34 = in[1 * stride + 1];
+    int32_t r35 = in[3 * stride + 1];
+    int32_t r36 = in[1 * stride + 2];
+    int32_t r37 = in[3 * stride + 2];
+    int32_t r38 = in[1 * stride + 3];
+    int32_t r39 = in[3 * stride + 3];
+    int32_t r40 = in[1 * stride + 4];
+    int32_t r41 = in[3 * stride + 4];
+    int32_t r42 = in[1 * stride + 5];
+    int32_t r43 = in[3 * stride + 5];
+    int32_t r44 = in[1 * stride + 6];
+    int32_t r45 = in[3 * stride + 6];
+    int32_t r46 = in[1 * stride + 7];
+    int32_t r47 = in[3 * stride + 7];
+    int32_t r48 = in[1 * stride + 8];
+    int32_t r49 = in[3 * stride + 8];
+    int32_t r50 = in[1 * stride + 9];
+    int32_t r51 = in[3 * stride + 9];
+    int32_t r52 = in[1 * stride + 10];
+    int32_t r53 = in[3 * stride + 10];
+    int32_t r54 = in[1 * stride + 11];
+    int32_t r55 = in[3 * stride + 11];
+    int32_t r56 = in[1 * stride + 12];
+    int32_t r57 = in[3 * stride + 12];
+    int32_t r58 = in[1 * stride + 13];
+    int32_t r59 = in[3 * stride + 13];
+    int32_t r60 = in[1 * stride + 14];
+    int32_t r61 = in[3 * stride + 14];
+    int32_t r62 = in[1 * stride + 15];
+    int32_t r63 = in[3 * stride + 15];
+    int32_t t;
+    int32_t u;
+
+    // 第 1 層 (t = 2)，輸入 |r| <= 32768
+    u = r0; r0 = u + r2; r2 = u - r2;
+    t = KERN(barrett)(r2 * 365);
+    r2 = t;
+    u = r1; r1 = u + r3; r3 = u - r3;
+    t = KERN(barrett)(r3 * 365);
+    r3 = t;
+    u = r4; r4 = u + r6; r6 = u - r6;
+    t = KERN(barrett)(r6 * 1846);
+    r6 = t;
+    u = r5; r5 = u + r7; r7 = u - r7;
+    t = KERN(barrett)(r7 * 1846);
+    r7 = t;
+    u = r8; r8 = u + r10; r10 = u - r10;
+    t = KERN(barrett)(r10 * 2753);
+    r10 = t;
+    u = r9; r9 = u + r11; r11 = u - r11;
+    t = KERN(barrett)(r11 * 2753);
+    r11 = t;
+    u = r12; r12 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * 3654);
+    r14 = t;
+    u = r13; r13 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * 3654);
+    r15 = t;
+    u = r16; r16 = u + r18; r18 = u - r18;
+    t = KERN(barrett)(r18 * -2645);
+    r18 = t;
+    u = r17; r17 = u + r19; r19 = u - r19;
+    t = KERN(barrett)(r19 * -2645);
+    r19 = t;
+    u = r20; r20 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -330);
+    r22 = t;
+    u = r21; r21 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -330);
+    r23 = t;
+    u = r24; r24 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -2273);
+    r26 = t;
+    u = r25; r25 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -2273);
+    r27 = t;
+    u = r28; r28 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * 878);
+    r30 = t;
+    u = r29; r29 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * 878);
+    r31 = t;
+    u = r32; r32 = u + r34; r34 = u - r34;
+    t = KERN(barrett)(r34 * -1286);
+    r34 = t;
+    u = r33; r33 = u + r35; r35 = u - r35;
+    t = KERN(barrett)(r35 * -1286);
+    r35 = t;
+    u = r36; r36 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * 3092);
+    r38 = t;
+    u = r37; r37 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * 3092);
+    r39 = t;
+    u = r40; r40 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * 675);
+    r42 = t;
+    u = r41; r41 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * 675);
+    r43 = t;
+    u = r44; r44 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * -2268);
+    r46 = t;
+    u = r45; r45 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * -2268);
+    r47 = t;
+    u = r48; r48 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * 1112);
+    r50 = t;
+    u = r49; r49 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * 1112);
+    r51 = t;
+    u = r52; r52 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * 1794);
+    r54 = t;
+    u = r53; r53 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * 1794);
+    r55 = t;
+    u = r56; r56 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 3000);
+    r58 = t;
+    u = r57; r57 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 3000);
+    r59 = t;
+    u = r60; r60 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * -2399);
+    r62 = t;
+    u = r61; r61 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -2399);
+    r63 = t;
+
+    // 第 2 層 (t = 4)，輸入 |r| <= 65536
+    u = r0; r0 = u + r4; r4 = u - r4;
+    t = KERN(barrett)(r4 * 2648);
+    r4 = t;
+    u = r1; r1 = u + r5; r5 = u - r5;
+    t = KERN(barrett)(r5 * 2648);
+    r5 = t;
+    u = r2; r2 = u + r6; r6 = u - r6;
+    t = KERN(barrett)(r6 * 2648);
+    r6 = t;
+    u = r3; r3 = u + r7; r7 = u - r7;
+    t = KERN(barrett)(r7 * 2648);
+    r7 = t;
+    u = r8; r8 = u + r12; r12 = u - r12;
+    t = KERN(barrett)(r12 * -2138);
+    r12 = t;
+    u = r9; r9 = u + r13; r13 = u - r13;
+    t = KERN(barrett)(r13 * -2138);
+    r13 = t;
+    u = r10; r10 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * -2138);
+    r14 = t;
+    u = r11; r11 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * -2138);
+    r15 = t;
+    u = r16; r16 = u + r20; r20 = u - r20;
+    t = KERN(barrett)(r20 * -1366);
+    r20 = t;
+    u = r17; r17 = u + r21; r21 = u - r21;
+    t = KERN(barrett)(r21 * -1366);
+    r21 = t;
+    u = r18; r18 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -1366);
+    r22 = t;
+    u = r19; r19 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -1366);
+    r23 = t;
+    u = r24; r24 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -2784);
+    r28 = t;
+    u = r25; r25 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -2784);
+    r29 = t;
+    u = r26; r26 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -2784);
+    r30 = t;
+    u = r27; r27 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -2784);
+    r31 = t;
+    u = r32; r32 = u + r36; r36 = u - r36;
+    t = KERN(barrett)(r36 * 2381);
+    r36 = t;
+    u = r33; r33 = u + r37; r37 = u - r37;
+    t = KERN(barrett)(r37 * 2381);
+    r37 = t;
+    u = r34; r34 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * 2381);
+    r38 = t;
+    u = r35; r35 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * 2381);
+    r39 = t;
+    u = r40; r40 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * 2446);
+    r44 = t;
+    u = r41; r41 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 2446);
+    r45 = t;
+    u = r42; r42 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * 2446);
+    r46 = t;
+    u = r43; r43 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * 2446);
+    r47 = t;
+    u = r48; r48 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * -97);
+    r52 = t;
+    u = r49; r49 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * -97);
+    r53 = t;
+    u = r50; r50 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * -97);
+    r54 = t;
+    u = r51; r51 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * -97);
+    r55 = t;
+    u = r56; r56 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * -2132);
+    r60 = t;
+    u = r57; r57 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * -2132);
+    r61 = t;
+    u = r58; r58 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * -2132);
+    r62 = t;
+    u = r59; r59 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -2132);
+    r63 = t;
+
+    // 第 3 層 (t = 8)，輸入 |r| <= 131072
+    u = r0; r0 = u + r8; r8 = u - r8;
+    t = KERN(barrett)(r8 * -849);
+    r8 = t;
+    u = r1; r1 = u + r9; r9 = u - r9;
+    t = KERN(barrett)(r9 * -849);
+    r9 = t;
+    u = r2; r2 = u + r10; r10 = u - r10;
+    t = KERN(barrett)(r10 * -849);
+    r10 = t;
+    u = r3; r3 = u + r11; r11 = u - r11;
+    t = KERN(barrett)(r11 * -849);
+    r11 = t;
+    u = r4; r4 = u + r12; r12 = u - r12;
+    t = KERN(barrett)(r12 * -849);
+    r12 = t;
+    u = r5; r5 = u + r13; r13 = u - r13;
+    t = KERN(barrett)(r13 * -849);
+    r13 = t;
+    u = r6; r6 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * -849);
+    r14 = t;
+    u = r7; r7 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * -849);
+    r15 = t;
+    u = r16; r16 = u + r24; r24 = u - r24;
+    t = KERN(barrett)(r24 * -527);
+    r24 = t;
+    u = r17; r17 = u + r25; r25 = u - r25;
+    t = KERN(barrett)(r25 * -527);
+    r25 = t;
+    u = r18; r18 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -527);
+    r26 = t;
+    u = r19; r19 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -527);
+    r27 = t;
+    u = r20; r20 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -527);
+    r28 = t;
+    u = r21; r21 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -527);
+    r29 = t;
+    u = r22; r22 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -527);
+    r30 = t;
+    u = r23; r23 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -527);
+    r31 = t;
+    u = r32; r32 = u + r40; r40 = u - r40;
+    t = KERN(barrett)(r40 * 583);
+    r40 = t;
+    u = r33; r33 = u + r41; r41 = u - r41;
+    t = KERN(barrett)(r41 * 583);
+    r41 = t;
+    u = r34; r34 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * 583);
+    r42 = t;
+    u = r35; r35 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * 583);
+    r43 = t;
+    u = r36; r36 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * 583);
+    r44 = t;
+    u = r37; r37 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 583);
+    r45 = t;
+    u = r38; r38 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * 583);
+    r46 = t;
+    u = r39; r39 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * 583);
+    r47 = t;
+    u = r48; r48 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * 1728);
+    r56 = t;
+    u = r49; r49 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 1728);
+    r57 = t;
+    u = r50; r50 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 1728);
+    r58 = t;
+    u = r51; r51 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 1728);
+    r59 = t;
+    u = r52; r52 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * 1728);
+    r60 = t;
+    u = r53; r53 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 1728);
+    r61 = t;
+    u = r54; r54 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * 1728);
+    r62 = t;
+    u = r55; r55 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * 1728);
+    r63 = t;
+
+    // 第 4 層 (t = 16)，輸入 |r| <= 262144
+    u = r0; r0 = u + r16; r16 = u - r16;
+    t = KERN(barrett)(r16 * -1213);
+    r16 = t;
+    u = r1; r1 = u + r17; r17 = u - r17;
+    t = KERN(barrett)(r17 * -1213);
+    r17 = t;
+    u = r2; r2 = u + r18; r18 = u - r18;
+    t = KERN(barrett)(r18 * -1213);
+    r18 = t;
+    u = r3; r3 = u + r19; r19 = u - r19;
+    t = KERN(barrett)(r19 * -1213);
+    r19 = t;
+    u = r4; r4 = u + r20; r20 = u - r20;
+    t = KERN(barrett)(r20 * -1213);
+    r20 = t;
+    u = r5; r5 = u + r21; r21 = u - r21;
+    t = KERN(barrett)(r21 * -1213);
+    r21 = t;
+    u = r6; r6 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -1213);
+    r22 = t;
+    u = r7; r7 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -1213);
+    r23 = t;
+    u = r8; r8 = u + r24; r24 = u - r24;
+    t = KERN(barrett)(r24 * -1213);
+    r24 = t;
+    u = r9; r9 = u + r25; r25 = u - r25;
+    t = KERN(barrett)(r25 * -1213);
+    r25 = t;
+    u = r10; r10 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -1213);
+    r26 = t;
+    u = r11; r11 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -1213);
+    r27 = t;
+    u = r12; r12 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -1213);
+    r28 = t;
+    u = r13; r13 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -1213);
+    r29 = t;
+    u = r14; r14 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -1213);
+    r30 = t;
+    u = r15; r15 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -1213);
+    r31 = t;
+    u = r32; r32 = u + r48; r48 = u - r48;
+    t = KERN(barrett)(r48 * 1925);
+    r48 = t;
+    u = r33; r33 = u + r49; r49 = u - r49;
+    t = KERN(barrett)(r49 * 1925);
+    r49 = t;
+    u = r34; r34 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * 1925);
+    r50 = t;
+    u = r35; r35 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * 1925);
+    r51 = t;
+    u = r36; r36 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * 1925);
+    r52 = t;
+    u = r37; r37 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * 1925);
+    r53 = t;
+    u = r38; r38 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * 1925);
+    r54 = t;
+    u = r39; r39 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * 1925);
+    r55 = t;
+    u = r40; r40 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * 1925);
+    r56 = t;
+    u = r41; r41 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 1925);
+    r57 = t;
+    u = r42; r42 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 1925);
+    r58 = t;
+    u = r43; r43 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 1925);
+    r59 = t;
+    u = r44; r44 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * 1925);
+    r60 = t;
+    u = r45; r45 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 1925);
+    r61 = t;
+    u = r46; r46 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * 1925);
+    r62 = t;
+    u = r47; r47 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * 1925);
+    r63 = t;
+
+    // 第 5 層 (t = 32)，輸入 |r| <= 524288
+    u = r0; r0 = u + r32; r32 = u - r32;
+    r32 = KERN(barrett)(r32);
+    t = KERN(barrett)(r32 * -2266);
+    r32 = t;
+    t = KERN(barrett)(r0 * -240);
+    r0 = t;
+    u = r1; r1 = u + r33; r33 = u - r33;
+    r33 = KERN(barrett)(r33);
+    t = KERN(barrett)(r33 * -2266);
+    r33 = t;
+    t = KERN(barrett)(r1 * -240);
+    r1 = t;
+    u = r2; r2 = u + r34; r34 = u - r34;
+    t = KERN(barrett)(r34 * -2266);
+    r34 = t;
+    t = KERN(barrett)(r2 * -240);
+    r2 = t;
+    u = r3; r3 = u + r35; r35 = u - r35;
+    t = KERN(barrett)(r35 * -2266);
+    r35 = t;
+    t = KERN(barrett)(r3 * -240);
+    r3 = t;
+    u = r4; r4 = u + r36; r36 = u - r36;
+    t = KERN(barrett)(r36 * -2266);
+    r36 = t;
+    t = KERN(barrett)(r4 * -240);
+    r4 = t;
+    u = r5; r5 = u + r37; r37 = u - r37;
+    t = KERN(barrett)(r37 * -2266);
+    r37 = t;
+    t = KERN(barrett)(r5 * -240);
+    r5 = t;
+    u = r6; r6 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * -2266);
+    r38 = t;
+    t = KERN(barrett)(r6 * -240);
+    r6 = t;
+    u = r7; r7 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * -2266);
+    r39 = t;
+    t = KERN(barrett)(r7 * -240);
+    r7 = t;
+    u = r8; r8 = u + r40; r40 = u - r40;
+    t = KERN(barrett)(r40 * -2266);
+    r40 = t;
+    t = KERN(barrett)(r8 * -240);
+    r8 = t;
+    u = r9; r9 = u + r41; r41 = u - r41;
+    t = KERN(barrett)(r41 * -2266);
+    r41 = t;
+    t = KERN(barrett)(r9 * -240);
+    r9 = t;
+    u = r10; r10 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * -2266);
+    r42 = t;
+    t = KERN(barrett)(r10 * -240);
+    r10 = t;
+    u = r11; r11 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * -2266);
+    r43 = t;
+    t = KERN(barrett)(r11 * -240);
+    r11 = t;
+    u = r12; r12 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * -2266);
+    r44 = t;
+    t = KERN(barrett)(r12 * -240);
+    r12 = t;
+    u = r13; r13 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * -2266);
+    r45 = t;
+    t = KERN(barrett)(r13 * -240);
+    r13 = t;
+    u = r14; r14 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * -2266);
+    r46 = t;
+    t = KERN(barrett)(r14 * -240);
+    r14 = t;
+    u = r15; r15 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * -2266);
+    r47 = t;
+    t = KERN(barrett)(r15 * -240);
+    r15 = t;
+    u = r16; r16 = u + r48; r48 = u - r48;
+    t = KERN(barrett)(r48 * -2266);
+    r48 = t;
+    t = KERN(barrett)(r16 * -240);
+    r16 = t;
+    u = r17; r17 = u + r49; r49 = u - r49;
+    t = KERN(barrett)(r49 * -2266);
+    r49 = t;
+    t = KERN(barrett)(r17 * -240);
+    r17 = t;
+    u = r18; r18 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * -2266);
+    r50 = t;
+    t = KERN(barrett)(r18 * -240);
+    r18 = t;
+    u = r19; r19 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * -2266);
+    r51 = t;
+    t = KERN(barrett)(r19 * -240);
+    r19 = t;
+    u = r20; r20 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * -2266);
+    r52 = t;
+    t = KERN(barrett)(r20 * -240);
+    r20 = t;
+    u = r21; r21 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * -2266);
+    r53 = t;
+    t = KERN(barrett)(r21 * -240);
+    r21 = t;
+    u = r22; r22 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * -2266);
+    r54 = t;
+    t = KERN(barrett)(r22 * -240);
+    r22 = t;
+    u = r23; r23 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * -2266);
+    r55 = t;
+    t = KERN(barrett)(r23 * -240);
+    r23 = t;
+    u = r24; r24 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * -2266);
+    r56 = t;
+    t = KERN(barrett)(r24 * -240);
+    r24 = t;
+    u = r25; r25 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * -2266);
+    r57 = t;
+    t = KERN(barrett)(r25 * -240);
+    r25 = t;
+    u = r26; r26 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * -2266);
+    r58 = t;
+    t = KERN(barrett)(r26 * -240);
+    r26 = t;
+    u = r27; r27 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * -2266);
+    r59 = t;
+    t = KERN(barrett)(r27 * -240);
+    r27 = t;
+    u = r28; r28 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * -2266);
+    r60 = t;
+    t = KERN(barrett)(r28 * -240);
+    r28 = t;
+    u = r29; r29 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * -2266);
+    r61 = t;
+    t = KERN(barrett)(r29 * -240);
+    r29 = t;
+    u = r30; r30 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * -2266);
+    r62 = t;
+    t = KERN(barrett)(r30 * -240);
+    r30 = t;
+    u = r31; r31 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -2266);
+    r63 = t;
+    t = KERN(barrett)(r31 * -240);
+    r31 = t;
+
+    // 輸出化約，|r| <= 15361
+    p->coeffs[0] = KERN(canon)(r0);
+    p->coeffs[1] = KERN(canon)(r1);
+    p->coeffs[2] = KERN(canon)(r2);
+    p->coeffs[3] = KERN(canon)(r3);
+    p->coeffs[4] = KERN(canon)(r4);
+    p->coeffs[5] = KERN(canon)(r5);
+    p->coeffs[6] = KERN(canon)(r6);
+    p->coeffs[7] = KERN(canon)(r7);
+    p->coeffs[8] = KERN(canon)(r8);
+    p->coeffs[9] = KERN(canon)(r9);
+    p->coeffs[10] = KERN(canon)(r10);
+    p->coeffs[11] = KERN(canon)(r11);
+    p->coeffs[12] = KERN(canon)(r12);
+    p->coeffs[13] = KERN(canon)(r13);
+    p->coeffs[14] = KERN(canon)(r14);
+    p->coeffs[15] = KERN(canon)(r15);
+    p->coeffs[16] = KERN(canon)(r16);
+    p->coeffs[17] = KERN(canon)(r17);
+    p->coeffs[18] = KERN(canon)(r18);
+    p->coeffs[19] = KERN(canon)(r19);
+    p->coeffs[20] = KERN(canon)(r20);
+    p->coeffs[21] = KERN(canon)(r21);
+    p->coeffs[22] = KERN(canon)(r22);
+    p->coeffs[23] = KERN(canon)(r23);
+    p->coeffs[24] = KERN(canon)(r24);
+    p->coeffs[25] = KERN(canon)(r25);
+    p->coeffs[26] = KERN(canon)(r26);
+    p->coeffs[27] = KERN(canon)(r27);
+    p->coeffs[28] = KERN(canon)(r28);
+    p->coeffs[29] = KERN(canon)(r29);
+    p->coeffs[30] = KERN(canon)(r30);
+    p->coeffs[31] = KERN(canon)(r31);
+    p->coeffs[32] = KERN(canon)(r32);
+    p->coeffs[33] = KERN(canon)(r33);
+    p->coeffs[34] = KERN(canon)(r34);
+    p->coeffs[35] = KERN(canon)(r35);
+    p->coeffs[36] = KERN(canon)(r36);
+    p->coeffs[37] = KERN(canon)(r37);
+    p->coeffs[38] = KERN(canon)(r38);
+    p->coeffs[39] = KERN(canon)(r39);
+    p->coeffs[40] = KERN(canon)(r40);
+    p->coeffs[41] = KERN(canon)(r41);
+    p->coeffs[42] = KERN(canon)(r42);
+    p->coeffs[43] = KERN(canon)(r43);
+    p->coeffs[44] = KERN(canon)(r44);
+    p->coeffs[45] = KERN(canon)(r45);
+    p->coeffs[46] = KERN(canon)(r46);
+    p->coeffs[47] = KERN(canon)(r47);
+    p->coeffs[48] = KERN(canon)(r48);
+    p->coeffs[49] = KERN(canon)(r49);
+    p->coeffs[50] = KERN(canon)(r50);
+    p->coeffs[51] = KERN(canon)(r51);
+    p->coeffs[52] = KERN(canon)(r52);
+    p->coeffs[53] = KERN(canon)(r53);
+    p->coeffs[54] = KERN(canon)(r54);
+    p->coeffs[55] = KERN(canon)(r55);
+    p->coeffs[56] = KERN(canon)(r56);
+    p->coeffs[57] = KERN(canon)(r57);
+    p->coeffs[58] = KERN(canon)(r58);
+    p->coeffs[59] = KERN(canon)(r59);
+    p->coeffs[60] = KERN(canon)(r60);
+    p->coeffs[61] = KERN(canon)(r61);
+    p->coeffs[62] = KERN(canon)(r62);
+    p->coeffs[63] = KERN(canon)(r63);
+}
+
+#elif RUDRAKSH_NTT_LAYERS == 4
+
+// 正向 NTT (4 層，輸入自然順序 -> 輸出位元反轉)，輸入可為任意 int16，輸出在 [0, q)
+static void KERN(ntt)(poly *p) {
+    int32_t r0 = p->coeffs[0];
+    int32_t r1 = p->coeffs[1];
+    int32_t r2 = p->coeffs[2];
+    int32_t r3 = p->coeffs[3];
+    int32_t r4 = p->coeffs[4];
+    int32_t r5 = p->coeffs[5];
+    int32_t r6 = p->coeffs[6];
+    int32_t r7 = p->coeffs[7];
+    int32_t r8 = p->coeffs[8];
+    int32_t r9 = p->coeffs[9];
+    int32_t r10 = p->coeffs[10];
+    int32_t r11 = p->coeffs[11];
+    int32_t r12 = p->coeffs[12];
+    int32_t r13 = p->coeffs[13];
+    int32_t r14 = p->coeffs[14];
+    int32_t r15 = p->coeffs[15];
+    int32_t r16 = p->coeffs[16];
+    int32_t r17 = p->coeffs[17];
+    int32_t r18 = p->coeffs[18];
+    int32_t r19 = p->coeffs[19];
+    int32_t r20 = p->coeffs[20];
+    int32_t r21 = p->coeffs[21];
+    int32_t r22 = p->coeffs[22];
+    int32_t r23 = p->coeffs[23];
+    int32_t r24 = p->coeffs[24];
+    int32_t r25 = p->coeffs[25];
+    int32_t r26 = p->coeffs[26];
+    int32_t r27 = p->coeffs[27];
+    int32_t r28 = p->coeffs[28];
+    int32_t r29 = p->coeffs[29];
+    int32_t r30 = p->coeffs[30];
+    int32_t r31 = p->coeffs[31];
+    int32_t r32 = p->coeffs[32];
+    int32_t r33 = p->coeffs[33];
+    int32_t r34 = p->coeffs[34];
+    int32_t r35 = p->coeffs[35];
+    int32_t r36 = p->coeffs[36];
+    int32_t r37 = p->coeffs[37];
+    int32_t r38 = p->coeffs[38];
+    int32_t r39 = p->coeffs[39];
+    int32_t r40 = p->coeffs[40];
+    int32_t r41 = p->coeffs[41];
+    int32_t r42 = p->coeffs[42];
+    int32_t r43 = p->coeffs[43];
+    int32_t r44 = p->coeffs[44];
+    int32_t r45 = p->coeffs[45];
+    int32_t r46 = p->coeffs[46];
+    int32_t r47 = p->coeffs[47];
+    int32_t r48 = p->coeffs[48];
+    int32_t r49 = p->coeffs[49];
+    int32_t r50 = p->coeffs[50];
+    int32_t r51 = p->coeffs[51];
+    int32_t r52 = p->coeffs[52];
+    int32_t r53 = p->coeffs[53];
+    int32_t r54 = p->coeffs[54];
+    int32_t r55 = p->coeffs[55];
+    int32_t r56 = p->coeffs[56];
+    int32_t r57 = p->coeffs[57];
+    int32_t r58 = p->coeffs[58];
+    int32_t r59 = p->coeffs[59];
+    int32_t r60 = p->coeffs[60];
+    int32_t r61 = p->coeffs[61];
+    int32_t r62 = p->coeffs[62];
+    int32_t r63 = p->coeffs[63];
+    int32_t t;
+
+    // 第 1 層 (t = 32)，輸入 |r| <= 32768
+    t = KERN(barrett)(r32 * 3383);
+    r32 = r0 - t; r0 += t;
+    t = KERN(barrett)(r33 * 3383);
+    r33 = r1 - t; r1 += t;
+    t = KERN(barrett)(r34 * 3383);
+    r34 = r2 - t; r2 += t;
+    t = KERN(barrett)(r35 * 3383);
+    r35 = r3 - t; r3 += t;
+    t = KERN(barrett)(r36 * 3383);
+    r36 = r4 - t; r4 += t;
+    t = KERN(barrett)(r37 * 3383);
+    r37 = r5 - t; r5 += t;
+    t = KERN(barrett)(r38 * 3383);
+    r38 = r6 - t; r6 += t;
+    t = KERN(barrett)(r39 * 3383);
+    r39 = r7 - t; r7 += t;
+    t = KERN(barrett)(r40 * 3383);
+    r40 = r8 - t; r8 += t;
+    t = KERN(barrett)(r41 * 3383);
+    r41 = r9 - t; r9 += t;
+    t = KERN(barrett)(r42 * 3383);
+    r42 = r10 - t; r10 += t;
+    t = KERN(barrett)(r43 * 3383);
+    r43 = r11 - t; r11 += t;
+    t = KERN(barrett)(r44 * 3383);
+    r44 = r12 - t; r12 += t;
+    t = KERN(barrett)(r45 * 3383);
+    r45 = r13 - t; r13 += t;
+    t = KERN(barrett)(r46 * 3383);
+    r46 = r14 - t; r14 += t;
+    t = KERN(barrett)(r47 * 3383);
+    r47 = r15 - t; r15 += t;
+    t = KERN(barrett)(r48 * 3383);
+    r48 = r16 - t; r16 += t;
+    t = KERN(barrett)(r49 * 3383);
+    r49 = r17 - t; r17 += t;
+    t = KERN(barrett)(r50 * 3383);
+    r50 = r18 - t; r18 += t;
+    t = KERN(barrett)(r51 * 3383);
+    r51 = r19 - t; r19 += t;
+    t = KERN(barrett)(r52 * 3383);
+    r52 = r20 - t; r20 += t;
+    t = KERN(barrett)(r53 * 3383);
+    r53 = r21 - t; r21 += t;
+    t = KERN(barrett)(r54 * 3383);
+    r54 = r22 - t; r22 += t;
+    t = KERN(barrett)(r55 * 3383);
+    r55 = r23 - t; r23 += t;
+    t = KERN(barrett)(r56 * 3383);
+    r56 = r24 - t; r24 += t;
+    t = KERN(barrett)(r57 * 3383);
+    r57 = r25 - t; r25 += t;
+    t = KERN(barrett)(r58 * 3383);
+    r58 = r26 - t; r26 += t;
+    t = KERN(barrett)(r59 * 3383);
+    r59 = r27 - t; r27 += t;
+    t = KERN(barrett)(r60 * 3383);
+    r60 = r28 - t; r28 += t;
+    t = KERN(barrett)(r61 * 3383);
+    r61 = r29 - t; r29 += t;
+    t = KERN(barrett)(r62 * 3383);
+    r62 = r30 - t; r30 += t;
+    t = KERN(barrett)(r63 * 3383);
+    r63 = r31 - t; r31 += t;
+
+    // 第 2 層 (t = 16)，輸入 |r| <= 48129
+    t = KERN(barrett)(r16 * -1925);
+    r16 = r0 - t; r0 += t;
+    t = KERN(barrett)(r17 * -1925);
+    r17 = r1 - t; r1 += t;
+    t = KERN(barrett)(r18 * -1925);
+    r18 = r2 - t; r2 += t;
+    t = KERN(barrett)(r19 * -1925);
+    r19 = r3 - t; r3 += t;
+    t = KERN(barrett)(r20 * -1925);
+    r20 = r4 - t; r4 += t;
+    t = KERN(barrett)(r21 * -1925);
+    r21 = r5 - t; r5 += t;
+    t = KERN(barrett)(r22 * -1925);
+    r22 = r6 - t; r6 += t;
+    t = KERN(barrett)(r23 * -1925);
+    r23 = r7 - t; r7 += t;
+    t = KERN(barrett)(r24 * -1925);
+    r24 = r8 - t; r8 += t;
+    t = KERN(barrett)(r25 * -1925);
+    r25 = r9 - t; r9 += t;
+    t = KERN(barrett)(r26 * -1925);
+    r26 = r10 - t; r10 += t;
+    t = KERN(barrett)(r27 * -1925);
+    r27 = r11 - t; r11 += t;
+    t = KERN(barrett)(r28 * -1925);
+    r28 = r12 - t; r12 += t;
+    t = KERN(barrett)(r29 * -1925);
+    r29 = r13 - t; r13 += t;
+    t = KERN(barrett)(r30 * -1925);
+    r30 = r14 - t; r14 += t;
+    t = KERN(barrett)(r31 * -1925);
+    r31 = r15 - t; r15 += t;
+    t = KERN(barrett)(r48 * 1213);
+    r48 = r32 - t; r32 += t;
+    t = KERN(barrett)(r49 * 1213);
+    r49 = r33 - t; r33 += t;
+    t = KERN(barrett)(r50 * 1213);
+    r50 = r34 - t; r34 += t;
+    t = KERN(barrett)(r51 * 1213);
+    r51 = r35 - t; r35 += t;
+    t = KERN(barrett)(r52 * 1213);
+    r52 = r36 - t; r36 += t;
+    t = KERN(barrett)(r53 * 1213);
+    r53 = r37 - t; r37 += t;
+    t = KERN(barrett)(r54 * 1213);
+    r54 = r38 - t; r38 += t;
+    t = KERN(barrett)(r55 * 1213);
+    r55 = r39 - t; r39 += t;
+    t = KERN(barrett)(r56 * 1213);
+    r56 = r40 - t; r40 += t;
+    t = KERN(barrett)(r57 * 1213);
+    r57 = r41 - t; r41 += t;
+    t = KERN(barrett)(r58 * 1213);
+    r58 = r42 - t; r42 += t;
+    t = KERN(barrett)(r59 * 1213);
+    r59 = r43 - t; r43 += t;
+    t = KERN(barrett)(r60 * 1213);
+    r60 = r44 - t; r44 += t;
+    t = KERN(barrett)(r61 * 1213);
+    r61 = r45 - t; r45 += t;
+    t = KERN(barrett)(r62 * 1213);
+    r62 = r46 - t; r46 += t;
+    t = KERN(barrett)(r63 * 1213);
+    r63 = r47 - t; r47 += t;
+
+    // 第 3 層 (t = 8)，輸入 |r| <= 63490
+    t = KERN(barrett)(r8 * -1728);
+    r8 = r0 - t; r0 += t;
+    t = KERN(barrett)(r9 * -1728);
+    r9 = r1 - t; r1 += t;
+    t = KERN(barrett)(r10 * -1728);
+    r10 = r2 - t; r2 += t;
+    t = KERN(barrett)(r11 * -1728);
+    r11 = r3 - t; r3 += t;
+    t = KERN(barrett)(r12 * -1728);
+    r12 = r4 - t; r4 += t;
+    t = KERN(barrett)(r13 * -1728);
+    r13 = r5 - t; r5 += t;
+    t = KERN(barrett)(r14 * -1728);
+    r14 = r6 - t; r6 += t;
+    t = KERN(barrett)(r15 * -1728);
+    r15 = r7 - t; r7 += t;
+    t = KERN(barrett)(r24 * -583);
+    r24 = r16 - t; r16 += t;
+    t = KERN(barrett)(r25 * -583);
+    r25 = r17 - t; r17 += t;
+    t = KERN(barrett)(r26 * -583);
+    r26 = r18 - t; r18 += t;
+    t = KERN(barrett)(r27 * -583);
+    r27 = r19 - t; r19 += t;
+    t = KERN(barrett)(r28 * -583);
+    r28 = r20 - t; r20 += t;
+    t = KERN(barrett)(r29 * -583);
+    r29 = r21 - t; r21 += t;
+    t = KERN(barrett)(r30 * -583);
+    r30 = r22 - t; r22 += t;
+    t = KERN(barrett)(r31 * -583);
+    r31 = r23 - t; r23 += t;
+    t = KERN(barrett)(r40 * 527);
+    r40 = r32 - t; r32 += t;
+    t = KERN(barrett)(r41 * 527);
+    r41 = r33 - t; r33 += t;
+    t = KERN(barrett)(r42 * 527);
+    r42 = r34 - t; r34 += t;
+    t = KERN(barrett)(r43 * 527);
+    r43 = r35 - t; r35 += t;
+    t = KERN(barrett)(r44 * 527);
+    r44 = r36 - t; r36 += t;
+    t = KERN(barrett)(r45 * 527);
+    r45 = r37 - t; r37 += t;
+    t = KERN(barrett)(r46 * 527);
+    r46 = r38 - t; r38 += t;
+    t = KERN(barrett)(r47 * 527);
+    r47 = r39 - t; r39 += t;
+    t = KERN(barrett)(r56 * 849);
+    r56 = r48 - t; r48 += t;
+    t = KERN(barrett)(r57 * 849);
+    r57 = r49 - t; r49 += t;
+    t = KERN(barrett)(r58 * 849);
+    r58 = r50 - t; r50 += t;
+    t = KERN(barrett)(r59 * 849);
+    r59 = r51 - t; r51 += t;
+    t = KERN(barrett)(r60 * 849);
+    r60 = r52 - t; r52 += t;
+    t = KERN(barrett)(r61 * 849);
+    r61 = r53 - t; r53 += t;
+    t = KERN(barrett)(r62 * 849);
+    r62 = r54 - t; r54 += t;
+    t = KERN(barrett)(r63 * 849);
+    r63 = r55 - t; r55 += t;
+
+    // 第 4 層 (t = 4)，輸入 |r| <= 78851
+    t = KERN(barrett)(r4 * 2132);
+    r4 = r0 - t; r0 += t;
+    t = KERN(barrett)(r5 * 2132);
+    r5 = r1 - t; r1 += t;
+    t = KERN(barrett)(r6 * 2132);
+    r6 = r2 - t; r2 += t;
+    t = KERN(barrett)(r7 * 2132);
+    r7 = r3 - t; r3 += t;
+    t = KERN(barrett)(r12 * 97);
+    r12 = r8 - t; r8 += t;
+    t = KERN(barrett)(r13 * 97);
+    r13 = r9 - t; r9 += t;
+    t = KERN(barrett)(r14 * 97);
+    r14 = r10 - t; r10 += t;
+    t = KERN(barrett)(r15 * 97);
+    r15 = r11 - t; r11 += t;
+    t = KERN(barrett)(r20 * -2446);
+    r20 = r16 - t; r16 += t;
+    t = KERN(barrett)(r21 * -2446);
+    r21 = r17 - t; r17 += t;
+    t = KERN(barrett)(r22 * -2446);
+    r22 = r18 - t; r18 += t;
+    t = KERN(barrett)(r23 * -2446);
+    r23 = r19 - t; r19 += t;
+    t = KERN(barrett)(r28 * -2381);
+    r28 = r24 - t; r24 += t;
+    t = KERN(barrett)(r29 * -2381);
+    r29 = r25 - t; r25 += t;
+    t = KERN(barrett)(r30 * -2381);
+    r30 = r26 - t; r26 += t;
+    t = KERN(barrett)(r31 * -2381);
+    r31 = r27 - t; r27 += t;
+    t = KERN(barrett)(r36 * 2784);
+    r36 = r32 - t; r32 += t;
+    t = KERN(barrett)(r37 * 2784);
+    r37 = r33 - t; r33 += t;
+    t = KERN(barrett)(r38 * 2784);
+    r38 = r34 - t; r34 += t;
+    t = KERN(barrett)(r39 * 2784);
+    r39 = r35 - t; r35 += t;
+    t = KERN(barrett)(r44 * 1366);
+    r44 = r40 - t; r40 += t;
+    t = KERN(barrett)(r45 * 1366);
+    r45 = r41 - t; r41 += t;
+    t = KERN(barrett)(r46 * 1366);
+    r46 = r42 - t; r42 += t;
+    t = KERN(barrett)(r47 * 1366);
+    r47 = r43 - t; r43 += t;
+    t = KERN(barrett)(r52 * 2138);
+    r52 = r48 - t; r48 += t;
+    t = KERN(barrett)(r53 * 2138);
+    r53 = r49 - t; r49 += t;
+    t = KERN(barrett)(r54 * 2138);
+    r54 = r50 - t; r50 += t;
+    t = KERN(barrett)(r55 * 2138);
+    r55 = r51 - t; r51 += t;
+    t = KERN(barrett)(r60 * -2648);
+    r60 = r56 - t; r56 += t;
+    t = KERN(barrett)(r61 * -2648);
+    r61 = r57 - t; r57 += t;
+    t = KERN(barrett)(r62 * -2648);
+    r62 = r58 - t; r58 += t;
+    t = KERN(barrett)(r63 * -2648);
+    r63 = r59 - t; r59 += t;
+
+    // 輸出化約，|r| <= 94212
+    r0 = KERN(barrett)(r0);
+    r1 = KERN(barrett)(r1);
+    r2 = KERN(barrett)(r2);
+    r3 = KERN(barrett)(r3);
+    r4 = KERN(barrett)(r4);
+    r5 = KERN(barrett)(r5);
+    r6 = KERN(barrett)(r6);
+    r7 = KERN(barrett)(r7);
+    r8 = KERN(barrett)(r8);
+    r9 = KERN(barrett)(r9);
+    r10 = KERN(barrett)(r10);
+    r11 = KERN(barrett)(r11);
+    r12 = KERN(barrett)(r12);
+    r13 = KERN(barrett)(r13);
+    r14 = KERN(barrett)(r14);
+    r15 = KERN(barrett)(r15);
+    r16 = KERN(barrett)(r16);
+    r17 = KERN(barrett)(r17);
+    r18 = KERN(barrett)(r18);
+    r19 = KERN(barrett)(r19);
+    r20 = KERN(barrett)(r20);
+    r21 = KERN(barrett)(r21);
+    r22 = KERN(barrett)(r22);
+    r23 = KERN(barrett)(r23);
+    r24 = KERN(barrett)(r24);
+    r25 = KERN(barrett)(r25);
+    r26 = KERN(barrett)(r26);
+    r27 = KERN(barrett)(r27);
+    r28 = KERN(barrett)(r28);
+    r29 = KERN(barrett)(r29);
+    r30 = KERN(barrett)(r30);
+    r31 = KERN(barrett)(r31);
+    r32 = KERN(barrett)(r32);
+    r33 = KERN(barrett)(r33);
+    r34 = KERN(barrett)(r34);
+    r35 = KERN(barrett)(r35);
+    r36 = KERN(barrett)(r36);
+    r37 = KERN(barrett)(r37);
+    r38 = KERN(barrett)(r38);
+    r39 = KERN(barrett)(r39);
+    r40 = KERN(barrett)(r40);
+    r41 = KERN(barrett)(r41);
+    r42 = KERN(barrett)(r42);
+    r43 = KERN(barrett)(r43);
+    r44 = KERN(barrett)(r44);
+    r45 = KERN(barrett)(r45);
+    r46 = KERN(barrett)(r46);
+    r47 = KERN(barrett)(r47);
+    r48 = KERN(barrett)(r48);
+    r49 = KERN(barrett)(r49);
+    r50 = KERN(barrett)(r50);
+    r51 = KERN(barrett)(r51);
+    r52 = KERN(barrett)(r52);
+    r53 = KERN(barrett)(r53);
+    r54 = KERN(barrett)(r54);
+    r55 = KERN(barrett)(r55);
+    r56 = KERN(barrett)(r56);
+    r57 = KERN(barrett)(r57);
+    r58 = KERN(barrett)(r58);
+    r59 = KERN(barrett)(r59);
+    r60 = KERN(barrett)(r60);
+    r61 = KERN(barrett)(r61);
+    r62 = KERN(barrett)(r62);
+    r63 = KERN(barrett)(r63);
+    p->coeffs[0] = KERN(canon)(r0);
+    p->coeffs[1] = KERN(canon)(r1);
+    p->coeffs[2] = KERN(canon)(r2);
+    p->coeffs[3] = KERN(canon)(r3);
+    p->coeffs[4] = KERN(canon)(r4);
+    p->coeffs[5] = KERN(canon)(r5);
+    p->coeffs[6] = KERN(canon)(r6);
+    p->coeffs[7] = KERN(canon)(r7);
+    p->coeffs[8] = KERN(canon)(r8);
+    p->coeffs[9] = KERN(canon)(r9);
+    p->coeffs[10] = KERN(canon)(r10);
+    p->coeffs[11] = KERN(canon)(r11);
+    p->coeffs[12] = KERN(canon)(r12);
+    p->coeffs[13] = KERN(canon)(r13);
+    p->coeffs[14] = KERN(canon)(r14);
+    p->coeffs[15] = KERN(canon)(r15);
+    p->coeffs[16] = KERN(canon)(r16);
+    p->coeffs[17] = KERN(canon)(r17);
+    p->coeffs[18] = KERN(canon)(r18);
+    p->coeffs[19] = KERN(canon)(r19);
+    p->coeffs[20] = KERN(canon)(r20);
+    p->coeffs[21] = KERN(canon)(r21);
+    p->coeffs[22] = KERN(canon)(r22);
+    p->coeffs[23] = KERN(canon)(r23);
+    p->coeffs[24] = KERN(canon)(r24);
+    p->coeffs[25] = KERN(canon)(r25);
+    p->coeffs[26] = KERN(canon)(r26);
+    p->coeffs[27] = KERN(canon)(r27);
+    p->coeffs[28] = KERN(canon)(r28);
+    p->coeffs[29] = KERN(canon)(r29);
+    p->coeffs[30] = KERN(canon)(r30);
+    p->coeffs[31] = KERN(canon)(r31);
+    p->coeffs[32] = KERN(canon)(r32);
+    p->coeffs[33] = KERN(canon)(r33);
+    p->coeffs[34] = KERN(canon)(r34);
+    p->coeffs[35] = KERN(canon)(r35);
+    p->coeffs[36] = KERN(canon)(r36);
+    p->coeffs[37] = KERN(canon)(r37);
+    p->coeffs[38] = KERN(canon)(r38);
+    p->coeffs[39] = KERN(canon)(r39);
+    p->coeffs[40] = KERN(canon)(r40);
+    p->coeffs[41] = KERN(canon)(r41);
+    p->coeffs[42] = KERN(canon)(r42);
+    p->coeffs[43] = KERN(canon)(r43);
+    p->coeffs[44] = KERN(canon)(r44);
+    p->coeffs[45] = KERN(canon)(r45);
+    p->coeffs[46] = KERN(canon)(r46);
+    p->coeffs[47] = KERN(canon)(r47);
+    p->coeffs[48] = KERN(canon)(r48);
+    p->coeffs[49] = KERN(canon)(r49);
+    p->coeffs[50] = KERN(canon)(r50);
+    p->coeffs[51] = KERN(canon)(r51);
+    p->coeffs[52] = KERN(canon)(r52);
+    p->coeffs[53] = KERN(canon)(r53);
+    p->coeffs[54] = KERN(canon)(r54);
+    p->coeffs[55] = KERN(canon)(r55);
+    p->coeffs[56] = KERN(canon)(r56);
+    p->coeffs[57] = KERN(canon)(r57);
+    p->coeffs[58] = KERN(canon)(r58);
+    p->coeffs[59] = KERN(canon)(r59);
+    p->coeffs[60] = KERN(canon)(r60);
+    p->coeffs[61] = KERN(canon)(r61);
+    p->coeffs[62] = KERN(canon)(r62);
+    p->coeffs[63] = KERN(canon)(r63);
+}
+
+// 同 ntt，輸出同時寫到頻率優先佈局 (out 指向該多項式在第 0 個 tile 的起點，stride 為相鄰 tile 的距離)
+static void KERN(ntt_fm)(poly *p, int16_t *out, size_t stride) {
+    int32_t r0 = p->coeffs[0];
+    int32_t r1 = p->coeffs[1];
+    int32_t r2 = p->coeffs[2];
+    int32_t r3 = p->coeffs[3];
+    int32_t r4 = p->coeffs[4];
+    int32_t r5 = p->coeffs[5];
+    int32_t r6 = p->coeffs[6];
+    int32_t r7 = p->coeffs[7];
+    int32_t r8 = p->coeffs[8];
+    int32_t r9 = p->coeffs[9];
+    int32_t r10 = p->coeffs[10];
+    int32_t r11 = p->coeffs[11];
+    int32_t r12 = p->coeffs[12];
+    int32_t r13 = p->coeffs[13];
+    int32_t r14 = p->coeffs[14];
+    int32_t r15 = p->coeffs[15];
+    int32_t r16 = p->coeffs[16];
+    int32_t r17 = p->coeffs[17];
+    int32_t r18 = p->coeffs[18];
+    int32_t r19 = p->coeffs[19];
+    int32_t r20 = p->coeffs[20];
+    int32_t r21 = p->coeffs[21];
+    int32_t r22 = p->coeffs[22];
+    int32_t r23 = p->coeffs[23];
+    int32_t r24 = p->coeffs[24];
+    int32_t r25 = p->coeffs[25];
+    int32_t r26 = p->coeffs[26];
+    int32_t r27 = p->coeffs[27];
+    int32_t r28 = p->coeffs[28];
+    int32_t r29 = p->coeffs[29];
+    int32_t r30 = p->coeffs[30];
+    int32_t r31 = p->coeffs[31];
+    int32_t r32 = p->coeffs[32];
+    int32_t r33 = p->coeffs[33];
+    int32_t r34 = p->coeffs[34];
+    int32_t r35 = p->coeffs[35];
+    int32_t r36 = p->coeffs[36];
+    int32_t r37 = p->coeffs[37];
+    int32_t r38 = p->coeffs[38];
+    int32_t r39 = p->coeffs[39];
+    int32_t r40 = p->coeffs[40];
+    int32_t r41 = p->coeffs[41];
+    int32_t r42 = p->coeffs[42];
+    int32_t r43 = p->coeffs[43];
+    int32_t r44 = p->coeffs[44];
+    int32_t r45 = p->coeffs[45];
+    int32_t r46 = p->coeffs[46];
+    int32_t r47 = p->coeffs[47];
+    int32_t r48 = p->coeffs[48];
+    int32_t r49 = p->coeffs[49];
+    int32_t r50 = p->coeffs[50];
+    int32_t r51 = p->coeffs[51];
+    int32_t r52 = p->coeffs[52];
+    int32_t r53 = p->coeffs[53];
+    int32_t r54 = p->coeffs[54];
+    int32_t r55 = p->coeffs[55];
+    int32_t r56 = p->coeffs[56];
+    int32_t r57 = p->coeffs[57];
+    int32_t r58 = p->coeffs[58];
+    int32_t r59 = p->coeffs[59];
+    int32_t r60 = p->coeffs[60];
+    int32_t r61 = p->coeffs[61];
+    int32_t r62 = p->coeffs[62];
+    int32_t r63 = p->coeffs[63];
+    int32_t t;
+
+    // 第 1 層 (t = 32)，輸入 |r| <= 32768
+    t = KERN(barrett)(r32 * 3383);
+    r32 = r0 - t; r0 += t;
+    t = KERN(barrett)(r33 * 3383);
+    r33 = r1 - t; r1 += t;
+    t = KERN(barrett)(r34 * 3383);
+    r34 = r2 - t; r2 += t;
+    t = KERN(barrett)(r35 * 3383);
+    r35 = r3 - t; r3 += t;
+    t = KERN(barrett)(r36 * 3383);
+    r36 = r4 - t; r4 += t;
+    t = KERN(barrett)(r37 * 3383);
+    r37 = r5 - t; r5 += t;
+    t = KERN(barrett)(r38 * 3383);
+    r38 = r6 - t; r6 += t;
+    t = KERN(barrett)(r39 * 3383);
+    r39 = r7 - t; r7 += t;
+    t = KERN(barrett)(r40 * 3383);
+    r40 = r8 - t; r8 += t;
+    t = KERN(barrett)(r41 * 3383);
+    r41 = r9 - t; r9 += t;
+    t = KERN(barrett)(r42 * 3383);
+    r42 = r10 - t; r10 += t;
+    t = KERN(barrett)(r43 * 3383);
+    r43 = r11 - t; r11 += t;
+    t = KERN(barrett)(r44 * 3383);
+    r44 = r12 - t; r12 += t;
+    t = KERN(barrett)(r45 * 3383);
+    r45 = r13 - t; r13 += t;
+    t = KERN(barrett)(r46 * 3383);
+    r46 = r14 - t; r14 += t;
+    t = KERN(barrett)(r47 * 3383);
+    r47 = r15 - t; r15 += t;
+    t = KERN(barrett)(r48 * 3383);
+    r48 = r16 - t; r16 += t;
+    t = KERN(barrett)(r49 * 3383);
+    r49 = r17 - t; r17 += t;
+    t = KERN(barrett)(r50 * 3383);
+    r50 = r18 - t; r18 += t;
+    t = KERN(barrett)(r51 * 3383);
+    r51 = r19 - t; r19 += t;
+    t = KERN(barrett)(r52 * 3383);
+    r52 = r20 - t; r20 += t;
+    t = KERN(barrett)(r53 * 3383);
+    r53 = r21 - t; r21 += t;
+    t = KERN(barrett)(r54 * 3383);
+    r54 = r22 - t; r22 += t;
+    t = KERN(barrett)(r55 * 3383);
+    r55 = r23 - t; r23 += t;
+    t = KERN(barrett)(r56 * 3383);
+    r56 = r24 - t; r24 += t;
+    t = KERN(barrett)(r57 * 3383);
+    r57 = r25 - t; r25 += t;
+    t = KERN(barrett)(r58 * 3383);
+    r58 = r26 - t; r26 += t;
+    t = KERN(barrett)(r59 * 3383);
+    r59 = r27 - t; r27 += t;
+    t = KERN(barrett)(r60 * 3383);
+    r60 = r28 - t; r28 += t;
+    t = KERN(barrett)(r61 * 3383);
+    r61 = r29 - t; r29 += t;
+    t = KERN(barrett)(r62 * 3383);
+    r62 = r30 - t; r30 += t;
+    t = KERN(barrett)(r63 * 3383);
+    r63 = r31 - t; r31 += t;
+
+    // 第 2 層 (t = 16)，輸入 |r| <= 48129
+    t = KERN(barrett)(r16 * -1925);
+    r16 = r0 - t; r0 += t;
+    t = KERN(barrett)(r17 * -1925);
+    r17 = r1 - t; r1 += t;
+    t = KERN(barrett)(r18 * -1925);
+    r18 = r2 - t; r2 += t;
+    t = KERN(barrett)(r19 * -1925);
+    r19 = r3 - t; r3 += t;
+    t = KERN(barrett)(r20 * -1925);
+    r20 = r4 - t; r4 += t;
+    t = KERN(barrett)(r21 * -1925);
+    r21 = r5 - t; r5 += t;
+    t = KERN(barrett)(r22 * -1925);
+    r22 = r6 - t; r6 += t;
+    t = KERN(barrett)(r23 * -1925);
+    r23 = r7 - t; r7 += t;
+    t = KERN(barrett)(r24 * -1925);
+    r24 = r8 - t; r8 += t;
+    t = KERN(barrett)(r25 * -1925);
+    r25 = r9 - t; r9 += t;
+    t = KERN(barrett)(r26 * -1925);
+    r26 = r10 - t; r10 += t;
+    t = KERN(barrett)(r27 * -1925);
+    r27 = r11 - t; r11 += t;
+    t = KERN(barrett)(r28 * -1925);
+    r28 = r12 - t; r12 += t;
+    t = KERN(barrett)(r29 * -1925);
+    r29 = r13 - t; r13 += t;
+    t = KERN(barrett)(r30 * -1925);
+    r30 = r14 - t; r14 += t;
+    t = KERN(barrett)(r31 * -1925);
+    r31 = r15 - t; r15 += t;
+    t = KERN(barrett)(r48 * 1213);
+    r48 = r32 - t; r32 += t;
+    t = KERN(barrett)(r49 * 1213);
+    r49 = r33 - t; r33 += t;
+    t = KERN(barrett)(r50 * 1213);
+    r50 = r34 - t; r34 += t;
+    t = KERN(barrett)(r51 * 1213);
+    r51 = r35 - t; r35 += t;
+    t = KERN(barrett)(r52 * 1213);
+    r52 = r36 - t; r36 += t;
+    t = KERN(barrett)(r53 * 1213);
+    r53 = r37 - t; r37 += t;
+    t = KERN(barrett)(r54 * 1213);
+    r54 = r38 - t; r38 += t;
+    t = KERN(barrett)(r55 * 1213);
+    r55 = r39 - t; r39 += t;
+    t = KERN(barrett)(r56 * 1213);
+    r56 = r40 - t; r40 += t;
+    t = KERN(barrett)(r57 * 1213);
+    r57 = r41 - t; r41 += t;
+    t = KERN(barrett)(r58 * 1213);
+    r58 = r42 - t; r42 += t;
+    t = KERN(barrett)(r59 * 1213);
+    r59 = r43 - t; r43 += t;
+    t = KERN(barrett)(r60 * 1213);
+    r60 = r44 - t; r44 += t;
+    t = KERN(barrett)(r61 * 1213);
+    r61 = r45 - t; r45 += t;
+    t = KERN(barrett)(r62 * 1213);
+    r62 = r46 - t; r46 += t;
+    t = KERN(barrett)(r63 * 1213);
+    r63 = r47 - t; r47 += t;
+
+    // 第 3 層 (t = 8)，輸入 |r| <= 63490
+    t = KERN(barrett)(r8 * -1728);
+    r8 = r0 - t; r0 += t;
+    t = KERN(barrett)(r9 * -1728);
+    r9 = r1 - t; r1 += t;
+    t = KERN(barrett)(r10 * -1728);
+    r10 = r2 - t; r2 += t;
+    t = KERN(barrett)(r11 * -1728);
+    r11 = r3 - t; r3 += t;
+    t = KERN(barrett)(r12 * -1728);
+    r12 = r4 - t; r4 += t;
+    t = KERN(barrett)(r13 * -1728);
+    r13 = r5 - t; r5 += t;
+    t = KERN(barrett)(r14 * -1728);
+    r14 = r6 - t; r6 += t;
+    t = KERN(barrett)(r15 * -1728);
+    r15 = r7 - t; r7 += t;
+    t = KERN(barrett)(r24 * -583);
+    r24 = r16 - t; r16 += t;
+    t = KERN(barrett)(r25 * -583);
+    r25 = r17 - t; r17 += t;
+    t = KERN(barrett)(r26 * -583);
+    r26 = r18 - t; r18 += t;
+    t = KERN(barrett)(r27 * -583);
+    r27 = r19 - t; r19 += t;
+    t = KERN(barrett)(r28 * -583);
+    r28 = r20 - t; r20 += t;
+    t = KERN(barrett)(r29 * -583);
+    r29 = r21 - t; r21 += t;
+    t = KERN(barrett)(r30 * -583);
+    r30 = r22 - t; r22 += t;
+    t = KERN(barrett)(r31 * -583);
+    r31 = r23 - t; r23 += t;
+    t = KERN(barrett)(r40 * 527);
+    r40 = r32 - t; r32 += t;
+    t = KERN(barrett)(r41 * 527);
+    r41 = r33 - t; r33 += t;
+    t = KERN(barrett)(r42 * 527);
+    r42 = r34 - t; r34 += t;
+    t = KERN(barrett)(r43 * 527);
+    r43 = r35 - t; r35 += t;
+    t = KERN(barrett)(r44 * 527);
+    r44 = r36 - t; r36 += t;
+    t = KERN(barrett)(r45 * 527);
+    r45 = r37 - t; r37 += t;
+    t = KERN(barrett)(r46 * 527);
+    r46 = r38 - t; r38 += t;
+    t = KERN(barrett)(r47 * 527);
+    r47 = r39 - t; r39 += t;
+    t = KERN(barrett)(r56 * 849);
+    r56 = r48 - t; r48 += t;
+    t = KERN(barrett)(r57 * 849);
+    r57 = r49 - t; r49 += t;
+    t = KERN(barrett)(r58 * 849);
+    r58 = r50 - t; r50 += t;
+    t = KERN(barrett)(r59 * 849);
+    r59 = r51 - t; r51 += t;
+    t = KERN(barrett)(r60 * 849);
+    r60 = r52 - t; r52 += t;
+    t = KERN(barrett)(r61 * 849);
+    r61 = r53 - t; r53 += t;
+    t = KERN(barrett)(r62 * 849);
+    r62 = r54 - t; r54 += t;
+    t = KERN(barrett)(r63 * 849);
+    r63 = r55 - t; r55 += t;
+
+    // 第 4 層 (t = 4)，輸入 |r| <= 78851
+    t = KERN(barrett)(r4 * 2132);
+    r4 = r0 - t; r0 += t;
+    t = KERN(barrett)(r5 * 2132);
+    r5 = r1 - t; r1 += t;
+    t = KERN(barrett)(r6 * 2132);
+    r6 = r2 - t; r2 += t;
+    t = KERN(barrett)(r7 * 2132);
+    r7 = r3 - t; r3 += t;
+    t = KERN(barrett)(r12 * 97);
+    r12 = r8 - t; r8 += t;
+    t = KERN(barrett)(r13 * 97);
+    r13 = r9 - t; r9 += t;
+    t = KERN(barrett)(r14 * 97);
+    r14 = r10 - t; r10 += t;
+    t = KERN(barrett)(r15 * 97);
+    r15 = r11 - t; r11 += t;
+    t = KERN(barrett)(r20 * -2446);
+    r20 = r16 - t; r16 += t;
+    t = KERN(barrett)(r21 * -2446);
+    r21 = r17 - t; r17 += t;
+    t = KERN(barrett)(r22 * -2446);
+    r22 = r18 - t; r18 += t;
+    t = KERN(barrett)(r23 * -2446);
+    r23 = r19 - t; r19 += t;
+    t = KERN(barrett)(r28 * -2381);
+    r28 = r24 - t; r24 += t;
+    t = KERN(barrett)(r29 * -2381);
+    r29 = r25 - t; r25 += t;
+    t = KERN(barrett)(r30 * -2381);
+    r30 = r26 - t; r26 += t;
+    t = KERN(barrett)(r31 * -2381);
+    r31 = r27 - t; r27 += t;
+    t = KERN(barrett)(r36 * 2784);
+    r36 = r32 - t; r32 += t;
+    t = KERN(barrett)(r37 * 2784);
+    r37 = r33 - t; r33 += t;
+    t = KERN(barrett)(r38 * 2784);
+    r38 = r34 - t; r34 += t;
+    t = KERN(barrett)(r39 * 2784);
+    r39 = r35 - t; r35 += t;
+    t = KERN(barrett)(r44 * 1366);
+    r44 = r40 - t; r40 += t;
+    t = KERN(barrett)(r45 * 1366);
+    r45 = r41 - t; r41 += t;
+    t = KERN(barrett)(r46 * 1366);
+    r46 = r42 - t; r42 += t;
+    t = KERN(barrett)(r47 * 1366);
+    r47 = r43 - t; r43 += t;
+    t = KERN(barrett)(r52 * 2138);
+    r52 = r48 - t; r48 += t;
+    t = KERN(barrett)(r53 * 2138);
+    r53 = r49 - t; r49 += t;
+    t = KERN(barrett)(r54 * 2138);
+    r54 = r50 - t; r50 += t;
+    t = KERN(barrett)(r55 * 2138);
+    r55 = r51 - t; r51 += t;
+    t = KERN(barrett)(r60 * -2648);
+    r60 = r56 - t; r56 += t;
+    t = KERN(barrett)(r61 * -2648);
+    r61 = r57 - t; r57 += t;
+    t = KERN(barrett)(r62 * -2648);
+    r62 = r58 - t; r58 += t;
+    t = KERN(barrett)(r63 * -2648);
+    r63 = r59 - t; r59 += t;
+
+    // 輸出化約，|r| <= 94212
+    r0 = KERN(barrett)(r0);
+    r1 = KERN(barrett)(r1);
+    r2 = KERN(barrett)(r2);
+    r3 = KERN(barrett)(r3);
+    r4 = KERN(barrett)(r4);
+    r5 = KERN(barrett)(r5);
+    r6 = KERN(barrett)(r6);
+    r7 = KERN(barrett)(r7);
+    r8 = KERN(barrett)(r8);
+    r9 = KERN(barrett)(r9);
+    r10 = KERN(barrett)(r10);
+    r11 = KERN(barrett)(r11);
+    r12 = KERN(barrett)(r12);
+    r13 = KERN(barrett)(r13);
+    r14 = KERN(barrett)(r14);
+    r15 = KERN(barrett)(r15);
+    r16 = KERN(barrett)(r16);
+    r17 = KERN(barrett)(r17);
+    r18 = KERN(barrett)(r18);
+    r19 = KERN(barrett)(r19);
+    r20 = KERN(barrett)(r20);
+    r21 = KERN(barrett)(r21);
+    r22 = KERN(barrett)(r22);
+    r23 = KERN(barrett)(r23);
+    r24 = KERN(barrett)(r24);
+    r25 = KERN(barrett)(r25);
+    r26 = KERN(barrett)(r26);
+    r27 = KERN(barrett)(r27);
+    r28 = KERN(barrett)(r28);
+    r29 = KERN(barrett)(r29);
+    r30 = KERN(barrett)(r30);
+    r31 = KERN(barrett)(r31);
+    r32 = KERN(barrett)(r32);
+    r33 = KERN(barrett)(r33);
+    r34 = KERN(barrett)(r34);
+    r35 = KERN(barrett)(r35);
+    r36 = KERN(barrett)(r36);
+    r37 = KERN(barrett)(r37);
+    r38 = KERN(barrett)(r38);
+    r39 = KERN(barrett)(r39);
+    r40 = KERN(barrett)(r40);
+    r41 = KERN(barrett)(r41);
+    r42 = KERN(barrett)(r42);
+    r43 = KERN(barrett)(r43);
+    r44 = KERN(barrett)(r44);
+    r45 = KERN(barrett)(r45);
+    r46 = KERN(barrett)(r46);
+    r47 = KERN(barrett)(r47);
+    r48 = KERN(barrett)(r48);
+    r49 = KERN(barrett)(r49);
+    r50 = KERN(barrett)(r50);
+    r51 = KERN(barrett)(r51);
+    r52 = KERN(barrett)(r52);
+    r53 = KERN(barrett)(r53);
+    r54 = KERN(barrett)(r54);
+    r55 = KERN(barrett)(r55);
+    r56 = KERN(barrett)(r56);
+    r57 = KERN(barrett)(r57);
+    r58 = KERN(barrett)(r58);
+    r59 = KERN(barrett)(r59);
+    r60 = KERN(barrett)(r60);
+    r61 = KERN(barrett)(r61);
+    r62 = KERN(barrett)(r62);
+    r63 = KERN(barrett)(r63);
+    out[0 * stride + 0] = p->coeffs[0] = KERN(canon)(r0);
+    out[1 * stride + 0] = p->coeffs[1] = KERN(canon)(r1);
+    out[2 * stride + 0] = p->coeffs[2] = KERN(canon)(r2);
+    out[3 * stride + 0] = p->coeffs[3] = KERN(canon)(r3);
+    out[0 * stride + 1] = p->coeffs[4] = KERN(canon)(r4);
+    out[1 * stride + 1] = p->coeffs[5] = KERN(canon)(r5);
+    out[2 * stride + 1] = p->coeffs[6] = KERN(canon)(r6);
+    out[3 * stride + 1] = p->coeffs[7] = KERN(canon)(r7);
+    out[0 * stride + 2] = p->coeffs[8] = KERN(canon)(r8);
+    out[1 * stride + 2] = p->coeffs[9] = KERN(canon)(r9);
+    out[2 * stride + 2] = p->coeffs[10] = KERN(canon)(r10);
+    out[3 * stride + 2] = p->coeffs[11] = KERN(canon)(r11);
+    out[0 * stride + 3] = p->coeffs[12] = KERN(canon)(r12);
+    out[1 * stride + 3] = p->coeffs[13] = KERN(canon)(r13);
+    out[2 * stride + 3] = p->coeffs[14] = KERN(canon)(r14);
+    out[3 * stride + 3] = p->coeffs[15] = KERN(canon)(r15);
+    out[0 * stride + 4] = p->coeffs[16] = KERN(canon)(r16);
+    out[1 * stride + 4] = p->coeffs[17] = KERN(canon)(r17);
+    out[2 * stride + 4] = p->coeffs[18] = KERN(canon)(r18);
+    out[3 * stride + 4] = p->coeffs[19] = KERN(canon)(r19);
+    out[0 * stride + 5] = p->coeffs[20] = KERN(canon)(r20);
+    out[1 * stride + 5] = p->coeffs[21] = KERN(canon)(r21);
+    out[2 * stride + 5] = p->coeffs[22] = KERN(canon)(r22);
+    out[3 * stride + 5] = p->coeffs[23] = KERN(canon)(r23);
+    out[0 * stride + 6] = p->coeffs[24] = KERN(canon)(r24);
+    out[1 * stride + 6] = p->coeffs[25] = KERN(canon)(r25);
+    out[2 * stride + 6] = p->coeffs[26] = KERN(canon)(r26);
+    out[3 * stride + 6] = p->coeffs[27] = KERN(canon)(r27);
+    out[0 * stride + 7] = p->coeffs[28] = KERN(canon)(r28);
+    out[1 * stride + 7] = p->coeffs[29] = KERN(canon)(r29);
+    out[2 * stride + 7] = p->coeffs[30] = KERN(canon)(r30);
+    out[3 * stride + 7] = p->coeffs[31] = KERN(canon)(r31);
+    out[0 * stride + 8] = p->coeffs[32] = KERN(canon)(r32);
+    out[1 * stride + 8] = p->coeffs[33] = KERN(canon)(r33);
+    out[2 * stride + 8] = p->coeffs[34] = KERN(canon)(r34);
+    out[3 * stride + 8] = p->coeffs[35] = KERN(canon)(r35);
+    out[0 * stride + 9] = p->coeffs[36] = KERN(canon)(r36);
+    out[1 * stride + 9] = p->coeffs[37] = KERN(canon)(r37);
+    out[2 * stride + 9] = p->coeffs[38] = KERN(canon)(r38);
+    out[3 * stride + 9] = p->coeffs[39] = KERN(canon)(r39);
+    out[0 * stride + 10] = p->coeffs[40] = KERN(canon)(r40);
+    out[1 * stride + 10] = p->coeffs[41] = KERN(canon)(r41);
+    out[2 * stride + 10] = p->coeffs[42] = KERN(canon)(r42);
+    out[3 * stride + 10] = p->coeffs[43] = KERN(canon)(r43);
+    out[0 * stride + 11] = p->coeffs[44] = KERN(canon)(r44);
+    out[1 * stride + 11] = p->coeffs[45] = KERN(canon)(r45);
+    out[2 * stride + 11] = p->coeffs[46] = KERN(canon)(r46);
+    out[3 * stride + 11] = p->coeffs[47] = KERN(canon)(r47);
+    out[0 * stride + 12] = p->coeffs[48] = KERN(canon)(r48);
+    out[1 * stride + 12] = p->coeffs[49] = KERN(canon)(r49);
+    out[2 * stride + 12] = p->coeffs[50] = KERN(canon)(r50);
+    out[3 * stride + 12] = p->coeffs[51] = KERN(canon)(r51);
+    out[0 * stride + 13] = p->coeffs[52] = KERN(canon)(r52);
+    out[1 * stride + 13] = p->coeffs[53] = KERN(canon)(r53);
+    out[2 * stride + 13] = p->coeffs[54] = KERN(canon)(r54);
+    out[3 * stride + 13] = p->coeffs[55] = KERN(canon)(r55);
+    out[0 * stride + 14] = p->coeffs[56] = KERN(canon)(r56);
+    out[1 * stride + 14] = p->coeffs[57] = KERN(canon)(r57);
+    out[2 * stride + 14] = p->coeffs[58] = KERN(canon)(r58);
+    out[3 * stride + 14] = p->coeffs[59] = KERN(canon)(r59);
+    out[0 * stride + 15] = p->coeffs[60] = KERN(canon)(r60);
+    out[1 * stride + 15] = p->coeffs[61] = KERN(canon)(r61);
+    out[2 * stride + 15] = p->coeffs[62] = KERN(canon)(r62);
+    out[3 * stride + 15] = p->coeffs[63] = KERN(canon)(r63);
+}
+
+// 反向 INTT (4 層，輸入位元反轉 -> 輸出自然順序)，輸入可為任意 int16，輸出在 [0, q)
+static void KERN(invntt)(poly *p) {
+    int32_t r0 = p->coeffs[0];
+    int32_t r1 = p->coeffs[1];
+    int32_t r2 = p->coeffs[2];
+    int32_t r3 = p->coeffs[3];
+    int32_t r4 = p->coeffs[4];
+    int32_t r5 = p->coeffs[5];
+    int32_t r6 = p->coeffs[6];
+    int32_t r7 = p->coeffs[7];
+    int32_t r8 = p->coeffs[8];
+    int32_t r9 = p->coeffs[9];
+    int32_t r10 = p->coeffs[10];
+    int32_t r11 = p->coeffs[11];
+    int32_t r12 = p->coeffs[12];
+    int32_t r13 = p->coeffs[13];
+    int32_t r14 = p->coeffs[14];
+    int32_t r15 = p->coeffs[15];
+    int32_t r16 = p->coeffs[16];
+    int32_t r17 = p->coeffs[17];
+    int32_t r18 = p->coeffs[18];
+    int32_t r19 = p->coeffs[19];
+    int32_t r20 = p->coeffs[20];
+    int32_t r21 = p->coeffs[21];
+    int32_t r22 = p->coeffs[22];
+    int32_t r23 = p->coeffs[23];
+    int32_t r24 = p->coeffs[24];
+    int32_t r25 = p->coeffs[25];
+    int32_t r26 = p->coeffs[26];
+    int32_t r27 = p->coeffs[27];
+    int32_t r28 = p->coeffs[28];
+    int32_t r29 = p->coeffs[29];
+    int32_t r30 = p->coeffs[30];
+    int32_t r31 = p->coeffs[31];
+    int32_t r32 = p->coeffs[32];
+    int32_t r33 = p->coeffs[33];
+    int32_t r34 = p->coeffs[34];
+    int32_t r35 = p->coeffs[35];
+    int32_t r36 = p->coeffs[36];
+    int32_t r37 = p->coeffs[37];
+    int32_t r38 = p->coeffs[38];
+    int32_t r39 = p->coeffs[39];
+    int32_t r40 = p->coeffs[40];
+    int32_t r41 = p->coeffs[41];
+    int32_t r42 = p->coeffs[42];
+    int32_t r43 = p->coeffs[43];
+    int32_t r44 = p->coeffs[44];
+    int32_t r45 = p->coeffs[45];
+    int32_t r46 = p->coeffs[46];
+    int32_t r47 = p->coeffs[47];
+    int32_t r48 = p->coeffs[48];
+    int32_t r49 = p->coeffs[49];
+    int32_t r50 = p->coeffs[50];
+    int32_t r51 = p->coeffs[51];
+    int32_t r52 = p->coeffs[52];
+    int32_t r53 = p->coeffs[53];
+    int32_t r54 = p->coeffs[54];
+    int32_t r55 = p->coeffs[55];
+    int32_t r56 = p->coeffs[56];
+    int32_t r57 = p->coeffs[57];
+    int32_t r58 = p->coeffs[58];
+    int32_t r59 = p->coeffs[59];
+    int32_t r60 = p->coeffs[60];
+    int32_t r61 = p->coeffs[61];
+    int32_t r62 = p->coeffs[62];
+    int32_t r63 = p->coeffs[63];
+    int32_t t;
+    int32_t u;
+
+    // 第 1 層 (t = 4)，輸入 |r| <= 32768
+    u = r0; r0 = u + r4; r4 = u - r4;
+    t = KERN(barrett)(r4 * 2648);
+    r4 = t;
+    u = r1; r1 = u + r5; r5 = u - r5;
+    t = KERN(barrett)(r5 * 2648);
+    r5 = t;
+    u = r2; r2 = u + r6; r6 = u - r6;
+    t = KERN(barrett)(r6 * 2648);
+    r6 = t;
+    u = r3; r3 = u + r7; r7 = u - r7;
+    t = KERN(barrett)(r7 * 2648);
+    r7 = t;
+    u = r8; r8 = u + r12; r12 = u - r12;
+    t = KERN(barrett)(r12 * -2138);
+    r12 = t;
+    u = r9; r9 = u + r13; r13 = u - r13;
+    t = KERN(barrett)(r13 * -2138);
+    r13 = t;
+    u = r10; r10 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * -2138);
+    r14 = t;
+    u = r11; r11 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * -2138);
+    r15 = t;
+    u = r16; r16 = u + r20; r20 = u - r20;
+    t = KERN(barrett)(r20 * -1366);
+    r20 = t;
+    u = r17; r17 = u + r21; r21 = u - r21;
+    t = KERN(barrett)(r21 * -1366);
+    r21 = t;
+    u = r18; r18 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -1366);
+    r22 = t;
+    u = r19; r19 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -1366);
+    r23 = t;
+    u = r24; r24 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -2784);
+    r28 = t;
+    u = r25; r25 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -2784);
+    r29 = t;
+    u = r26; r26 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -2784);
+    r30 = t;
+    u = r27; r27 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -2784);
+    r31 = t;
+    u = r32; r32 = u + r36; r36 = u - r36;
+    t = KERN(barrett)(r36 * 2381);
+    r36 = t;
+    u = r33; r33 = u + r37; r37 = u - r37;
+    t = KERN(barrett)(r37 * 2381);
+    r37 = t;
+    u = r34; r34 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * 2381);
+    r38 = t;
+    u = r35; r35 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * 2381);
+    r39 = t;
+    u = r40; r40 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * 2446);
+    r44 = t;
+    u = r41; r41 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 2446);
+    r45 = t;
+    u = r42; r42 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * 2446);
+    r46 = t;
+    u = r43; r43 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * 2446);
+    r47 = t;
+    u = r48; r48 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * -97);
+    r52 = t;
+    u = r49; r49 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * -97);
+    r53 = t;
+    u = r50; r50 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * -97);
+    r54 = t;
+    u = r51; r51 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * -97);
+    r55 = t;
+    u = r56; r56 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * -2132);
+    r60 = t;
+    u = r57; r57 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * -2132);
+    r61 = t;
+    u = r58; r58 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * -2132);
+    r62 = t;
+    u = r59; r59 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -2132);
+    r63 = t;
+
+    // 第 2 層 (t = 8)，輸入 |r| <= 65536
+    u = r0; r0 = u + r8; r8 = u - r8;
+    t = KERN(barrett)(r8 * -849);
+    r8 = t;
+    u = r1; r1 = u + r9; r9 = u - r9;
+    t = KERN(barrett)(r9 * -849);
+    r9 = t;
+    u = r2; r2 = u + r10; r10 = u - r10;
+    t = KERN(barrett)(r10 * -849);
+    r10 = t;
+    u = r3; r3 = u + r11; r11 = u - r11;
+    t = KERN(barrett)(r11 * -849);
+    r11 = t;
+    u = r4; r4 = u + r12; r12 = u - r12;
+    t = KERN(barrett)(r12 * -849);
+    r12 = t;
+    u = r5; r5 = u + r13; r13 = u - r13;
+    t = KERN(barrett)(r13 * -849);
+    r13 = t;
+    u = r6; r6 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * -849);
+    r14 = t;
+    u = r7; r7 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * -849);
+    r15 = t;
+    u = r16; r16 = u + r24; r24 = u - r24;
+    t = KERN(barrett)(r24 * -527);
+    r24 = t;
+    u = r17; r17 = u + r25; r25 = u - r25;
+    t = KERN(barrett)(r25 * -527);
+    r25 = t;
+    u = r18; r18 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -527);
+    r26 = t;
+    u = r19; r19 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -527);
+    r27 = t;
+    u = r20; r20 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -527);
+    r28 = t;
+    u = r21; r21 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -527);
+    r29 = t;
+    u = r22; r22 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -527);
+    r30 = t;
+    u = r23; r23 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -527);
+    r31 = t;
+    u = r32; r32 = u + r40; r40 = u - r40;
+    t = KERN(barrett)(r40 * 583);
+    r40 = t;
+    u = r33; r33 = u + r41; r41 = u - r41;
+    t = KERN(barrett)(r41 * 583);
+    r41 = t;
+    u = r34; r34 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * 583);
+    r42 = t;
+    u = r35; r35 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * 583);
+    r43 = t;
+    u = r36; r36 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * 583);
+    r44 = t;
+    u = r37; r37 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 583);
+    r45 = t;
+    u = r38; r38 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * 583);
+    r46 = t;
+    u = r39; r39 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * 583);
+    r47 = t;
+    u = r48; r48 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * 1728);
+    r56 = t;
+    u = r49; r49 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 1728);
+    r57 = t;
+    u = r50; r50 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 1728);
+    r58 = t;
+    u = r51; r51 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 1728);
+    r59 = t;
+    u = r52; r52 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * 1728);
+    r60 = t;
+    u = r53; r53 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 1728);
+    r61 = t;
+    u = r54; r54 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * 1728);
+    r62 = t;
+    u = r55; r55 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * 1728);
+    r63 = t;
+
+    // 第 3 層 (t = 16)，輸入 |r| <= 131072
+    u = r0; r0 = u + r16; r16 = u - r16;
+    t = KERN(barrett)(r16 * -1213);
+    r16 = t;
+    u = r1; r1 = u + r17; r17 = u - r17;
+    t = KERN(barrett)(r17 * -1213);
+    r17 = t;
+    u = r2; r2 = u + r18; r18 = u - r18;
+    t = KERN(barrett)(r18 * -1213);
+    r18 = t;
+    u = r3; r3 = u + r19; r19 = u - r19;
+    t = KERN(barrett)(r19 * -1213);
+    r19 = t;
+    u = r4; r4 = u + r20; r20 = u - r20;
+    t = KERN(barrett)(r20 * -1213);
+    r20 = t;
+    u = r5; r5 = u + r21; r21 = u - r21;
+    t = KERN(barrett)(r21 * -1213);
+    r21 = t;
+    u = r6; r6 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -1213);
+    r22 = t;
+    u = r7; r7 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -1213);
+    r23 = t;
+    u = r8; r8 = u + r24; r24 = u - r24;
+    t = KERN(barrett)(r24 * -1213);
+    r24 = t;
+    u = r9; r9 = u + r25; r25 = u - r25;
+    t = KERN(barrett)(r25 * -1213);
+    r25 = t;
+    u = r10; r10 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -1213);
+    r26 = t;
+    u = r11; r11 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -1213);
+    r27 = t;
+    u = r12; r12 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -1213);
+    r28 = t;
+    u = r13; r13 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -1213);
+    r29 = t;
+    u = r14; r14 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -1213);
+    r30 = t;
+    u = r15; r15 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -1213);
+    r31 = t;
+    u = r32; r32 = u + r48; r48 = u - r48;
+    t = KERN(barrett)(r48 * 1925);
+    r48 = t;
+    u = r33; r33 = u + r49; r49 = u - r49;
+    t = KERN(barrett)(r49 * 1925);
+    r49 = t;
+    u = r34; r34 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * 1925);
+    r50 = t;
+    u = r35; r35 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * 1925);
+    r51 = t;
+    u = r36; r36 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * 1925);
+    r52 = t;
+    u = r37; r37 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * 1925);
+    r53 = t;
+    u = r38; r38 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * 1925);
+    r54 = t;
+    u = r39; r39 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * 1925);
+    r55 = t;
+    u = r40; r40 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * 1925);
+    r56 = t;
+    u = r41; r41 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 1925);
+    r57 = t;
+    u = r42; r42 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 1925);
+    r58 = t;
+    u = r43; r43 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 1925);
+    r59 = t;
+    u = r44; r44 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * 1925);
+    r60 = t;
+    u = r45; r45 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 1925);
+    r61 = t;
+    u = r46; r46 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * 1925);
+    r62 = t;
+    u = r47; r47 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * 1925);
+    r63 = t;
+
+    // 第 4 層 (t = 32)，輸入 |r| <= 262144
+    u = r0; r0 = u + r32; r32 = u - r32;
+    t = KERN(barrett)(r32 * 3149);
+    r32 = t;
+    t = KERN(barrett)(r0 * -480);
+    r0 = t;
+    u = r1; r1 = u + r33; r33 = u - r33;
+    t = KERN(barrett)(r33 * 3149);
+    r33 = t;
+    t = KERN(barrett)(r1 * -480);
+    r1 = t;
+    u = r2; r2 = u + r34; r34 = u - r34;
+    t = KERN(barrett)(r34 * 3149);
+    r34 = t;
+    t = KERN(barrett)(r2 * -480);
+    r2 = t;
+    u = r3; r3 = u + r35; r35 = u - r35;
+    t = KERN(barrett)(r35 * 3149);
+    r35 = t;
+    t = KERN(barrett)(r3 * -480);
+    r3 = t;
+    u = r4; r4 = u + r36; r36 = u - r36;
+    t = KERN(barrett)(r36 * 3149);
+    r36 = t;
+    t = KERN(barrett)(r4 * -480);
+    r4 = t;
+    u = r5; r5 = u + r37; r37 = u - r37;
+    t = KERN(barrett)(r37 * 3149);
+    r37 = t;
+    t = KERN(barrett)(r5 * -480);
+    r5 = t;
+    u = r6; r6 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * 3149);
+    r38 = t;
+    t = KERN(barrett)(r6 * -480);
+    r6 = t;
+    u = r7; r7 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * 3149);
+    r39 = t;
+    t = KERN(barrett)(r7 * -480);
+    r7 = t;
+    u = r8; r8 = u + r40; r40 = u - r40;
+    t = KERN(barrett)(r40 * 3149);
+    r40 = t;
+    t = KERN(barrett)(r8 * -480);
+    r8 = t;
+    u = r9; r9 = u + r41; r41 = u - r41;
+    t = KERN(barrett)(r41 * 3149);
+    r41 = t;
+    t = KERN(barrett)(r9 * -480);
+    r9 = t;
+    u = r10; r10 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * 3149);
+    r42 = t;
+    t = KERN(barrett)(r10 * -480);
+    r10 = t;
+    u = r11; r11 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * 3149);
+    r43 = t;
+    t = KERN(barrett)(r11 * -480);
+    r11 = t;
+    u = r12; r12 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * 3149);
+    r44 = t;
+    t = KERN(barrett)(r12 * -480);
+    r12 = t;
+    u = r13; r13 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 3149);
+    r45 = t;
+    t = KERN(barrett)(r13 * -480);
+    r13 = t;
+    u = r14; r14 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * 3149);
+    r46 = t;
+    t = KERN(barrett)(r14 * -480);
+    r14 = t;
+    u = r15; r15 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * 3149);
+    r47 = t;
+    t = KERN(barrett)(r15 * -480);
+    r15 = t;
+    u = r16; r16 = u + r48; r48 = u - r48;
+    t = KERN(barrett)(r48 * 3149);
+    r48 = t;
+    t = KERN(barrett)(r16 * -480);
+    r16 = t;
+    u = r17; r17 = u + r49; r49 = u - r49;
+    t = KERN(barrett)(r49 * 3149);
+    r49 = t;
+    t = KERN(barrett)(r17 * -480);
+    r17 = t;
+    u = r18; r18 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * 3149);
+    r50 = t;
+    t = KERN(barrett)(r18 * -480);
+    r18 = t;
+    u = r19; r19 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * 3149);
+    r51 = t;
+    t = KERN(barrett)(r19 * -480);
+    r19 = t;
+    u = r20; r20 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * 3149);
+    r52 = t;
+    t = KERN(barrett)(r20 * -480);
+    r20 = t;
+    u = r21; r21 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * 3149);
+    r53 = t;
+    t = KERN(barrett)(r21 * -480);
+    r21 = t;
+    u = r22; r22 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * 3149);
+    r54 = t;
+    t = KERN(barrett)(r22 * -480);
+    r22 = t;
+    u = r23; r23 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * 3149);
+    r55 = t;
+    t = KERN(barrett)(r23 * -480);
+    r23 = t;
+    u = r24; r24 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * 3149);
+    r56 = t;
+    t = KERN(barrett)(r24 * -480);
+    r24 = t;
+    u = r25; r25 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 3149);
+    r57 = t;
+    t = KERN(barrett)(r25 * -480);
+    r25 = t;
+    u = r26; r26 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 3149);
+    r58 = t;
+    t = KERN(barrett)(r26 * -480);
+    r26 = t;
+    u = r27; r27 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 3149);
+    r59 = t;
+    t = KERN(barrett)(r27 * -480);
+    r27 = t;
+    u = r28; r28 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * 3149);
+    r60 = t;
+    t = KERN(barrett)(r28 * -480);
+    r28 = t;
+    u = r29; r29 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 3149);
+    r61 = t;
+    t = KERN(barrett)(r29 * -480);
+    r29 = t;
+    u = r30; r30 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * 3149);
+    r62 = t;
+    t = KERN(barrett)(r30 * -480);
+    r30 = t;
+    u = r31; r31 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * 3149);
+    r63 = t;
+    t = KERN(barrett)(r31 * -480);
+    r31 = t;
+
+    // 輸出化約，|r| <= 15361
+    p->coeffs[0] = KERN(canon)(r0);
+    p->coeffs[1] = KERN(canon)(r1);
+    p->coeffs[2] = KERN(canon)(r2);
+    p->coeffs[3] = KERN(canon)(r3);
+    p->coeffs[4] = KERN(canon)(r4);
+    p->coeffs[5] = KERN(canon)(r5);
+    p->coeffs[6] = KERN(canon)(r6);
+    p->coeffs[7] = KERN(canon)(r7);
+    p->coeffs[8] = KERN(canon)(r8);
+    p->coeffs[9] = KERN(canon)(r9);
+    p->coeffs[10] = KERN(canon)(r10);
+    p->coeffs[11] = KERN(canon)(r11);
+    p->coeffs[12] = KERN(canon)(r12);
+    p->coeffs[13] = KERN(canon)(r13);
+    p->coeffs[14] = KERN(canon)(r14);
+    p->coeffs[15] = KERN(canon)(r15);
+    p->coeffs[16] = KERN(canon)(r16);
+    p->coeffs[17] = KERN(canon)(r17);
+    p->coeffs[18] = KERN(canon)(r18);
+    p->coeffs[19] = KERN(canon)(r19);
+    p->coeffs[20] = KERN(canon)(r20);
+    p->coeffs[21] = KERN(canon)(r21);
+    p->coeffs[22] = KERN(canon)(r22);
+    p->coeffs[23] = KERN(canon)(r23);
+    p->coeffs[24] = KERN(canon)(r24);
+    p->coeffs[25] = KERN(canon)(r25);
+    p->coeffs[26] = KERN(canon)(r26);
+    p->coeffs[27] = KERN(canon)(r27);
+    p->coeffs[28] = KERN(canon)(r28);
+    p->coeffs[29] = KERN(canon)(r29);
+    p->coeffs[30] = KERN(canon)(r30);
+    p->coeffs[31] = KERN(canon)(r31);
+    p->coeffs[32] = KERN(canon)(r32);
+    p->coeffs[33] = KERN(canon)(r33);
+    p->coeffs[34] = KERN(canon)(r34);
+    p->coeffs[35] = KERN(canon)(r35);
+    p->coeffs[36] = KERN(canon)(r36);
+    p->coeffs[37] = KERN(canon)(r37);
+    p->coeffs[38] = KERN(canon)(r38);
+    p->coeffs[39] = KERN(canon)(r39);
+    p->coeffs[40] = KERN(canon)(r40);
+    p->coeffs[41] = KERN(canon)(r41);
+    p->coeffs[42] = KERN(canon)(r42);
+    p->coeffs[43] = KERN(canon)(r43);
+    p->coeffs[44] = KERN(canon)(r44);
+    p->coeffs[45] = KERN(canon)(r45);
+    p->coeffs[46] = KERN(canon)(r46);
+    p->coeffs[47] = KERN(canon)(r47);
+    p->coeffs[48] = KERN(canon)(r48);
+    p->coeffs[49] = KERN(canon)(r49);
+    p->coeffs[50] = KERN(canon)(r50);
+    p->coeffs[51] = KERN(canon)(r51);
+    p->coeffs[52] = KERN(canon)(r52);
+    p->coeffs[53] = KERN(canon)(r53);
+    p->coeffs[54] = KERN(canon)(r54);
+    p->coeffs[55] = KERN(canon)(r55);
+    p->coeffs[56] = KERN(canon)(r56);
+    p->coeffs[57] = KERN(canon)(r57);
+    p->coeffs[58] = KERN(canon)(r58);
+    p->coeffs[59] = KERN(canon)(r59);
+    p->coeffs[60] = KERN(canon)(r60);
+    p->coeffs[61] = KERN(canon)(r61);
+    p->coeffs[62] = KERN(canon)(r62);
+    p->coeffs[63] = KERN(canon)(r63);
+}
+
+// 同 invntt，輸入取自頻率優先佈局 (in 指向該多項式在第 0 個 tile 的起點)
+static void KERN(invntt_fm)(poly *p, const int16_t *in, size_t stride) {
+    int32_t r0 = in[0 * stride + 0];
+    int32_t r1 = in[1 * stride + 0];
+    int32_t r2 = in[2 * stride + 0];
+    int32_t r3 = in[3 * stride + 0];
+    int32_t r4 = in[0 * stride + 1];
+    int32_t r5 = in[1 * stride + 1];
+    int32_t r6 = in[2 * stride + 1];
+    int32_t r7 = in[3 * stride + 1];
+    int32_t r8 = in[0 * stride + 2];
+    int32_t r9 = in[1 * stride + 2];
+    int32_t r10 = in[2 * stride + 2];
+    int32_t r11 = in[3 * stride + 2];
+    int32_t r12 = in[0 * stride + 3];
+    int32_t r13 = in[1 * stride + 3];
+    int32_t r14 = in[2 * stride + 3];
+    int32_t r15 = in[3 * stride + 3];
+    int32_t r16 = in[0 * stride + 4];
+    int32_t r17 = in[1 * stride + 4];
+    int32_t r18 = in[2 * stride + 4];
+    int32_t r19 = in[3 * stride + 4];
+    int32_t r20 = in[0 * stride + 5];
+    int32_t r21 = in[1 * stride + 5];
+    int32_t r22 = in[2 * stride + 5];
+    int32_t r23 = in[3 * stride + 5];
+    int32_t r24 = in[0 * stride + 6];
+    int32_t r25 = in[1 * stride + 6];
+    int32_t r26 = in[2 * stride + 6];
+    int32_t r27 = in[3 * stride + 6];
+    int32_t r28 = in[0 * stride + 7];
+    int32_t r29 = in[1 * stride + 7];
+    int32_t r30 = in[2 * stride + 7];
+    int32_t r31 = in[3 * stride + 7];
+    int32_t r32 = in[0 * stride + 8];
+    int32_t r33 = in[1 * stride + 8];
+    int32_t r34 = in[2 * stride + 8];
+    int32_t r35 = in[3 * stride + 8];
+    int32_t r36 = in[0 * stride + 9];
+    int32_t r37 = in[1 * stride + 9];
+    int32_t r38 = in[2 * stride + 9];
+    int32_t r39 = in[3 * stride + 9];
+    int32_t r40 = in[0 * stride + 10];
+    int32_t r41 = in[1 * stride + 10];
+    int32_t r42 = in[2 * stride + 10];
+    int32_t r43 = in[3 * stride + 10];
+    int32_t r44 = in[0 * stride + 11];
+    int32_t r45 = in[1 * stride + 11];
+    int32_t r46 = in[2 * stride + 11];
+    int32_t r47 = in[3 * stride + 11];
+    int32_t r48 = in[0 * stride + 12];
+    int32_t r49 = in[1 * stride + 12];
+    int32_t r50 = in[2 * stride + 12];
+    int32_t r51 = in[3 * stride + 12];
+    int32_t r52 = in[0 * stride + 13];
+    int32_t r53 = in[1 * stride + 13];
+    int32_t r54 = in[2 * stride + 13];
+    int32_t r55 = in[3 * stride + 13];
+    int32_t r56 = in[0 * stride + 14];
+    int32_t r57 = in[1 * stride + 14];
+    int32_t r58 = in[2 * stride + 14];
+    int32_t r59 = in[3 * stride + 14];
+    int32_t r60 = in[0 * stride + 15];
+    int32_t r61 = in[1 * stride + 15];
+    int32_t r62 = in[2 * stride + 15];
+    int32_t r63 = in[3 * stride + 15];
+    int32_t t;
+    int32_t u;
+
+    // 第 1 層 (t = 4)，輸入 |r| <= 32768
+    u = r0; r0 = u + r4; r4 = u - r4;
+    t = KERN(barrett)(r4 * 2648);
+    r4 = t;
+    u = r1; r1 = u + r5; r5 = u - r5;
+    t = KERN(barrett)(r5 * 2648);
+    r5 = t;
+    u = r2; r2 = u + r6; r6 = u - r6;
+    t = KERN(barrett)(r6 * 2648);
+    r6 = t;
+    u = r3; r3 = u + r7; r7 = u - r7;
+    t = KERN(barrett)(r7 * 2648);
+    r7 = t;
+    u = r8; r8 = u + r12; r12 = u - r12;
+    t = KERN(barrett)(r12 * -2138);
+    r12 = t;
+    u = r9; r9 = u + r13; r13 = u - r13;
+    t = KERN(barrett)(r13 * -2138);
+    r13 = t;
+    u = r10; r10 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * -2138);
+    r14 = t;
+    u = r11; r11 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * -2138);
+    r15 = t;
+    u = r16; r16 = u + r20; r20 = u - r20;
+    t = KERN(barrett)(r20 * -1366);
+    r20 = t;
+    u = r17; r17 = u + r21; r21 = u - r21;
+    t = KERN(barrett)(r21 * -1366);
+    r21 = t;
+    u = r18; r18 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -1366);
+    r22 = t;
+    u = r19; r19 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -1366);
+    r23 = t;
+    u = r24; r24 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -2784);
+    r28 = t;
+    u = r25; r25 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -2784);
+    r29 = t;
+    u = r26; r26 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -2784);
+    r30 = t;
+    u = r27; r27 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -2784);
+    r31 = t;
+    u = r32; r32 = u + r36; r36 = u - r36;
+    t = KERN(barrett)(r36 * 2381);
+    r36 = t;
+    u = r33; r33 = u + r37; r37 = u - r37;
+    t = KERN(barrett)(r37 * 2381);
+    r37 = t;
+    u = r34; r34 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * 2381);
+    r38 = t;
+    u = r35; r35 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * 2381);
+    r39 = t;
+    u = r40; r40 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * 2446);
+    r44 = t;
+    u = r41; r41 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 2446);
+    r45 = t;
+    u = r42; r42 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * 2446);
+    r46 = t;
+    u = r43; r43 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * 2446);
+    r47 = t;
+    u = r48; r48 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * -97);
+    r52 = t;
+    u = r49; r49 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * -97);
+    r53 = t;
+    u = r50; r50 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * -97);
+    r54 = t;
+    u = r51; r51 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * -97);
+    r55 = t;
+    u = r56; r56 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * -2132);
+    r60 = t;
+    u = r57; r57 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * -2132);
+    r61 = t;
+    u = r58; r58 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * -2132);
+    r62 = t;
+    u = r59; r59 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * -2132);
+    r63 = t;
+
+    // 第 2 層 (t = 8)，輸入 |r| <= 65536
+    u = r0; r0 = u + r8; r8 = u - r8;
+    t = KERN(barrett)(r8 * -849);
+    r8 = t;
+    u = r1; r1 = u + r9; r9 = u - r9;
+    t = KERN(barrett)(r9 * -849);
+    r9 = t;
+    u = r2; r2 = u + r10; r10 = u - r10;
+    t = KERN(barrett)(r10 * -849);
+    r10 = t;
+    u = r3; r3 = u + r11; r11 = u - r11;
+    t = KERN(barrett)(r11 * -849);
+    r11 = t;
+    u = r4; r4 = u + r12; r12 = u - r12;
+    t = KERN(barrett)(r12 * -849);
+    r12 = t;
+    u = r5; r5 = u + r13; r13 = u - r13;
+    t = KERN(barrett)(r13 * -849);
+    r13 = t;
+    u = r6; r6 = u + r14; r14 = u - r14;
+    t = KERN(barrett)(r14 * -849);
+    r14 = t;
+    u = r7; r7 = u + r15; r15 = u - r15;
+    t = KERN(barrett)(r15 * -849);
+    r15 = t;
+    u = r16; r16 = u + r24; r24 = u - r24;
+    t = KERN(barrett)(r24 * -527);
+    r24 = t;
+    u = r17; r17 = u + r25; r25 = u - r25;
+    t = KERN(barrett)(r25 * -527);
+    r25 = t;
+    u = r18; r18 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -527);
+    r26 = t;
+    u = r19; r19 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -527);
+    r27 = t;
+    u = r20; r20 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -527);
+    r28 = t;
+    u = r21; r21 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -527);
+    r29 = t;
+    u = r22; r22 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -527);
+    r30 = t;
+    u = r23; r23 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -527);
+    r31 = t;
+    u = r32; r32 = u + r40; r40 = u - r40;
+    t = KERN(barrett)(r40 * 583);
+    r40 = t;
+    u = r33; r33 = u + r41; r41 = u - r41;
+    t = KERN(barrett)(r41 * 583);
+    r41 = t;
+    u = r34; r34 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * 583);
+    r42 = t;
+    u = r35; r35 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * 583);
+    r43 = t;
+    u = r36; r36 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * 583);
+    r44 = t;
+    u = r37; r37 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 583);
+    r45 = t;
+    u = r38; r38 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * 583);
+    r46 = t;
+    u = r39; r39 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * 583);
+    r47 = t;
+    u = r48; r48 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * 1728);
+    r56 = t;
+    u = r49; r49 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 1728);
+    r57 = t;
+    u = r50; r50 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 1728);
+    r58 = t;
+    u = r51; r51 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 1728);
+    r59 = t;
+    u = r52; r52 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * 1728);
+    r60 = t;
+    u = r53; r53 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 1728);
+    r61 = t;
+    u = r54; r54 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * 1728);
+    r62 = t;
+    u = r55; r55 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * 1728);
+    r63 = t;
+
+    // 第 3 層 (t = 16)，輸入 |r| <= 131072
+    u = r0; r0 = u + r16; r16 = u - r16;
+    t = KERN(barrett)(r16 * -1213);
+    r16 = t;
+    u = r1; r1 = u + r17; r17 = u - r17;
+    t = KERN(barrett)(r17 * -1213);
+    r17 = t;
+    u = r2; r2 = u + r18; r18 = u - r18;
+    t = KERN(barrett)(r18 * -1213);
+    r18 = t;
+    u = r3; r3 = u + r19; r19 = u - r19;
+    t = KERN(barrett)(r19 * -1213);
+    r19 = t;
+    u = r4; r4 = u + r20; r20 = u - r20;
+    t = KERN(barrett)(r20 * -1213);
+    r20 = t;
+    u = r5; r5 = u + r21; r21 = u - r21;
+    t = KERN(barrett)(r21 * -1213);
+    r21 = t;
+    u = r6; r6 = u + r22; r22 = u - r22;
+    t = KERN(barrett)(r22 * -1213);
+    r22 = t;
+    u = r7; r7 = u + r23; r23 = u - r23;
+    t = KERN(barrett)(r23 * -1213);
+    r23 = t;
+    u = r8; r8 = u + r24; r24 = u - r24;
+    t = KERN(barrett)(r24 * -1213);
+    r24 = t;
+    u = r9; r9 = u + r25; r25 = u - r25;
+    t = KERN(barrett)(r25 * -1213);
+    r25 = t;
+    u = r10; r10 = u + r26; r26 = u - r26;
+    t = KERN(barrett)(r26 * -1213);
+    r26 = t;
+    u = r11; r11 = u + r27; r27 = u - r27;
+    t = KERN(barrett)(r27 * -1213);
+    r27 = t;
+    u = r12; r12 = u + r28; r28 = u - r28;
+    t = KERN(barrett)(r28 * -1213);
+    r28 = t;
+    u = r13; r13 = u + r29; r29 = u - r29;
+    t = KERN(barrett)(r29 * -1213);
+    r29 = t;
+    u = r14; r14 = u + r30; r30 = u - r30;
+    t = KERN(barrett)(r30 * -1213);
+    r30 = t;
+    u = r15; r15 = u + r31; r31 = u - r31;
+    t = KERN(barrett)(r31 * -1213);
+    r31 = t;
+    u = r32; r32 = u + r48; r48 = u - r48;
+    t = KERN(barrett)(r48 * 1925);
+    r48 = t;
+    u = r33; r33 = u + r49; r49 = u - r49;
+    t = KERN(barrett)(r49 * 1925);
+    r49 = t;
+    u = r34; r34 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * 1925);
+    r50 = t;
+    u = r35; r35 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * 1925);
+    r51 = t;
+    u = r36; r36 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * 1925);
+    r52 = t;
+    u = r37; r37 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * 1925);
+    r53 = t;
+    u = r38; r38 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * 1925);
+    r54 = t;
+    u = r39; r39 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * 1925);
+    r55 = t;
+    u = r40; r40 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * 1925);
+    r56 = t;
+    u = r41; r41 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 1925);
+    r57 = t;
+    u = r42; r42 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 1925);
+    r58 = t;
+    u = r43; r43 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 1925);
+    r59 = t;
+    u = r44; r44 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * 1925);
+    r60 = t;
+    u = r45; r45 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 1925);
+    r61 = t;
+    u = r46; r46 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * 1925);
+    r62 = t;
+    u = r47; r47 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * 1925);
+    r63 = t;
+
+    // 第 4 層 (t = 32)，輸入 |r| <= 262144
+    u = r0; r0 = u + r32; r32 = u - r32;
+    t = KERN(barrett)(r32 * 3149);
+    r32 = t;
+    t = KERN(barrett)(r0 * -480);
+    r0 = t;
+    u = r1; r1 = u + r33; r33 = u - r33;
+    t = KERN(barrett)(r33 * 3149);
+    r33 = t;
+    t = KERN(barrett)(r1 * -480);
+    r1 = t;
+    u = r2; r2 = u + r34; r34 = u - r34;
+    t = KERN(barrett)(r34 * 3149);
+    r34 = t;
+    t = KERN(barrett)(r2 * -480);
+    r2 = t;
+    u = r3; r3 = u + r35; r35 = u - r35;
+    t = KERN(barrett)(r35 * 3149);
+    r35 = t;
+    t = KERN(barrett)(r3 * -480);
+    r3 = t;
+    u = r4; r4 = u + r36; r36 = u - r36;
+    t = KERN(barrett)(r36 * 3149);
+    r36 = t;
+    t = KERN(barrett)(r4 * -480);
+    r4 = t;
+    u = r5; r5 = u + r37; r37 = u - r37;
+    t = KERN(barrett)(r37 * 3149);
+    r37 = t;
+    t = KERN(barrett)(r5 * -480);
+    r5 = t;
+    u = r6; r6 = u + r38; r38 = u - r38;
+    t = KERN(barrett)(r38 * 3149);
+    r38 = t;
+    t = KERN(barrett)(r6 * -480);
+    r6 = t;
+    u = r7; r7 = u + r39; r39 = u - r39;
+    t = KERN(barrett)(r39 * 3149);
+    r39 = t;
+    t = KERN(barrett)(r7 * -480);
+    r7 = t;
+    u = r8; r8 = u + r40; r40 = u - r40;
+    t = KERN(barrett)(r40 * 3149);
+    r40 = t;
+    t = KERN(barrett)(r8 * -480);
+    r8 = t;
+    u = r9; r9 = u + r41; r41 = u - r41;
+    t = KERN(barrett)(r41 * 3149);
+    r41 = t;
+    t = KERN(barrett)(r9 * -480);
+    r9 = t;
+    u = r10; r10 = u + r42; r42 = u - r42;
+    t = KERN(barrett)(r42 * 3149);
+    r42 = t;
+    t = KERN(barrett)(r10 * -480);
+    r10 = t;
+    u = r11; r11 = u + r43; r43 = u - r43;
+    t = KERN(barrett)(r43 * 3149);
+    r43 = t;
+    t = KERN(barrett)(r11 * -480);
+    r11 = t;
+    u = r12; r12 = u + r44; r44 = u - r44;
+    t = KERN(barrett)(r44 * 3149);
+    r44 = t;
+    t = KERN(barrett)(r12 * -480);
+    r12 = t;
+    u = r13; r13 = u + r45; r45 = u - r45;
+    t = KERN(barrett)(r45 * 3149);
+    r45 = t;
+    t = KERN(barrett)(r13 * -480);
+    r13 = t;
+    u = r14; r14 = u + r46; r46 = u - r46;
+    t = KERN(barrett)(r46 * 3149);
+    r46 = t;
+    t = KERN(barrett)(r14 * -480);
+    r14 = t;
+    u = r15; r15 = u + r47; r47 = u - r47;
+    t = KERN(barrett)(r47 * 3149);
+    r47 = t;
+    t = KERN(barrett)(r15 * -480);
+    r15 = t;
+    u = r16; r16 = u + r48; r48 = u - r48;
+    t = KERN(barrett)(r48 * 3149);
+    r48 = t;
+    t = KERN(barrett)(r16 * -480);
+    r16 = t;
+    u = r17; r17 = u + r49; r49 = u - r49;
+    t = KERN(barrett)(r49 * 3149);
+    r49 = t;
+    t = KERN(barrett)(r17 * -480);
+    r17 = t;
+    u = r18; r18 = u + r50; r50 = u - r50;
+    t = KERN(barrett)(r50 * 3149);
+    r50 = t;
+    t = KERN(barrett)(r18 * -480);
+    r18 = t;
+    u = r19; r19 = u + r51; r51 = u - r51;
+    t = KERN(barrett)(r51 * 3149);
+    r51 = t;
+    t = KERN(barrett)(r19 * -480);
+    r19 = t;
+    u = r20; r20 = u + r52; r52 = u - r52;
+    t = KERN(barrett)(r52 * 3149);
+    r52 = t;
+    t = KERN(barrett)(r20 * -480);
+    r20 = t;
+    u = r21; r21 = u + r53; r53 = u - r53;
+    t = KERN(barrett)(r53 * 3149);
+    r53 = t;
+    t = KERN(barrett)(r21 * -480);
+    r21 = t;
+    u = r22; r22 = u + r54; r54 = u - r54;
+    t = KERN(barrett)(r54 * 3149);
+    r54 = t;
+    t = KERN(barrett)(r22 * -480);
+    r22 = t;
+    u = r23; r23 = u + r55; r55 = u - r55;
+    t = KERN(barrett)(r55 * 3149);
+    r55 = t;
+    t = KERN(barrett)(r23 * -480);
+    r23 = t;
+    u = r24; r24 = u + r56; r56 = u - r56;
+    t = KERN(barrett)(r56 * 3149);
+    r56 = t;
+    t = KERN(barrett)(r24 * -480);
+    r24 = t;
+    u = r25; r25 = u + r57; r57 = u - r57;
+    t = KERN(barrett)(r57 * 3149);
+    r57 = t;
+    t = KERN(barrett)(r25 * -480);
+    r25 = t;
+    u = r26; r26 = u + r58; r58 = u - r58;
+    t = KERN(barrett)(r58 * 3149);
+    r58 = t;
+    t = KERN(barrett)(r26 * -480);
+    r26 = t;
+    u = r27; r27 = u + r59; r59 = u - r59;
+    t = KERN(barrett)(r59 * 3149);
+    r59 = t;
+    t = KERN(barrett)(r27 * -480);
+    r27 = t;
+    u = r28; r28 = u + r60; r60 = u - r60;
+    t = KERN(barrett)(r60 * 3149);
+    r60 = t;
+    t = KERN(barrett)(r28 * -480);
+    r28 = t;
+    u = r29; r29 = u + r61; r61 = u - r61;
+    t = KERN(barrett)(r61 * 3149);
+    r61 = t;
+    t = KERN(barrett)(r29 * -480);
+    r29 = t;
+    u = r30; r30 = u + r62; r62 = u - r62;
+    t = KERN(barrett)(r62 * 3149);
+    r62 = t;
+    t = KERN(barrett)(r30 * -480);
+    r30 = t;
+    u = r31; r31 = u + r63; r63 = u - r63;
+    t = KERN(barrett)(r63 * 3149);
+    r63 = t;
+    t = KERN(barrett)(r31 * -480);
+    r31 = t;
+
+    // 輸出化約，|r| <= 15361
+    p->coeffs[0] = KERN(canon)(r0);
+    p->coeffs[1] = KERN(canon)(r1);
+    p->coeffs[2] = KERN(canon)(r2);
+    p->coeffs[3] = KERN(canon)(r3);
+    p->coeffs[4] = KERN(canon)(r4);
+    p->coeffs[5] = KERN(canon)(r5);
+    p->coeffs[6] = KERN(canon)(r6);
+    p->coeffs[7] = KERN(canon)(r7);
+    p->coeffs[8] = KERN(canon)(r8);
+    p->coeffs[9] = KERN(canon)(r9);
+    p->coeffs[10] = KERN(canon)(r10);
+    p->coeffs[11] = KERN(canon)(r11);
+    p->coeffs[12] = KERN(canon)(r12);
+    p->coeffs[13] = KERN(canon)(r13);
+    p->coeffs[14] = KERN(canon)(r14);
+    p->coeffs[15] = KERN(canon)(r15);
+    p->coeffs[16] = KERN(canon)(r16);
+    p->coeffs[17] = KERN(canon)(r17);
+    p->coeffs[18] = KERN(canon)(r18);
+    p->coeffs[19] = KERN(canon)(r19);
+    p->coeffs[20] = KERN(canon)(r20);
+    p->coeffs[21] = KERN(canon)(r21);
+    p->coeffs[22] = KERN(canon)(r22);
+    p->coeffs[23] = KERN(canon)(r23);
+    p->coeffs[24] = KERN(canon)(r24);
+    p->coeffs[25] = KERN(canon)(r25);
+    p->coeffs[26] = KERN(canon)(r26);
+    p->coeffs[27] = KERN(canon)(r27);
+    p->coeffs[28] = KERN(canon)(r28);
+    p->coeffs[29] = KERN(canon)(r29);
+    p->coeffs[30] = KERN(canon)(r30);
+    p->coeffs[31] = KERN(canon)(r31);
+    p->coeffs[32] = KERN(canon)(r32);
+    p->coeffs[33] = KERN(canon)(r33);
+    p->coeffs[34] = KERN(canon)(r34);
+    p->coeffs[35] = KERN(canon)(r35);
+    p->coeffs[36] = KERN(canon)(r36);
+    p->coeffs[37] = KERN(canon)(r37);
+    p->coeffs[38] = KERN(canon)(r38);
+    p->coeffs[39] = KERN(canon)(r39);
+    p->coeffs[40] = KERN(canon)(r40);
+    p->coeffs[41] = KERN(canon)(r41);
+    p->coeffs[42] = KERN(canon)(r42);
+    p->coeffs[43] = KERN(canon)(r43);
+    p->coeffs[44] = KERN(canon)(r44);
+    p->coeffs[45] = KERN(canon)(r45);
+    p->coeffs[46] = KERN(canon)(r46);
+    p->coeffs[47] = KERN(canon)(r47);
+    p->coeffs[48] = KERN(canon)(r48);
+    p->coeffs[49] = KERN(canon)(r49);
+    p->coeffs[50] = KERN(canon)(r50);
+    p->coeffs[51] = KERN(canon)(r51);
+    p->coeffs[52] = KERN(canon)(r52);
+    p->coeffs[53] = KERN(canon)(r53);
+    p->coeffs[54] = KERN(canon)(r54);
+    p->coeffs[55] = KERN(canon)(r55);
+    p->coeffs[56] = KERN(canon)(r56);
+    p->coeffs[57] = KERN(canon)(r57);
+    p->coeffs[58] = KERN(canon)(r58);
+    p->coeffs[59] = KERN(canon)(r59);
+    p->coeffs[60] = KERN(canon)(r60);
+    p->coeffs[61] = KERN(canon)(r61);
+    p->coeffs[62] = KERN(canon)(r62);
+    p->coeffs[63] = KERN(canon)(r63);
+}
+
+#endif
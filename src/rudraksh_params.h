@@ -44,4 +44,66 @@
 // len_K 定義為 16 bytes (128 bits) 的共享金鑰長度
 #define RUDRAKSH_len_K 16
 
+// 7. 對稱式 profile (編譯時選擇，版本化)
+// 金鑰 header 的高 4 bits 與密文對齊區的第一個 byte 記錄 profile，不同 profile 的金鑰 / 密文無法混用
+//   0x00 : 標準 profile，Ascon-XOF / Ascon-Hash (12 輪)
+//   0x10 : 快速 profile v1，Ascon-XOFa / Ascon-Hasha (吸收 / 擠出改用 8 輪)，-DRUDRAKSH_SYM_ASCON_FAST
+//   0x20 : SHAKE128 / SHAKE256 後端，-DRUDRAKSH_SYM_KECCAK
+#define RUDRAKSH_PROFILE_STD   0x00
+#define RUDRAKSH_PROFILE_FAST  0x10
+#define RUDRAKSH_PROFILE_SHAKE 0x20
+#define RUDRAKSH_PROFILE_MASK  0xF0
+
+#if defined(RUDRAKSH_SYM_KECCAK) && defined(RUDRAKSH_SYM_ASCON_FAST)
+#error "RUDRAKSH_SYM_KECCAK and RUDRAKSH_SYM_ASCON_FAST are mutually exclusive"
+#elif defined(RUDRAKSH_SYM_KECCAK)
+#define RUDRAKSH_PROFILE RUDRAKSH_PROFILE_SHAKE
+#elif defined(RUDRAKSH_SYM_ASCON_FAST)
+#define RUDRAKSH_PROFILE RUDRAKSH_PROFILE_FAST
+#else
+#define RUDRAKSH_PROFILE RUDRAKSH_PROFILE_STD
+#endif
+
+// 密文 : u (720) + v (24) 之後的第一個對齊 byte 存放 profile (標準 profile 為 0，與原本的清零相同)
+#define RUDRAKSH_CT_PROFILE_OFFSET (CRYPTO_CIPHERTEXTBYTES_VEC_U + 24)
+
+// 8. NTT 層數 (編譯時選擇，make linux NTT_LAYERS=5)
+// 6 = 完整 NTT，NTT 域為 64 個點值；4 / 5 層為不完整 NTT，NTT 域為 2^L 個 Z_q[x]/(x^d - gamma) 子環
+// (d = 64 / 2^L = 4 / 2)，點乘改為 d 次多項式乘法。金鑰 / 密文 (一般域) 與層數無關
+#ifndef RUDRAKSH_NTT_LAYERS
+#define RUDRAKSH_NTT_LAYERS 6
+#endif
+#if RUDRAKSH_NTT_LAYERS < 4 || RUDRAKSH_NTT_LAYERS > 6
+#error "RUDRAKSH_NTT_LAYERS must be 4, 5 or 6"
+#endif
+#define RUDRAKSH_NTT_BLOCKS (1 << RUDRAKSH_NTT_LAYERS)            // 子環個數
+#define RUDRAKSH_NTT_BLOCK  (RUDRAKSH_N >> RUDRAKSH_NTT_LAYERS)   // 子環次數 d
+
+// 9. NTT 域金鑰格式 (選用，第一個 byte 為格式版本 | profile)
+// b, s 以 NTT 域 13-bit 打包，encaps / decaps 不需再對 b, s 做正向 NTT
+// NTT 域內容與層數有關：完整 NTT 為版本 0x01，不完整 NTT 為 0x08 | 層數，不同層數的金鑰無法混用
+#if RUDRAKSH_NTT_LAYERS == 6
+#define RUDRAKSH_KEYFMT_NTT (0x01 | RUDRAKSH_PROFILE)
+#else
+#define RUDRAKSH_KEYFMT_NTT (0x08 | RUDRAKSH_NTT_LAYERS | RUDRAKSH_PROFILE)
+#endif
+#define RUDRAKSH_KEYFMT_HEADERBYTES 1
+// pk : 969 = header + b_hat + seedA + pkh = 1 + 936 + 16 + 16
+#define CRYPTO_PUBLICKEYBYTES_NTT  (RUDRAKSH_KEYFMT_HEADERBYTES + CRYPTO_PUBLICKEYBYTES + RUDRAKSH_len_K)
+// sk : 1921 = header + s_hat + b_hat + seedA + pkh + z = 1 + 936 + 936 + 16 + 16 + 16
+#define CRYPTO_SECRETKEYBYTES_NTT  (RUDRAKSH_KEYFMT_HEADERBYTES + CRYPTO_SECRETKEYBYTES)
+
+// 10. 精簡私鑰格式 (選用，大量金鑰常駐記憶體時使用)
+// s 的係數只落在 [-2, 2]，以 3-bit 打包即可 (13-bit 打包浪費 10 bits / 係數)
+#define RUDRAKSH_KEYFMT_PACKED (0x02 | RUDRAKSH_PROFILE)
+#define RUDRAKSH_KEYFMT_SEED   (0x03 | RUDRAKSH_PROFILE)
+#define RUDRAKSH_POLY_3BIT_BYTES 24 // 24 Bytes = 64*3 bits
+#define CRYPTO_SECRETKEYBYTES_S_3BIT (RUDRAKSH_K * RUDRAKSH_POLY_3BIT_BYTES) // 216 Bytes = 9*64*3 bits
+// sk : 1201 = header + s(3-bit) + pk + pkh + z = 1 + 216 + 952 + 16 + 16
+#define CRYPTO_SECRETKEYBYTES_PACKED (RUDRAKSH_KEYFMT_HEADERBYTES + CRYPTO_SECRETKEYBYTES_S_3BIT + CRYPTO_PUBLICKEYBYTES + 2 * RUDRAKSH_len_K)
+// seed-only : 只存 keygen 的種子 seedA || seed_se，s, b, pkh, z 皆於載入時重新生成
+#define RUDRAKSH_SEEDBYTES (2 * RUDRAKSH_len_K)
+// sk : 33 = header + seedA + seed_se = 1 + 16 + 16
+#define CRYPTO_SECRETKEYBYTES_SEED (RUDRAKSH_KEYFMT_HEADERBYTES + RUDRAKSH_SEEDBYTES)
+
 #endif // RUDRAKSH_PARAMS_H
\ No newline at end of file
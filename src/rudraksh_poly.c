@@ -1,6 +1,7 @@
 #include <stdint.h>
 #include "rudraksh_math.h"
 #include "rudraksh_params.h"
+#include "rudraksh_dispatch.h"
 
 // ==========================================================
 // 1. Encode / Decode (訊息 <-> 多項式)
@@ -55,13 +56,8 @@ void original_msg(uint8_t msg[16], const poly *m) {
  * 輸出: r (係數 0, 1920, 3840, 5760)
  */
 void poly_encode(poly *r, const poly *m) {
-    // 預計算常數: 7681 / 4 = 1920
-    const int16_t factor = 1920; 
-
-    for(int i=0; i<RUDRAKSH_N; i++) {
-        // 純粹的純量乘法
-        r->coeffs[i] = m->coeffs[i] * factor;
-    }
+    // 實作位於 rudraksh_kernels_impl.h (swar 變體: rudraksh_swar.c)
+    rudraksh_kernels_active()->encode(r, m);
 }
 
 /**
@@ -71,18 +67,7 @@ void poly_encode(poly *r, const poly *m) {
  * 輸出: m (係數還原回 0~3)
  */
 void poly_decode(poly *m, const poly *noisy_poly) {
-    for(int i=0; i<RUDRAKSH_N; i++) {
-        // 1. 取得數值 (假設已標準化為正數)
-        uint32_t t = (uint32_t)noisy_poly->coeffs[i];
-        
-        // 2. 執行四捨五入公式: (t * 4 + q/2) / q
-        // RUDRAKSH_Q = 7681, q/2 = 3840
-        t = (t << 2) + 3840;
-        t /= RUDRAKSH_Q;
-        
-        // 3. 取模 4 (確保結果是 0~3)
-        m->coeffs[i] = t & 0x3;
-    }
+    rudraksh_kernels_active()->decode(m, noisy_poly);
 }
 
 // ==========================================================
@@ -95,27 +80,8 @@ void poly_decode(poly *m, const poly *noisy_poly) {
  * Bit Packing: 4 個係數 (40 bits) -> 5 bytes
  */
 void poly_compress_u(uint8_t *r, const poly *a) {
-    int i;
-    uint16_t t[4];
-    int ctr = 0;
-
-    for(i=0; i<RUDRAKSH_N/4; i++) {
-        for(int j=0; j<4; j++) {
-            // round(1024 * x / 7681)
-            uint32_t val = (uint32_t)a->coeffs[4*i+j];
-            val = (val << 10) + (RUDRAKSH_Q/2);
-            val = val / RUDRAKSH_Q;
-            t[j] = val & 0x3FF;
-        }
-
-        // Pack 4x10 bits -> 5 bytes
-        r[ctr+0] = (t[0] >> 0);
-        r[ctr+1] = (t[0] >> 8) | (t[1] << 2);
-        r[ctr+2] = (t[1] >> 6) | (t[2] << 4);
-        r[ctr+3] = (t[2] >> 4) | (t[3] << 6);
-        r[ctr+4] = (t[3] >> 2);
-        ctr += 5;
-    }
+    // 實作位於 rudraksh_kernels_impl.h (依 CPU 分派)
+    rudraksh_kernels_active()->compress_u(r, a);
 }
 
 void poly_decompress_u(poly *r, const uint8_t *a) {
@@ -227,30 +193,8 @@ void poly_decompress_v(poly *r, const uint8_t *a) {
  * 邏輯: 8 個係數 (8 * 13 = 104 bits) -> 13 bytes
  */
 void poly_tobytes_13bit(uint8_t *r, const poly *a) {
-    int i;
-    int ctr = 0;
-    for(i=0; i<RUDRAKSH_N/8; i++) {
-        // 取出 8 個係數
-        uint16_t t[8];
-        for(int k=0; k<8; k++) t[k] = a->coeffs[8*i+k] & 0x1FFF; // Mask 13 bits
-
-        // 暴力打包: 8 coeffs -> 13 bytes
-        r[ctr+0]  = (t[0] >> 0);
-        r[ctr+1]  = (t[0] >> 8) | (t[1] << 5);
-        r[ctr+2]  = (t[1] >> 3);
-        r[ctr+3]  = (t[1] >> 11) | (t[2] << 2);
-        r[ctr+4]  = (t[2] >> 6) | (t[3] << 7);
-        r[ctr+5]  = (t[3] >> 1);
-        r[ctr+6]  = (t[3] >> 9) | (t[4] << 4);
-        r[ctr+7]  = (t[4] >> 4);
-        r[ctr+8]  = (t[4] >> 12) | (t[5] << 1);
-        r[ctr+9]  = (t[5] >> 7) | (t[6] << 6);
-        r[ctr+10] = (t[6] >> 2);
-        r[ctr+11] = (t[6] >> 10) | (t[7] << 3);
-        r[ctr+12] = (t[7] >> 5);
-
-        ctr += 13;
-    }
+    // 實作位於 rudraksh_kernels_impl.h (依 CPU 分派)
+    rudraksh_kernels_active()->tobytes_13bit(r, a);
 }
 
 /**
@@ -320,4 +264,81 @@ void polyvec_invntt_tomont(polyvec *r) {
     for(int i=0; i<RUDRAKSH_K; i++) {
         poly_invntt(&r->vec[i]);
     }
-}
\ No newline at end of file
+}
+
+// 矩陣 NTT 轉換 (A 以一般域取樣，需逐一轉換 K*K 個多項式)
+void polymat_ntt(polymat *r) {
+    for(int i=0; i<RUDRAKSH_K; i++) {
+        for(int j=0; j<RUDRAKSH_K; j++) {
+            poly_ntt(&r->matrix[i][j]);
+        }
+    }
+}
+
+// ==========================================================
+// 6. 3-bit Serialization (精簡私鑰格式的 s)
+// s 的係數 (mod q) 只可能是 0, 1, 2, q-1, q-2，即 [-2, 2]
+// 編碼 t = 2 - s ∈ [0, 4]，8 個係數 -> 3 bytes (打包方式同 poly_compress_v)
+// s 為秘密，轉換不使用分支
+// ==========================================================
+
+int poly_tobytes_3bit(uint8_t *r, const poly *a) {
+    uint8_t t[8];
+    int32_t bad = 0;
+    for(int i=0; i<RUDRAKSH_N/8; i++) {
+        for(int j=0; j<8; j++) {
+            int16_t c = a->coeffs[8*i+j];
+            // c > q/2 代表負數：c -= q
+            c -= ((RUDRAKSH_Q/2 - c) >> 15) & RUDRAKSH_Q;
+            // 2 - c 超出 [0, 4] (s 不在 [-2, 2]) 無法以 3 bits 表示，不分支地累計
+            int32_t e = 2 - (int32_t)c;
+            bad |= e | (4 - e);
+            t[j] = (uint8_t)e & 0x7;
+        }
+
+        r[3*i+0] = t[0] | (t[1] << 3) | (t[2] << 6);
+        r[3*i+1] = (t[2] >> 2) | (t[3] << 1) | (t[4] << 4) | (t[5] << 7);
+        r[3*i+2] = (t[5] >> 1) | (t[6] << 2) | (t[7] << 5);
+    }
+    return bad < 0 ? -1 : 0;
+}
+
+int poly_frombytes_3bit(poly *r, const uint8_t *a) {
+    uint8_t t[8];
+    int32_t bad = 0;
+    for(int i=0; i<RUDRAKSH_N/8; i++) {
+        t[0] = a[3*i+0] & 0x7;
+        t[1] = (a[3*i+0] >> 3) & 0x7;
+        t[2] = (a[3*i+0] >> 6) | ((a[3*i+1] & 0x1) << 2);
+        t[3] = (a[3*i+1] >> 1) & 0x7;
+        t[4] = (a[3*i+1] >> 4) & 0x7;
+        t[5] = (a[3*i+1] >> 7) | ((a[3*i+2] & 0x3) << 1);
+        t[6] = (a[3*i+2] >> 2) & 0x7;
+        t[7] = (a[3*i+2] >> 5) & 0x7;
+
+        for(int j=0; j<8; j++) {
+            // s = 2 - t，負數加回 q；t = 5..7 (s < -2) 不是合法的編碼，不分支地累計
+            int16_t c = 2 - (int16_t)t[j];
+            bad |= 4 - (int32_t)t[j];
+            c += (c >> 15) & RUDRAKSH_Q;
+            r->coeffs[8*i+j] = c;
+        }
+    }
+    return bad < 0 ? -1 : 0;
+}
+
+int polyvec_tobytes_3bit(uint8_t *r, const polyvec *a) {
+    int ret = 0;
+    for(int i=0; i<RUDRAKSH_K; i++) {
+        ret |= poly_tobytes_3bit(r + i*RUDRAKSH_POLY_3BIT_BYTES, &a->vec[i]);
+    }
+    return ret;
+}
+
+int polyvec_frombytes_3bit(polyvec *r, const uint8_t *a) {
+    int ret = 0;
+    for(int i=0; i<RUDRAKSH_K; i++) {
+        ret |= poly_frombytes_3bit(&r->vec[i], a + i*RUDRAKSH_POLY_3BIT_BYTES);
+    }
+    return ret;
+}
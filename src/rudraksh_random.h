@@ -4,7 +4,20 @@
 #include <stdint.h>
 #include <stddef.h>
 #include "ascon/ascon.h"
+#include "rudraksh_keccak.h"
+
+// 對稱式後端 (編譯時選擇)：預設 Ascon-XOF / Ascon-Hash，-DRUDRAKSH_SYM_KECCAK 改用 SHAKE128 / SHAKE256，
+// -DRUDRAKSH_SYM_ASCON_FAST 改用 8 輪的 Ascon-XOFa / Ascon-Hasha (profile 見 rudraksh_params.h)
+#ifdef RUDRAKSH_SYM_KECCAK
+#define RUDRAFKSH_STATE rudraksh_keccak_state
+#define RUDRAKSH_SYM_NAME "shake"
+#elif defined(RUDRAKSH_SYM_ASCON_FAST)
+#define RUDRAFKSH_STATE ascon_state_t
+#define RUDRAKSH_SYM_NAME "ascon-fast"
+#else
 #define RUDRAFKSH_STATE ascon_state_t
+#define RUDRAKSH_SYM_NAME "ascon"
+#endif
 
 #define RUDRAKSH_PRF_matrixA_IN_BYTES 18   // 16 bytes seed + 2 byte nonce
 #define RUDRAKSH_PRF_cbd_IN_BYTE 17     // 16 bytes seed + 1 byte nonce
@@ -18,13 +31,36 @@ void rudraksh_prf_init_matrixA(RUDRAFKSH_STATE *s, const uint8_t *key, const uin
 void rudraksh_prf_init_cbd(RUDRAFKSH_STATE *s, const uint8_t *key, const uint8_t *nonce);
 void rudraksh_prf_put(RUDRAFKSH_STATE *s, uint8_t *out );
 
+#ifdef RUDRAKSH_SYM_KECCAK
+// 4 路 SHAKE128：一次展開 4 個 A 多項式 (定義於 rudraksh_keccak.c)
+void rudraksh_prf_init_matrixA_x4(rudraksh_keccakx4_state *s, const uint8_t *key,
+                                  const uint8_t nonce_i[4], const uint8_t nonce_j[4]);
+#endif
+
 
 void rudraksh_hash(uint8_t *output, const uint8_t *input, size_t inlen,size_t outlen);
 
+// Ascon 12 / 8 輪置換 (定義於 rudraksh_ascon.c，所有後端都會編譯)
+void P12(ascon_state_t* s);
+void P8(ascon_state_t* s);
+
 
 // ==========================================================
 // 2. random bytes 產生器
 // ==========================================================
 void rudraksh_randombytes(uint8_t *x, size_t xlen);
 
+// ==========================================================
+// 3. Ascon DRBG (以系統亂數播種一次，之後以 XOF 產生大量亂數)
+//    供大量 keygen 使用，每個執行緒各自一個實例
+// ==========================================================
+#define RUDRAKSH_DRBG_SEEDBYTES 32
+
+typedef struct {
+    RUDRAFKSH_STATE state;
+} rudraksh_drbg;
+
+void rudraksh_drbg_init(rudraksh_drbg *d, const uint8_t seed[RUDRAKSH_DRBG_SEEDBYTES]);
+void rudraksh_drbg_generate(rudraksh_drbg *d, uint8_t *out, size_t outlen);
+
 #endif
\ No newline at end of file
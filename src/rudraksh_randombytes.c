@@ -1,34 +1,35 @@
 #include "rudraksh_random.h"
 
+#ifndef _WIN32
 // ==========================================================
 // Linux/macOS 系統的亂數產生器實作
 // ==========================================================
-// #include <stdio.h>  // 為了 fopen, fread, fclose
-// #include <stdlib.h> // 為了 exit
+#include <stdio.h>  // 為了 fopen, fread, fclose
+#include <stdlib.h> // 為了 exit
 
-// void rudraksh_randombytes(uint8_t *x, size_t xlen) {
-//     // 1. 打開系統的亂數裝置
-//     FILE *f = fopen("/dev/urandom", "rb");
+void rudraksh_randombytes(uint8_t *x, size_t xlen) {
+    // 1. 打開系統的亂數裝置
+    FILE *f = fopen("/dev/urandom", "rb");
     
-//     if (f == NULL) {
-//         fprintf(stderr, "Fatal error: Cannot open /dev/urandom\n");
-//         exit(1);
-//     }
+    if (f == NULL) {
+        fprintf(stderr, "Fatal error: Cannot open /dev/urandom\n");
+        exit(1);
+    }
 
-//     // 2. 讀取 xlen 個 bytes
-//     size_t result = fread(x, 1, xlen, f);
+    // 2. 讀取 xlen 個 bytes
+    size_t result = fread(x, 1, xlen, f);
     
-//     if (result != xlen) {
-//         fprintf(stderr, "Fatal error: Failed to read random bytes\n");
-//         fclose(f);
-//         exit(1);
-//     }
-
-//     // 3. 關閉檔案
-//     fclose(f);
-// }
+    if (result != xlen) {
+        fprintf(stderr, "Fatal error: Failed to read random bytes\n");
+        fclose(f);
+        exit(1);
+    }
 
+    // 3. 關閉檔案
+    fclose(f);
+}
 
+#else
 // ==========================================================
 // Windows 系統的亂數產生器實作 (使用 CryptGenRandom)
 // ==========================================================
@@ -49,4 +50,5 @@ void rudraksh_randombytes(uint8_t *x, size_t xlen) {
     }
     
     CryptReleaseContext(hCryptProv, 0);
-}
\ No newline at end of file
+}
+#endif
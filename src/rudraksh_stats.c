@@ -0,0 +1,27 @@
+#include <string.h>
+
+#include "rudraksh_stats.h"
+
+#ifdef RUDRAKSH_STATS
+
+RUDRAKSH_THREAD_LOCAL rudraksh_stats rudraksh_stats_tls;
+
+int rudraksh_stats_snapshot(rudraksh_stats *out) {
+    *out = rudraksh_stats_tls;
+    return 0;
+}
+
+void rudraksh_stats_reset(void) {
+    memset(&rudraksh_stats_tls, 0, sizeof(rudraksh_stats_tls));
+}
+
+#else
+
+int rudraksh_stats_snapshot(rudraksh_stats *out) {
+    memset(out, 0, sizeof(*out));
+    return -1;
+}
+
+void rudraksh_stats_reset(void) {}
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef RUDRAKSH_STATS_H
+#define RUDRAKSH_STATS_H
+
+#include <stdint.h>
+
+// ==========================================================
+// 熱路徑事件計數器 (編譯時選用：-DRUDRAKSH_STATS，或 make ... STATS=1)
+// 每個執行緒各自一份計數器，不需要 atomic；snapshot 只回傳呼叫者執行緒的值
+// 未定義 RUDRAKSH_STATS 時，RUDRAKSH_STAT_INC / RUDRAKSH_STAT_ADD 展開為空，不產生任何程式碼
+// ==========================================================
+
+typedef struct {
+    uint64_t p12;           // Ascon P12 置換次數 (SHAKE 後端時為 Keccak-f[1600] 次數)
+    uint64_t p8;            // Ascon P8 置換次數 (快速 profile 的吸收 / 擠出)
+    uint64_t hash;          // rudraksh_hash 呼叫次數 (H / G)
+    uint64_t gen_samples;   // poly_generator 取出的 13-bit 候選值
+    uint64_t gen_rejects;   // 其中 >= q 被拒絕的數量
+    uint64_t poly_mul;      // 多項式乘法 (NTT 域 basemul 與 schoolbook)
+    uint64_t ntt;           // 正向 NTT
+    uint64_t invntt;        // 反向 NTT
+} rudraksh_stats;
+
+#ifdef RUDRAKSH_STATS
+
+#ifndef RUDRAKSH_THREAD_LOCAL
+#if defined(_MSC_VER)
+#define RUDRAKSH_THREAD_LOCAL __declspec(thread)
+#else
+#define RUDRAKSH_THREAD_LOCAL _Thread_local
+#endif
+#endif
+
+extern RUDRAKSH_THREAD_LOCAL rudraksh_stats rudraksh_stats_tls;
+#define RUDRAKSH_STAT_INC(field) (rudraksh_stats_tls.field++)
+#define RUDRAKSH_STAT_ADD(field, n) (rudraksh_stats_tls.field += (n))
+
+#else
+
+#define RUDRAKSH_STAT_INC(field) ((void)0)
+#define RUDRAKSH_STAT_ADD(field, n) ((void)0)
+
+#endif
+
+// 複製目前執行緒的計數器，回傳 0；未啟用 RUDRAKSH_STATS 時清零並回傳 -1
+int rudraksh_stats_snapshot(rudraksh_stats *out);
+// 將目前執行緒的計數器歸零
+void rudraksh_stats_reset(void);
+
+#endif // RUDRAKSH_STATS_H
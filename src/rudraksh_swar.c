@@ -0,0 +1,119 @@
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "rudraksh_math.h"
+#include "rudraksh_params.h"
+
+// ==========================================================
+// SWAR (SIMD within a register) 多項式算術：給沒有可用向量指令的 64-bit 平台
+// q = 7681 只需 13 bits，每個 64-bit word 放 4 個係數，每個係數佔 16-bit lane (3 個 guard bits)
+//   - 比較 x >= T：x + (2^15 - T) 的第 15 bit (x, T < 2^15 時不會進位到下一個 lane)
+//   - 條件減 q：把比較結果 (0 / 1) 乘上 q 再減，乘法不會跨 lane
+//   - 延遲化約：lane 可累加到 8q (< 2^16) 才化約，2^13 = 511 (mod q) 把 [0, 8q) 摺到 [0, 2q)
+// 輸入需為 [0, q) (decode 亦同，encode 為 0~3)，此範圍內結果與 scalar 版逐 bit 相同
+// 由 rudraksh_dispatch.c 的 "swar" 變體使用 (沒有向量變體可用時自動選擇)
+// ==========================================================
+
+#define SWAR_LANE(x) ((uint64_t)(x) * 0x0001000100010001ULL)
+#define SWAR_H SWAR_LANE(0x8000)
+#define SWAR_WORDS (RUDRAKSH_N / 4)
+
+// Decode 門檻：round(4x / q) >= k 等價於 x >= ceil((k * q - q / 2) / 4)
+#define SWAR_DECODE_T(k) (((k) * RUDRAKSH_Q - RUDRAKSH_Q / 2 + 3) / 4)
+
+// 以原生 byte order 直接載入 4 個係數：所有運算都在 lane 內進行，lane 與係數的對應順序不影響結果
+// (逐 lane 移位組合的版本 GCC 不會合併成單一 load / store，實測比 scalar 還慢)
+static inline uint64_t swar_load(const int16_t *c) {
+    uint64_t w;
+    memcpy(&w, c, sizeof(w));
+    return w;
+}
+
+static inline void swar_store(int16_t *c, uint64_t w) {
+    memcpy(c, &w, sizeof(w));
+}
+
+// 每個 lane 為 1 (x >= t) 或 0，x, t < 2^15
+static inline uint64_t swar_ge(uint64_t x, uint32_t t) {
+    return ((x + SWAR_LANE(0x8000 - t)) & SWAR_H) >> 15;
+}
+
+// [0, 2q) -> [0, q)
+static inline uint64_t swar_csubq(uint64_t x) {
+    return x - swar_ge(x, RUDRAKSH_Q) * RUDRAKSH_Q;
+}
+
+// [0, 8q) -> [0, 2q)：x = hi * 2^13 + lo = lo + hi * 511 (mod q)，lo + 7 * 511 < 2q
+static inline uint64_t swar_fold(uint64_t x) {
+    return (x & SWAR_LANE(0x1FFF)) + ((x >> 13) & SWAR_LANE(0x7)) * ((1 << 13) - RUDRAKSH_Q);
+}
+
+// r = a + b
+void poly_add_swar(poly *r, const poly *a, const poly *b) {
+    for (int i = 0; i < SWAR_WORDS; i++) {
+        uint64_t s = swar_load(&a->coeffs[4 * i]) + swar_load(&b->coeffs[4 * i]);
+        swar_store(&r->coeffs[4 * i], swar_csubq(s));
+    }
+}
+
+// r = a - b：a + q - b 落在 (0, 2q)，不會向相鄰 lane 借位
+void poly_sub_swar(poly *r, const poly *a, const poly *b) {
+    for (int i = 0; i < SWAR_WORDS; i++) {
+        uint64_t d = swar_load(&a->coeffs[4 * i]) + SWAR_LANE(RUDRAKSH_Q) - swar_load(&b->coeffs[4 * i]);
+        swar_store(&r->coeffs[4 * i], swar_csubq(d));
+    }
+}
+
+// r = m * 1920 (m 為 0~3，乘積 < 2^13，整個 word 直接乘)
+void poly_encode_swar(poly *r, const poly *m) {
+    for (int i = 0; i < SWAR_WORDS; i++) {
+        swar_store(&r->coeffs[4 * i], swar_load(&m->coeffs[4 * i]) * (RUDRAKSH_Q / 4));
+    }
+}
+
+// m = round(4x / q) mod 4：四個門檻的比較結果相加，不需要除法
+void poly_decode_swar(poly *m, const poly *noisy_poly) {
+    for (int i = 0; i < SWAR_WORDS; i++) {
+        uint64_t x = swar_load(&noisy_poly->coeffs[4 * i]);
+        uint64_t t = swar_ge(x, SWAR_DECODE_T(1)) + swar_ge(x, SWAR_DECODE_T(2)) +
+                     swar_ge(x, SWAR_DECODE_T(3)) + swar_ge(x, SWAR_DECODE_T(4));
+        swar_store(&m->coeffs[4 * i], t & SWAR_LANE(0x3));
+    }
+}
+
+// (a * b) 在 NTT 域第 n 個係數的值，化約到 [0, q)
+// 不完整 NTT 時為子環乘法的第 c 項：sum_u x[u] * (u <= c ? y[c - u] : gamma_k * y[c - u + d])
+static inline uint32_t swar_basemul_coeff(const poly *a, const poly *b, int n) {
+#if RUDRAKSH_NTT_BLOCK == 1
+    return (uint32_t)((int32_t)a->coeffs[n] * b->coeffs[n]) % RUDRAKSH_Q;
+#else
+    const int k = n / RUDRAKSH_NTT_BLOCK, c = n % RUDRAKSH_NTT_BLOCK;
+    const int16_t *x = &a->coeffs[k * RUDRAKSH_NTT_BLOCK], *y = &b->coeffs[k * RUDRAKSH_NTT_BLOCK];
+    uint32_t t = 0;
+    for (int u = 0; u < RUDRAKSH_NTT_BLOCK; u++) {
+        uint32_t w = u <= c ? (uint32_t)y[c - u]
+                            : (uint32_t)((int32_t)y[c - u + RUDRAKSH_NTT_BLOCK] * ntt_gamma[k]) % RUDRAKSH_Q;
+        t += (uint32_t)x[u] * w;
+    }
+    return t % RUDRAKSH_Q;
+#endif
+}
+
+// r = sum_j a[j * stride] * b[j] (K 項，NTT 域)
+// 乘積仍逐係數計算並化約到 [0, q)，累加在 lane 上延遲化約：lane 上界 (以 q 為單位) 到 8 時才摺疊一次
+void poly_basemul_dot_swar(poly *r, const poly *a, size_t stride, const poly *b) {
+    for (int i = 0; i < SWAR_WORDS; i++) {
+        uint64_t acc = 0;
+        int bound = 0;
+        for (int j = 0; j < RUDRAKSH_K; j++) {
+            int16_t p[4];
+            for (int l = 0; l < 4; l++) p[l] = (int16_t)swar_basemul_coeff(&a[j * stride], &b[j], 4 * i + l);
+            acc += swar_load(p);
+            if (++bound == 8) {
+                acc = swar_fold(acc);
+                bound = 2;
+            }
+        }
+        swar_store(&r->coeffs[4 * i], swar_csubq(swar_fold(acc)));
+    }
+}
@@ -0,0 +1,126 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 199309L // clock_gettime
+#endif
+
+#include <stdio.h>
+#include <time.h>
+
+#include "rudraksh_trace.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+RUDRAKSH_THREAD_LOCAL rudraksh_tracer rudraksh_trace_current;
+
+static const char *const STAGE_NAMES[RUDRAKSH_TRACE_N_STAGES] = {
+    "kem_keygen", "kem_encaps", "kem_decaps",
+    "unpack", "pack", "hash_pkh", "hash_g", "hash_cz",
+    "decrypt", "encrypt", "gen_a", "sample", "multiply", "compress", "compare",
+};
+
+// ==========================================================
+// 1. 事件發送
+// ==========================================================
+
+static uint64_t now_ns(void) {
+#ifdef _WIN32
+    LARGE_INTEGER f, c;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&c);
+    return (uint64_t)((double)c.QuadPart * 1e9 / (double)f.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+// 只在 tracer 已掛上時由 RUDRAKSH_TRACE_BEGIN / END 呼叫
+void rudraksh_trace_emit(rudraksh_trace_stage stage, int phase) {
+    rudraksh_tracer t = rudraksh_trace_current;
+    if (t.fn != NULL) t.fn(t.user, stage, phase, now_ns());
+}
+
+void rudraksh_trace_set_callback(rudraksh_trace_fn fn, void *user) {
+    rudraksh_trace_current.fn = fn;
+    rudraksh_trace_current.user = user;
+}
+
+const char *rudraksh_trace_stage_name(rudraksh_trace_stage stage) {
+    return (unsigned)stage < RUDRAKSH_TRACE_N_STAGES ? STAGE_NAMES[stage] : "unknown";
+}
+
+// ==========================================================
+// 2. Ring buffer
+// ==========================================================
+
+static void ring_push(void *user, rudraksh_trace_stage stage, int phase, uint64_t ts_ns) {
+    rudraksh_trace_ring *ring = (rudraksh_trace_ring *)user;
+    rudraksh_trace_event *e = &ring->events[ring->written % ring->capacity];
+
+    e->ts_ns = ts_ns;
+    e->stage = (uint8_t)stage;
+    e->phase = (uint8_t)phase;
+    ring->written++;
+}
+
+void rudraksh_trace_ring_init(rudraksh_trace_ring *ring, rudraksh_trace_event *events, size_t capacity, uint32_t tid) {
+    ring->events = events;
+    ring->capacity = capacity;
+    ring->written = 0;
+    ring->tid = tid;
+}
+
+void rudraksh_trace_attach_ring(rudraksh_trace_ring *ring) {
+    if (ring == NULL || ring->capacity == 0) {
+        rudraksh_trace_set_callback(NULL, NULL);
+        return;
+    }
+    rudraksh_trace_set_callback(ring_push, ring);
+}
+
+size_t rudraksh_trace_ring_size(const rudraksh_trace_ring *ring) {
+    return ring->written < ring->capacity ? (size_t)ring->written : ring->capacity;
+}
+
+const rudraksh_trace_event *rudraksh_trace_ring_at(const rudraksh_trace_ring *ring, size_t i) {
+    uint64_t first = ring->written - rudraksh_trace_ring_size(ring);
+    return &ring->events[(first + i) % ring->capacity];
+}
+
+// ==========================================================
+// 3. Chrome trace JSON
+//    {"traceEvents":[{"name":..,"ph":"B"|"E","ts":微秒,"pid":1,"tid":..}, ...]}
+//    ring 已覆寫時，最前面可能有缺少 begin 的 end 事件，這些事件會被略過
+// ==========================================================
+
+int rudraksh_trace_export_chrome(const char *path, const rudraksh_trace_ring *rings, size_t n_rings) {
+    FILE *f = fopen(path, "w");
+    int first = 1;
+
+    if (f == NULL) return -1;
+
+    fprintf(f, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    for (size_t r = 0; r < n_rings; r++) {
+        const rudraksh_trace_ring *ring = &rings[r];
+        size_t n = rudraksh_trace_ring_size(ring);
+        int depth = 0;
+
+        for (size_t i = 0; i < n; i++) {
+            const rudraksh_trace_event *e = rudraksh_trace_ring_at(ring, i);
+
+            if (e->phase == RUDRAKSH_TRACE_PH_BEGIN) depth++;
+            else if (depth == 0) continue;
+            else depth--;
+
+            fprintf(f, "%s{\"name\":\"%s\",\"cat\":\"rudraksh\",\"ph\":\"%c\",\"ts\":%llu.%03u,\"pid\":1,\"tid\":%u}",
+                    first ? "" : ",\n", rudraksh_trace_stage_name((rudraksh_trace_stage)e->stage),
+                    e->phase == RUDRAKSH_TRACE_PH_BEGIN ? 'B' : 'E',
+                    (unsigned long long)(e->ts_ns / 1000), (unsigned)(e->ts_ns % 1000), (unsigned)ring->tid);
+            first = 0;
+        }
+    }
+    fprintf(f, "\n]}\n");
+    return fclose(f) == 0 ? 0 : -1;
+}
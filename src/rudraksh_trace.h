@@ -0,0 +1,93 @@
+#ifndef RUDRAKSH_TRACE_H
+#define RUDRAKSH_TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ==========================================================
+// KEM 階段追蹤 (Tracing)
+// 每個執行緒可各自掛上一個 callback 或 ring buffer，接收帶時間戳 (ns, monotonic) 的 begin / end 事件
+// 未掛上 tracer 時，每個追蹤點只多一次 thread-local 指標比較
+// ==========================================================
+
+#ifndef RUDRAKSH_THREAD_LOCAL
+#if defined(_MSC_VER)
+#define RUDRAKSH_THREAD_LOCAL __declspec(thread)
+#else
+#define RUDRAKSH_THREAD_LOCAL _Thread_local
+#endif
+#endif
+
+typedef enum {
+    // 最外層 API
+    RUDRAKSH_TRACE_KEM_KEYGEN,
+    RUDRAKSH_TRACE_KEM_ENCAPS,
+    RUDRAKSH_TRACE_KEM_DECAPS,
+    // 內部階段
+    RUDRAKSH_TRACE_UNPACK,      // 金鑰反序列化 (含轉到 NTT 域)
+    RUDRAKSH_TRACE_PACK,        // 金鑰序列化
+    RUDRAKSH_TRACE_HASH_PKH,    // pkh = H(pk)
+    RUDRAKSH_TRACE_HASH_G,      // (K, r) = G(pkh || m)
+    RUDRAKSH_TRACE_HASH_CZ,     // K'' = H(c || z)
+    RUDRAKSH_TRACE_DECRYPT,     // PKE 解密 (解壓縮、s^T u、decode)
+    RUDRAKSH_TRACE_ENCRYPT,     // PKE 加密 (decaps 內為重新加密)
+    RUDRAKSH_TRACE_GEN_A,       // 展開矩陣 A (NTT 轉換算在 multiply)
+    RUDRAKSH_TRACE_SAMPLE,      // CBD 取樣
+    RUDRAKSH_TRACE_MULTIPLY,    // NTT、矩陣 / 向量乘法、INTT、加誤差
+    RUDRAKSH_TRACE_COMPRESS,    // 密文壓縮
+    RUDRAKSH_TRACE_COMPARE,     // c == c* 與 constant-time 選擇
+    RUDRAKSH_TRACE_N_STAGES
+} rudraksh_trace_stage;
+
+#define RUDRAKSH_TRACE_PH_BEGIN 0
+#define RUDRAKSH_TRACE_PH_END   1
+
+typedef void (*rudraksh_trace_fn)(void *user, rudraksh_trace_stage stage, int phase, uint64_t ts_ns);
+
+// 目前執行緒的 tracer (NULL 代表未掛上)
+typedef struct {
+    rudraksh_trace_fn fn;
+    void *user;
+} rudraksh_tracer;
+
+extern RUDRAKSH_THREAD_LOCAL rudraksh_tracer rudraksh_trace_current;
+
+void rudraksh_trace_emit(rudraksh_trace_stage stage, int phase);
+
+#define RUDRAKSH_TRACE_BEGIN(stage) \
+    do { if (rudraksh_trace_current.fn != NULL) rudraksh_trace_emit((stage), RUDRAKSH_TRACE_PH_BEGIN); } while (0)
+#define RUDRAKSH_TRACE_END(stage) \
+    do { if (rudraksh_trace_current.fn != NULL) rudraksh_trace_emit((stage), RUDRAKSH_TRACE_PH_END); } while (0)
+
+// 掛上 / 移除 (fn = NULL) 目前執行緒的 callback
+void rudraksh_trace_set_callback(rudraksh_trace_fn fn, void *user);
+const char *rudraksh_trace_stage_name(rudraksh_trace_stage stage);
+
+// ==========================================================
+// Ring buffer tracer：滿了之後覆寫最舊的事件，保留最近的一段
+// ==========================================================
+
+typedef struct {
+    uint64_t ts_ns;
+    uint8_t stage;
+    uint8_t phase;
+} rudraksh_trace_event;
+
+typedef struct {
+    rudraksh_trace_event *events;   // 由呼叫端配置
+    size_t capacity;
+    uint64_t written;               // 累計寫入數 (可能大於 capacity)
+    uint32_t tid;                   // 匯出時的 thread id
+} rudraksh_trace_ring;
+
+void rudraksh_trace_ring_init(rudraksh_trace_ring *ring, rudraksh_trace_event *events, size_t capacity, uint32_t tid);
+// 將 ring 掛為目前執行緒的 tracer
+void rudraksh_trace_attach_ring(rudraksh_trace_ring *ring);
+// ring 內目前保留的事件數，與第 i 舊的事件
+size_t rudraksh_trace_ring_size(const rudraksh_trace_ring *ring);
+const rudraksh_trace_event *rudraksh_trace_ring_at(const rudraksh_trace_ring *ring, size_t i);
+
+// 匯出為 Chrome trace JSON (chrome://tracing 或 Perfetto 開啟)，成功回傳 0
+int rudraksh_trace_export_chrome(const char *path, const rudraksh_trace_ring *rings, size_t n_rings);
+
+#endif // RUDRAKSH_TRACE_H
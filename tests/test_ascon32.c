@@ -0,0 +1,185 @@
+# include "../src/rudraksh_params.h"
+# include "../src/rudraksh_random.h"
+# include "../src/ascon/permutations.h"
+# include "../src/ascon/word.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// ==========================================================
+// bit-interleaved 32-bit Ascon (ascon/config.h 的 ASCON_BI32) 對照 64-bit 版
+// 1. TOBI / FROMBI 互為反函數
+// 2. 置換：64-bit ROUND (PROUNDS) 與 interleave 後的 32-bit ROUNDBI (PROUNDSBI) 輸出相同
+// 3. Hash / XOF / PRF：函式庫輸出 (32-bit 建置或 ASCON32=1 時為 interleaved 狀態) 對照本檔的 64-bit 參考 sponge
+// ==========================================================
+
+#define COLOR_GREEN "\033[0;32m"
+#define COLOR_RED   "\033[0;31m"
+#define COLOR_RESET "\033[0m"
+
+static int fails = 0;
+
+static void check(int cond, const char *msg) {
+    if (cond) {
+        printf("[%sPASS%s] %s\n", COLOR_GREEN, COLOR_RESET, msg);
+    } else {
+        printf("[%sFAIL%s] %s\n", COLOR_RED, COLOR_RESET, msg);
+        fails++;
+    }
+}
+
+static uint64_t next(uint64_t *x) {
+    // xorshift64：只需可重現的測試輸入
+    *x ^= *x << 13;
+    *x ^= *x >> 7;
+    *x ^= *x << 17;
+    return *x;
+}
+
+#ifndef RUDRAKSH_SYM_KECCAK
+
+#ifdef RUDRAKSH_SYM_ASCON_FAST
+#define REF_XOF_IV  ASCON_XOFA_IV
+#define REF_HASH_IV ASCON_HASHA_IV
+#define REF_PB 8
+#else
+#define REF_XOF_IV  ASCON_XOF_IV
+#define REF_HASH_IV ASCON_HASH_IV
+#define REF_PB 12
+#endif
+
+// 64-bit 參考 sponge：一般 (非 interleaved) 表示法，位元組以 little-endian 逐一組合，不經過 word.h
+static uint64_t ref_load(const uint8_t *in, size_t n) {
+    uint64_t x = 0;
+    for (size_t i = 0; i < n; i++) x |= (uint64_t)in[i] << (8 * i);
+    return x;
+}
+
+static void ref_store(uint8_t *out, uint64_t x) {
+    for (int i = 0; i < 8; i++) out[i] = (uint8_t)(x >> (8 * i));
+}
+
+static void ref_init_absorb(ascon_state_t *s, uint64_t iv, const uint8_t *in, size_t len) {
+    s->x[0] = iv;
+    s->x[1] = s->x[2] = s->x[3] = s->x[4] = 0;
+    PROUNDS(s, 12);
+    while (len >= ASCON_HASH_RATE) {
+        s->x[0] ^= ref_load(in, 8);
+        PROUNDS(s, REF_PB);
+        in += ASCON_HASH_RATE;
+        len -= ASCON_HASH_RATE;
+    }
+    s->x[0] ^= ref_load(in, len) ^ (0x01ull << (8 * len));
+    PROUNDS(s, 12);
+}
+
+static void ref_squeeze(ascon_state_t *s, uint8_t *out, size_t outlen) {
+    for (size_t i = 0; i < outlen / 8; i++) {
+        ref_store(out + 8 * i, s->x[0]);
+        PROUNDS(s, REF_PB);
+    }
+}
+
+#endif // RUDRAKSH_SYM_KECCAK
+
+int main(void) {
+    uint64_t x = 0x0123456789ABCDEFull;
+    int ok;
+
+    printf("=======================================\n");
+    printf(" Bit-Interleaved 32-bit Ascon\n");
+    printf("=======================================\n");
+    printf("library permutation: %s\n", ASCON_BI32 ? "bit-interleaved 32-bit" : "64-bit");
+
+    // -----------------------------------------------------
+    // 1. Interleave
+    // -----------------------------------------------------
+    ok = TOBI(0x5555555555555555ull) == 0x00000000FFFFFFFFull && TOBI(0xAAAAAAAAAAAAAAAAull) == 0xFFFFFFFF00000000ull;
+    ok &= TOBI(1) == 1 && TOBI(2) == 1ull << 32 && TOBI(1ull << 63) == 1ull << 63;
+    for (int i = 0; i < 10000; i++) {
+        uint64_t v = next(&x);
+        ok &= FROMBI(TOBI(v)) == v;
+    }
+    check(ok, "TOBI / FROMBI: even bits -> low word, odd bits -> high word, round trip");
+
+    // -----------------------------------------------------
+    // 2. 置換 (12 / 8 / 6 輪)
+    // -----------------------------------------------------
+    const int rounds[3] = {12, 8, 6};
+    for (int r = 0; r < 3; r++) {
+        char msg[96];
+        ok = 1;
+        for (int t = 0; t < 1000; t++) {
+            ascon_state_t a, b;
+            for (int i = 0; i < 5; i++) {
+                a.x[i] = t == 0 ? 0 : t == 1 ? ~0ull : next(&x);
+                b.x[i] = TOBI(a.x[i]);
+            }
+            PROUNDS(&a, rounds[r]);
+            PROUNDSBI(&b, rounds[r]);
+            for (int i = 0; i < 5; i++) ok &= FROMBI(b.x[i]) == a.x[i];
+        }
+        snprintf(msg, sizeof(msg), "P%d: interleaved 32-bit rounds match 64-bit rounds", rounds[r]);
+        check(ok, msg);
+    }
+
+    // -----------------------------------------------------
+    // 3. Hash / XOF / PRF 輸出
+    // -----------------------------------------------------
+#ifdef RUDRAKSH_SYM_KECCAK
+    printf("[SKIP] Hash / XOF / PRF (SHAKE backend)\n");
+#else
+    uint8_t in[CRYPTO_PUBLICKEYBYTES], o1[128], o2[128];
+    ascon_state_t ref;
+    for (size_t i = 0; i < sizeof(in); i++) in[i] = (uint8_t)next(&x);
+
+    // Hash：各種輸入長度 (含空輸入、未滿 / 剛好 / 跨 rate)，16 與 32 bytes 輸出
+    const size_t lens[] = {0, 1, 7, 8, 9, 17, 18, 33, CRYPTO_PUBLICKEYBYTES};
+    ok = 1;
+    for (size_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+        for (size_t outlen = 16; outlen <= 32; outlen += 16) {
+            rudraksh_hash(o1, in, lens[l], outlen);
+            ref_init_absorb(&ref, REF_HASH_IV, in, lens[l]);
+            ref_squeeze(&ref, o2, outlen);
+            ok &= memcmp(o1, o2, outlen) == 0;
+        }
+    }
+    check(ok, "rudraksh_hash matches the 64-bit reference");
+
+    // PRF：矩陣 A (18 bytes 輸入) 與 CBD (17 bytes 輸入)，每次擠出 8 bytes
+    ok = 1;
+    for (int t = 0; t < 16; t++) {
+        ascon_state_t s;
+        uint8_t ni = (uint8_t)t, nj = (uint8_t)(t * 7), buf[18];
+        memcpy(buf, in + t, 16);
+        buf[16] = ni;
+        buf[17] = nj;
+
+        rudraksh_prf_init_matrixA(&s, in + t, &ni, &nj);
+        for (int i = 0; i < 16; i++) rudraksh_prf_put(&s, o1 + 8 * i);
+        ref_init_absorb(&ref, REF_XOF_IV, buf, RUDRAKSH_PRF_matrixA_IN_BYTES);
+        ref_squeeze(&ref, o2, 128);
+        ok &= memcmp(o1, o2, 128) == 0;
+
+        rudraksh_prf_init_cbd(&s, in + t, &ni);
+        for (int i = 0; i < 16; i++) rudraksh_prf_put(&s, o1 + 8 * i);
+        ref_init_absorb(&ref, REF_XOF_IV, buf, RUDRAKSH_PRF_cbd_IN_BYTE);
+        ref_squeeze(&ref, o2, 128);
+        ok &= memcmp(o1, o2, 128) == 0;
+    }
+    check(ok, "PRF (matrix A / CBD) matches the 64-bit reference");
+
+    // XOF 串流 (DRBG)：32 bytes 種子，非 8 的倍數的擠出長度捨棄該 block 剩餘部分
+    rudraksh_drbg d;
+    rudraksh_drbg_init(&d, in);
+    rudraksh_drbg_generate(&d, o1, 100);
+    ref_init_absorb(&ref, REF_XOF_IV, in, RUDRAKSH_DRBG_SEEDBYTES);
+    ref_squeeze(&ref, o2, 104);
+    check(memcmp(o1, o2, 100) == 0, "XOF stream (DRBG) matches the 64-bit reference");
+#endif
+
+    printf("=======================================\n");
+    printf(" End of Tests (%d failures)\n", fails);
+    printf("=======================================\n");
+    return fails != 0;
+}
@@ -0,0 +1,211 @@
+# include "../src/rudraksh_params.h"
+# include "../src/rudraksh_crypto.h"
+# include "../src/rudraksh_autotune.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ==========================================================
+// 輔助工具
+// ==========================================================
+
+#define COLOR_GREEN "\033[0;32m"
+#define COLOR_RED   "\033[0;31m"
+#define COLOR_RESET "\033[0m"
+
+#define CACHE_FILE "test_autotune.cache"
+
+static int fails = 0;
+
+static void check(int cond, const char *msg) {
+    if (cond) {
+        printf("[%sPASS%s] %s\n", COLOR_GREEN, COLOR_RESET, msg);
+    } else {
+        printf("[%sFAIL%s] %s\n", COLOR_RED, COLOR_RESET, msg);
+        fails++;
+    }
+}
+
+static void set_env(const char *name, const char *value) {
+#ifdef _WIN32
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 1);
+#endif
+}
+
+static void unset_env(const char *name) {
+#ifdef _WIN32
+    _putenv_s(name, ""); // Windows 上設為空字串即移除
+#else
+    unsetenv(name);
+#endif
+}
+
+static void random_poly(poly *p, uint32_t *x) {
+    for (int i = 0; i < RUDRAKSH_N; i++) {
+        *x = *x * 1103515245u + 12345u;
+        p->coeffs[i] = (int16_t)((*x >> 8) % RUDRAKSH_Q);
+    }
+}
+
+// 以固定種子產生金鑰並做一次 encaps / decaps，回傳 shared secret 是否一致
+static int derand_kem(public_key_bitstream *pk, secret_key_bitstream *sk) {
+    cipher_text ct;
+    shared_secret ss_enc, ss_dec;
+    uint8_t seed[RUDRAKSH_SEEDBYTES], z[RUDRAKSH_len_K];
+
+    for (int i = 0; i < RUDRAKSH_SEEDBYTES; i++) seed[i] = (uint8_t)(5 * i + 2);
+    for (int i = 0; i < RUDRAKSH_len_K; i++) z[i] = (uint8_t)(11 * i + 3);
+
+    rudraksh_kem_keygen_derand(pk, sk, seed, z);
+    rudraksh_kem_encapsulate(pk, &ct, &ss_enc);
+    rudraksh_kem_decapsulate(sk, &ct, &ss_dec);
+    return memcmp(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K) == 0;
+}
+
+// ==========================================================
+// 1. 每個策略、每個形狀的結果都與 NTT 策略相同
+// ==========================================================
+static void test_strategies_agree(void) {
+    static polymat A0, A;
+    polyvec s0, s, b_ref, b, s_hat_ref;
+    poly c_ref, c;
+    uint32_t x = 2024;
+    char msg[128];
+
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        for (int j = 0; j < RUDRAKSH_K; j++) random_poly(&A0.matrix[i][j], &x);
+        random_poly(&s0.vec[i], &x);
+    }
+
+    const rudraksh_mul_strategy *ref = rudraksh_mul_variant(0);
+    check(ref != NULL && strcmp(ref->name, "ntt") == 0, "Strategy 0 is the NTT reference");
+
+    for (size_t k = 1; k < rudraksh_mul_count(); k++) {
+        const rudraksh_mul_strategy *st = rudraksh_mul_variant(k);
+        int ok;
+
+        A = A0; s = s0; ref->matvec(&b_ref, &A, &s); s_hat_ref = s;
+        A = A0; s = s0; st->matvec(&b, &A, &s);
+        ok = memcmp(&b, &b_ref, sizeof(b)) == 0 && memcmp(&s, &s_hat_ref, sizeof(s)) == 0;
+
+        A = A0; s = s0; ref->matvec_trans(&b_ref, &A, &s);
+        A = A0; s = s0; st->matvec_trans(&b, &A, &s);
+        ok &= memcmp(&b, &b_ref, sizeof(b)) == 0 && memcmp(&s, &s_hat_ref, sizeof(s)) == 0;
+
+        ref->inner(&c_ref, &b_ref, &s0);
+        st->inner(&c, &b_ref, &s0);
+        ok &= memcmp(&c, &c_ref, sizeof(c)) == 0;
+
+        snprintf(msg, sizeof(msg), "%s: matvec / matvec_t / inner match NTT", st->name);
+        check(ok, msg);
+    }
+}
+
+// ==========================================================
+// 2. 每個策略產生相同的 KEM 輸出
+// ==========================================================
+static void test_kem_per_strategy(void) {
+    static public_key_bitstream pk_ref, pk;
+    static secret_key_bitstream sk_ref, sk;
+    char msg[128];
+
+    rudraksh_mul_select("ntt");
+    derand_kem(&pk_ref, &sk_ref);
+
+    for (size_t k = 0; k < rudraksh_mul_count(); k++) {
+        const rudraksh_mul_strategy *st = rudraksh_mul_variant(k);
+        rudraksh_mul_select(st->name);
+        int roundtrip = derand_kem(&pk, &sk);
+        snprintf(msg, sizeof(msg), "%s: keys identical to NTT, encaps/decaps match", st->name);
+        check(roundtrip && memcmp(pk.bytes, pk_ref.bytes, CRYPTO_PUBLICKEYBYTES) == 0 &&
+              memcmp(sk.bytes, sk_ref.bytes, CRYPTO_SECRETKEYBYTES) == 0, msg);
+    }
+    check(rudraksh_mul_select("no-such-strategy") != 0, "Unknown strategy rejected");
+}
+
+// ==========================================================
+// 3. 量測、快取寫入與讀回
+// ==========================================================
+static void test_cache(void) {
+    const rudraksh_mul_strategy *tuned[RUDRAKSH_N_SHAPES];
+    int same = 1, untuned = 1;
+    FILE *f;
+
+    // 未 opt-in：第一次使用不量測也不寫檔，直接使用 NTT
+    unset_env(RUDRAKSH_AUTOTUNE_CACHE_ENV);
+    set_env(RUDRAKSH_MUL_ENV, "");
+    rudraksh_mul_select(NULL);
+    for (int sh = 0; sh < RUDRAKSH_N_SHAPES; sh++) {
+        untuned &= strcmp(rudraksh_mul_choice((rudraksh_mul_shape)sh)->name, "ntt") == 0;
+        for (size_t k = 0; k < rudraksh_mul_count(); k++) untuned &= rudraksh_autotune_cost((rudraksh_mul_shape)sh, k) == 0;
+    }
+    check(untuned, "Without opt-in the first use takes NTT and measures nothing");
+
+    // 設定 RUDRAKSH_AUTOTUNE_CACHE：第一次使用即調校並寫入該檔
+    remove(CACHE_FILE);
+    set_env(RUDRAKSH_AUTOTUNE_CACHE_ENV, CACHE_FILE);
+    rudraksh_mul_select(NULL);
+    rudraksh_mul_choice(RUDRAKSH_SHAPE_MATVEC);
+    f = fopen(CACHE_FILE, "r");
+    check(f != NULL && rudraksh_autotune_cost(RUDRAKSH_SHAPE_MATVEC, 0) != 0,
+          "RUDRAKSH_AUTOTUNE_CACHE opts in to tuning on first use");
+    if (f != NULL) fclose(f);
+
+    remove(CACHE_FILE);
+    rudraksh_mul_select(NULL);
+    check(rudraksh_autotune_init() == 1, "Missing cache triggers a measurement");
+    for (int sh = 0; sh < RUDRAKSH_N_SHAPES; sh++) {
+        tuned[sh] = rudraksh_mul_choice((rudraksh_mul_shape)sh);
+        printf("   %-8s ->  %-10s (", rudraksh_mul_shape_name((rudraksh_mul_shape)sh), tuned[sh]->name);
+        for (size_t k = 0; k < rudraksh_mul_count(); k++) {
+            printf("%s%s %llu ns", k ? ", " : "", rudraksh_mul_variant(k)->name,
+                   (unsigned long long)rudraksh_autotune_cost((rudraksh_mul_shape)sh, k));
+        }
+        printf(")\n");
+    }
+
+    f = fopen(CACHE_FILE, "r");
+    check(f != NULL, "Tuned choice persisted to the cache file");
+    if (f != NULL) fclose(f);
+
+    rudraksh_mul_select(NULL);
+    check(rudraksh_autotune_init() == 0, "Next initialisation reads the cache");
+    for (int sh = 0; sh < RUDRAKSH_N_SHAPES; sh++) same &= rudraksh_mul_choice((rudraksh_mul_shape)sh) == tuned[sh];
+    check(same, "Cached choice equals the measured choice");
+
+    // 簽章不符 (例如策略清單改變) 的快取檔必須重新量測
+    f = fopen(CACHE_FILE, "w");
+    if (f != NULL) {
+        fprintf(f, "rudraksh-autotune 0 ntt\n");
+        fclose(f);
+    }
+    rudraksh_mul_select(NULL);
+    check(rudraksh_autotune_init() == 1, "Stale cache file is ignored and re-measured");
+
+    set_env(RUDRAKSH_MUL_ENV, "schoolbook");
+    rudraksh_mul_select(NULL);
+    check(rudraksh_autotune_init() == 2 && strcmp(rudraksh_mul_choice(RUDRAKSH_SHAPE_MATVEC)->name, "schoolbook") == 0,
+          "RUDRAKSH_MUL forces a strategy without tuning");
+
+    set_env(RUDRAKSH_MUL_ENV, "");
+    rudraksh_mul_select(NULL);
+    remove(CACHE_FILE);
+}
+
+int main(void) {
+    printf("=======================================\n");
+    printf(" Rudraksh Multiplication Autotune Tests\n");
+    printf("=======================================\n");
+
+    test_strategies_agree();
+    test_kem_per_strategy();
+    test_cache();
+
+    printf("\n=============================================\n");
+    printf("   End of Tests (%d failures)\n", fails);
+    printf("=============================================\n");
+    return fails != 0;
+}
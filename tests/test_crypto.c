@@ -296,6 +296,243 @@ void test_kem_implicit_rejection() {
     }
 }
 
+// ==========================================================
+// 4. NTT 域金鑰格式測試
+//    測試: 標準 <-> NTT 轉換、跨格式 Encaps/Decaps、版本檢查
+// ==========================================================
+void test_kem_ntt_format() {
+    printf("\n=== Test 5: NTT-domain Key Format ===\n");
+
+    public_key_bitstream pkb, pkb_back;
+    secret_key_bitstream skb, skb_back;
+    public_key_bitstream_ntt pkb_ntt;
+    secret_key_bitstream_ntt skb_ntt;
+    cipher_text ct;
+    shared_secret ss_enc, ss_dec;
+
+    rudraksh_kem_keygen(&pkb, &skb);
+    rudraksh_pk_to_ntt(&pkb_ntt, &pkb);
+    rudraksh_sk_to_ntt(&skb_ntt, &skb);
+
+    // 1. 轉換回標準格式應完全一致
+    rudraksh_pk_from_ntt(&pkb_back, &pkb_ntt);
+    rudraksh_sk_from_ntt(&skb_back, &skb_ntt);
+    assert_bytes_eq(pkb.bytes, pkb_back.bytes, CRYPTO_PUBLICKEYBYTES, "PK standard -> NTT -> standard roundtrip");
+    assert_bytes_eq(skb.bytes, skb_back.bytes, CRYPTO_SECRETKEYBYTES, "SK standard -> NTT -> standard roundtrip");
+
+    // 2. NTT 格式 Encaps -> 標準格式 Decaps
+    rudraksh_kem_encapsulate_ntt(&pkb_ntt, &ct, &ss_enc);
+    rudraksh_kem_decapsulate(&skb, &ct, &ss_dec);
+    assert_bytes_eq(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K, "Encaps(NTT pk) / Decaps(standard sk) match");
+
+    // 3. 標準格式 Encaps -> NTT 格式 Decaps
+    rudraksh_kem_encapsulate(&pkb, &ct, &ss_enc);
+    rudraksh_kem_decapsulate_ntt(&skb_ntt, &ct, &ss_dec);
+    assert_bytes_eq(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K, "Encaps(standard pk) / Decaps(NTT sk) match");
+
+    // 4. 版本 byte 錯誤時應拒絕
+    pkb_ntt.bytes[0] ^= 0xFF;
+    skb_ntt.bytes[0] ^= 0xFF;
+    if (rudraksh_kem_encapsulate_ntt(&pkb_ntt, &ct, &ss_enc) != 0 &&
+        rudraksh_kem_decapsulate_ntt(&skb_ntt, &ct, &ss_dec) != 0 &&
+        rudraksh_pk_from_ntt(&pkb_back, &pkb_ntt) != 0) {
+        printf("[%sPASS%s] Unknown key format version rejected\n", COLOR_GREEN, COLOR_RESET);
+    } else {
+        printf("[%sFAIL%s] Unknown key format version accepted\n", COLOR_RED, COLOR_RESET);
+    }
+}
+
+void test_kem_compact_sk() {
+    printf("\n=== Test 6: Compact Secret Key Formats ===\n");
+
+    public_key_bitstream pkb, pkb_seed;
+    secret_key_bitstream skb, skb_back;
+    secret_key_bitstream_packed skb_packed;
+    secret_key_bitstream_seed skb_seed;
+    cipher_text ct;
+    shared_secret ss_enc, ss_dec;
+    rudraksh_sk_cache_entry entries[4];
+    rudraksh_sk_cache cache;
+
+    // 1. 3-bit 打包格式：轉換回標準格式應完全一致
+    rudraksh_kem_keygen(&pkb, &skb);
+    rudraksh_sk_to_packed(&skb_packed, &skb);
+    rudraksh_sk_from_packed(&skb_back, &skb_packed);
+    assert_bytes_eq(skb.bytes, skb_back.bytes, CRYPTO_SECRETKEYBYTES, "SK standard -> packed -> standard roundtrip");
+
+    rudraksh_kem_encapsulate(&pkb, &ct, &ss_enc);
+    rudraksh_kem_decapsulate_packed(&skb_packed, &ct, &ss_dec);
+    assert_bytes_eq(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K, "Encaps(standard pk) / Decaps(packed sk) match");
+
+    // 2. seed 格式：重建的 pk 與 keygen 輸出一致
+    rudraksh_kem_keygen_seed(&pkb_seed, &skb_seed);
+    rudraksh_sk_from_seed(&skb_back, &pkb, &skb_seed);
+    assert_bytes_eq(pkb_seed.bytes, pkb.bytes, CRYPTO_PUBLICKEYBYTES, "PK regenerated from seed matches keygen");
+
+    rudraksh_kem_encapsulate(&pkb_seed, &ct, &ss_enc);
+    rudraksh_kem_decapsulate(&skb_back, &ct, &ss_dec);
+    assert_bytes_eq(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K, "Decaps(SK regenerated from seed) match");
+
+    rudraksh_kem_decapsulate_seed(&skb_seed, &ct, &ss_dec, NULL);
+    assert_bytes_eq(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K, "Decaps(seed sk, no cache) match");
+
+    // 3. 快取：第一次未命中、第二次命中，結果相同
+    rudraksh_sk_cache_init(&cache, entries, 4);
+    memset(ss_dec.bytes, 0, RUDRAKSH_len_K);
+    rudraksh_kem_decapsulate_seed(&skb_seed, &ct, &ss_dec, &cache);
+    assert_bytes_eq(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K, "Decaps(seed sk, cache miss) match");
+    memset(ss_dec.bytes, 0, RUDRAKSH_len_K);
+    rudraksh_kem_decapsulate_seed(&skb_seed, &ct, &ss_dec, &cache);
+    assert_bytes_eq(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K, "Decaps(seed sk, cache hit) match");
+
+    if (cache.hits == 1 && cache.misses == 1) {
+        printf("[%sPASS%s] Cache hit/miss counters (1/1)\n", COLOR_GREEN, COLOR_RESET);
+    } else {
+        printf("[%sFAIL%s] Cache hit/miss counters (%llu/%llu)\n", COLOR_RED, COLOR_RESET,
+               (unsigned long long)cache.hits, (unsigned long long)cache.misses);
+    }
+    rudraksh_sk_cache_clear(&cache);
+
+    // 4. s 的 3-bit 欄位 5..7 (s < -2) 不是合法編碼：第一個欄位設為 7
+    skb_packed.bytes[1] |= 0x07;
+    if (rudraksh_sk_from_packed(&skb_back, &skb_packed) != 0 &&
+        rudraksh_kem_decapsulate_packed(&skb_packed, &ct, &ss_dec) != 0) {
+        printf("[%sPASS%s] Out-of-range 3-bit coefficient rejected\n", COLOR_GREEN, COLOR_RESET);
+    } else {
+        printf("[%sFAIL%s] Out-of-range 3-bit coefficient accepted\n", COLOR_RED, COLOR_RESET);
+    }
+    rudraksh_sk_to_packed(&skb_packed, &skb);
+
+    // 4b. 標準格式的 s 係數超出 [-2, 2] 時不能打包：第一個 13-bit 係數改為 10
+    memcpy(skb_back.bytes, skb.bytes, CRYPTO_SECRETKEYBYTES);
+    skb_back.bytes[0] = 10;
+    skb_back.bytes[1] &= 0xE0;
+    if (rudraksh_sk_to_packed(&skb_packed, &skb_back) != 0 &&
+        rudraksh_sk_from_packed(&skb_back, &skb_packed) != 0) {
+        printf("[%sPASS%s] Out-of-range s coefficient rejected by packing\n", COLOR_GREEN, COLOR_RESET);
+    } else {
+        printf("[%sFAIL%s] Out-of-range s coefficient packed\n", COLOR_RED, COLOR_RESET);
+    }
+    rudraksh_sk_to_packed(&skb_packed, &skb);
+
+    // 5. 版本 byte 錯誤時應拒絕
+    skb_packed.bytes[0] ^= 0xFF;
+    skb_seed.bytes[0] ^= 0xFF;
+    if (rudraksh_kem_decapsulate_packed(&skb_packed, &ct, &ss_dec) != 0 &&
+        rudraksh_kem_decapsulate_seed(&skb_seed, &ct, &ss_dec, NULL) != 0 &&
+        rudraksh_sk_from_seed(&skb_back, NULL, &skb_seed) != 0) {
+        printf("[%sPASS%s] Unknown key format version rejected\n", COLOR_GREEN, COLOR_RESET);
+    } else {
+        printf("[%sFAIL%s] Unknown key format version accepted\n", COLOR_RED, COLOR_RESET);
+    }
+}
+
+void test_kem_iov() {
+    printf("\n=== Test 7: Scatter/Gather Ciphertext I/O ===\n");
+
+    public_key_bitstream pkb;
+    secret_key_bitstream skb;
+    cipher_text ct;
+    shared_secret ss_enc, ss_dec;
+
+    // 模擬協定封包：密文從位移 5 開始，被切成 1 / 0 / 397 / 362 (+ 10 多餘) bytes 四段
+    uint8_t record[5 + CRYPTO_CIPHERTEXTBYTES + 10];
+    memset(record, 0xAA, sizeof(record));
+    rudraksh_iovec iov[4] = {
+        { record + 5, 1 },
+        { record + 6, 0 },
+        { record + 6, 397 },
+        { record + 403, 362 + 10 },
+    };
+
+    rudraksh_kem_keygen(&pkb, &skb);
+    int ret = rudraksh_kem_encapsulate_iov(&pkb, iov, 4, &ss_enc);
+
+    // 1. 連續的密文 (從封包中取出) 可用一般 decaps 解開
+    memcpy(ct.bytes, record + 5, CRYPTO_CIPHERTEXTBYTES);
+    rudraksh_kem_decapsulate(&skb, &ct, &ss_dec);
+    assert_bytes_eq(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K, "Encaps(iov) / Decaps(contiguous) match");
+
+    // 2. 封包中密文以外的 bytes 不可被改動
+    int untouched = ret == 0 && record[0] == 0xAA && record[4] == 0xAA;
+    for (size_t i = 5 + CRYPTO_CIPHERTEXTBYTES; i < sizeof(record); i++) untouched &= record[i] == 0xAA;
+    if (untouched) {
+        printf("[%sPASS%s] Bytes outside the ciphertext untouched\n", COLOR_GREEN, COLOR_RESET);
+    } else {
+        printf("[%sFAIL%s] Bytes outside the ciphertext modified\n", COLOR_RED, COLOR_RESET);
+    }
+
+    // 3. 一般 encaps -> 分段 decaps
+    rudraksh_kem_encapsulate(&pkb, &ct, &ss_enc);
+    rudraksh_iovec iov_in[3] = {
+        { ct.bytes, 100 },
+        { ct.bytes + 100, 0 },
+        { ct.bytes + 100, CRYPTO_CIPHERTEXTBYTES - 100 },
+    };
+    memset(ss_dec.bytes, 0, RUDRAKSH_len_K);
+    rudraksh_kem_decapsulate_iov(&skb, iov_in, 3, &ss_dec);
+    assert_bytes_eq(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K, "Encaps(contiguous) / Decaps(iov) match");
+
+    // 4. segments 總長度不足時拒絕
+    if (rudraksh_kem_encapsulate_iov(&pkb, iov_in, 1, &ss_enc) != 0 &&
+        rudraksh_kem_decapsulate_iov(&skb, iov_in, 2, &ss_dec) != 0) {
+        printf("[%sPASS%s] Short iov rejected\n", COLOR_GREEN, COLOR_RESET);
+    } else {
+        printf("[%sFAIL%s] Short iov accepted\n", COLOR_RED, COLOR_RESET);
+    }
+}
+
+// ==========================================================
+// 8. 對稱式 profile 測試
+//    測試: 密文 profile byte、改標成其他 profile 的密文 / 金鑰被拒絕
+// ==========================================================
+void test_kem_profile() {
+    printf("\n=== Test 8: Symmetric Profile (%s, 0x%02X) ===\n", RUDRAKSH_SYM_NAME, RUDRAKSH_PROFILE);
+
+    public_key_bitstream pkb;
+    secret_key_bitstream skb;
+    public_key_bitstream_ntt pkb_ntt;
+    secret_key_bitstream_packed skb_packed;
+    secret_key_bitstream_seed skb_seed;
+    cipher_text ct;
+    shared_secret ss_enc, ss_dec;
+    const uint8_t other = RUDRAKSH_PROFILE == RUDRAKSH_PROFILE_STD ? RUDRAKSH_PROFILE_FAST : RUDRAKSH_PROFILE_STD;
+
+    rudraksh_kem_keygen(&pkb, &skb);
+    rudraksh_kem_encapsulate(&pkb, &ct, &ss_enc);
+
+    // 1. 密文帶有本 profile 的標記
+    if (rudraksh_ct_profile(&ct) == RUDRAKSH_PROFILE) {
+        printf("[%sPASS%s] Ciphertext tagged with profile 0x%02X\n", COLOR_GREEN, COLOR_RESET, RUDRAKSH_PROFILE);
+    } else {
+        printf("[%sFAIL%s] Ciphertext profile byte is 0x%02X\n", COLOR_RED, COLOR_RESET, rudraksh_ct_profile(&ct));
+    }
+
+    // 2. 改標成其他 profile 的密文走 implicit rejection
+    ct.bytes[RUDRAKSH_CT_PROFILE_OFFSET] = other;
+    rudraksh_kem_decapsulate(&skb, &ct, &ss_dec);
+    if (memcmp(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K) != 0) {
+        printf("[%sPASS%s] Ciphertext from another profile rejected\n", COLOR_GREEN, COLOR_RESET);
+    } else {
+        printf("[%sFAIL%s] Ciphertext from another profile accepted\n", COLOR_RED, COLOR_RESET);
+    }
+
+    // 3. 改標成其他 profile 的金鑰 header 在載入時即拒絕
+    rudraksh_pk_to_ntt(&pkb_ntt, &pkb);
+    rudraksh_sk_to_packed(&skb_packed, &skb);
+    rudraksh_kem_keygen_seed(&pkb, &skb_seed);
+    pkb_ntt.bytes[0] = (pkb_ntt.bytes[0] & ~RUDRAKSH_PROFILE_MASK) | other;
+    skb_packed.bytes[0] = (skb_packed.bytes[0] & ~RUDRAKSH_PROFILE_MASK) | other;
+    skb_seed.bytes[0] = (skb_seed.bytes[0] & ~RUDRAKSH_PROFILE_MASK) | other;
+    if (rudraksh_kem_encapsulate_ntt(&pkb_ntt, &ct, &ss_enc) != 0 &&
+        rudraksh_kem_decapsulate_packed(&skb_packed, &ct, &ss_dec) != 0 &&
+        rudraksh_kem_decapsulate_seed(&skb_seed, &ct, &ss_dec, NULL) != 0) {
+        printf("[%sPASS%s] Key headers from another profile rejected\n", COLOR_GREEN, COLOR_RESET);
+    } else {
+        printf("[%sFAIL%s] Key headers from another profile accepted\n", COLOR_RED, COLOR_RESET);
+    }
+}
+
 // ==========================================================
 // Main Function
 // ==========================================================
@@ -356,6 +593,11 @@ int main() {
         printf("[%sFAIL%s] %d failures detected in stress test.\n", COLOR_RED, COLOR_RESET, fails);
     }
 
+    test_kem_ntt_format();
+    test_kem_compact_sk();
+    test_kem_iov();
+    test_kem_profile();
+
     printf("\n=============================================\n");
     printf("   End of Tests\n");
     printf("=============================================\n");
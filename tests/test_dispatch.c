@@ -0,0 +1,100 @@
+# include "../src/rudraksh_params.h"
+# include "../src/rudraksh_crypto.h"
+# include "../src/rudraksh_dispatch.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ==========================================================
+// 輔助工具
+// ==========================================================
+
+#define COLOR_GREEN "\033[0;32m"
+#define COLOR_RED   "\033[0;31m"
+#define COLOR_RESET "\033[0m"
+
+static int fails = 0;
+
+static void check(int cond, const char *msg) {
+    if (cond) {
+        printf("[%sPASS%s] %s\n", COLOR_GREEN, COLOR_RESET, msg);
+    } else {
+        printf("[%sFAIL%s] %s\n", COLOR_RED, COLOR_RESET, msg);
+        fails++;
+    }
+}
+
+static void set_env(const char *value) {
+#ifdef _WIN32
+    _putenv_s(RUDRAKSH_KERNELS_ENV, value);
+#else
+    setenv(RUDRAKSH_KERNELS_ENV, value, 1);
+#endif
+}
+
+// 以固定種子產生金鑰 (所有變體都必須與 scalar 相同)，回傳 encaps / decaps 是否一致
+static int derand_kem(public_key_bitstream *pk, secret_key_bitstream *sk) {
+    cipher_text ct;
+    shared_secret ss_enc, ss_dec;
+    uint8_t seed[RUDRAKSH_SEEDBYTES], z[RUDRAKSH_len_K];
+
+    for (int i = 0; i < RUDRAKSH_SEEDBYTES; i++) seed[i] = (uint8_t)(3 * i + 1);
+    for (int i = 0; i < RUDRAKSH_len_K; i++) z[i] = (uint8_t)(7 * i + 5);
+
+    rudraksh_kem_keygen_derand(pk, sk, seed, z);
+    rudraksh_kem_encapsulate(pk, &ct, &ss_enc);
+    rudraksh_kem_decapsulate(sk, &ct, &ss_dec);
+    return memcmp(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K) == 0;
+}
+
+int main(void) {
+    char msg[128];
+    static public_key_bitstream pk_ref, pk;
+    static secret_key_bitstream sk_ref, sk;
+
+    printf("=======================================\n");
+    printf(" Rudraksh Runtime Dispatch Tests\n");
+    printf("=======================================\n");
+    printf("active kernels: %s\n\n", rudraksh_kernels_active()->name);
+
+    // 1. 變體表
+    const rudraksh_kernels *scalar = rudraksh_kernels_variant(0);
+    check(scalar != NULL && strcmp(scalar->name, "scalar") == 0 && rudraksh_kernels_supported(scalar),
+          "Variant 0 is the scalar reference");
+    check(rudraksh_kernels_supported(rudraksh_kernels_active()), "Active variant is supported by this CPU");
+
+    // 2. 每個 CPU 支援的變體：self-test 與決定性 KEM 輸出
+    rudraksh_kernels_select("scalar");
+    derand_kem(&pk_ref, &sk_ref);
+
+    for (size_t i = 0; i < rudraksh_kernels_count(); i++) {
+        const rudraksh_kernels *k = rudraksh_kernels_variant(i);
+        if (!rudraksh_kernels_supported(k)) {
+            printf("[SKIP] %s not supported by this CPU\n", k->name);
+            continue;
+        }
+        snprintf(msg, sizeof(msg), "%s: all kernels match scalar", k->name);
+        check(rudraksh_kernels_selftest(k) == 0, msg);
+
+        rudraksh_kernels_select(k->name);
+        int roundtrip = derand_kem(&pk, &sk);
+        snprintf(msg, sizeof(msg), "%s: keys identical to scalar, encaps/decaps match", k->name);
+        check(roundtrip && memcmp(pk.bytes, pk_ref.bytes, CRYPTO_PUBLICKEYBYTES) == 0 &&
+              memcmp(sk.bytes, sk_ref.bytes, CRYPTO_SECRETKEYBYTES) == 0, msg);
+    }
+
+    // 3. 選擇介面與環境變數
+    check(rudraksh_kernels_select("no-such-isa") != 0, "Unknown variant rejected");
+    set_env("scalar");
+    check(rudraksh_kernels_select(NULL) == 0 && rudraksh_kernels_active() == scalar,
+          "RUDRAKSH_KERNELS=scalar forces the scalar variant");
+    set_env("no-such-isa");
+    check(rudraksh_kernels_select(NULL) == 0 && rudraksh_kernels_supported(rudraksh_kernels_active()),
+          "Invalid RUDRAKSH_KERNELS falls back to automatic selection");
+
+    printf("\n=============================================\n");
+    printf("   End of Tests (%d failures)\n", fails);
+    printf("=============================================\n");
+    return fails != 0;
+}
@@ -2,6 +2,7 @@
 # include "../src/rudraksh_random.h"
 # include "../src/rudraksh_params.h"
 # include <stdio.h>
+# include <string.h>
 
 int main()
 {
@@ -51,6 +52,19 @@ int main()
 
     printf(">> Avg coffe : %lld( Avg = 3840 )\n",sum/coffe_n);
 
+    // 整個矩陣一次生成 (SHAKE 後端走 4 路路徑) 必須與逐一呼叫 poly_generator 相同
+    int same = 1;
+    for(int mi=0;mi<RUDRAKSH_K;mi++)
+    {
+        for(int mj=0;mj<RUDRAKSH_K;mj++)
+        {
+            poly p;
+            poly_generator(&p,key,(uint8_t)mi,(uint8_t)mj);
+            same &= memcmp(&p,&test_matrix[9].matrix[mi][mj],sizeof(poly)) == 0;
+        }
+    }
+    printf(">> Matrix == per-poly generator (%s) : %s\n", RUDRAKSH_SYM_NAME, same ? "PASSED" : "FAILED");
+
 
     // ==========================================================
     // 2. cbd eta generator
@@ -119,5 +133,5 @@ int main()
     printf("\n=============================================\n");
     printf("   End of Tests\n");
     printf("=============================================\n");
-    return 0;
+    return !same;
 }
\ No newline at end of file
@@ -0,0 +1,161 @@
+# include "../src/rudraksh_params.h"
+# include "../src/rudraksh_crypto.h"
+# include "../src/rudraksh_random.h"
+# include "../src/rudraksh_keystore.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ==========================================================
+// 輔助工具
+// ==========================================================
+
+#define COLOR_GREEN "\033[0;32m"
+#define COLOR_RED   "\033[0;31m"
+#define COLOR_RESET "\033[0m"
+
+#define N_KEYS 32
+#define CAPACITY 128 // create 的最小 index 為 256 槽，最多存放 128 把金鑰
+#define KEYSTORE_PATH "test_keystore.rks"
+
+static int fails = 0;
+
+static void check(int cond, const char *msg) {
+    if (cond) {
+        printf("[%sPASS%s] %s\n", COLOR_GREEN, COLOR_RESET, msg);
+    } else {
+        printf("[%sFAIL%s] %s\n", COLOR_RED, COLOR_RESET, msg);
+        fails++;
+    }
+}
+
+// ==========================================================
+// 單一記錄格式的完整流程：create -> append (含重複) -> open -> find -> decaps
+// ==========================================================
+static void test_format(const char *name, uint32_t key_format, size_t record_bytes) {
+    printf("\n=== Keystore: %s records (%zu bytes) ===\n", name, record_bytes);
+
+    public_key_bitstream *pk = malloc(N_KEYS * sizeof(*pk));
+    uint8_t *records = calloc(CAPACITY, record_bytes);
+    char msg[128];
+
+    for (int i = 0; i < N_KEYS; i++) {
+        secret_key_bitstream sk;
+        rudraksh_kem_keygen(&pk[i], &sk);
+
+        uint8_t *rec = records + i * record_bytes;
+        if (key_format == RUDRAKSH_KEYFMT_NTT) {
+            rudraksh_sk_to_ntt((secret_key_bitstream_ntt *)rec, &sk);
+        } else if (key_format == RUDRAKSH_KEYFMT_PACKED) {
+            rudraksh_sk_to_packed((secret_key_bitstream_packed *)rec, &sk);
+        } else {
+            memcpy(rec, sk.bytes, CRYPTO_SECRETKEYBYTES);
+        }
+    }
+
+    // 1. 分兩批附加，第二批包含一把重複的金鑰
+    check(rudraksh_keystore_create(KEYSTORE_PATH, key_format, N_KEYS) == 0, "Create keystore");
+    int64_t a1 = rudraksh_keystore_append(KEYSTORE_PATH, records, N_KEYS / 2);
+    // 在第二批附加前先映射一份，用於檢查 open 之後才附加的記錄 (步驟 5)
+    rudraksh_keystore ks_old;
+    int old_open = rudraksh_keystore_open(&ks_old, KEYSTORE_PATH) == 0;
+    int64_t a2 = rudraksh_keystore_append(KEYSTORE_PATH, records + (N_KEYS / 2 - 1) * record_bytes, N_KEYS / 2 + 1);
+    snprintf(msg, sizeof(msg), "Bulk append (%lld + %lld, duplicate skipped)", (long long)a1, (long long)a2);
+    check(a1 == N_KEYS / 2 && a2 == N_KEYS / 2, msg);
+
+    // 2. 超過容量時整批拒絕
+    check(rudraksh_keystore_append(KEYSTORE_PATH, records, CAPACITY - N_KEYS + 1) < 0, "Append beyond capacity rejected");
+
+    // 3. 唯讀映射後，以 H(pk) 查詢並直接在映射記憶體上 decaps
+    rudraksh_keystore ks;
+    check(rudraksh_keystore_open(&ks, KEYSTORE_PATH) == 0 && ks.header->count == N_KEYS, "Open (read-only mmap)");
+
+    int found = 0, match = 0, zero_copy = 0;
+    for (int i = 0; i < N_KEYS; i++) {
+        uint8_t pkh[RUDRAKSH_len_K];
+        cipher_text ct;
+        shared_secret ss_enc, ss_dec;
+
+        rudraksh_hash(pkh, pk[i].bytes, CRYPTO_PUBLICKEYBYTES, RUDRAKSH_len_K);
+
+        const uint8_t *rec = rudraksh_keystore_find(&ks, pkh);
+        found += rec != NULL;
+        zero_copy += rec >= ks.base && rec + record_bytes <= ks.base + ks.map_bytes &&
+                     memcmp(rec, records + i * record_bytes, record_bytes) == 0;
+
+        rudraksh_kem_encapsulate(&pk[i], &ct, &ss_enc);
+        if (rudraksh_keystore_decapsulate(&ks, pkh, &ct, &ss_dec) == 0 &&
+            memcmp(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K) == 0) {
+            match++;
+        }
+    }
+    snprintf(msg, sizeof(msg), "Find by pkh (%d/%d), records point into mapping", found, N_KEYS);
+    check(found == N_KEYS && zero_copy == N_KEYS, msg);
+    snprintf(msg, sizeof(msg), "Decaps on mapped records (%d/%d)", match, N_KEYS);
+    check(match == N_KEYS, msg);
+
+    // 4. 不存在的 pkh
+    uint8_t unknown[RUDRAKSH_len_K] = {0};
+    cipher_text ct = {0};
+    shared_secret ss;
+    check(rudraksh_keystore_find(&ks, unknown) == NULL &&
+          rudraksh_keystore_decapsulate(&ks, unknown, &ct, &ss) != 0, "Unknown pkh not found");
+
+    // 5. open 之後才附加的記錄：舊映射只看得到 open 時已提交的記錄，且不會讀出映射範圍
+    int old_found = 0, new_found = 0;
+    for (int i = 0; old_open && i < N_KEYS; i++) {
+        uint8_t pkh[RUDRAKSH_len_K];
+        rudraksh_hash(pkh, pk[i].bytes, CRYPTO_PUBLICKEYBYTES, RUDRAKSH_len_K);
+        const uint8_t *rec = rudraksh_keystore_find(&ks_old, pkh);
+        if (i < N_KEYS / 2) {
+            old_found += rec != NULL && rec + record_bytes <= ks_old.base + ks_old.map_bytes;
+        } else {
+            new_found += rec != NULL;
+        }
+    }
+    snprintf(msg, sizeof(msg), "Append after open: old mapping finds %d/%d, later records %d (expect 0)",
+             old_found, N_KEYS / 2, new_found);
+    check(old_open && old_found == N_KEYS / 2 && new_found == 0, msg);
+    if (old_open) rudraksh_keystore_close(&ks_old);
+
+    rudraksh_keystore_close(&ks);
+    remove(KEYSTORE_PATH);
+    free(pk);
+    free(records);
+}
+
+int main() {
+    printf("=======================================\n");
+    printf(" Rudraksh Memory-mapped Keystore Tests\n");
+    printf("=======================================\n");
+
+    test_format("standard", RUDRAKSH_KEYSTORE_FMT_STANDARD, CRYPTO_SECRETKEYBYTES);
+    test_format("NTT-domain", RUDRAKSH_KEYFMT_NTT, CRYPTO_SECRETKEYBYTES_NTT);
+    test_format("3-bit packed", RUDRAKSH_KEYFMT_PACKED, CRYPTO_SECRETKEYBYTES_PACKED);
+
+    // 不支援的格式 (seed 格式不含 pkh)
+    printf("\n=== Keystore: invalid input ===\n");
+    check(rudraksh_keystore_create(KEYSTORE_PATH, RUDRAKSH_KEYFMT_SEED, N_KEYS) != 0, "Seed-only format rejected");
+    rudraksh_keystore ks;
+    check(rudraksh_keystore_open(&ks, "no_such_keystore.rks") != 0, "Missing file rejected");
+
+    // 竄改 header：index_slots = 2^62 時 records_offset 會溢位繞回，必須在 open / append 時被拒絕
+    int crafted_ok = rudraksh_keystore_create(KEYSTORE_PATH, RUDRAKSH_KEYSTORE_FMT_STANDARD, N_KEYS) == 0;
+    rudraksh_keystore_header hdr;
+    FILE *f = fopen(KEYSTORE_PATH, "r+b");
+    crafted_ok &= f != NULL && fread(&hdr, sizeof(hdr), 1, f) == 1;
+    hdr.index_slots = 1ull << 62;
+    hdr.count = 0;
+    crafted_ok &= f != NULL && fseek(f, 0, SEEK_SET) == 0 && fwrite(&hdr, sizeof(hdr), 1, f) == 1;
+    if (f != NULL) fclose(f);
+    check(crafted_ok && rudraksh_keystore_open(&ks, KEYSTORE_PATH) != 0, "Oversized index_slots rejected by open");
+    uint8_t dummy[CRYPTO_SECRETKEYBYTES] = {0};
+    check(crafted_ok && rudraksh_keystore_append(KEYSTORE_PATH, dummy, 1) < 0, "Oversized index_slots rejected by append");
+    remove(KEYSTORE_PATH);
+
+    printf("\n=============================================\n");
+    printf("   End of Tests (%d failures)\n", fails);
+    printf("=============================================\n");
+    return fails != 0;
+}
@@ -28,6 +28,20 @@ int poly_check_const(const poly *p, int16_t expected) {
     return 1;
 }
 
+// 輔助函式：NTT 域的常數 (不完整 NTT 時只有每個子環的常數項非 0)
+void poly_set_ntt_const(poly *p, int16_t val) {
+    for (int i = 0; i < RUDRAKSH_N; i++) {
+        p->coeffs[i] = i % RUDRAKSH_NTT_BLOCK == 0 ? val % RUDRAKSH_Q : 0;
+    }
+}
+
+int poly_check_ntt_const(const poly *p, int16_t expected) {
+    for (int i = 0; i < RUDRAKSH_N; i++) {
+        if (p->coeffs[i] != (i % RUDRAKSH_NTT_BLOCK == 0 ? expected % RUDRAKSH_Q : 0)) return 0;
+    }
+    return 1;
+}
+
 // =========================================================
 // 測試主體
 // =========================================================
@@ -59,16 +73,16 @@ void test_ntt_arithmetic() {
     // -----------------------------------------------------
     printf("[Test 2] Poly BaseMul Acc: ");
     poly_zero(&r);
-    poly_set_const(&a, 10);
-    poly_set_const(&b, 20);
+    poly_set_ntt_const(&a, 10);
+    poly_set_ntt_const(&b, 20);
     
     // 第一次累加: 0 + 10*20 = 200
     poly_basemul_acc(&r, &a, &b);
-    assert(poly_check_const(&r, 200));
+    assert(poly_check_ntt_const(&r, 200));
 
     // 第二次累加: 200 + 10*20 = 400
     poly_basemul_acc(&r, &a, &b);
-    assert(poly_check_const(&r, 400));
+    assert(poly_check_ntt_const(&r, 400));
     printf("PASSED\n");
 
 
@@ -183,6 +197,352 @@ void test_schoolbook_arithmetic() {
     printf("\nAll Schoolbook Domain Arithmetic Tests PASSED!\n");
 }
 
+// 輔助函式：固定種子的偽隨機多項式 (係數在 [0, q))
+void poly_set_random(poly *p, uint32_t *x) {
+    for (int i = 0; i < RUDRAKSH_N; i++) {
+        *x = *x * 1103515245u + 12345u;
+        p->coeffs[i] = (int16_t)((*x >> 8) % RUDRAKSH_Q);
+    }
+}
+
+void test_karatsuba_arithmetic() {
+    static polymat ma;
+    polyvec s, b_ref, b_kara;
+    poly a, b, r_ref, r_kara;
+    uint32_t x = 7;
+
+    printf("\n=== Starting Karatsuba Arithmetic Tests ===\n");
+
+    // -----------------------------------------------------
+    // 1. 負循環約減 (x * x^63 = -1)
+    // -----------------------------------------------------
+    printf("[Test 1] Polynomial Reduction (x * x^63 = -1): ");
+    poly_zero(&a); a.coeffs[1] = 1;
+    poly_zero(&b); b.coeffs[63] = 1;
+    poly_zero(&r_kara);
+    poly_basemul_acc_karatsuba(&r_kara, &a, &b);
+    assert(poly_check_constant(&r_kara, RUDRAKSH_Q - 1));
+    printf("PASSED\n");
+
+    // -----------------------------------------------------
+    // 2. 與 schoolbook 比對 (含最大量值：全部係數為 q/2 與 q/2 + 1)
+    // -----------------------------------------------------
+    printf("[Test 2] Karatsuba vs Schoolbook (random + extreme): ");
+    for (int t = 0; t < 64; t++) {
+        if (t == 0) { poly_set_const(&a, RUDRAKSH_Q / 2); poly_set_const(&b, RUDRAKSH_Q / 2); }
+        else if (t == 1) { poly_set_const(&a, RUDRAKSH_Q / 2 + 1); poly_set_const(&b, RUDRAKSH_Q / 2); }
+        else { poly_set_random(&a, &x); poly_set_random(&b, &x); }
+        poly_set_random(&r_ref, &x);
+        r_kara = r_ref;
+        poly_basemul_acc_serial(&r_ref, &a, &b);
+        poly_basemul_acc_karatsuba(&r_kara, &a, &b);
+        assert(memcmp(&r_ref, &r_kara, sizeof(poly)) == 0);
+    }
+    printf("PASSED\n");
+
+    // -----------------------------------------------------
+    // 3. 矩陣 / 轉置 / 內積 (整列累加後才化約)
+    // -----------------------------------------------------
+    printf("[Test 3] Matrix-Vector / Transpose / Dot Product: ");
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        for (int j = 0; j < RUDRAKSH_K; j++) poly_set_const(&ma.matrix[i][j], RUDRAKSH_Q / 2);
+        poly_set_const(&s.vec[i], RUDRAKSH_Q / 2);
+    }
+    poly_matrix_vec_mul(&b_ref, &ma, &s);
+    poly_matrix_vec_mul_karatsuba(&b_kara, &ma, &s);
+    assert(memcmp(&b_ref, &b_kara, sizeof(polyvec)) == 0);
+
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        for (int j = 0; j < RUDRAKSH_K; j++) poly_set_random(&ma.matrix[i][j], &x);
+        poly_set_random(&s.vec[i], &x);
+    }
+    poly_matrix_vec_mul(&b_ref, &ma, &s);
+    poly_matrix_vec_mul_karatsuba(&b_kara, &ma, &s);
+    assert(memcmp(&b_ref, &b_kara, sizeof(polyvec)) == 0);
+
+    poly_matrix_trans_vec_mul(&b_ref, &ma, &s);
+    poly_matrix_trans_vec_mul_karatsuba(&b_kara, &ma, &s);
+    assert(memcmp(&b_ref, &b_kara, sizeof(polyvec)) == 0);
+
+    poly_vector_vector_mul(&r_ref, &b_ref, &s);
+    poly_vector_vector_mul_karatsuba(&r_kara, &b_ref, &s);
+    assert(memcmp(&r_ref, &r_kara, sizeof(poly)) == 0);
+    printf("PASSED\n");
+}
+
+void test_fft_arithmetic() {
+    static polymat ma;
+    polyvec s, b_ref, b_fft;
+    poly a, b, r_ref, r_fft;
+    uint32_t x = 11;
+
+    printf("\n=== Starting FFT Arithmetic Tests (%s) ===\n", rudraksh_fft_impl());
+
+    // -----------------------------------------------------
+    // 1. 負循環約減 (x * x^63 = -1)
+    // -----------------------------------------------------
+    printf("[Test 1] Polynomial Reduction (x * x^63 = -1): ");
+    poly_zero(&a); a.coeffs[1] = 1;
+    poly_zero(&b); b.coeffs[63] = 1;
+    poly_zero(&r_fft);
+    poly_basemul_acc_fft(&r_fft, &a, &b);
+    assert(poly_check_constant(&r_fft, RUDRAKSH_Q - 1));
+    printf("PASSED\n");
+
+    // -----------------------------------------------------
+    // 2. 與 schoolbook 比對 (四捨五入後必須是精確整數)
+    // -----------------------------------------------------
+    printf("[Test 2] FFT vs Schoolbook (random + extreme): ");
+    for (int t = 0; t < 64; t++) {
+        if (t == 0) { poly_set_const(&a, RUDRAKSH_Q / 2); poly_set_const(&b, RUDRAKSH_Q / 2); }
+        else if (t == 1) { poly_set_const(&a, RUDRAKSH_Q / 2 + 1); poly_set_const(&b, RUDRAKSH_Q / 2); }
+        else { poly_set_random(&a, &x); poly_set_random(&b, &x); }
+        poly_set_random(&r_ref, &x);
+        r_fft = r_ref;
+        poly_basemul_acc_serial(&r_ref, &a, &b);
+        poly_basemul_acc_fft(&r_fft, &a, &b);
+        assert(memcmp(&r_ref, &r_fft, sizeof(poly)) == 0);
+    }
+    printf("PASSED\n");
+
+    // -----------------------------------------------------
+    // 3. 矩陣 / 轉置 / 內積 (頻域累加，最大量值為 K 個乘積之和)
+    // -----------------------------------------------------
+    printf("[Test 3] Matrix-Vector / Transpose / Dot Product: ");
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        for (int j = 0; j < RUDRAKSH_K; j++) poly_set_const(&ma.matrix[i][j], RUDRAKSH_Q / 2);
+        poly_set_const(&s.vec[i], RUDRAKSH_Q / 2);
+    }
+    poly_matrix_vec_mul(&b_ref, &ma, &s);
+    poly_matrix_vec_mul_fft(&b_fft, &ma, &s);
+    assert(memcmp(&b_ref, &b_fft, sizeof(polyvec)) == 0);
+
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        for (int j = 0; j < RUDRAKSH_K; j++) poly_set_random(&ma.matrix[i][j], &x);
+        poly_set_random(&s.vec[i], &x);
+    }
+    poly_matrix_vec_mul(&b_ref, &ma, &s);
+    poly_matrix_vec_mul_fft(&b_fft, &ma, &s);
+    assert(memcmp(&b_ref, &b_fft, sizeof(polyvec)) == 0);
+
+    poly_matrix_trans_vec_mul(&b_ref, &ma, &s);
+    poly_matrix_trans_vec_mul_fft(&b_fft, &ma, &s);
+    assert(memcmp(&b_ref, &b_fft, sizeof(polyvec)) == 0);
+
+    poly_vector_vector_mul(&r_ref, &b_ref, &s);
+    poly_vector_vector_mul_fft(&r_fft, &b_ref, &s);
+    assert(memcmp(&r_ref, &r_fft, sizeof(poly)) == 0);
+    printf("PASSED\n");
+}
+
+void test_kronecker_arithmetic() {
+    static polymat ma;
+    polyvec s, b_ref, b_kron;
+    poly a, b, r_ref, r_kron;
+    uint32_t x = 13;
+
+    printf("\n=== Starting Kronecker Arithmetic Tests ===\n");
+
+    // -----------------------------------------------------
+    // 1. 負循環約減 (x * x^63 = -1)
+    // -----------------------------------------------------
+    printf("[Test 1] Polynomial Reduction (x * x^63 = -1): ");
+    poly_zero(&a); a.coeffs[1] = 1;
+    poly_zero(&b); b.coeffs[63] = 1;
+    poly_zero(&r_kron);
+    poly_basemul_acc_kronecker(&r_kron, &a, &b);
+    assert(poly_check_constant(&r_kron, RUDRAKSH_Q - 1));
+    printf("PASSED\n");
+
+    // -----------------------------------------------------
+    // 2. 與 schoolbook 比對 (打包用 [0, q) 代表，最大量值為全部係數 q - 1)
+    // -----------------------------------------------------
+    printf("[Test 2] Kronecker vs Schoolbook (random + extreme): ");
+    for (int t = 0; t < 64; t++) {
+        if (t == 0) { poly_set_const(&a, RUDRAKSH_Q - 1); poly_set_const(&b, RUDRAKSH_Q - 1); }
+        else if (t == 1) { poly_set_const(&a, -(RUDRAKSH_Q - 1)); poly_set_const(&b, RUDRAKSH_Q - 1); }
+        else { poly_set_random(&a, &x); poly_set_random(&b, &x); }
+        poly_set_random(&r_ref, &x);
+        r_kron = r_ref;
+        poly_basemul_acc_serial(&r_ref, &a, &b);
+        poly_basemul_acc_kronecker(&r_kron, &a, &b);
+        assert(memcmp(&r_ref, &r_kron, sizeof(poly)) == 0);
+    }
+    printf("PASSED\n");
+
+    // -----------------------------------------------------
+    // 3. 矩陣 / 轉置 / 內積 (K 個乘積在 35-bit 欄位內累加，不得進位到相鄰係數)
+    // -----------------------------------------------------
+    printf("[Test 3] Matrix-Vector / Transpose / Dot Product: ");
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        for (int j = 0; j < RUDRAKSH_K; j++) poly_set_const(&ma.matrix[i][j], RUDRAKSH_Q - 1);
+        poly_set_const(&s.vec[i], RUDRAKSH_Q - 1);
+    }
+    poly_matrix_vec_mul(&b_ref, &ma, &s);
+    poly_matrix_vec_mul_kronecker(&b_kron, &ma, &s);
+    assert(memcmp(&b_ref, &b_kron, sizeof(polyvec)) == 0);
+
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        for (int j = 0; j < RUDRAKSH_K; j++) poly_set_random(&ma.matrix[i][j], &x);
+        poly_set_random(&s.vec[i], &x);
+    }
+    poly_matrix_vec_mul(&b_ref, &ma, &s);
+    poly_matrix_vec_mul_kronecker(&b_kron, &ma, &s);
+    assert(memcmp(&b_ref, &b_kron, sizeof(polyvec)) == 0);
+
+    poly_matrix_trans_vec_mul(&b_ref, &ma, &s);
+    poly_matrix_trans_vec_mul_kronecker(&b_kron, &ma, &s);
+    assert(memcmp(&b_ref, &b_kron, sizeof(polyvec)) == 0);
+
+    poly_vector_vector_mul(&r_ref, &b_ref, &s);
+    poly_vector_vector_mul_kronecker(&r_kron, &b_ref, &s);
+    assert(memcmp(&r_ref, &r_kron, sizeof(poly)) == 0);
+    printf("PASSED\n");
+}
+
+void test_fm_arithmetic() {
+    static polymat ma, ma_ntt;
+    static polymat_fm ma_fm;
+    polyvec s, s_ntt, b_ref, b_fm;
+    polyvec_fm s_fm, r_fm;
+    uint32_t x = 17;
+
+    printf("\n=== Starting Frequency-Major NTT Tests ===\n");
+
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        for (int j = 0; j < RUDRAKSH_K; j++) poly_set_random(&ma.matrix[i][j], &x);
+        poly_set_random(&s.vec[i], &x);
+    }
+
+    // -----------------------------------------------------
+    // 1. ntt_fm 的一般佈局輸出與 polymat_ntt 相同，頻率優先副本逐一對應
+    // -----------------------------------------------------
+    printf("[Test 1] NTT Output Layout (normal + frequency-major): ");
+    ma_ntt = ma;
+    polymat_ntt(&ma_ntt);
+    polymat ma_tmp = ma;
+    polymat_ntt_fm(&ma_fm, &ma_tmp);
+    assert(memcmp(&ma_tmp, &ma_ntt, sizeof(polymat)) == 0);
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        for (int j = 0; j < RUDRAKSH_K; j++) {
+            for (int c = 0; c < RUDRAKSH_N; c++) {
+                int p = RUDRAKSH_FM_POS(c);
+                assert(ma_fm.t[p / RUDRAKSH_FM_LANES][i][j][p % RUDRAKSH_FM_LANES] == ma_ntt.matrix[i][j].coeffs[c]);
+            }
+        }
+    }
+    printf("PASSED\n");
+
+    // -----------------------------------------------------
+    // 2. 矩陣 / 轉置 (GEMV + invntt_fm) 與一般域 schoolbook 比對
+    // -----------------------------------------------------
+    printf("[Test 2] Matrix-Vector / Transpose vs Schoolbook: ");
+    s_ntt = s;
+    polyvec_ntt_fm(&s_fm, &s_ntt);
+    poly_matrix_vec_mul(&b_ref, &ma, &s);
+    poly_matrix_vec_mul_fm(&r_fm, &ma_fm, &s_fm);
+    polyvec_invntt_fm(&b_fm, &r_fm);
+    assert(memcmp(&b_ref, &b_fm, sizeof(polyvec)) == 0);
+
+    poly_matrix_trans_vec_mul(&b_ref, &ma, &s);
+    poly_matrix_trans_vec_mul_fm(&r_fm, &ma_fm, &s_fm);
+    polyvec_invntt_fm(&b_fm, &r_fm);
+    assert(memcmp(&b_ref, &b_fm, sizeof(polyvec)) == 0);
+    printf("PASSED\n");
+
+    // -----------------------------------------------------
+    // 3. 最大量值 (係數全為 q - 1 的 NTT 域輸入，K 個乘積在 int32 累加)
+    // -----------------------------------------------------
+    printf("[Test 3] Extreme NTT-Domain Inputs: ");
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        for (int j = 0; j < RUDRAKSH_K; j++) poly_set_const(&ma_ntt.matrix[i][j], RUDRAKSH_Q - 1);
+        poly_set_const(&s_ntt.vec[i], RUDRAKSH_Q - 1);
+    }
+    for (int g = 0; g < RUDRAKSH_FM_TILES; g++) {
+        for (int i = 0; i < RUDRAKSH_K; i++) {
+            for (int l = 0; l < RUDRAKSH_FM_LANES; l++) {
+                for (int j = 0; j < RUDRAKSH_K; j++) ma_fm.t[g][i][j][l] = RUDRAKSH_Q - 1;
+                s_fm.t[g][i][l] = RUDRAKSH_Q - 1;
+            }
+        }
+    }
+    poly_matrix_vec_mul_ntt(&b_ref, &ma_ntt, &s_ntt);
+    poly_matrix_vec_mul_fm(&r_fm, &ma_fm, &s_fm);
+    for (int i = 0; i < RUDRAKSH_K; i++) {
+        for (int c = 0; c < RUDRAKSH_N; c++) {
+            int p = RUDRAKSH_FM_POS(c);
+            assert(r_fm.t[p / RUDRAKSH_FM_LANES][i][p % RUDRAKSH_FM_LANES] == b_ref.vec[i].coeffs[c]);
+        }
+    }
+    printf("PASSED\n");
+}
+
+void test_swar_arithmetic() {
+    static polymat ma;
+    polyvec s;
+    poly a, b, r_ref, r_swar;
+    uint32_t x = 19;
+
+    printf("\n=== Starting SWAR Arithmetic Tests ===\n");
+
+    // -----------------------------------------------------
+    // 1. 加減 (邊界值 0 / q - 1 與隨機值，逐係數 fqadd / fqsub)
+    // -----------------------------------------------------
+    printf("[Test 1] SWAR Add / Sub vs fqadd / fqsub: ");
+    for (int t = 0; t < 64; t++) {
+        if (t < 4) { poly_set_const(&a, (t & 1) ? RUDRAKSH_Q - 1 : 0); poly_set_const(&b, (t & 2) ? RUDRAKSH_Q - 1 : 0); }
+        else { poly_set_random(&a, &x); poly_set_random(&b, &x); }
+        poly_add_swar(&r_swar, &a, &b);
+        for (int i = 0; i < RUDRAKSH_N; i++) assert(r_swar.coeffs[i] == fqadd(a.coeffs[i], b.coeffs[i]));
+        poly_sub_swar(&r_swar, &a, &b);
+        for (int i = 0; i < RUDRAKSH_N; i++) assert(r_swar.coeffs[i] == fqsub(a.coeffs[i], b.coeffs[i]));
+    }
+    printf("PASSED\n");
+
+    // -----------------------------------------------------
+    // 2. Encode (0~3) 與 Decode (窮舉 [0, q))
+    // -----------------------------------------------------
+    printf("[Test 2] SWAR Encode / Decode (exhaustive): ");
+    for (int i = 0; i < RUDRAKSH_N; i++) a.coeffs[i] = i & 3;
+    poly_encode_swar(&r_swar, &a);
+    for (int i = 0; i < RUDRAKSH_N; i++) assert(r_swar.coeffs[i] == (i & 3) * 1920);
+    for (int base = 0; base < RUDRAKSH_Q; base += RUDRAKSH_N) {
+        for (int i = 0; i < RUDRAKSH_N; i++) a.coeffs[i] = (base + i) % RUDRAKSH_Q;
+        poly_decode_swar(&r_swar, &a);
+        for (int i = 0; i < RUDRAKSH_N; i++) {
+            assert(r_swar.coeffs[i] == (int16_t)(((((uint32_t)a.coeffs[i]) << 2) + 3840) / RUDRAKSH_Q & 3));
+        }
+    }
+    printf("PASSED\n");
+
+    // -----------------------------------------------------
+    // 3. K 項點乘和 (延遲化約；全為 q - 1 時每個 lane 的累加量最大)
+    // -----------------------------------------------------
+    printf("[Test 3] SWAR Dot Product (lazy reduction): ");
+    for (int t = 0; t < 2; t++) {
+        for (int i = 0; i < RUDRAKSH_K; i++) {
+            for (int j = 0; j < RUDRAKSH_K; j++) {
+                if (t == 0) poly_set_const(&ma.matrix[i][j], RUDRAKSH_Q - 1);
+                else poly_set_random(&ma.matrix[i][j], &x);
+            }
+            if (t == 0) poly_set_const(&s.vec[i], RUDRAKSH_Q - 1);
+            else poly_set_random(&s.vec[i], &x);
+        }
+        for (int i = 0; i < RUDRAKSH_K; i++) {
+            poly_zero(&r_ref);
+            for (int j = 0; j < RUDRAKSH_K; j++) poly_basemul_acc(&r_ref, &ma.matrix[i][j], &s.vec[j]);
+            poly_basemul_dot_swar(&r_swar, ma.matrix[i], 1, s.vec);
+            assert(memcmp(&r_ref, &r_swar, sizeof(poly)) == 0);
+
+            poly_zero(&r_ref);
+            for (int j = 0; j < RUDRAKSH_K; j++) poly_basemul_acc(&r_ref, &ma.matrix[j][i], &s.vec[j]);
+            poly_basemul_dot_swar(&r_swar, &ma.matrix[0][i], RUDRAKSH_K, s.vec);
+            assert(memcmp(&r_ref, &r_swar, sizeof(poly)) == 0);
+        }
+    }
+    printf("PASSED\n");
+}
+
 int main()
 {
     printf("\n=============================================\n");
@@ -190,6 +550,11 @@ int main()
     printf("=============================================\n");
 
     test_ntt_arithmetic();
+    test_karatsuba_arithmetic();
+    test_fft_arithmetic();
+    test_kronecker_arithmetic();
+    test_fm_arithmetic();
+    test_swar_arithmetic();
 
     printf("\n=============================================\n");
     printf("   End of Tests\n");
@@ -16,8 +16,9 @@ int main() {
 
     poly a;
     
-    // 初始化一個簡單的多項式 a(x) = 1 + 1x + 1x^2 ... (全為1)
-    for(int i=0; i<RUDRAKSH_N; i++) a.coeffs[i] = 1;
+    // 初始化常數多項式 a(x) = 1
+    poly_zero(&a);
+    a.coeffs[0] = 1;
     
     print_poly("Input", &a);
 
@@ -27,13 +28,18 @@ int main() {
     print_poly("Output (NTT)", &a);
     
     // 簡單驗證：
-    // 對於全 1 的輸入，NTT 的結果第一個係數應該是 N (或者 N mod Q)
-    // 其他係數應該是 0 (這是 DFT 的性質)
+    // 負循環 NTT 是在 X^64 + 1 的 64 個根上求值，常數多項式 1 的結果應全為 1
+    // (不完整 NTT 時為每個子環的常數 1：每 RUDRAKSH_NTT_BLOCK 個係數的第一個為 1，其餘為 0)
     printf("\nVerification Check:\n");
-    printf("Coeff[0] should be %d. Actual: %d\n", RUDRAKSH_N, a.coeffs[0]);
-    printf("Coeff[1] should be 0.  Actual: %d\n", a.coeffs[1]);
+    printf("Coeff[0] should be 1. Actual: %d\n", a.coeffs[0]);
+    printf("Coeff[%d] should be 1. Actual: %d\n", RUDRAKSH_N - RUDRAKSH_NTT_BLOCK, a.coeffs[RUDRAKSH_N - RUDRAKSH_NTT_BLOCK]);
 
-    if (a.coeffs[0] == RUDRAKSH_N && a.coeffs[1] == 0) {
+    int fail = 0;
+    for(int i=0; i<RUDRAKSH_N; i++) {
+        if (a.coeffs[i] != (i % RUDRAKSH_NTT_BLOCK == 0)) fail = 1;
+    }
+
+    if (!fail) {
         printf(">> NTT Test PASSED! (Basic Property Check)\n");
     } else {
         printf(">> NTT Test FAILED!\n");
@@ -47,12 +53,12 @@ int main() {
     
     print_poly("Output (INTT)", &a);
 
-    // 驗證是否變回全 1
-    int fail = 0;
+    // 驗證是否變回 1
+    fail = 0;
     for(int i=0; i<RUDRAKSH_N; i++) {
-        if (a.coeffs[i] != 1) {
+        if (a.coeffs[i] != (i == 0)) {
             fail = 1;
-            printf("Error at index %d: expected 1, got %d\n", i, a.coeffs[i]);
+            printf("Error at index %d: expected %d, got %d\n", i, (i == 0), a.coeffs[i]);
             break;
         }
     }
@@ -63,6 +69,40 @@ int main() {
         printf(">> Round-Trip Test FAILED!\n");
     }
 
+    // =========================================================
+    // Part 2.5: NTT 乘法 vs Schoolbook 乘法
+    // =========================================================
+    printf("\n=== NTT Mul vs Schoolbook Test ===\n");
+    {
+        poly x, y, r_school, r_ntt;
+        for(int i=0; i<RUDRAKSH_N; i++) {
+            x.coeffs[i] = (i * 1237 + 11) % RUDRAKSH_Q;
+            y.coeffs[i] = (i * 4099 + 7) % RUDRAKSH_Q;
+        }
+        poly_zero(&r_school);
+        poly_basemul_acc_serial(&r_school, &x, &y);
+
+        poly_ntt(&x);
+        poly_ntt(&y);
+        poly_zero(&r_ntt);
+        poly_basemul_acc(&r_ntt, &x, &y);
+        poly_invntt(&r_ntt);
+
+        fail = 0;
+        for(int i=0; i<RUDRAKSH_N; i++) {
+            if (r_school.coeffs[i] != r_ntt.coeffs[i]) {
+                fail = 1;
+                printf("Error at index %d: schoolbook %d, ntt %d\n", i, r_school.coeffs[i], r_ntt.coeffs[i]);
+                break;
+            }
+        }
+        if (!fail) {
+            printf(">> INTT(NTT(a) * NTT(b)) == a * b mod (X^64 + 1) PASSED!\n");
+        } else {
+            printf(">> NTT Mul Test FAILED!\n");
+        }
+    }
+
     // =========================================================
     // Part 3: Vector-Vector Multiplication Test (c = b^T * s)
     // =========================================================
@@ -75,14 +115,14 @@ int main() {
     // 我們假設 b 和 s 已經是在 NTT 域中的資料
     for(int i = 0; i < RUDRAKSH_K; i++) {
         for(int j = 0; j < RUDRAKSH_N; j++) {
-            b.vec[i].coeffs[j] = 1;
-            s.vec[i].coeffs[j] = 1;
+            b.vec[i].coeffs[j] = j % RUDRAKSH_NTT_BLOCK == 0; // NTT 域的常數 1
+            s.vec[i].coeffs[j] = j % RUDRAKSH_NTT_BLOCK == 0;
         }
     }
 
     // 2. 執行向量內積 (Inner Product)
     // c = b[0]*s[0] + b[1]*s[1] + ... + b[K-1]*s[K-1]
-    poly_vector_vector_mul(&c, &b, &s);
+    poly_vector_vector_mul_ntt(&c, &b, &s);
 
     // 3. 驗證結果
     // 因為 b[i]*s[i] = 1*1 = 1
@@ -92,7 +132,7 @@ int main() {
     int expected_val = RUDRAKSH_K; 
     
     for(int i = 0; i < RUDRAKSH_N; i++) {
-        if (c.coeffs[i] != expected_val) {
+        if (c.coeffs[i] != (i % RUDRAKSH_NTT_BLOCK == 0 ? expected_val : 0)) {
             fail = 1;
             printf("VecMul Error at coeff %d: expected %d, got %d\n", 
                    i, expected_val, c.coeffs[i]);
@@ -119,7 +159,7 @@ int main() {
     for(int i = 0; i < RUDRAKSH_K; i++) {
         for(int j = 0; j < RUDRAKSH_K; j++) {
             for(int k = 0; k < RUDRAKSH_N; k++) {
-                A.matrix[i][j].coeffs[k] = 1;
+                A.matrix[i][j].coeffs[k] = k % RUDRAKSH_NTT_BLOCK == 0;
             }
         }
     }
@@ -127,7 +167,7 @@ int main() {
     // 2. 執行矩陣向量乘法
     // res_vec[i] = sum( A[j][i] * s[j] )  <-- 注意這是轉置乘法
     // 由於我們輸入全都是 1，轉置與否結果數值是一樣的
-    poly_matrix_trans_vec_mul(&res_vec, &A, &s);
+    poly_matrix_trans_vec_mul_ntt(&res_vec, &A, &s);
 
     // 3. 驗證結果
     // 每個結果向量的多項式，都是 K 個 (1*1) 的累加
@@ -135,7 +175,7 @@ int main() {
     fail = 0;
     for(int i = 0; i < RUDRAKSH_K; i++) {
         for(int j = 0; j < RUDRAKSH_N; j++) {
-            if (res_vec.vec[i].coeffs[j] != expected_val) {
+            if (res_vec.vec[i].coeffs[j] != (j % RUDRAKSH_NTT_BLOCK == 0 ? expected_val : 0)) {
                 fail = 1;
                 printf("MatMul Error at vec[%d].coeff[%d]: expected %d, got %d\n", 
                        i, j, expected_val, res_vec.vec[i].coeffs[j]);
@@ -0,0 +1,139 @@
+# include "../src/rudraksh_params.h"
+# include "../src/rudraksh_math.h"
+# include "../src/rudraksh_dispatch.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// ==========================================================
+// 產生的展開版 NTT (tools/gen_ntt_unrolled.c -> src/rudraksh_ntt_unrolled.h) 對照迴圈參考實作
+// 參考實作即展開前的 poly_ntt / poly_invntt (查 zetas 表的三層迴圈，每步都化約到 [0, q))，層數依 RUDRAKSH_NTT_LAYERS
+// ==========================================================
+
+#define COLOR_GREEN "\033[0;32m"
+#define COLOR_RED   "\033[0;31m"
+#define COLOR_RESET "\033[0m"
+
+#define KERN_INV_2 3841
+
+static int fails = 0;
+
+static void check(int cond, const char *msg) {
+    if (cond) {
+        printf("[%sPASS%s] %s\n", COLOR_GREEN, COLOR_RESET, msg);
+    } else {
+        printf("[%sFAIL%s] %s\n", COLOR_RED, COLOR_RESET, msg);
+        fails++;
+    }
+}
+
+static int16_t mod_q(int32_t x) {
+    x %= RUDRAKSH_Q;
+    return (int16_t)(x < 0 ? x + RUDRAKSH_Q : x);
+}
+
+// 正向 NTT: Cooley-Tukey (輸入自然順序 -> 輸出位元反轉)
+static void ref_ntt(poly *p) {
+    int t = 32, k = 1;
+    for (int i = 0; i < RUDRAKSH_N; i++) p->coeffs[i] = mod_q(p->coeffs[i]);
+    for (int m = 1; m < RUDRAKSH_NTT_BLOCKS; m <<= 1) {
+        for (int i = 0; i < m; i++) {
+            int16_t zeta = zetas[k++];
+            for (int j = i * 2 * t; j < i * 2 * t + t; j++) {
+                int16_t u = p->coeffs[j];
+                int16_t v = mod_q((int32_t)p->coeffs[j + t] * zeta);
+                p->coeffs[j] = mod_q(u + v);
+                p->coeffs[j + t] = mod_q(u - v);
+            }
+        }
+        t >>= 1;
+    }
+}
+
+// 反向 INTT: Gentleman-Sande (輸入位元反轉 -> 輸出自然順序)，每一層除以 2
+static void ref_invntt(poly *p) {
+    int t = RUDRAKSH_NTT_BLOCK;
+    for (int i = 0; i < RUDRAKSH_N; i++) p->coeffs[i] = mod_q(p->coeffs[i]);
+    for (int m = RUDRAKSH_NTT_BLOCKS / 2; m >= 1; m >>= 1) {
+        int k = m;
+        for (int i = 0; i < m; i++) {
+            int16_t zeta_inv = zetas_inv[k++];
+            for (int j = i * 2 * t; j < i * 2 * t + t; j++) {
+                int16_t u = p->coeffs[j];
+                int16_t v = p->coeffs[j + t];
+                p->coeffs[j] = mod_q((int32_t)mod_q(u + v) * KERN_INV_2);
+                p->coeffs[j + t] = mod_q((int32_t)mod_q((int32_t)mod_q(u - v) * zeta_inv) * KERN_INV_2);
+            }
+        }
+        t <<= 1;
+    }
+}
+
+static uint32_t next(uint32_t *x) {
+    *x = *x * 1103515245u + 12345u;
+    return *x >> 8;
+}
+
+// 對目前的 kernel 變體比對 rounds 組輸入；wide 時輸入涵蓋整個 int16 範圍
+static int compare(int rounds, int wide, uint32_t seed) {
+    uint32_t x = seed;
+    int ok = 1;
+    for (int r = 0; r < rounds; r++) {
+        poly a, b;
+        for (int i = 0; i < RUDRAKSH_N; i++) {
+            if (r == 0) a.coeffs[i] = wide ? INT16_MIN : RUDRAKSH_Q - 1;
+            else if (r == 1) a.coeffs[i] = wide ? INT16_MAX : 0;
+            else a.coeffs[i] = wide ? (int16_t)next(&x) : (int16_t)(next(&x) % RUDRAKSH_Q);
+        }
+
+        b = a;
+        ref_ntt(&a);
+        poly_ntt(&b);
+        ok &= memcmp(&a, &b, sizeof(poly)) == 0;
+
+        for (int i = 0; i < RUDRAKSH_N && wide; i++) b.coeffs[i] = (int16_t)next(&x);
+        a = b;
+        ref_invntt(&a);
+        poly_invntt(&b);
+        ok &= memcmp(&a, &b, sizeof(poly)) == 0;
+    }
+    return ok;
+}
+
+int main(void) {
+    char msg[128];
+
+    printf("=======================================\n");
+    printf(" Unrolled NTT vs Loop Reference\n");
+    printf("=======================================\n");
+
+    for (size_t i = 0; i < rudraksh_kernels_count(); i++) {
+        const rudraksh_kernels *k = rudraksh_kernels_variant(i);
+        if (!rudraksh_kernels_supported(k)) continue;
+        rudraksh_kernels_select(k->name);
+
+        snprintf(msg, sizeof(msg), "%s: NTT / INTT match the reference on [0, q) inputs", k->name);
+        check(compare(1000, 0, 1), msg);
+        snprintf(msg, sizeof(msg), "%s: NTT / INTT match the reference on full int16 inputs", k->name);
+        check(compare(1000, 1, 2), msg);
+    }
+    rudraksh_kernels_select(NULL);
+
+    // 負循環卷積性質：NTT(x) * NTT(x^63) = NTT(-1)
+    poly a, b, r;
+    poly_zero(&a); a.coeffs[1] = 1;
+    poly_zero(&b); b.coeffs[63] = 1;
+    poly_zero(&r);
+    poly_ntt(&a);
+    poly_ntt(&b);
+    poly_basemul_acc(&r, &a, &b);
+    poly_invntt(&r);
+    int ok = r.coeffs[0] == RUDRAKSH_Q - 1;
+    for (int i = 1; i < RUDRAKSH_N; i++) ok &= r.coeffs[i] == 0;
+    check(ok, "INTT(NTT(x) * NTT(x^63)) == -1");
+
+    printf("=======================================\n");
+    printf(" End of Tests (%d failures)\n", fails);
+    printf("=======================================\n");
+    return fails != 0;
+}
@@ -173,6 +173,78 @@ printf("[3] Testing CBD PRF (Key[16]+Nonce[1] -> 16 bytes)...\n");
     }
 }
 
+printf("\n");
+
+// --- [4.3] Testing rudraksh_drbg ---
+printf("[4] Testing Ascon DRBG (Seed[32] -> stream)...\n");
+{
+    uint8_t seed[RUDRAKSH_DRBG_SEEDBYTES];
+    uint8_t out1[48], out2[48];
+    rudraksh_drbg d1, d2;
+
+    for (int i = 0; i < RUDRAKSH_DRBG_SEEDBYTES; i++) seed[i] = (uint8_t)i;
+
+    // 一次取 48 bytes
+    rudraksh_drbg_init(&d1, seed);
+    rudraksh_drbg_generate(&d1, out1, 48);
+    print_hex("  DRBG Output (first 16b): ", out1, 16);
+
+    // 1. 分段取 (16 + 32) 應與一次取相同 (皆為 8 bytes 的倍數)
+    rudraksh_drbg_init(&d2, seed);
+    rudraksh_drbg_generate(&d2, out2, 16);
+    rudraksh_drbg_generate(&d2, out2 + 16, 32);
+    if (memcmp(out1, out2, 48) == 0) {
+        printf("  >> Stream Consistency: PASSED\n");
+    } else {
+        printf("  >> Stream Consistency: FAILED\n");
+    }
+
+    // 2. 下一次輸出不可重複
+    rudraksh_drbg_generate(&d1, out2, 48);
+    if (memcmp(out1, out2, 48) != 0) {
+        printf("  >> No Repeat Check   : PASSED\n");
+    } else {
+        printf("  >> No Repeat Check   : FAILED\n");
+    }
+}
+
+printf("\n");
+
+// --- [5] Keccak-f[1600] / SHAKE (替代後端) ---
+printf("[5] Testing Keccak-f[1600] / SHAKE (x4 impl: %s)...\n", rudraksh_keccakf1600_x4_impl());
+{
+    // FIPS 202 空字串的已知答案 (前 16 bytes)
+    static const uint8_t shake128_empty[16] = {
+        0x7f, 0x9c, 0x2b, 0xa4, 0xe8, 0x8f, 0x82, 0x7d, 0x61, 0x60, 0x45, 0x50, 0x76, 0x05, 0x85, 0x3e
+    };
+    static const uint8_t shake256_empty[16] = {
+        0x46, 0xb9, 0xdd, 0x2b, 0x0b, 0xa8, 0x8d, 0x13, 0x23, 0x3b, 0x3f, 0xeb, 0x74, 0x3e, 0xeb, 0x24
+    };
+    uint8_t out[16];
+    rudraksh_keccak_state ks;
+
+    rudraksh_shake128_absorb(&ks, out, 0);
+    rudraksh_shake128_squeeze(&ks, out, 16);
+    int ok = memcmp(out, shake128_empty, 16) == 0;
+    rudraksh_shake256(out, 16, out, 0);
+    ok &= memcmp(out, shake256_empty, 16) == 0;
+    printf("  >> SHAKE Known Answer: %s\n", ok ? "PASSED" : "FAILED");
+
+    // 4 路置換必須與逐一置換相同 (AVX2 / scalar 皆同)
+    uint64_t lanes[25 * 4], one[4][25];
+    for (int i = 0; i < 25 * 4; i++) lanes[i] = 0x9e3779b97f4a7c15ULL * (uint64_t)(i + 1);
+    for (int l = 0; l < 4; l++) {
+        for (int k = 0; k < 25; k++) one[l][k] = lanes[4 * k + l];
+        rudraksh_keccakf1600(one[l]);
+    }
+    rudraksh_keccakf1600_x4(lanes);
+    ok = 1;
+    for (int l = 0; l < 4; l++) {
+        for (int k = 0; k < 25; k++) ok &= lanes[4 * k + l] == one[l][k];
+    }
+    printf("  >> x4 == 4 x scalar  : %s\n", ok ? "PASSED" : "FAILED");
+}
+
 // ---------------------------------------------------------
 // 3. Random Bytes Test
 // ---------------------------------------------------------
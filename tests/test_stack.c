@@ -0,0 +1,157 @@
+# include "../src/rudraksh_params.h"
+# include "../src/rudraksh_crypto.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+// ==========================================================
+// Stack 實際峰值量測 (stack painting)
+// 以呼叫端配置、預先填滿固定圖樣的記憶體作為執行緒的 stack，
+// 在該執行緒上執行一次 API，結束後從 stack 底端往上找第一個被改寫的 byte，
+// 即可得到實際用到的深度；再扣掉空函式的基準值 (執行緒啟動、TLS 等)
+// 需要 pthread_attr_setstack，Windows 上略過
+// ==========================================================
+
+#define COLOR_GREEN "\033[0;32m"
+#define COLOR_RED   "\033[0;31m"
+#define COLOR_RESET "\033[0m"
+
+#define PAINT_BYTE 0xA5
+#define STACK_BYTES (256 * 1024)
+#define STACK_LIMIT (64 * 1024) // worker pool 預設的 stack 上限
+
+static int fails = 0;
+
+static void check(int cond, const char *msg) {
+    if (cond) {
+        printf("[%sPASS%s] %s\n", COLOR_GREEN, COLOR_RESET, msg);
+    } else {
+        printf("[%sFAIL%s] %s\n", COLOR_RED, COLOR_RESET, msg);
+        fails++;
+    }
+}
+
+// 所有被測 API 共用的輸入 / 輸出 (放在 heap，避免算進量測的 stack)
+typedef struct {
+    public_key_bitstream pk;
+    secret_key_bitstream sk;
+    secret_key_bitstream_ntt sk_ntt;
+    secret_key_bitstream_packed sk_packed;
+    secret_key_bitstream_seed sk_seed;
+    cipher_text ct;
+    shared_secret ss;
+} stack_ctx;
+
+static void op_none(stack_ctx *x)           { (void)x; }
+static void op_kem_keygen(stack_ctx *x)     { rudraksh_kem_keygen(&x->pk, &x->sk); }
+static void op_kem_encaps(stack_ctx *x)     { rudraksh_kem_encapsulate(&x->pk, &x->ct, &x->ss); }
+static void op_kem_decaps(stack_ctx *x)     { rudraksh_kem_decapsulate(&x->sk, &x->ct, &x->ss); }
+static void op_decaps_ntt(stack_ctx *x)     { rudraksh_kem_decapsulate_ntt(&x->sk_ntt, &x->ct, &x->ss); }
+static void op_decaps_packed(stack_ctx *x)  { rudraksh_kem_decapsulate_packed(&x->sk_packed, &x->ct, &x->ss); }
+static void op_decaps_seed(stack_ctx *x)    { rudraksh_kem_decapsulate_seed(&x->sk_seed, &x->ct, &x->ss, NULL); }
+
+typedef struct {
+    void (*fn)(stack_ctx *);
+    stack_ctx *ctx;
+} thread_arg;
+
+static void *thread_main(void *arg) {
+    thread_arg *a = (thread_arg *)arg;
+    a->fn(a->ctx);
+    return NULL;
+}
+
+// 回傳實際用到的 stack bytes，失敗回傳 0
+static size_t measure(void (*fn)(stack_ctx *), stack_ctx *ctx) {
+#ifdef _WIN32
+    (void)fn; (void)ctx;
+    return 0;
+#else
+    uint8_t *stack = NULL;
+    pthread_attr_t attr;
+    pthread_t tid;
+    thread_arg arg = { fn, ctx };
+    size_t used = 0;
+
+    if (posix_memalign((void **)&stack, 4096, STACK_BYTES) != 0) return 0;
+    memset(stack, PAINT_BYTE, STACK_BYTES);
+
+    pthread_attr_init(&attr);
+    if (pthread_attr_setstack(&attr, stack, STACK_BYTES) == 0 &&
+        pthread_create(&tid, &attr, thread_main, &arg) == 0) {
+        pthread_join(tid, NULL);
+
+        // stack 往低位址成長：從底端找第一個被改寫的 byte
+        size_t untouched = 0;
+        while (untouched < STACK_BYTES && stack[untouched] == PAINT_BYTE) untouched++;
+        used = STACK_BYTES - untouched;
+    }
+    pthread_attr_destroy(&attr);
+    free(stack);
+    return used;
+#endif
+}
+
+int main() {
+    printf("=======================================\n");
+    printf(" Rudraksh Stack Painting Tests\n");
+    printf("=======================================\n");
+
+#ifdef _WIN32
+    printf("pthread_attr_setstack not available on Windows, skipped\n");
+    return 0;
+#endif
+
+    stack_ctx *ctx = calloc(1, sizeof(stack_ctx));
+    if (ctx == NULL) return 1;
+
+    // 準備有效的金鑰與密文 (在主執行緒上)
+    rudraksh_kem_keygen_seed(&ctx->pk, &ctx->sk_seed);
+    rudraksh_sk_from_seed(&ctx->sk, NULL, &ctx->sk_seed);
+    rudraksh_sk_to_ntt(&ctx->sk_ntt, &ctx->sk);
+    rudraksh_sk_to_packed(&ctx->sk_packed, &ctx->sk);
+    rudraksh_kem_encapsulate(&ctx->pk, &ctx->ct, &ctx->ss);
+
+    static const struct {
+        const char *name;
+        void (*fn)(stack_ctx *);
+    } OPS[] = {
+        { "kem_keygen",     op_kem_keygen },
+        { "kem_encaps",     op_kem_encaps },
+        { "kem_decaps",     op_kem_decaps },
+        { "decaps (ntt)",   op_decaps_ntt },
+        { "decaps (packed)", op_decaps_packed },
+        { "decaps (seed)",  op_decaps_seed },
+    };
+
+    size_t baseline = measure(op_none, ctx);
+    check(baseline > 0, "Painted thread stack can be measured");
+    printf("   baseline (thread start-up, TLS): %zu bytes\n\n", baseline);
+
+    printf("   %-16s %10s\n", "operation", "peak stack");
+    size_t worst = 0;
+    int measured = 1;
+    for (size_t k = 0; k < sizeof(OPS) / sizeof(OPS[0]); k++) {
+        size_t used = measure(OPS[k].fn, ctx);
+        size_t peak = used > baseline ? used - baseline : 0;
+
+        measured &= peak > 0;
+        if (peak > worst) worst = peak;
+        printf("   %-16s %10zu bytes (%.1f KiB)\n", OPS[k].name, peak, peak / 1024.0);
+    }
+    printf("\n");
+
+    check(measured, "Every API touches its own stack frames");
+    char msg[128];
+    snprintf(msg, sizeof(msg), "Peak stack %zu bytes fits a %d KiB worker stack", worst, STACK_LIMIT / 1024);
+    check(worst + baseline <= STACK_LIMIT, msg);
+
+    free(ctx);
+
+    printf("\n=============================================\n");
+    printf("   End of Tests (%d failures)\n", fails);
+    printf("=============================================\n");
+    return fails != 0;
+}
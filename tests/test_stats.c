@@ -0,0 +1,97 @@
+# include "../src/rudraksh_params.h"
+# include "../src/rudraksh_crypto.h"
+# include "../src/rudraksh_stats.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// ==========================================================
+// 輔助工具
+// ==========================================================
+
+#define COLOR_GREEN "\033[0;32m"
+#define COLOR_RED   "\033[0;31m"
+#define COLOR_RESET "\033[0m"
+
+static int fails = 0;
+
+static void check(int cond, const char *msg) {
+    if (cond) {
+        printf("[%sPASS%s] %s\n", COLOR_GREEN, COLOR_RESET, msg);
+    } else {
+        printf("[%sFAIL%s] %s\n", COLOR_RED, COLOR_RESET, msg);
+        fails++;
+    }
+}
+
+static void print_stats(const char *op, const rudraksh_stats *st) {
+    printf("   %-7s P12 %6llu | P8 %6llu | hash %2llu | gen %5llu (rejected %3llu) | mul %3llu | ntt %3llu | invntt %3llu\n", op,
+           (unsigned long long)st->p12, (unsigned long long)st->p8, (unsigned long long)st->hash,
+           (unsigned long long)st->gen_samples, (unsigned long long)st->gen_rejects,
+           (unsigned long long)st->poly_mul, (unsigned long long)st->ntt, (unsigned long long)st->invntt);
+}
+
+// 每次 keygen / encaps / decaps 都會重新展開整個矩陣 A：接受的 13-bit 樣本恰為 K*K*N
+static int matrix_a_expanded_once(const rudraksh_stats *st) {
+    return st->gen_samples - st->gen_rejects == (uint64_t)RUDRAKSH_K * RUDRAKSH_K * RUDRAKSH_N;
+}
+
+int main() {
+    printf("=======================================\n");
+    printf(" Rudraksh Hot-path Event Counter Tests\n");
+    printf("=======================================\n");
+
+    rudraksh_stats st;
+    if (rudraksh_stats_snapshot(&st) != 0) {
+        printf("RUDRAKSH_STATS not enabled (build with STATS=1), only the disabled API is checked\n");
+        rudraksh_stats zero;
+        memset(&zero, 0, sizeof(zero));
+        check(memcmp(&st, &zero, sizeof(st)) == 0, "Disabled snapshot returns zeros");
+        return fails != 0;
+    }
+
+    public_key_bitstream pk;
+    secret_key_bitstream sk;
+    cipher_text ct;
+    shared_secret ss_enc, ss_dec;
+
+    // 1. KeyGen
+    rudraksh_stats_reset();
+    rudraksh_kem_keygen(&pk, &sk);
+    rudraksh_stats_snapshot(&st);
+    print_stats("keygen", &st);
+    check(matrix_a_expanded_once(&st) && st.poly_mul == RUDRAKSH_K * RUDRAKSH_K, "KeyGen: one A expansion, K*K products");
+#ifdef RUDRAKSH_SYM_KECCAK
+    // SHAKE128 每次置換輸出 168 bytes (約 103 個 13-bit 樣本)
+    check(st.hash >= 1 && st.p12 > st.gen_samples / 104, "KeyGen: hash and Keccak-f counted");
+#elif defined(RUDRAKSH_SYM_ASCON_FAST)
+    // 區塊之間改為 P8，P12 只剩初始化與吸收結束
+    check(st.hash >= 1 && st.p8 > st.gen_samples / 5 && st.p12 < st.p8, "KeyGen: hash and P8 counted");
+#else
+    check(st.hash >= 1 && st.p12 > st.gen_samples / 5, "KeyGen: hash and P12 counted");
+#endif
+
+    // 2. Encaps
+    rudraksh_stats_reset();
+    rudraksh_kem_encapsulate(&pk, &ct, &ss_enc);
+    rudraksh_stats_snapshot(&st);
+    print_stats("encaps", &st);
+    check(matrix_a_expanded_once(&st) && st.invntt > 0, "Encaps: one A expansion, inverse NTT counted");
+
+    // 3. Decaps (內含重新加密)
+    rudraksh_stats_reset();
+    rudraksh_kem_decapsulate(&sk, &ct, &ss_dec);
+    rudraksh_stats_snapshot(&st);
+    print_stats("decaps", &st);
+    check(matrix_a_expanded_once(&st) && st.hash >= 2, "Decaps: re-encryption expands A again");
+
+    // 4. reset
+    rudraksh_stats_reset();
+    rudraksh_stats_snapshot(&st);
+    check(st.p12 == 0 && st.p8 == 0 && st.hash == 0 && st.poly_mul == 0, "Reset clears counters");
+
+    printf("\n=============================================\n");
+    printf("   End of Tests (%d failures)\n", fails);
+    printf("=============================================\n");
+    return fails != 0;
+}
@@ -0,0 +1,221 @@
+# include "../src/rudraksh_params.h"
+# include "../src/rudraksh_crypto.h"
+# include "../src/rudraksh_trace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ==========================================================
+// 輔助工具
+// ==========================================================
+
+#define COLOR_GREEN "\033[0;32m"
+#define COLOR_RED   "\033[0;31m"
+#define COLOR_RESET "\033[0m"
+
+#define RING_CAPACITY 256
+#define TRACE_PATH "test_trace.json"
+
+static int fails = 0;
+
+static void check(int cond, const char *msg) {
+    if (cond) {
+        printf("[%sPASS%s] %s\n", COLOR_GREEN, COLOR_RESET, msg);
+    } else {
+        printf("[%sFAIL%s] %s\n", COLOR_RED, COLOR_RESET, msg);
+        fails++;
+    }
+}
+
+// begin / end 必須成對且正確巢狀，時間戳不可倒退
+static int well_nested(const rudraksh_trace_ring *ring) {
+    uint8_t stack[32];
+    int depth = 0;
+    uint64_t last = 0;
+
+    for (size_t i = 0; i < rudraksh_trace_ring_size(ring); i++) {
+        const rudraksh_trace_event *e = rudraksh_trace_ring_at(ring, i);
+        if (e->ts_ns < last) return 0;
+        last = e->ts_ns;
+
+        if (e->phase == RUDRAKSH_TRACE_PH_BEGIN) {
+            if (depth == 32) return 0;
+            stack[depth++] = e->stage;
+        } else if (depth == 0 || stack[--depth] != e->stage) {
+            return 0;
+        }
+    }
+    return depth == 0;
+}
+
+// 依序取出 begin 事件的 stage 名稱，以空白分隔
+static void begin_sequence(const rudraksh_trace_ring *ring, char *out, size_t outlen) {
+    out[0] = '\0';
+    for (size_t i = 0; i < rudraksh_trace_ring_size(ring); i++) {
+        const rudraksh_trace_event *e = rudraksh_trace_ring_at(ring, i);
+        if (e->phase != RUDRAKSH_TRACE_PH_BEGIN) continue;
+        if (out[0] != '\0') strncat(out, " ", outlen - strlen(out) - 1);
+        strncat(out, rudraksh_trace_stage_name((rudraksh_trace_stage)e->stage), outlen - strlen(out) - 1);
+    }
+}
+
+// 整段只有一個頂層區段，且為指定的 stage
+static int single_top_level(const rudraksh_trace_ring *ring, rudraksh_trace_stage stage) {
+    int depth = 0, n_top = 0;
+
+    for (size_t i = 0; i < rudraksh_trace_ring_size(ring); i++) {
+        const rudraksh_trace_event *e = rudraksh_trace_ring_at(ring, i);
+        if (e->phase == RUDRAKSH_TRACE_PH_BEGIN) {
+            if (depth++ == 0 && (e->stage != stage || ++n_top > 1)) return 0;
+        } else {
+            depth--;
+        }
+    }
+    return n_top == 1 && well_nested(ring);
+}
+
+static void count_cb(void *user, rudraksh_trace_stage stage, int phase, uint64_t ts_ns) {
+    (void)stage; (void)phase; (void)ts_ns;
+    (*(int *)user)++;
+}
+
+int main() {
+    printf("=======================================\n");
+    printf(" Rudraksh KEM Stage Tracing Tests\n");
+    printf("=======================================\n");
+
+    static rudraksh_trace_event events[3][RING_CAPACITY];
+    rudraksh_trace_ring rings[3];
+    public_key_bitstream pk;
+    secret_key_bitstream sk;
+    cipher_text ct;
+    shared_secret ss_enc, ss_dec;
+    char seq[512];
+
+    // 1. keygen / encaps / decaps 各自記錄到一個 ring
+    rudraksh_trace_ring_init(&rings[0], events[0], RING_CAPACITY, 1);
+    rudraksh_trace_attach_ring(&rings[0]);
+    rudraksh_kem_keygen(&pk, &sk);
+
+    rudraksh_trace_ring_init(&rings[1], events[1], RING_CAPACITY, 2);
+    rudraksh_trace_attach_ring(&rings[1]);
+    rudraksh_kem_encapsulate(&pk, &ct, &ss_enc);
+
+    rudraksh_trace_ring_init(&rings[2], events[2], RING_CAPACITY, 3);
+    rudraksh_trace_attach_ring(&rings[2]);
+    rudraksh_kem_decapsulate(&sk, &ct, &ss_dec);
+    rudraksh_trace_attach_ring(NULL);
+
+    check(memcmp(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K) == 0, "KEM still correct with tracer attached");
+    check(well_nested(&rings[0]) && well_nested(&rings[1]) && well_nested(&rings[2]), "Begin/end events balanced and nested");
+
+    begin_sequence(&rings[0], seq, sizeof(seq));
+    printf("   keygen: %s\n", seq);
+    check(strcmp(seq, "kem_keygen gen_a sample multiply pack hash_pkh pack") == 0, "KeyGen stages");
+
+    begin_sequence(&rings[1], seq, sizeof(seq));
+    printf("   encaps: %s\n", seq);
+    check(strcmp(seq, "kem_encaps unpack hash_pkh hash_g encrypt gen_a sample multiply compress") == 0, "Encaps stages");
+
+    begin_sequence(&rings[2], seq, sizeof(seq));
+    printf("   decaps: %s\n", seq);
+    check(strcmp(seq, "kem_decaps unpack decrypt hash_g encrypt gen_a sample multiply compress hash_cz compare") == 0,
+          "Decaps stages (re-encryption nested)");
+
+    // 2. 移除 tracer 後不再記錄
+    uint64_t before = rings[2].written;
+    rudraksh_kem_decapsulate(&sk, &ct, &ss_dec);
+    check(rings[2].written == before, "No events after detach");
+
+    // 3. 自訂 callback
+    int n_events = 0;
+    rudraksh_trace_set_callback(count_cb, &n_events);
+    rudraksh_kem_decapsulate(&sk, &ct, &ss_dec);
+    rudraksh_trace_set_callback(NULL, NULL);
+    check(n_events == (int)rudraksh_trace_ring_size(&rings[2]), "Callback receives the same events");
+
+    // 4. ring 滿了之後保留最新的事件
+    rudraksh_trace_event small[8];
+    rudraksh_trace_ring ring_small;
+    rudraksh_trace_ring_init(&ring_small, small, 8, 4);
+    rudraksh_trace_attach_ring(&ring_small);
+    rudraksh_kem_decapsulate(&sk, &ct, &ss_dec);
+    rudraksh_trace_attach_ring(NULL);
+    const rudraksh_trace_event *last = rudraksh_trace_ring_at(&ring_small, 7);
+    check(rudraksh_trace_ring_size(&ring_small) == 8 && last->stage == RUDRAKSH_TRACE_KEM_DECAPS &&
+          last->phase == RUDRAKSH_TRACE_PH_END, "Ring keeps the most recent events");
+
+    // 5. Chrome trace JSON
+    check(rudraksh_trace_export_chrome(TRACE_PATH, rings, 3) == 0, "Export Chrome trace JSON");
+    FILE *f = fopen(TRACE_PATH, "r");
+    char head[32] = {0};
+    int n_b = 0, n_e = 0, ch, prev = 0;
+    if (f != NULL) {
+        if (fread(head, 1, sizeof(head) - 1, f) == 0) head[0] = '\0';
+        rewind(f);
+        // 計算 "ph":"B" / "ph":"E" 出現次數
+        while ((ch = fgetc(f)) != EOF) {
+            if (prev == ':' && ch == '"') {
+                int c1 = fgetc(f), c2 = fgetc(f);
+                if (c2 == '"' && c1 == 'B') n_b++;
+                if (c2 == '"' && c1 == 'E') n_e++;
+                ch = c2;
+            }
+            prev = ch;
+        }
+        fclose(f);
+    }
+    size_t total = rudraksh_trace_ring_size(&rings[0]) + rudraksh_trace_ring_size(&rings[1]) +
+                   rudraksh_trace_ring_size(&rings[2]);
+    check(strncmp(head, "{\"displayTimeUnit\"", 18) == 0 && n_b == n_e && (size_t)(n_b + n_e) == total,
+          "Exported file contains every begin/end pair");
+    remove(TRACE_PATH);
+
+    // 6. 其他金鑰格式 / iov 入口同樣只有一個頂層 kem_encaps / kem_decaps 區段
+    public_key_bitstream_ntt pk_ntt;
+    secret_key_bitstream_ntt sk_ntt;
+    secret_key_bitstream_packed sk_packed;
+    secret_key_bitstream_seed sk_seed;
+    public_key_bitstream pk_seed;
+    rudraksh_sk_cache_entry entries[1];
+    rudraksh_sk_cache cache;
+    uint8_t ct_lo[CRYPTO_CIPHERTEXTBYTES / 2], ct_hi[CRYPTO_CIPHERTEXTBYTES - CRYPTO_CIPHERTEXTBYTES / 2];
+    const rudraksh_iovec iov[2] = { { ct_lo, sizeof(ct_lo) }, { ct_hi, sizeof(ct_hi) } };
+    int balanced = 1, correct = 1;
+
+    rudraksh_pk_to_ntt(&pk_ntt, &pk);
+    rudraksh_sk_to_ntt(&sk_ntt, &sk);
+    rudraksh_sk_to_packed(&sk_packed, &sk);
+    rudraksh_kem_keygen_seed(&pk_seed, &sk_seed);
+    rudraksh_sk_cache_init(&cache, entries, 1);
+
+    for (int v = 0; v < 6; v++) {
+        rudraksh_trace_ring_init(&rings[0], events[0], RING_CAPACITY, 5);
+        rudraksh_trace_attach_ring(&rings[0]);
+        rudraksh_trace_stage top = RUDRAKSH_TRACE_KEM_DECAPS;
+        switch (v) {
+            case 0: top = RUDRAKSH_TRACE_KEM_ENCAPS; correct &= rudraksh_kem_encapsulate_ntt(&pk_ntt, &ct, &ss_enc) == 0; break;
+            case 1: correct &= rudraksh_kem_decapsulate_ntt(&sk_ntt, &ct, &ss_dec) == 0; break;
+            case 2: correct &= rudraksh_kem_decapsulate_packed(&sk_packed, &ct, &ss_dec) == 0; break;
+            case 3: top = RUDRAKSH_TRACE_KEM_ENCAPS; correct &= rudraksh_kem_encapsulate_iov(&pk, iov, 2, &ss_enc) == 0; break;
+            case 4: correct &= rudraksh_kem_decapsulate_iov(&sk, iov, 2, &ss_dec) == 0; break;
+            default:
+                rudraksh_trace_attach_ring(NULL);
+                rudraksh_kem_encapsulate(&pk_seed, &ct, &ss_enc);
+                rudraksh_trace_attach_ring(&rings[0]);
+                correct &= rudraksh_kem_decapsulate_seed(&sk_seed, &ct, &ss_dec, &cache) == 0;
+                break;
+        }
+        rudraksh_trace_attach_ring(NULL);
+        if (v != 0 && v != 3) correct &= memcmp(ss_enc.bytes, ss_dec.bytes, RUDRAKSH_len_K) == 0;
+        balanced &= single_top_level(&rings[0], top);
+    }
+    rudraksh_sk_cache_clear(&cache);
+    check(correct && balanced, "NTT / packed / seed / iov entry points: one balanced top-level event");
+
+    printf("\n=============================================\n");
+    printf("   End of Tests (%d failures)\n", fails);
+    printf("=============================================\n");
+    return fails != 0;
+}
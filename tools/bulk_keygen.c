@@ -0,0 +1,244 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "rudraksh_params.h"
+#include "rudraksh_crypto.h"
+#include "rudraksh_random.h"
+
+// ==========================================================
+// 大量金鑰生成工具 (key ceremony 用)
+// 用法: bulk_keygen -n <金鑰數> -o <輸出檔> [-t <執行緒數>] [-f packed|ntt|std|seed] [-b <批次大小>]
+//
+// 輸出檔為固定長度記錄，無檔頭：每筆 = pk (952 bytes) || sk (依 -f 格式)
+// 每個執行緒各自一個 Ascon DRBG (以系統亂數播種一次) 與一個批次緩衝區，
+// 生成期間不做任何配置；批次滿了才以單次 fwrite 附加到檔尾
+// ==========================================================
+
+#define DEFAULT_BATCH 512
+
+enum { FMT_PACKED, FMT_NTT, FMT_STD, FMT_SEED };
+
+typedef struct {
+    int format;
+    size_t sk_bytes;
+    size_t record_bytes;
+    size_t batch;
+    FILE *out;
+    pthread_mutex_t out_lock;
+    int write_error;
+    int abort;              // 有執行緒無法啟動：其餘執行緒在目前批次結束後停止 (受 out_lock 保護)
+} job_t;
+
+// 每個執行緒的工作區 (啟動前配置，生成期間重複使用)
+typedef struct {
+    job_t *job;
+    size_t n_keys;
+    rudraksh_drbg drbg;
+    uint8_t *buf;           // batch * record_bytes
+    pthread_t tid;
+} worker_t;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int cpu_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return (int)si.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+// 生成一把金鑰寫入 rec = pk || sk
+static void keygen_one(const job_t *job, rudraksh_drbg *drbg, uint8_t *rec) {
+    public_key_bitstream *pk = (public_key_bitstream *)rec;
+    uint8_t *sk_out = rec + CRYPTO_PUBLICKEYBYTES;
+    uint8_t coins[RUDRAKSH_SEEDBYTES + RUDRAKSH_len_K]; // seed_A || seed_se || z
+    secret_key_bitstream sk;
+
+    if (job->format == FMT_SEED) {
+        // seed 格式：z 由種子衍生，只需 32 bytes
+        secret_key_bitstream_seed *sk_seed = (secret_key_bitstream_seed *)sk_out;
+        sk_seed->bytes[0] = RUDRAKSH_KEYFMT_SEED;
+        rudraksh_drbg_generate(drbg, sk_seed->bytes + RUDRAKSH_KEYFMT_HEADERBYTES, RUDRAKSH_SEEDBYTES);
+        rudraksh_sk_from_seed(&sk, pk, sk_seed);
+    } else {
+        rudraksh_drbg_generate(drbg, coins, sizeof(coins));
+        rudraksh_kem_keygen_derand(pk, &sk, coins, coins + RUDRAKSH_SEEDBYTES);
+
+        if (job->format == FMT_PACKED) {
+            rudraksh_sk_to_packed((secret_key_bitstream_packed *)sk_out, &sk);
+        } else if (job->format == FMT_NTT) {
+            rudraksh_sk_to_ntt((secret_key_bitstream_ntt *)sk_out, &sk);
+        } else {
+            memcpy(sk_out, sk.bytes, CRYPTO_SECRETKEYBYTES);
+        }
+    }
+
+    memset(coins, 0, sizeof(coins));
+    memset(&sk, 0, sizeof(sk));
+}
+
+static void *worker_main(void *arg) {
+    worker_t *w = (worker_t *)arg;
+    job_t *job = w->job;
+    size_t left = w->n_keys;
+
+    while (left > 0) {
+        size_t n = left < job->batch ? left : job->batch;
+
+        for (size_t i = 0; i < n; i++) {
+            keygen_one(job, &w->drbg, w->buf + i * job->record_bytes);
+        }
+
+        // 整批一次寫出 (記錄順序不重要，每把金鑰互相獨立)
+        pthread_mutex_lock(&job->out_lock);
+        int stop = job->abort;
+        if (!stop && fwrite(w->buf, job->record_bytes, n, job->out) != n) job->write_error = 1;
+        pthread_mutex_unlock(&job->out_lock);
+        if (stop) break;
+
+        left -= n;
+    }
+
+    memset(w->buf, 0, job->batch * job->record_bytes);
+    memset(&w->drbg, 0, sizeof(w->drbg));
+    return NULL;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr, "usage: %s -n <keys> -o <output> [-t <threads>] [-f packed|ntt|std|seed] [-b <batch>]\n", prog);
+}
+
+int main(int argc, char **argv) {
+    size_t n_keys = 0;
+    const char *out_path = NULL;
+    int n_threads = cpu_count();
+    int started = 0, ok = 0;
+    double t0, elapsed = 0;
+    job_t job;
+
+    memset(&job, 0, sizeof(job));
+    job.format = FMT_PACKED;
+    job.batch = DEFAULT_BATCH;
+
+    // 1. 參數解析
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "-n") == 0) n_keys = (size_t)strtoull(argv[i + 1], NULL, 10);
+        else if (strcmp(argv[i], "-o") == 0) out_path = argv[i + 1];
+        else if (strcmp(argv[i], "-t") == 0) n_threads = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "-b") == 0) job.batch = (size_t)strtoull(argv[i + 1], NULL, 10);
+        else if (strcmp(argv[i], "-f") == 0) {
+            if (strcmp(argv[i + 1], "packed") == 0) job.format = FMT_PACKED;
+            else if (strcmp(argv[i + 1], "ntt") == 0) job.format = FMT_NTT;
+            else if (strcmp(argv[i + 1], "std") == 0) job.format = FMT_STD;
+            else if (strcmp(argv[i + 1], "seed") == 0) job.format = FMT_SEED;
+            else { usage(argv[0]); return 1; }
+        } else { usage(argv[0]); return 1; }
+    }
+    if (n_keys == 0 || out_path == NULL || n_threads <= 0 || job.batch == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+    if ((size_t)n_threads > n_keys) n_threads = (int)n_keys;
+
+    switch (job.format) {
+        case FMT_PACKED: job.sk_bytes = CRYPTO_SECRETKEYBYTES_PACKED; break;
+        case FMT_NTT:    job.sk_bytes = CRYPTO_SECRETKEYBYTES_NTT;    break;
+        case FMT_STD:    job.sk_bytes = CRYPTO_SECRETKEYBYTES;        break;
+        default:         job.sk_bytes = CRYPTO_SECRETKEYBYTES_SEED;   break;
+    }
+    job.record_bytes = CRYPTO_PUBLICKEYBYTES + job.sk_bytes;
+
+    job.out = fopen(out_path, "wb");
+    if (job.out == NULL) {
+        fprintf(stderr, "cannot open %s\n", out_path);
+        return 1;
+    }
+    // 批次已經很大，關閉 stdio 緩衝避免多一次複製
+    setvbuf(job.out, NULL, _IONBF, 0);
+    pthread_mutex_init(&job.out_lock, NULL);
+
+    // 2. 配置每個執行緒的工作區並各自播種 DRBG
+    worker_t *workers = calloc((size_t)n_threads, sizeof(worker_t));
+    if (workers == NULL) {
+        fprintf(stderr, "out of memory\n");
+        goto cleanup;
+    }
+    for (int t = 0; t < n_threads; t++) {
+        uint8_t seed[RUDRAKSH_DRBG_SEEDBYTES];
+
+        workers[t].job = &job;
+        workers[t].n_keys = n_keys / n_threads + ((size_t)t < n_keys % n_threads);
+        workers[t].buf = malloc(job.batch * job.record_bytes);
+        if (workers[t].buf == NULL) {
+            fprintf(stderr, "out of memory\n");
+            goto cleanup;
+        }
+
+        rudraksh_randombytes(seed, sizeof(seed));
+        rudraksh_drbg_init(&workers[t].drbg, seed);
+        memset(seed, 0, sizeof(seed));
+    }
+
+    // 3. 平行生成；只 join 成功啟動的執行緒
+    t0 = now_sec();
+    for (; started < n_threads; started++) {
+        int err = pthread_create(&workers[started].tid, NULL, worker_main, &workers[started]);
+        if (err != 0) {
+            fprintf(stderr, "cannot start thread %d: %s\n", started, strerror(err));
+            pthread_mutex_lock(&job.out_lock);
+            job.abort = 1;
+            pthread_mutex_unlock(&job.out_lock);
+            break;
+        }
+    }
+    for (int t = 0; t < started; t++) {
+        pthread_join(workers[t].tid, NULL);
+    }
+    elapsed = now_sec() - t0;
+    ok = !job.abort;
+
+cleanup:
+    if (fclose(job.out) != 0) job.write_error = 1;
+    if (workers != NULL) {
+        // 未啟動的執行緒仍保有已播種的 DRBG，一併清除
+        for (int t = 0; t < n_threads; t++) free(workers[t].buf);
+        memset(workers, 0, (size_t)n_threads * sizeof(worker_t));
+        free(workers);
+    }
+    pthread_mutex_destroy(&job.out_lock);
+
+    if (!ok) {
+        remove(out_path); // 金鑰數不足的輸出檔不可用
+        return 1;
+    }
+    if (job.write_error) {
+        fprintf(stderr, "write error on %s\n", out_path);
+        return 1;
+    }
+
+    // 4. 報告
+    printf("keys:        %zu\n", n_keys);
+    printf("threads:     %d\n", n_threads);
+    printf("record:      %zu bytes (pk %d + sk %zu)\n", job.record_bytes, CRYPTO_PUBLICKEYBYTES, job.sk_bytes);
+    printf("output:      %s (%.1f MiB)\n", out_path, n_keys * (double)job.record_bytes / (1024.0 * 1024.0));
+    printf("elapsed:     %.3f s\n", elapsed);
+    printf("throughput:  %.0f keys/s\n", n_keys / elapsed);
+    return 0;
+}
@@ -0,0 +1,244 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// ==========================================================
+// 完全展開的 n = 64 負循環 NTT / INTT 產生器
+// 用法: ./bin/gen_ntt_unrolled > src/rudraksh_ntt_unrolled.h (make lgen_ntt)
+// 對每個支援的層數 (RUDRAKSH_NTT_LAYERS = 6 / 5 / 4) 各產生一組，以 #if 選擇；
+// 少於 6 層時停在 d = 64 / 2^L 次的子環 (子環常數見 tools/gen_table.c 的 ntt_gamma)
+//
+// 輸出為無迴圈、無分支的 C：64 個係數放在區域變數，旋轉因子為立即數 (置中到 [-q/2, q/2])，
+// 產生器追蹤每個變數的值域 [lo, hi]，只在下一步可能超出 int32 (或乘法超出 Barrett 的輸入範圍) 時才插入化約
+// 運算順序同原本的迴圈版 (正向 Cooley-Tukey、反向 Gentleman-Sande，zetas 按位元反轉順序)；
+// INTT 每層的 1/2 合併到最後一層的旋轉因子 (乘上 2^-L)，輸出 (化約到 [0, q)) 與迴圈版逐 bit 相同
+// 產生的檔案與 rudraksh_kernels_impl.h 一樣以 KERN() 命名，由各 ISA 變體重複 include，
+// 並同時產生頻率優先佈局的 ntt_fm / invntt_fm (rudraksh_math.h 的 polymat_fm，不完整 NTT 時 lane 對應子環)
+// 參數來源: rudraksh_params.h / rudraksh_math.h
+// ==========================================================
+
+#define Q 7681
+#define N 64
+#define LOG_N 6
+#define ZETA 202
+
+#define FM_LANES 16       // RUDRAKSH_FM_LANES
+#define MIN_LAYERS 4      // 頻率優先佈局需要 d <= RUDRAKSH_FM_TILES
+#define BARRETT_M 559167 // floor(2^32 / q)
+#define LIMIT 2147483647LL
+
+static int64_t lo[N], hi[N];
+static int layers;        // 目前產生的層數
+
+static int32_t pow_mod(int32_t base, int32_t exp) {
+    int32_t res = 1;
+    base %= Q;
+    while (exp > 0) {
+        if (exp & 1) res = (res * base) % Q;
+        base = (base * base) % Q;
+        exp >>= 1;
+    }
+    return res;
+}
+
+static int brv(int k) {
+    int r = 0;
+    for (int i = 0; i < LOG_N; i++) r = (r << 1) | ((k >> i) & 1);
+    return r;
+}
+
+// 置中到 [-q/2, q/2]，讓乘積的值域減半
+static int32_t center(int32_t c) {
+    c %= Q;
+    if (c < 0) c += Q;
+    return c > Q / 2 ? c - Q : c;
+}
+
+static int64_t mag(int64_t l, int64_t h) {
+    return llabs(l) > llabs(h) ? llabs(l) : llabs(h);
+}
+
+// Barrett 化約 (m = floor(2^32 / q))：|a| < 2^31 時，a >= 0 的結果在 [0, 2q)，a < 0 的結果在 (-q, q)
+static void barrett_range(int64_t *l, int64_t *h) {
+    if (mag(*l, *h) > LIMIT) {
+        fprintf(stderr, "barrett input out of range\n");
+        exit(1);
+    }
+    *h = 2 * Q - 1;
+    *l = *l >= 0 ? 0 : -(Q - 1);
+}
+
+static void emit_barrett(int i) {
+    printf("    r%d = KERN(barrett)(r%d);\n", i, i);
+    barrett_range(&lo[i], &hi[i]);
+}
+
+// t = barrett(r[i] * c)，必要時先化約 r[i]
+static void emit_mulred(int i, int32_t c, int64_t *tl, int64_t *th) {
+    if (mag(lo[i], hi[i]) * llabs(c) > LIMIT) emit_barrett(i);
+    printf("    t = KERN(barrett)(r%d * %d);\n", i, c);
+
+    int64_t a = lo[i] * c, b = hi[i] * c;
+    *tl = a < b ? a : b;
+    *th = a < b ? b : a;
+    barrett_range(tl, th);
+}
+
+// r[a] 與 r[b] 加減後仍須在 int32 內
+static void ensure_sum(int a, int b) {
+    if (mag(lo[a], hi[a]) + mag(lo[b], hi[b]) > LIMIT) {
+        if (mag(lo[a], hi[a]) >= mag(lo[b], hi[b])) emit_barrett(a);
+        else emit_barrett(b);
+    }
+}
+
+static int64_t bound_all(void) {
+    int64_t m = 0;
+    for (int i = 0; i < N; i++) {
+        int64_t v = mag(lo[i], hi[i]);
+        if (v > m) m = v;
+    }
+    return m;
+}
+
+// NTT 域位置 i (第 i / d 個子環的第 i % d 項) 在頻率優先佈局中的 tile 內位置 (tile * LANES + lane)
+static int fm_pos(int i) {
+    int d = N >> layers;
+    return (i % d) * (N / d) + i / d;
+}
+
+// 最後化約到 [0, q)；fm 時同時寫到頻率優先佈局
+static void emit_store(int fm) {
+    for (int i = 0; i < N; i++) {
+        if (lo[i] < -(Q - 1) || hi[i] > 2 * Q - 1) emit_barrett(i);
+    }
+    for (int i = 0; i < N; i++) {
+        if (fm) {
+            printf("    out[%d * stride + %d] = p->coeffs[%d] = KERN(canon)(r%d);\n", fm_pos(i) / FM_LANES, fm_pos(i) % FM_LANES, i, i);
+        } else {
+            printf("    p->coeffs[%d] = KERN(canon)(r%d);\n", i, i);
+        }
+    }
+}
+
+static void emit_load(int fm) {
+    for (int i = 0; i < N; i++) {
+        if (fm) printf("    int32_t r%d = in[%d * stride + %d];\n", i, fm_pos(i) / FM_LANES, fm_pos(i) % FM_LANES);
+        else printf("    int32_t r%d = p->coeffs[%d];\n", i, i);
+        lo[i] = INT16_MIN;
+        hi[i] = INT16_MAX;
+    }
+    printf("    int32_t t;\n");
+}
+
+static void emit_ntt(int fm) {
+    if (fm) {
+        printf("// 同 ntt，輸出同時寫到頻率優先佈局 (out 指向該多項式在第 0 個 tile 的起點，stride 為相鄰 tile 的距離)\n");
+        printf("static void KERN(ntt_fm)(poly *p, int16_t *out, size_t stride) {\n");
+    } else {
+        printf("// 正向 NTT (%d 層，輸入自然順序 -> 輸出位元反轉)，輸入可為任意 int16，輸出在 [0, q)\n", layers);
+        printf("static void KERN(ntt)(poly *p) {\n");
+    }
+    emit_load(0);
+
+    int t = 32, k = 1, layer = 1;
+    for (int m = 1; m < (1 << layers); m <<= 1, t >>= 1, layer++) {
+        printf("\n    // 第 %d 層 (t = %d)，輸入 |r| <= %lld\n", layer, t, (long long)bound_all());
+        for (int i = 0; i < m; i++) {
+            int32_t zeta = center(pow_mod(ZETA, brv(k++)));
+            for (int j = i * 2 * t; j < i * 2 * t + t; j++) {
+                int64_t tl, th;
+                emit_mulred(j + t, zeta, &tl, &th);
+                if (mag(lo[j], hi[j]) + mag(tl, th) > LIMIT) emit_barrett(j);
+                printf("    r%d = r%d - t; r%d += t;\n", j + t, j, j);
+                lo[j + t] = lo[j] - th; hi[j + t] = hi[j] - tl;
+                lo[j] += tl; hi[j] += th;
+            }
+        }
+    }
+
+    printf("\n    // 輸出化約，|r| <= %lld\n", (long long)bound_all());
+    emit_store(fm);
+    printf("}\n\n");
+}
+
+static void emit_invntt(int fm) {
+    const int32_t inv_n = pow_mod(1 << layers, Q - 2); // 2^-L mod q
+
+    if (fm) {
+        printf("// 同 invntt，輸入取自頻率優先佈局 (in 指向該多項式在第 0 個 tile 的起點)\n");
+        printf("static void KERN(invntt_fm)(poly *p, const int16_t *in, size_t stride) {\n");
+    } else {
+        printf("// 反向 INTT (%d 層，輸入位元反轉 -> 輸出自然順序)，輸入可為任意 int16，輸出在 [0, q)\n", layers);
+        printf("static void KERN(invntt)(poly *p) {\n");
+    }
+    emit_load(fm);
+    printf("    int32_t u;\n");
+
+    int t = N >> layers, layer = 1;
+    for (int m = (1 << layers) / 2; m >= 1; m >>= 1, t <<= 1, layer++) {
+        printf("\n    // 第 %d 層 (t = %d)，輸入 |r| <= %lld\n", layer, t, (long long)bound_all());
+        for (int i = 0; i < m; i++) {
+            int32_t z = pow_mod(ZETA, (2 * N - brv(m + i)) % (2 * N));
+            if (m == 1) z = (int32_t)((int64_t)z * inv_n % Q);
+            z = center(z);
+
+            for (int j = i * 2 * t; j < i * 2 * t + t; j++) {
+                ensure_sum(j, j + t);
+                // r[j + t] = (u - v) * z，r[j] = u + v (最後一層乘上 2^-L)
+                printf("    u = r%d; r%d = u + r%d; r%d = u - r%d;\n", j, j, j + t, j + t, j + t);
+                int64_t sl = lo[j] + lo[j + t], sh = hi[j] + hi[j + t];
+                int64_t dl = lo[j] - hi[j + t], dh = hi[j] - lo[j + t];
+                lo[j] = sl; hi[j] = sh;
+                lo[j + t] = dl; hi[j + t] = dh;
+
+                int64_t tl, th;
+                emit_mulred(j + t, z, &tl, &th);
+                printf("    r%d = t;\n", j + t);
+                lo[j + t] = tl; hi[j + t] = th;
+
+                if (m == 1) {
+                    emit_mulred(j, center(inv_n), &tl, &th);
+                    printf("    r%d = t;\n", j);
+                    lo[j] = tl; hi[j] = th;
+                }
+            }
+        }
+    }
+
+    printf("\n    // 輸出化約，|r| <= %lld\n", (long long)bound_all());
+    emit_store(0);
+    printf("}\n\n");
+}
+
+int main(void) {
+    printf("// ==========================================================\n");
+    printf("// 完全展開的 n = %d 負循環 NTT / INTT (q = %d, zeta = %d)，依 RUDRAKSH_NTT_LAYERS 選擇層數\n", N, Q, ZETA);
+    printf("// 由 tools/gen_ntt_unrolled.c 產生，請勿手動修改 (make lgen_ntt 重新產生)\n");
+    printf("// 本檔沒有 include guard，由 rudraksh_kernels_impl.h 在各 ISA 設定下重複 include (KERN 由該檔定義)\n");
+    printf("// 每層標示的 |r| 為產生器追蹤的值域上界，只在可能超出 int32 時插入 Barrett 化約\n");
+    printf("// ==========================================================\n\n");
+
+    printf("// |a| < 2^31：a >= 0 時結果在 [0, 2q)，a < 0 時在 (-q, q)\n");
+    printf("static inline int32_t KERN(barrett)(int32_t a) {\n");
+    printf("    int32_t t = (int32_t)(((int64_t)a * %d) >> 32);\n", BARRETT_M);
+    printf("    return a - t * %d;\n", Q);
+    printf("}\n\n");
+    printf("// (-q, 2q) -> [0, q)，無分支\n");
+    printf("static inline int16_t KERN(canon)(int32_t a) {\n");
+    printf("    a += (a >> 31) & %d;\n", Q);
+    printf("    a -= %d;\n", Q);
+    printf("    a += (a >> 31) & %d;\n", Q);
+    printf("    return (int16_t)a;\n");
+    printf("}\n\n");
+
+    for (layers = LOG_N; layers >= MIN_LAYERS; layers--) {
+        printf("#%s RUDRAKSH_NTT_LAYERS == %d\n\n", layers == LOG_N ? "if" : "elif", layers);
+        emit_ntt(0);
+        emit_ntt(1);
+        emit_invntt(0);
+        emit_invntt(1);
+    }
+    printf("#endif\n");
+    return 0;
+}
@@ -1,41 +1,80 @@
 #include <stdio.h>
 #include <stdint.h>
 
-// 參數來源: rudraksh_params.h / rudraksh_ntt.h
+// 參數來源: rudraksh_params.h / rudraksh_math.h
 #define Q 7681
 #define N 64
-#define ZETA 202 // 這是您剛剛算出來的
+#define LOG_N 6
+#define ZETA 202 // 這是您剛剛算出來的 (primitive 128-th root of unity)
 
-int main() {
-    int32_t f = 1; // 使用明確的 32-bit 整數避免平台差異
+// 模冪運算: (base^exp) % Q
+static int32_t pow_mod(int32_t base, int32_t exp) {
+    int32_t res = 1;
+    base %= Q;
+    while (exp > 0) {
+        if (exp & 1) res = (res * base) % Q;
+        base = (base * base) % Q;
+        exp >>= 1;
+    }
+    return res;
+}
 
-    printf("/* \n");
-    printf(" * Twiddle Factors for Rudraksh (KEM-poly64)\n");
-    printf(" * Modulus Q = %d, Zeta = %d, Size N = %d\n", Q, ZETA, N);
-    printf(" * Order: Natural Order (powers of zeta: 0, 1, 2, ..., N-1)\n");
-    printf(" */\n\n");
-    
-    printf("#include \"rudraksh_ntt.h\"\n\n");
-    printf("const int16_t zetas[RUDRAKSH_N] = {\n");
+// 6-bit 位元反轉 (bit reversal)
+static int brv(int k) {
+    int r = 0;
+    for (int i = 0; i < LOG_N; i++) {
+        r = (r << 1) | ((k >> i) & 1);
+    }
+    return r;
+}
 
-    for(int i = 0; i < N; i++) {
+static void print_table(const char *decl, int inverse) {
+    printf("%s = {\n", decl);
+    for (int i = 0; i < N; i++) {
         // 每行印 8 個數字，保持排版整潔
         if (i % 8 == 0) printf("    ");
-        
-        printf("%5d", f);
-        
-        // 最後一個數字後不加逗號，其他都要加
-        if (i != N - 1) printf(",");
-        
-        // 換行控制
+
+        // 負循環 NTT: zetas[k] = zeta^brv(k)，反向表使用 zeta^-brv(k) = zeta^(2N - brv(k))
+        int32_t e = brv(i);
+        if (inverse) e = (2 * N - e) % (2 * N);
+        printf("%5d,", pow_mod(ZETA, e));
+
         if (i % 8 == 7) printf("\n");
-        else printf(" ");
-        
-        // 計算下一個冪次: f = (f * ZETA) % Q
-        // 注意: 這裡使用 int32_t 計算，7681 * 202 = 1,551,562，不會溢位
-        f = (f * ZETA) % Q;
     }
     printf("};\n");
-    
+}
+
+// 不完整 NTT (layers 層) 的子環常數：第 k = 2i + s 個子環為 x^d - (-1)^s * zetas[2^(layers-1) + i]
+// (第 layers 層以 zetas[2^(layers-1) + i] 把 x^2d - gamma 拆成 x^d - zeta 與 x^d + zeta)
+static void print_gamma(int layers) {
+    int blocks = 1 << layers;
+    printf("#%s RUDRAKSH_NTT_LAYERS == %d\n", layers == LOG_N ? "if" : "elif", layers);
+    printf("const int16_t ntt_gamma[RUDRAKSH_NTT_BLOCKS] = {\n");
+    for (int k = 0; k < blocks; k++) {
+        if (k % 8 == 0) printf("    ");
+        int32_t z = pow_mod(ZETA, brv((blocks >> 1) + (k >> 1)));
+        if (k & 1) z = (Q - z) % Q;
+        printf("%5d,", z);
+        if (k % 8 == 7 || k == blocks - 1) printf("\n");
+    }
+    printf("};\n");
+}
+
+int main() {
+    printf("/* * Twiddle Factors for Rudraksh (KEM-poly64)\n");
+    printf(" * Modulus Q = %d, Zeta = %d, Size N = %d\n", Q, ZETA, N);
+    printf(" * Order: Bit-reversed (zetas[k] = zeta^brv6(k), zetas_inv[k] = zeta^-brv6(k))\n");
+    printf(" * 由 tools/gen_table.c 產生\n");
+    printf(" */\n\n");
+
+    printf("#include \"rudraksh_math.h\"\n\n");
+    printf("// 這是全域常數，供 NTT 運算時查表使用\n");
+    print_table("const int16_t zetas[RUDRAKSH_N]", 0);
+    printf("// 反向 INTT 旋轉因子表 (n=64, q=7681)\n");
+    print_table("const int16_t zetas_inv[64]", 1);
+    printf("// NTT 域子環常數 (依 RUDRAKSH_NTT_LAYERS；完整 NTT 時即每個點的求值點)\n");
+    for (int layers = LOG_N; layers >= 4; layers--) print_gamma(layers);
+    printf("#endif\n");
+
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,239 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ==========================================================
+// Stack 用量報告 (配合 make stack / make lstack)
+// 用法: stack_report <file.ci> ...
+//
+// 讀取 gcc -fstack-usage -fcallgraph-info=su 產生的 .ci (VCG 格式) 呼叫圖：
+//   node: { title: "<函式>" label: "<名稱>\n<檔案:行:列>\n<N> bytes (<static|dynamic|dynamic,bounded>)" }
+//   edge: { sourcename: "<呼叫者>" targetname: "<被呼叫者>" ... }
+// static 函式的 title 帶有 "<檔案>:" 前綴，其餘函式跨檔案以名稱合併
+//
+// 1. 每個函式自身的 frame 大小
+// 2. 每個公開 API (rudraksh_*) 的呼叫樹峰值 = 自身 frame + 最深被呼叫者的峰值，並列出最深路徑
+// 沒有 stack 資訊的外部函式 (libc) 以 0 計並標記 ext；函式指標呼叫標記 indirect；遞迴標記 recursive
+// ==========================================================
+
+#define MAX_TITLE 256
+#define MAX_LINE 1024
+
+typedef struct {
+    char title[MAX_TITLE];
+    char name[MAX_TITLE];
+    char where[MAX_TITLE];
+    long self;              // -1 代表沒有 stack 資訊 (外部函式)
+    char qual[24];
+    int *callees;
+    int n_callees, cap_callees;
+
+    // 呼叫樹峰值 (memoized)
+    int state;              // 0 = 未計算, 1 = 計算中, 2 = 完成
+    long peak;
+    int next;               // 最深路徑上的下一個函式，-1 代表葉節點
+    int flags;
+} fn_node;
+
+#define FLAG_EXT       1
+#define FLAG_INDIRECT  2
+#define FLAG_RECURSIVE 4
+#define FLAG_DYNAMIC   8
+
+static fn_node *nodes = NULL;
+static int n_nodes = 0, cap_nodes = 0;
+
+static int find_or_add(const char *title) {
+    for (int i = 0; i < n_nodes; i++) {
+        if (strcmp(nodes[i].title, title) == 0) return i;
+    }
+    if (n_nodes == cap_nodes) {
+        cap_nodes = cap_nodes ? 2 * cap_nodes : 256;
+        nodes = realloc(nodes, (size_t)cap_nodes * sizeof(fn_node));
+        if (nodes == NULL) exit(1);
+    }
+    fn_node *n = &nodes[n_nodes];
+    memset(n, 0, sizeof(*n));
+    snprintf(n->title, sizeof(n->title), "%s", title);
+    snprintf(n->name, sizeof(n->name), "%s", title);
+    n->self = -1;
+    n->next = -1;
+    return n_nodes++;
+}
+
+static void add_edge(int from, int to) {
+    fn_node *n = &nodes[from];
+    for (int i = 0; i < n->n_callees; i++) {
+        if (n->callees[i] == to) return;
+    }
+    if (n->n_callees == n->cap_callees) {
+        n->cap_callees = n->cap_callees ? 2 * n->cap_callees : 8;
+        n->callees = realloc(n->callees, (size_t)n->cap_callees * sizeof(int));
+        if (n->callees == NULL) exit(1);
+    }
+    n->callees[n->n_callees++] = to;
+}
+
+// 取出 key: "..." 的字串值
+static int get_field(const char *line, const char *key, char *out, size_t outlen) {
+    const char *p = strstr(line, key);
+    if (p == NULL) return -1;
+    p += strlen(key);
+
+    size_t i = 0;
+    while (*p != '\0' && *p != '"' && i + 1 < outlen) {
+        if (p[0] == '\\' && p[1] == 'n') { out[i++] = '\n'; p += 2; continue; }
+        out[i++] = *p++;
+    }
+    out[i] = '\0';
+    return 0;
+}
+
+static int load_ci(const char *path) {
+    FILE *f = fopen(path, "r");
+    char line[MAX_LINE], title[MAX_TITLE], label[MAX_TITLE * 2], src[MAX_TITLE], dst[MAX_TITLE];
+
+    if (f == NULL) return -1;
+
+    while (fgets(line, sizeof(line), f) != NULL) {
+        if (strncmp(line, "node:", 5) == 0) {
+            if (get_field(line, "title: \"", title, sizeof(title)) != 0) continue;
+            int idx = find_or_add(title); // find_or_add 可能 realloc，先取索引
+            fn_node *n = &nodes[idx];
+
+            if (get_field(line, "label: \"", label, sizeof(label)) != 0) continue;
+            // label = 名稱 \n 位置 [\n N bytes (qual)]
+            char *l1 = strchr(label, '\n');
+            char *l2 = l1 ? strchr(l1 + 1, '\n') : NULL;
+            if (l1 != NULL) *l1 = '\0';
+            if (l2 != NULL) *l2 = '\0';
+            snprintf(n->name, sizeof(n->name), "%.255s", label);
+
+            long bytes;
+            char qual[24];
+            if (l2 != NULL && sscanf(l2 + 1, "%ld bytes (%23[^)])", &bytes, qual) == 2) {
+                n->self = bytes;
+                snprintf(n->qual, sizeof(n->qual), "%s", qual);
+                snprintf(n->where, sizeof(n->where), "%.255s", l1 + 1);
+            }
+        } else if (strncmp(line, "edge:", 5) == 0) {
+            if (get_field(line, "sourcename: \"", src, sizeof(src)) != 0 ||
+                get_field(line, "targetname: \"", dst, sizeof(dst)) != 0) continue;
+            int a = find_or_add(src);
+            int b = find_or_add(dst);
+            add_edge(a, b);
+        }
+    }
+    fclose(f);
+    return 0;
+}
+
+// ==========================================================
+// 呼叫樹峰值
+// ==========================================================
+
+static void compute_peak(int i) {
+    fn_node *n = &nodes[i];
+
+    if (n->state == 2) return;
+    if (n->state == 1) { n->flags |= FLAG_RECURSIVE; return; }
+    n->state = 1;
+
+    if (strcmp(n->title, "__indirect_call") == 0) n->flags |= FLAG_INDIRECT;
+    else if (n->self < 0) n->flags |= FLAG_EXT;
+    if (strncmp(n->qual, "dynamic", 7) == 0 && strcmp(n->qual, "dynamic,bounded") != 0) n->flags |= FLAG_DYNAMIC;
+
+    long best = 0;
+    for (int k = 0; k < n->n_callees; k++) {
+        int c = n->callees[k];
+        compute_peak(c);
+        if (nodes[c].state == 1) { n->flags |= FLAG_RECURSIVE; continue; }
+
+        n->flags |= nodes[c].flags;
+        if (nodes[c].peak > best) {
+            best = nodes[c].peak;
+            n->next = c;
+        }
+    }
+    n->peak = (n->self > 0 ? n->self : 0) + best;
+    n->state = 2;
+}
+
+static void print_flags(int flags) {
+    if (flags & FLAG_RECURSIVE) printf(" recursive");
+    if (flags & FLAG_DYNAMIC) printf(" dynamic");
+    if (flags & FLAG_INDIRECT) printf(" indirect");
+    if (flags & FLAG_EXT) printf(" ext");
+}
+
+static int cmp_self_desc(const void *a, const void *b) {
+    long x = nodes[*(const int *)a].self, y = nodes[*(const int *)b].self;
+    return (y > x) - (y < x);
+}
+
+static int cmp_name(const void *a, const void *b) {
+    return strcmp(nodes[*(const int *)a].name, nodes[*(const int *)b].name);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <file.ci> ...\n", argv[0]);
+        return 1;
+    }
+    for (int i = 1; i < argc; i++) {
+        if (load_ci(argv[i]) != 0) {
+            fprintf(stderr, "cannot read %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    int *order = malloc((size_t)n_nodes * sizeof(int));
+    int n_defined = 0;
+    if (order == NULL) return 1;
+
+    // 1. 每個函式自身的 frame
+    for (int i = 0; i < n_nodes; i++) {
+        if (nodes[i].self >= 0) order[n_defined++] = i;
+    }
+    qsort(order, (size_t)n_defined, sizeof(int), cmp_self_desc);
+
+    printf("=============================================\n");
+    printf("   Rudraksh Stack Usage Report\n");
+    printf("=============================================\n");
+    printf("\n[1] Per-function frame size (bytes)\n\n");
+    printf("%-36s %8s  %-16s %s\n", "function", "self", "qualifier", "location");
+    for (int k = 0; k < n_defined; k++) {
+        const fn_node *n = &nodes[order[k]];
+        const char *where = strrchr(n->where, '/');
+        printf("%-36s %8ld  %-16s %s\n", n->name, n->self, n->qual, where ? where + 1 : n->where);
+    }
+
+    // 2. 公開 API 的呼叫樹峰值 (static 函式的 title 含 ':'，不列入)
+    int n_api = 0;
+    for (int i = 0; i < n_nodes; i++) {
+        if (nodes[i].self >= 0 && strncmp(nodes[i].title, "rudraksh_", 9) == 0) order[n_api++] = i;
+    }
+    qsort(order, (size_t)n_api, sizeof(int), cmp_name);
+
+    printf("\n[2] Public API call-tree peak (bytes)\n");
+    printf("    ext = 含外部函式 (以 0 計)，indirect = 含函式指標呼叫 (未計入)\n\n");
+    printf("%-36s %8s  %s\n", "api", "peak", "deepest path");
+    for (int k = 0; k < n_api; k++) {
+        int i = order[k];
+        compute_peak(i);
+
+        printf("%-36s %8ld  ", nodes[i].name, nodes[i].peak);
+        int depth = 0;
+        for (int c = nodes[i].next; c >= 0 && depth < 16; c = nodes[c].next, depth++) {
+            if (nodes[c].self <= 0) break;
+            printf("%s%s(%ld)", depth ? " > " : "", nodes[c].name, nodes[c].self);
+        }
+        if (nodes[i].flags) { printf("  ["); print_flags(nodes[i].flags); printf(" ]"); }
+        printf("\n");
+    }
+
+    for (int i = 0; i < n_nodes; i++) free(nodes[i].callees);
+    free(nodes);
+    free(order);
+    return 0;
+}